@@ -9,9 +9,12 @@
 #include <Coco/Windowing/WindowService.h>
 
 #include "Coco/Core/Math/Matrix4x4.h"
+#include "Coco/Core/Math/Random.h"
 #include "Coco/Core/Types/Sorting/QSorter.h"
+#include "Coco/Rendering/MeshOptimizer.h"
 #include "Coco/Rendering/MeshUtils.h"
 #include "Coco/Rendering/RenderService.h"
+#include "Coco/Rendering/Graphics/GraphicsResourceCache.h"
 #include "Coco/Rendering/RenderGraph/RenderGraph.h"
 #include "Coco/Rendering/RHI/Vulkan/VulkanGraphicsPlatform.h"
 
@@ -21,6 +24,7 @@
 #include "Coco/ECS/Components/Transform3DComponent.h"
 #include "Coco/ECS/Components/Transform2DComponent.h"
 #include "Coco/ECS/Rendering/Components/CameraComponent.h"
+#include "Coco/ECS/Rendering/Components/MeshRendererComponent.h"
 #include "Coco/ECS/Rendering/Components/SpriteRendererComponent.h"
 #include "Coco/ECS/Rendering/Components/SpritesheetAnimationComponent.h"
 #include "Coco/ImGui/ImGuiService.h"
@@ -28,15 +32,19 @@
 #include <imgui.h>
 
 #include "Coco/ECS/Rendering/Components/TileMapRendererComponent.h"
+#include "Coco/ECS/Rendering/Renderers/MeshComponentRenderer.h"
 #include "Coco/ECS/Rendering/Renderers/SpriteComponentRenderer.h"
 #include "Coco/ECS/Rendering/Renderers/TileMapComponentRenderer.h"
 #include "Coco/Rendering/RenderPasses/ClearRenderPass.h"
+#include "Coco/Rendering/RenderPasses/IndirectRenderPass.h"
 #include "Coco/Rendering/RenderPasses/SimpleRenderPass.h"
 
 
-SandboxApplication::SandboxApplication(Engine* engine) :
+SandboxApplication::SandboxApplication(Engine* engine, bool runMeshOptimizerBenchmark) :
     Application(engine, "Sandbox"),
-    _renderListener(this, &SandboxApplication::RenderSceneCallback, 0)
+    _renderListener(this, &SandboxApplication::RenderSceneCallback, 0),
+    _recordInParallel(false),
+    _useGPUCulling(false)
 {
     //engine->GetMainLoop()->SetTargetTickRate(60);
 
@@ -44,6 +52,9 @@ SandboxApplication::SandboxApplication(Engine* engine) :
     CreateResources();
     CreateScene();
 
+    if (runMeshOptimizerBenchmark)
+        RunMeshOptimizerBenchmark();
+
     COCO_ENGINE_LOG_INFO("Total memory usage: %u bytes", engine->GetPlatform()->GetMemoryManager()->GetTotalUsage());
     COCO_ENGINE_LOG_INFO("SandboxApplication created");
 }
@@ -56,6 +67,7 @@ SandboxApplication::~SandboxApplication()
 void SandboxApplication::Start()
 {
     _window->Show();
+    _renderListener.SetExtractCallbackFunction(this, &SandboxApplication::ExtractSceneCallback);
     _renderListener.Listen();
 
     COCO_ENGINE_LOG_INFO("SandboxApplication started");
@@ -67,6 +79,8 @@ void SandboxApplication::CreateServices()
 
     RenderService* rendering = _engine->CreateService<RenderService>();
     GraphicsDeviceCreateParams deviceCreateParams;
+    deviceCreateParams.EnablePipelinePrewarming = true;
+    deviceCreateParams.EnableBindlessTextures = true;
     VulkanGraphicsPlatformCreateParams rendererCreateParams(*this, deviceCreateParams);
     #ifndef NDEBUG
     rendererCreateParams.EnableDebugging = true;
@@ -102,6 +116,71 @@ void SandboxApplication::CreateResources()
             _tileMap->SetCell(Vector2i(x, y), atlas->GetCellID(x, y));
         }
     }
+
+    _meshShader = _engine->GetResourceManager()->CreateResource<Shader>("MeshShader", "Shaders/Testing/PushConstantMVP.slang");
+    _indirectMeshShader = _engine->GetResourceManager()->CreateResource<Shader>("IndirectMeshShader", "Shaders/Testing/IndirectMVP.slang");
+
+    // A dense grid simplifies well, so its LODs are easy to see in wireframe
+    _lodMesh = _engine->GetResourceManager()->CreateResource<Mesh>("LODGrid", false);
+    MeshUtils::CreateXYGrid(Vector2::One, Vector3::Zero, *_lodMesh, VertexChannelFlags::Position, 63);
+    _lodMesh->EnableLODGeneration();
+
+    _cubeMesh = _engine->GetResourceManager()->CreateResource<Mesh>("Cube", false);
+    MeshUtils::CreateCube(Vector3::One * 0.3f, Vector3::Zero, *_cubeMesh, VertexChannelFlags::Position);
+
+    // The quad's material references its texture by bindless table index, so its uniform block persists across frames
+    if (_engine->GetService<RenderService>()->GetGraphicsPlatform()->GetDeviceDescription().SupportsBindlessTextures)
+    {
+        _unlitShader = _engine->GetResourceManager()->CreateResource<Shader>("UnlitBindlessShader", "Shaders/BuiltIn/UnlitBindless.slang");
+
+        _quadMaterial = _engine->GetResourceManager()->CreateResource<Material>("QuadMaterial", _unlitShader);
+        _quadMaterial->SetValue("TintColor", Color::White);
+        _quadMaterial->SetValue("ColorTexture", _spriteTexture);
+
+        _quadMesh = _engine->GetResourceManager()->CreateResource<Mesh>("TexturedQuad", false);
+        MeshUtils::CreateXYGrid(Vector2::One, Vector3::Zero, *_quadMesh, VertexChannelFlags::Position | VertexChannelFlags::UV0);
+    }
+}
+
+void SandboxApplication::RunMeshOptimizerBenchmark()
+{
+    Array<Vector3> positions;
+    Array<Vector3> normals;
+    Array<Vector2> uvs;
+    Array<uint32> indices;
+    MeshUtils::CreateXYGrid(Vector2::One, Vector3::Zero, positions, indices, &normals, &uvs, 127);
+
+    // Shuffle the triangles so the mesh resembles one with no locality, like a poorly exported asset
+    const uint64 triangleCount = indices.GetCount() / 3;
+
+    for (uint64 t = triangleCount - 1; t > 0; t--)
+    {
+        const uint64 other = Random::RandomUInt64(0, t);
+
+        for (uint64 c = 0; c < 3; c++)
+            std::swap(indices[t * 3 + c], indices[other * 3 + c]);
+    }
+
+    SharedPtr<Mesh> mesh = _engine->GetResourceManager()->CreateResource<Mesh>("OptimizerBenchmark", false);
+    mesh->SetPositions(positions);
+    mesh->SetNormals(normals);
+    mesh->SetUVs(uvs);
+    mesh->SetIndices(indices);
+
+    MeshOptimizationSettings settings;
+    settings.OptimizeOverdraw = true;
+
+    const TimeSpan startTime = _engine->GetPlatform()->GetRunningTime();
+    const MeshOptimizationStats stats = MeshOptimizer::Optimize(*mesh, settings);
+    const TimeSpan elapsed = _engine->GetPlatform()->GetRunningTime() - startTime;
+
+    COCO_ENGINE_LOG_INFO("Optimized %u triangles in %.3fms: ACMR %.3f -> %.3f, %u -> %u vertices",
+        triangleCount,
+        elapsed.GetMilliseconds(),
+        stats.ACMRBefore, stats.ACMRAfter,
+        stats.VertexCountBefore, stats.VertexCountAfter);
+
+    _engine->GetResourceManager()->RemoveResource(mesh->GetID());
 }
 
 void SandboxApplication::CreateScene()
@@ -136,6 +215,28 @@ void SandboxApplication::CreateScene()
     spriteAnimComponent->AddAnimation("idle", 0, 11, 6.0);
     spriteAnimComponent->AddAnimation("run", 12, 16, 6.0);
     spriteAnimComponent->SetCurrentAnimation("run");
+
+    _meshEntity = _scene->CreateEntity("LODMesh");
+    _meshEntity.CreateComponent<Transform3DComponent>(Vector3(2.5f, 1.5f, 0.0f), Quaternion::Identity, Vector3::One * 1.5f);
+    _meshEntity.CreateComponent<MeshRendererComponent>(_lodMesh);
+
+    if (_quadMaterial)
+    {
+        Entity quadEntity = _scene->CreateEntity("TexturedQuad");
+        quadEntity.CreateComponent<Transform3DComponent>(Vector3(-4.0f, 1.5f, 0.0f), Quaternion::Identity, Vector3::One * 1.5f);
+        quadEntity.CreateComponent<MeshRendererComponent>(_quadMesh, _quadMaterial);
+    }
+
+    // A field of cubes that extends past the view, so moving the camera shows objects being culled
+    for (int x = 0; x < 16; x++)
+    {
+        for (int y = 0; y < 4; y++)
+        {
+            Entity cubeEntity = _scene->CreateEntity("Cube");
+            cubeEntity.CreateComponent<Transform3DComponent>(Vector3(static_cast<float>(x) - 7.5f, -2.0f - static_cast<float>(y) * 0.5f, 0.0f));
+            cubeEntity.CreateComponent<MeshRendererComponent>(_cubeMesh);
+        }
+    }
 }
 
 void SandboxApplication::Tick(const TickInfo& tickInfo)
@@ -155,7 +256,37 @@ void SandboxApplication::Tick(const TickInfo& tickInfo)
         ImGui::Text("Draw Calls: %u", static_cast<unsigned int>(stats.DrawCalls));
         ImGui::Text("Triangles Drawn: %u", static_cast<unsigned int>(stats.TrianglesDrawn));
         ImGui::Text("Vertices Drawn: %u", static_cast<unsigned int>(stats.VerticesDrawn));
+        ImGui::Text("Objects Culled: %u", static_cast<unsigned int>(stats.ObjectsCulled));
         ImGui::Text("Memory Usage: %u bytes", static_cast<unsigned int>(stats.MemoryUsage));
+        ImGui::Text(
+            "Transient Memory: %.2f MB (%.2f MB unaliased)",
+            static_cast<double>(stats.PeakTransientMemory) / (1024.0 * 1024.0),
+            static_cast<double>(stats.UnaliasedTransientMemory) / (1024.0 * 1024.0)
+        );
+
+        const GraphicsResourceCacheStats& cacheStats = rendering->GetGraphicsPlatform()->GetResourceCache()->GetStats();
+        ImGui::Text(
+            "Resource Cache: %u resources, %.2f MB (%u hits, %u misses, %u evictions)",
+            static_cast<unsigned int>(cacheStats.ResourceCount),
+            static_cast<double>(cacheStats.CachedBytes) / (1024.0 * 1024.0),
+            static_cast<unsigned int>(cacheStats.Hits),
+            static_cast<unsigned int>(cacheStats.Misses),
+            static_cast<unsigned int>(cacheStats.Evictions)
+        );
+        ImGui::Checkbox("Parallel Recording", &_recordInParallel);
+
+        if (ImGui::Checkbox("GPU Culling", &_useGPUCulling))
+            rendering->SetGPUCullingEnabled(_useGPUCulling);
+
+        MeshRendererComponent* meshComponent = _meshEntity.GetComponent<MeshRendererComponent>();
+        const Optional<uint32> meshLOD = rendering->GetObjectLOD(_window->GetID(), MeshComponentRenderer::GetLODObjectID(*meshComponent));
+
+        if (meshLOD.has_value())
+            ImGui::Text("Mesh LOD: %u of %u", meshLOD.value(), _lodMesh->GetLODCount());
+        else
+            ImGui::Text("Mesh LOD: not drawn");
+
+        ImGui::SliderFloat("Mesh LOD Bias", &meshComponent->LODBias, 0.05f, 2.0f);
     }
 
     ImGui::End();
@@ -205,6 +336,22 @@ struct GlobalSceneData
     }
 };
 
+void SandboxApplication::ExtractSceneCallback(RenderScene& sharedScene)
+{
+    // None of these depend on the camera, so they're extracted once and each view only culls them
+    TileMapComponentRenderer::Extract(_tilemapEntity, sharedScene);
+
+    for (auto& entity : _scene->CreateComponentView<SpriteRendererComponent, Transform2DComponent>(true))
+    {
+        SpriteComponentRenderer::Render2D(entity, sharedScene);
+    }
+
+    for (auto& entity : _scene->CreateComponentView<MeshRendererComponent, Transform3DComponent>(true))
+    {
+        MeshComponentRenderer::Render(entity, sharedScene);
+    }
+}
+
 void SandboxApplication::RenderSceneCallback(uint64 targetID, RenderGraph& graph, RenderScene& scene)
 {
     Transform2DComponent* camTransform = _cameraEntity.GetComponent<Transform2DComponent>();
@@ -218,35 +365,51 @@ void SandboxApplication::RenderSceneCallback(uint64 targetID, RenderGraph& graph
 
     auto clearPass = graph.CreateRenderPassObject<ClearRenderPass>("Clear", 0, cam->ClearColor);
 
-    DrawTilemap(clearPass.GetOutputResource(), graph, scene);
-    DrawSprites(clearPass.GetOutputResource(), graph, scene);
+    DrawTilemap(clearPass.GetOutputResource(), graph);
+    DrawSprites(clearPass.GetOutputResource(), graph);
+    DrawMeshes(clearPass.GetOutputResource(), graph);
 
     _engine->GetService<RenderService>()->GetGizmos()->Render(graph, scene);
 }
 
-void SandboxApplication::DrawTilemap(RenderGraphResourceRef colorRef, RenderGraph& graph, RenderScene& scene)
+void SandboxApplication::DrawTilemap(RenderGraphResourceRef colorRef, RenderGraph& graph)
 {
-    TileMapComponentRenderer::Render(_tilemapEntity, _cameraEntity, scene);
-
     GraphicsPipelineState pipelineState;
     pipelineState.CullingMode = CullMode::None;
     pipelineState.BlendState = AttachmentBlendState::AlphaBlending;
     pipelineState.EnableDepthWrite = false;
 
-    graph.CreateRenderPassObject<SimpleRenderPass<GlobalSceneData, TileMapComponentRenderer::TilemapObjectData>>("Tilemap", colorRef, _shader, pipelineState);
+    graph.CreateRenderPassObject<SimpleRenderPass<GlobalSceneData, TileMapComponentRenderer::TilemapObjectData>>("Tilemap", colorRef, _shader, pipelineState, "cameraData", _recordInParallel);
 }
 
-void SandboxApplication::DrawSprites(RenderGraphResourceRef colorRef, RenderGraph& graph, RenderScene& scene)
+void SandboxApplication::DrawSprites(RenderGraphResourceRef colorRef, RenderGraph& graph)
 {
-    for (auto& entity : _scene->CreateComponentView<SpriteRendererComponent, Transform2DComponent>(true))
-    {
-        SpriteComponentRenderer::Render2D(entity, scene);
-    }
-
     GraphicsPipelineState pipelineState;
     pipelineState.CullingMode = CullMode::None;
     pipelineState.BlendState = AttachmentBlendState::AlphaBlending;
     pipelineState.EnableDepthWrite = false;
 
-    graph.CreateRenderPassObject<SimpleRenderPass<GlobalSceneData, SpriteComponentRenderer::SpriteObjectData>>("Sprites", colorRef, _shader, pipelineState);
+    graph.CreateRenderPassObject<SimpleRenderPass<GlobalSceneData, SpriteComponentRenderer::SpriteObjectData>>("Sprites", colorRef, _shader, pipelineState, "cameraData", _recordInParallel);
 }
+
+void SandboxApplication::DrawMeshes(RenderGraphResourceRef colorRef, RenderGraph& graph)
+{
+    GraphicsPipelineState pipelineState;
+    pipelineState.CullingMode = CullMode::None;
+    pipelineState.FillMode = PolygonFillMode::Line;
+
+    // Meshes that can't be drawn indirectly fall back to the regular mesh shader
+    if (_engine->GetService<RenderService>()->IsGPUCullingEnabled())
+        graph.CreateRenderPassObject<IndirectRenderPass<GlobalSceneData, MeshComponentRenderer::MeshObjectData>>("Meshes", colorRef, _indirectMeshShader, _meshShader, pipelineState);
+    else
+        graph.CreateRenderPassObject<SimpleRenderPass<GlobalSceneData, MeshComponentRenderer::MeshObjectData>>("Meshes", colorRef, _meshShader, pipelineState, "cameraData", _recordInParallel);
+
+    // Meshes with materials bind them through their persistent uniform blocks
+    if (_unlitShader)
+    {
+        GraphicsPipelineState materialPipelineState;
+        materialPipelineState.CullingMode = CullMode::None;
+
+        graph.CreateRenderPassObject<SimpleRenderPass<GlobalSceneData, MeshComponentRenderer::MaterialMeshObjectData>>("MaterialMeshes", colorRef, _unlitShader, materialPipelineState, "cameraData", _recordInParallel);
+    }
+}
\ No newline at end of file
@@ -30,7 +30,7 @@ class SandboxApplication :
     public Application
 {
 public:
-    SandboxApplication(Engine* engine);
+    SandboxApplication(Engine* engine, bool runMeshOptimizerBenchmark);
     ~SandboxApplication();
 
     void Start() override;
@@ -43,22 +43,35 @@ private:
     RenderListener _renderListener;
     Ref<Window> _window;
     SharedPtr<Shader> _shader;
+    SharedPtr<Shader> _meshShader;
+    SharedPtr<Shader> _indirectMeshShader;
+    SharedPtr<Shader> _unlitShader;
     SharedPtr<Texture> _spriteTexture;
     SharedPtr<Texture> _texture2;
     SharedPtr<Scene> _scene;
     SharedPtr<TileMap> _tileMap;
+    SharedPtr<Mesh> _lodMesh;
+    SharedPtr<Mesh> _cubeMesh;
+    SharedPtr<Mesh> _quadMesh;
+    SharedPtr<Material> _quadMaterial;
     Entity _cameraEntity;
     Entity _tilemapEntity;
     Entity _spriteEntity;
     Entity _spriteEntity2;
+    Entity _meshEntity;
+    bool _recordInParallel;
+    bool _useGPUCulling;
 
 private:
     void CreateServices();
     void CreateResources();
+    void RunMeshOptimizerBenchmark();
     void CreateScene();
+    void ExtractSceneCallback(RenderScene& sharedScene);
     void RenderSceneCallback(uint64 targetID, RenderGraph& graph, RenderScene& scene);
-    void DrawTilemap(RenderGraphResourceRef colorRef, RenderGraph& graph, RenderScene& scene);
-    void DrawSprites(RenderGraphResourceRef colorRef, RenderGraph& graph, RenderScene& scene);
+    void DrawTilemap(RenderGraphResourceRef colorRef, RenderGraph& graph);
+    void DrawSprites(RenderGraphResourceRef colorRef, RenderGraph& graph);
+    void DrawMeshes(RenderGraphResourceRef colorRef, RenderGraph& graph);
 };
 
 
@@ -2,17 +2,27 @@
 // Created by cullen on 2/24/26.
 //
 
+#include <cstring>
+
 #include <Coco/Core/Engine.h>
 #include <Coco/Platforms/Linux/LinuxEnginePlatform.h>
 #include "SandboxApplication.h"
 
 using namespace Coco;
 
-int main()
+int main(int argc, char** argv)
 {
+    bool runMeshOptimizerBenchmark = false;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--mesh-optimizer-benchmark") == 0)
+            runMeshOptimizerBenchmark = true;
+    }
+
     LinuxEnginePlatform platform;
     auto* engine = platform.CreateEngine();
-    engine->CreateApplication<SandboxApplication>();
+    engine->CreateApplication<SandboxApplication>(runMeshOptimizerBenchmark);
 
     int result = engine->Run();
 
@@ -0,0 +1,83 @@
+//
+// Created by cullen on 10/18/26.
+//
+
+#include "BinaryData.h"
+
+namespace Coco
+{
+    BinaryReader::BinaryReader(Span<const uint8> data) :
+        _data(data),
+        _position(0),
+        _failed(false)
+    {}
+
+    String BinaryReader::ReadString()
+    {
+        const uint32 length = Read<uint32>();
+
+        if (_failed || length > GetRemaining())
+        {
+            _failed = true;
+            return String();
+        }
+
+        String str(std::string_view(reinterpret_cast<const char*>(_data.data() + _position), length));
+        _position += length;
+        return str;
+    }
+
+    void BinaryReader::ReadBytes(ArrayContainer<uint8>& outData)
+    {
+        const uint64 size = Read<uint64>();
+
+        if (_failed || size > GetRemaining())
+        {
+            _failed = true;
+            return;
+        }
+
+        const uint64 offset = outData.GetCount();
+        outData.Resize(offset + size);
+        ReadBytes(outData.Data() + offset, size);
+    }
+
+    void BinaryReader::ReadBytes(void* outData, uint64 size)
+    {
+        if (_failed || size > GetRemaining())
+        {
+            _failed = true;
+            return;
+        }
+
+        memcpy(outData, _data.data() + _position, size);
+        _position += size;
+    }
+
+    BinaryWriter::BinaryWriter(Allocator* allocator) :
+        _data(allocator)
+    {}
+
+    void BinaryWriter::WriteString(const String& str)
+    {
+        const uint32 length = static_cast<uint32>(str.GetLength());
+        Write(length);
+        WriteBytes(str.CStr(), length);
+    }
+
+    void BinaryWriter::WriteBytes(Span<const uint8> data)
+    {
+        Write(static_cast<uint64>(data.size()));
+        WriteBytes(data.data(), data.size());
+    }
+
+    void BinaryWriter::WriteBytes(const void* data, uint64 size)
+    {
+        if (size == 0)
+            return;
+
+        const uint64 offset = _data.GetCount();
+        _data.Resize(offset + size);
+        memcpy(_data.Data() + offset, data, size);
+    }
+} // Coco
\ No newline at end of file
@@ -0,0 +1,94 @@
+//
+// Created by cullen on 10/18/26.
+//
+
+#ifndef COCOENGINE_BINARYDATA_H
+#define COCOENGINE_BINARYDATA_H
+#include "Coco/Core/Types/CoreTypes.h"
+#include "Coco/Core/Types/Array.h"
+#include "Coco/Core/Types/Span.h"
+#include "Coco/Core/Types/String.h"
+
+#include <cstring>
+
+namespace Coco
+{
+    /// @brief Sequentially reads trivially-copyable values from a block of bytes.
+    /// Reading past the end of the data marks the reader as failed instead of throwing
+    class BinaryReader
+    {
+    public:
+        BinaryReader(Span<const uint8> data);
+
+        /// @brief Determines if a read went past the end of the data
+        /// @return True if a read failed
+        bool HasFailed() const { return _failed; }
+
+        /// @brief Gets the number of bytes that have not been read yet
+        /// @return The number of remaining bytes
+        uint64 GetRemaining() const { return _data.size() - _position; }
+
+        /// @brief Reads a value
+        /// @tparam ValueType The type of value
+        /// @return The value, or a default-constructed value if the read failed
+        template<typename ValueType>
+        ValueType Read()
+        {
+            ValueType value{};
+            ReadBytes(&value, sizeof(ValueType));
+            return value;
+        }
+
+        /// @brief Reads a String that was written with BinaryWriter::WriteString()
+        /// @return The String
+        String ReadString();
+
+        /// @brief Reads a length-prefixed block of bytes that was written with BinaryWriter::WriteBytes()
+        /// @param outData The container to append the bytes to
+        void ReadBytes(ArrayContainer<uint8>& outData);
+
+    private:
+        Span<const uint8> _data;
+        uint64 _position;
+        bool _failed;
+
+    private:
+        void ReadBytes(void* outData, uint64 size);
+    };
+
+    /// @brief Appends trivially-copyable values to a block of bytes
+    class BinaryWriter
+    {
+    public:
+        BinaryWriter(Allocator* allocator = nullptr);
+
+        /// @brief Gets the written data
+        /// @return The data
+        Span<const uint8> GetData() const { return _data; }
+
+        /// @brief Writes a value
+        /// @tparam ValueType The type of value
+        /// @param value The value
+        template<typename ValueType>
+        void Write(const ValueType& value)
+        {
+            WriteBytes(&value, sizeof(ValueType));
+        }
+
+        /// @brief Writes a length-prefixed String
+        /// @param str The String
+        void WriteString(const String& str);
+
+        /// @brief Writes a length-prefixed block of bytes
+        /// @param data The bytes
+        void WriteBytes(Span<const uint8> data);
+
+    private:
+        Array<uint8> _data;
+
+    private:
+        void WriteBytes(const void* data, uint64 size);
+    };
+} // Coco
+
+#endif //COCOENGINE_BINARYDATA_H
\ No newline at end of file
@@ -0,0 +1,113 @@
+//
+// Created by cullen on 10/18/26.
+//
+
+#ifndef COCOENGINE_BOUNDINGBOX_H
+#define COCOENGINE_BOUNDINGBOX_H
+#include <limits>
+
+#include "Matrix4x4.h"
+#include "Vector3.h"
+
+#include "Coco/Core/Types/Span.h"
+
+namespace Coco
+{
+    /// @brief Base class for an axis-aligned bounding box
+    /// @tparam ValueType The value type
+    template<typename ValueType>
+    struct BaseBoundingBox
+    {
+        /// @brief The corner of this box with the smallest value along each axis
+        BaseVector3<ValueType> Minimum;
+
+        /// @brief The corner of this box with the largest value along each axis
+        BaseVector3<ValueType> Maximum;
+
+        BaseBoundingBox() :
+            Minimum(),
+            Maximum()
+        {}
+
+        BaseBoundingBox(const BaseVector3<ValueType>& minimum, const BaseVector3<ValueType>& maximum) :
+            Minimum(minimum),
+            Maximum(maximum)
+        {}
+
+        /// @brief Creates the smallest box that contains all the given points
+        /// @param points The points
+        /// @return The bounding box, or an empty box at the origin if no points were given
+        static BaseBoundingBox FromPoints(Span<const BaseVector3<ValueType>> points)
+        {
+            if (points.empty())
+                return BaseBoundingBox();
+
+            BaseBoundingBox box(points[0], points[0]);
+
+            for (const auto& p : points)
+                box.Expand(p);
+
+            return box;
+        }
+
+        /// @brief Creates a box that spans all of space. Objects with infinite bounds are never culled
+        /// @return The infinite box
+        static BaseBoundingBox CreateInfinite()
+        {
+            constexpr ValueType max = std::numeric_limits<ValueType>::max();
+            return BaseBoundingBox(BaseVector3<ValueType>(-max, -max, -max), BaseVector3<ValueType>(max, max, max));
+        }
+
+        /// @brief Grows this box to include the given point
+        /// @param point The point
+        void Expand(const BaseVector3<ValueType>& point)
+        {
+            Minimum = BaseVector3<ValueType>(Math::Min(Minimum.X(), point.X()), Math::Min(Minimum.Y(), point.Y()), Math::Min(Minimum.Z(), point.Z()));
+            Maximum = BaseVector3<ValueType>(Math::Max(Maximum.X(), point.X()), Math::Max(Maximum.Y(), point.Y()), Math::Max(Maximum.Z(), point.Z()));
+        }
+
+        /// @brief Gets the center of this box
+        /// @return The center point
+        BaseVector3<ValueType> GetCenter() const { return (Minimum + Maximum) * static_cast<ValueType>(0.5); }
+
+        /// @brief Gets the half-size of this box along each axis
+        /// @return The extents
+        BaseVector3<ValueType> GetExtents() const { return (Maximum - Minimum) * static_cast<ValueType>(0.5); }
+
+        /// @brief Determines if this box spans all of space
+        /// @return True if this box is infinite
+        bool IsInfinite() const { return Maximum.X() == std::numeric_limits<ValueType>::max(); }
+
+        /// @brief Transforms this box and returns the axis-aligned box that encloses the result
+        /// @param transform The transform matrix
+        /// @return The transformed bounding box
+        BaseBoundingBox Transformed(const BaseMatrix4x4<ValueType>& transform) const
+        {
+            if (IsInfinite())
+                return *this;
+
+            // https://github.com/erich666/GraphicsGems/blob/master/gems/TransBox.c
+            const BaseVector3<ValueType> center = GetCenter();
+            const BaseVector3<ValueType> extents = GetExtents();
+
+            BaseVector3<ValueType> newCenter = transform.GetTranslation();
+            BaseVector3<ValueType> newExtents;
+
+            for (uint8 r = 0; r < 3; r++)
+            {
+                for (uint8 c = 0; c < 3; c++)
+                {
+                    newCenter.Raw[r] += transform.Values[r][c] * center.Raw[c];
+                    newExtents.Raw[r] += Math::Abs(transform.Values[r][c]) * extents.Raw[c];
+                }
+            }
+
+            return BaseBoundingBox(newCenter - newExtents, newCenter + newExtents);
+        }
+    };
+
+    /// @brief An axis-aligned bounding box backed by floats
+    using BoundingBox = BaseBoundingBox<float>;
+} // Coco
+
+#endif //COCOENGINE_BOUNDINGBOX_H
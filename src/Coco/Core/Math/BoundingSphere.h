@@ -0,0 +1,65 @@
+//
+// Created by cullen on 10/18/26.
+//
+
+#ifndef COCOENGINE_BOUNDINGSPHERE_H
+#define COCOENGINE_BOUNDINGSPHERE_H
+#include "BoundingBox.h"
+
+namespace Coco
+{
+    /// @brief Base class for a bounding sphere
+    /// @tparam ValueType The value type
+    template<typename ValueType>
+    struct BaseBoundingSphere
+    {
+        /// @brief The center of the sphere
+        BaseVector3<ValueType> Center;
+
+        /// @brief The radius of the sphere
+        ValueType Radius;
+
+        BaseBoundingSphere() :
+            Center(),
+            Radius(static_cast<ValueType>(0))
+        {}
+
+        BaseBoundingSphere(const BaseVector3<ValueType>& center, const ValueType& radius) :
+            Center(center),
+            Radius(radius)
+        {}
+
+        /// @brief Creates a sphere centered on the given box that contains all the given points
+        /// @param box The bounding box of the points
+        /// @param points The points
+        /// @return The bounding sphere
+        static BaseBoundingSphere FromPoints(const BaseBoundingBox<ValueType>& box, Span<const BaseVector3<ValueType>> points)
+        {
+            BaseBoundingSphere sphere(box.GetCenter(), static_cast<ValueType>(0));
+            ValueType radiusSquared = static_cast<ValueType>(0);
+
+            for (const auto& p : points)
+                radiusSquared = Math::Max(radiusSquared, (p - sphere.Center).GetLengthSquared());
+
+            sphere.Radius = Math::Sqrt(radiusSquared);
+            return sphere;
+        }
+
+        /// @brief Transforms this sphere. Non-uniform scaling uses the largest axis scale, so the result always encloses the transformed volume
+        /// @param transform The transform matrix
+        /// @return The transformed bounding sphere
+        BaseBoundingSphere Transformed(const BaseMatrix4x4<ValueType>& transform) const
+        {
+            BaseVector4<ValueType> center = transform * BaseVector4<ValueType>(Center, static_cast<ValueType>(1));
+            BaseVector3<ValueType> scale = transform.GetScale();
+            ValueType maxScale = Math::Max(scale.X(), Math::Max(scale.Y(), scale.Z()));
+
+            return BaseBoundingSphere(center.XYZ(), Radius * maxScale);
+        }
+    };
+
+    /// @brief A bounding sphere backed by floats
+    using BoundingSphere = BaseBoundingSphere<float>;
+} // Coco
+
+#endif //COCOENGINE_BOUNDINGSPHERE_H
@@ -26,8 +26,8 @@ namespace Coco
     void MemoryManager::AllocationMade(uint8 group, uint64 bytesAllocated) noexcept
     {
         AllocationGroupInfo& groupInfo = _allocationGroups[group];
-        groupInfo.AllocationCount++;
-        groupInfo.BytesAllocated += bytesAllocated;
+        groupInfo.AllocationCount.fetch_add(1, std::memory_order_relaxed);
+        groupInfo.BytesAllocated.fetch_add(bytesAllocated, std::memory_order_relaxed);
     }
 
     void MemoryManager::AllocationFreed(uint8 group, uint64 bytesFreed) noexcept
@@ -36,18 +36,18 @@ namespace Coco
         COCO_ASSERT(groupInfo.AllocationCount > 0, "AllocationCount for group %u must be more than 0", group);
         COCO_ASSERT(groupInfo.BytesAllocated >= bytesFreed, "BytesAllocated for group %u must be >= %u", group, bytesFreed);
 
-        groupInfo.AllocationCount--;
-        groupInfo.BytesAllocated -= bytesFreed;
+        const uint64 remainingCount = groupInfo.AllocationCount.fetch_sub(1, std::memory_order_relaxed) - 1;
+        const uint64 remainingBytes = groupInfo.BytesAllocated.fetch_sub(bytesFreed, std::memory_order_relaxed) - bytesFreed;
 
         // Sanity check for making sure all bytes freed match all bytes allocated
-        COCO_ASSERT(groupInfo.AllocationCount > 0 || groupInfo.BytesAllocated == 0, "Memory freed in group %u did not equal memory allocated. Remaining bytes: %u", group, groupInfo.BytesAllocated);
+        COCO_ASSERT(remainingCount > 0 || remainingBytes == 0, "Memory freed in group %u did not equal memory allocated. Remaining bytes: %u", group, remainingBytes);
     }
 
     uint64 MemoryManager::GetTotalUsage() const noexcept
     {
         uint64 total = 0;
         for (const auto& groupInfo : _allocationGroups)
-            total += groupInfo.BytesAllocated;
+            total += groupInfo.BytesAllocated.load(std::memory_order_relaxed);
 
         return total;
     }
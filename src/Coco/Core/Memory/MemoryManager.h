@@ -5,6 +5,8 @@
 #ifndef COCOENGINE_MEMORYMANAGER_H
 #define COCOENGINE_MEMORYMANAGER_H
 
+#include <atomic>
+
 #include "Coco/Core/Types/CoreTypes.h"
 #include "Coco/Core/Types/Map.h"
 
@@ -12,7 +14,7 @@ namespace Coco
 {
     class EnginePlatform;
 
-    /// @brief A Singleton that tracks memory allocations made for the Engine
+    /// @brief A Singleton that tracks memory allocations made for the Engine. Allocations can be recorded from any thread
     class MemoryManager
     {
     public:
@@ -46,10 +48,10 @@ namespace Coco
         struct AllocationGroupInfo
         {
             /// @brief The number of bytes allocated for this group
-            uint64 BytesAllocated;
+            std::atomic<uint64> BytesAllocated;
 
             /// @brief The number of allocations made within this group
-            uint64 AllocationCount;
+            std::atomic<uint64> AllocationCount;
         };
 
         static MemoryManager* _singleton;
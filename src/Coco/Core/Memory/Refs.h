@@ -4,6 +4,7 @@
 
 #ifndef COCOENGINE_REFS_H
 #define COCOENGINE_REFS_H
+#include <atomic>
 #include <type_traits>
 
 #include "Allocator.h"
@@ -23,8 +24,8 @@ namespace Coco
     	/// @brief The size of the object's memory
     	uint32 PtrSize;
 
-        /// @brief The number of weak uses
-        uint32 WeakUseCount;
+        /// @brief The number of weak uses. Atomic so Refs to the same object can be copied from multiple threads
+        std::atomic<uint32> WeakUseCount;
 
         RefControlBlock(Allocator& alloc, void* ptr, uint32 ptrSize) noexcept;
     };
@@ -108,7 +109,7 @@ namespace Coco
 
 		/// @brief Gets the number of Refs referencing the ManagedRef
 		/// @return The number of non-owning references
-		uint32 GetUseCount() const noexcept { return _controlPtr ? _controlPtr->WeakUseCount : 0; }
+		uint32 GetUseCount() const noexcept { return _controlPtr ? _controlPtr->WeakUseCount.load() : 0; }
 
 		/// @brief Determines if the reference is still valid
 		/// @return True if the reference is valid and can be used
@@ -155,10 +156,10 @@ namespace Coco
 				return;
 
 			COCO_ASSERT(_controlPtr->WeakUseCount > 0, "Weak use count was 0");
-			--_controlPtr->WeakUseCount;
+			const uint32 remainingUseCount = --_controlPtr->WeakUseCount;
 
 			// If this Ref is the only thing referencing the control block, destroy it
-			if (_controlPtr->WeakUseCount == 0 && !_controlPtr->Ptr)
+			if (remainingUseCount == 0 && !_controlPtr->Ptr)
 			{
 				Delete(*_controlPtr->Alloc, _controlPtr);
 			}
@@ -259,7 +260,7 @@ namespace Coco
 
 		/// @brief Gets the number of Refs created from this ManagedRef
 		/// @return The number of references (not including this one)
-		uint32 GetUseCount() const noexcept { return _controlPtr ? _controlPtr->WeakUseCount : 0; }
+		uint32 GetUseCount() const noexcept { return _controlPtr ? _controlPtr->WeakUseCount.load() : 0; }
 
 		/// @brief Destroys the managed object
 		void Invalidate() noexcept
@@ -415,7 +416,7 @@ namespace Coco
 
 		/// @brief Gets the number of Refs created from this ManagedRef
 		/// @return The number of references (not including this one)
-		uint32 GetUseCount() const noexcept { return _controlBlock.WeakUseCount; }
+		uint32 GetUseCount() const noexcept { return _controlBlock.WeakUseCount.load(); }
 
 		/// @brief Downcasts this ManagedRef to a Ref of the given type
 		/// @tparam ToType The type to downcast to
@@ -3,6 +3,26 @@
 //
 
 #include "MeshRendererComponent.h"
+#include <Coco/Rendering/Mesh.h>
+#include <Coco/Rendering/Material.h>
 
 namespace Coco
-{} // Coco
\ No newline at end of file
+{
+    DEFINE_RTTI_TYPE(MeshRendererComponent, EntityComponent);
+
+    MeshRendererComponent::MeshRendererComponent(const UUID& ownerEntityID) :
+        MeshRendererComponent(ownerEntityID, nullptr)
+    {}
+
+    MeshRendererComponent::MeshRendererComponent(const UUID& ownerEntityID, SharedPtr<Mesh> renderMesh) :
+        MeshRendererComponent(ownerEntityID, renderMesh, nullptr)
+    {}
+
+    MeshRendererComponent::MeshRendererComponent(const UUID& ownerEntityID, SharedPtr<Mesh> renderMesh, SharedPtr<Material> renderMaterial) :
+        EntityComponent(ownerEntityID),
+        RenderMesh(renderMesh),
+        RenderMaterial(renderMaterial),
+        LODBias(1.0f),
+        LODHysteresis(0.1f)
+    {}
+} // Coco
\ No newline at end of file
@@ -10,6 +10,7 @@
 namespace Coco
 {
     class Mesh;
+    class Material;
 
     struct MeshRendererComponent : public EntityComponent
     {
@@ -17,8 +18,19 @@ namespace Coco
 
     public:
         MeshRendererComponent(const UUID& ownerEntityID);
+        MeshRendererComponent(const UUID& ownerEntityID, SharedPtr<Mesh> renderMesh);
+        MeshRendererComponent(const UUID& ownerEntityID, SharedPtr<Mesh> renderMesh, SharedPtr<Material> renderMaterial);
 
         SharedPtr<Mesh> RenderMesh;
+
+        /// @brief The material to render the mesh with, or nullptr to render it with only its transform
+        SharedPtr<Material> RenderMaterial;
+
+        /// @brief Scales the projected screen size used to select the mesh's level of detail. Values above 1 keep detailed LODs for longer
+        float LODBias;
+
+        /// @brief The fraction the projected screen size must pass a LOD's threshold by before switching to or from it
+        float LODHysteresis;
     };
 } // Coco
 
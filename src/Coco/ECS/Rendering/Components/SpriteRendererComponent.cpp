@@ -5,6 +5,7 @@
 #include "SpriteRendererComponent.h"
 #include <Coco/Rendering/Texture.h>
 #include <Coco/Rendering/Mesh.h>
+#include <Coco/Rendering/2D/TextureAtlas.h>
 
 #include "Coco/Core/Engine.h"
 #include "Coco/Rendering/MeshUtils.h"
@@ -19,6 +20,7 @@ namespace Coco
         EntityComponent(ownerEntityID),
         SpriteTexture(nullptr),
         TintColor(Color::White),
+        TextureRegion(0.0f, 0.0f, 1.0f, 1.0f),
         Rows(1),
         Columns(1),
         AtlasCellIndex(0),
@@ -31,6 +33,7 @@ namespace Coco
         EntityComponent(ownerEntityID),
         SpriteTexture(spriteTexture),
         TintColor(tintColor),
+        TextureRegion(0.0f, 0.0f, 1.0f, 1.0f),
         Rows(1),
         Columns(1),
         AtlasCellIndex(0),
@@ -54,6 +57,12 @@ namespace Coco
         return resourceManager->GetResourceAs<Mesh>(SpriteMeshID);
     }
 
+    void SpriteRendererComponent::SetTextureRegion(const TextureAtlasRegion& region)
+    {
+        SpriteTexture = region.PageTexture;
+        TextureRegion = region.UVRect;
+    }
+
     void SpriteRendererComponent::SetAtlas(uint32 columns, uint32 rows) noexcept
     {
         Columns = Math::Max(columns, static_cast<uint32>(1));
@@ -63,10 +72,10 @@ namespace Coco
 
     Vector4 SpriteRendererComponent::GetCurrentAtlasCellSlice() const noexcept
     {
-        float sizeX = 1.0f / static_cast<float>(Columns);
-        float sizeY = 1.0f / static_cast<float>(Rows);
-        float offsetX = static_cast<float>(AtlasCellIndex % Columns) * sizeX;
-        float offsetY = static_cast<float>(AtlasCellIndex / Columns) * sizeY;
+        float sizeX = TextureRegion.Z() / static_cast<float>(Columns);
+        float sizeY = TextureRegion.W() / static_cast<float>(Rows);
+        float offsetX = TextureRegion.X() + static_cast<float>(AtlasCellIndex % Columns) * sizeX;
+        float offsetY = TextureRegion.Y() + static_cast<float>(AtlasCellIndex / Columns) * sizeY;
 
         if (FlipX)
         {
@@ -12,6 +12,7 @@ namespace Coco
 {
     class Mesh;
     class Texture;
+    struct TextureAtlasRegion;
 
     struct SpriteRendererComponent : public EntityComponent
     {
@@ -24,6 +25,9 @@ namespace Coco
         SharedPtr<Texture> SpriteTexture;
         Color TintColor;
 
+        /// @brief The UV rectangle of SpriteTexture that the sprite and its spritesheet cells are drawn from, in the format (offsetX, offsetY, sizeX, sizeY)
+        Vector4 TextureRegion;
+
         /// @brief The number of columns in the spritesheet
         uint32 Columns;
 
@@ -46,6 +50,11 @@ namespace Coco
         /// @return The sprite mesh
         static SharedPtr<Mesh> GetOrCreateSpriteMesh();
 
+        /// @brief Draws this sprite from a region of a texture atlas page, so it can share a texture with other sprites.
+        /// A spritesheet set with SetAtlas() is divided up within the region
+        /// @param region The region
+        void SetTextureRegion(const TextureAtlasRegion& region);
+
         /// @brief Sets the atlas of this sprite
         /// @param columns The number of columns
         /// @param rows The number of rows
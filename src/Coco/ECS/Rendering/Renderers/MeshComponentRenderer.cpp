@@ -0,0 +1,77 @@
+//
+// Created by cullen on 10/18/26.
+//
+
+#include "MeshComponentRenderer.h"
+
+#include "Coco/ECS/Components/Transform3DComponent.h"
+#include "Coco/ECS/Rendering/Components/MeshRendererComponent.h"
+#include "Coco/Rendering/Graphics/Resources/RenderContext.h"
+#include "Coco/Rendering/Material.h"
+#include "Coco/Rendering/Mesh.h"
+#include "Coco/Rendering/RenderScene.h"
+#include "Coco/ECS/Scene.h"
+
+namespace Coco
+{
+    void MeshComponentRenderer::MeshObjectData::SetDrawData(RenderContext& ctx) const
+    {
+        ctx.SetDrawData(&Model, sizeof(Matrix4x4), Span<const SharedPtr<Texture>>());
+    }
+
+    void MeshComponentRenderer::MaterialMeshObjectData::SetDrawData(RenderContext& ctx, const RenderScene& scene) const
+    {
+        if (const MaterialHandle* material = scene.GetMaterialHandle(MaterialID))
+            ctx.BindMaterial(scene, *material);
+
+        ctx.SetDrawData(&Model, sizeof(Matrix4x4), Span<const SharedPtr<Texture>>());
+    }
+
+    void MeshComponentRenderer::Render(Entity& entity, RenderScene& renderScene)
+    {
+        if (!entity.HasComponent<Transform3DComponent>() || !entity.HasComponent<MeshRendererComponent>())
+            return;
+
+        auto transformComponent = entity.GetComponent<Transform3DComponent>();
+        auto meshComponent = entity.GetComponent<MeshRendererComponent>();
+
+        if (!meshComponent->RenderMesh)
+            return;
+
+        Mesh& mesh = *meshComponent->RenderMesh;
+        const uint64 objectID = GetLODObjectID(*meshComponent);
+
+        // Each view keeps its own LODs, so views with different cameras don't change each other's LOD
+        const BoundingSphere worldSphere = mesh.GetBoundingSphere().Transformed(transformComponent->GlobalTransform);
+
+        MeshObjectData meshData;
+        meshData.Model = transformComponent->GlobalTransform;
+
+        MaterialMeshObjectData materialMeshData;
+        materialMeshData.Model = transformComponent->GlobalTransform;
+        materialMeshData.MaterialID = 0;
+
+        if (meshComponent->RenderMaterial)
+            materialMeshData.MaterialID = renderScene.StoreMaterial(*meshComponent->RenderMaterial).MaterialID;
+
+        // The shared scene has no camera, so its objects aren't ordered by distance
+        const float order = renderScene.IsShared() ? 0.0f : (renderScene.GetCameraPosition() - transformComponent->GetGlobalPosition()).GetLengthSquared();
+        const uint32 submeshCount = static_cast<uint32>(mesh.GetSubmeshes().size());
+
+        for (uint32 i = 0; i < submeshCount; i++)
+        {
+            RenderObject& object = renderScene.AddLODObject(Math::CombineHashes(objectID, static_cast<uint64>(i)), 0, order, mesh, transformComponent->GlobalTransform, i,
+                objectID, worldSphere, meshComponent->LODBias, meshComponent->LODHysteresis);
+
+            if (meshComponent->RenderMaterial)
+                renderScene.SetObjectData(object, materialMeshData);
+            else
+                renderScene.SetObjectData(object, meshData);
+        }
+    }
+
+    uint64 MeshComponentRenderer::GetLODObjectID(const MeshRendererComponent& meshComponent)
+    {
+        return ToHash(meshComponent.OwnerID);
+    }
+} // Coco
\ No newline at end of file
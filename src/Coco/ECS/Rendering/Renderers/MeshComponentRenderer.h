@@ -0,0 +1,52 @@
+//
+// Created by cullen on 10/18/26.
+//
+
+#ifndef COCOENGINE_MESHCOMPONENTRENDERER_H
+#define COCOENGINE_MESHCOMPONENTRENDERER_H
+#include "Coco/Core/Math/Matrix4x4.h"
+
+namespace Coco
+{
+    class Entity;
+    class RenderContext;
+    class RenderScene;
+    struct MeshRendererComponent;
+
+    class MeshComponentRenderer
+    {
+    public:
+        struct MeshObjectData
+        {
+            Matrix4x4 Model;
+
+            void SetDrawData(RenderContext& ctx) const;
+        };
+
+        /// @brief The object data of a mesh rendered with a material
+        struct MaterialMeshObjectData
+        {
+            Matrix4x4 Model;
+            uint64 MaterialID;
+
+            /// @brief Binds the object's material and sets its draw data
+            /// @param ctx The render context
+            /// @param scene The scene the material was stored in
+            void SetDrawData(RenderContext& ctx, const RenderScene& scene) const;
+        };
+
+        /// @brief Adds a RenderObject for each submesh of an entity's mesh, using the level of detail that fits its projected screen size in the scene's view.
+        /// This can be called on the frame's shared scene during extraction, in which case each view selects its own LOD when it adds the objects.
+        /// Objects get MaterialMeshObjectData if the entity has a material, and MeshObjectData otherwise
+        /// @param entity The entity with a MeshRendererComponent and Transform3DComponent
+        /// @param renderScene The scene to add the objects to
+        static void Render(Entity& entity, RenderScene& renderScene);
+
+        /// @brief Gets the ID that a mesh's level of detail is selected with, which can be passed to RenderService::GetObjectLOD()
+        /// @param meshComponent The mesh component
+        /// @return The object ID
+        static uint64 GetLODObjectID(const MeshRendererComponent& meshComponent);
+    };
+} // Coco
+
+#endif //COCOENGINE_MESHCOMPONENTRENDERER_H
\ No newline at end of file
@@ -37,8 +37,8 @@ namespace Coco
         spriteData.SpriteTexture = spriteComponent->SpriteTexture;
 
         uint64 objectID = ToHash(spriteComponent->OwnerID);
-        renderScene.StoreData(objectID, true, spriteData);
-        renderScene.AddObject(objectID, 0, static_cast<float>(transformComponent->ZIndex), *SpriteRendererComponent::GetOrCreateSpriteMesh(), 0);
+        RenderObject& object = renderScene.AddObject(objectID, 0, static_cast<float>(transformComponent->ZIndex), *SpriteRendererComponent::GetOrCreateSpriteMesh(), transformComponent->GlobalTransform, 0);
+        renderScene.SetObjectData(object, spriteData);
     }
 
     void SpriteComponentRenderer::Render3D(const Entity& sprite, const Vector3& cameraPosition, RenderScene& renderScene)
@@ -56,9 +56,8 @@ namespace Coco
         spriteData.SpriteTexture = spriteComponent->SpriteTexture;
 
         uint64 objectID = ToHash(spriteComponent->OwnerID);
-        renderScene.StoreData(objectID, true, spriteData);
-
         float dist = (cameraPosition - transformComponent->GetGlobalPosition()).GetLengthSquared();
-        renderScene.AddObject(objectID, 0, dist, *SpriteRendererComponent::GetOrCreateSpriteMesh(), 0);
+        RenderObject& object = renderScene.AddObject(objectID, 0, dist, *SpriteRendererComponent::GetOrCreateSpriteMesh(), transformComponent->GlobalTransform, 0);
+        renderScene.SetObjectData(object, spriteData);
     }
 } // Coco
\ No newline at end of file
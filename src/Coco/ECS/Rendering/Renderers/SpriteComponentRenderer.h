@@ -27,7 +27,16 @@ namespace Coco
             void SetDrawData(RenderContext& ctx) const;
         };
 
+        /// @brief Adds a RenderObject for a 2D sprite, ordered by its ZIndex.
+        /// This doesn't depend on the camera, so it can be called on the frame's shared scene during extraction
+        /// @param sprite The entity with a SpriteRendererComponent and Transform2DComponent
+        /// @param renderScene The scene to add the object to
         static void Render2D(const Entity& sprite, RenderScene& renderScene);
+
+        /// @brief Adds a RenderObject for a 3D sprite, ordered by its distance to the camera
+        /// @param sprite The entity with a SpriteRendererComponent and Transform3DComponent
+        /// @param cameraPosition The position of the camera
+        /// @param renderScene The scene to add the object to
         static void Render3D(const Entity& sprite, const Vector3& cameraPosition, RenderScene& renderScene);
     };
 } // Coco
@@ -14,6 +14,25 @@
 
 namespace Coco
 {
+    static TileMapComponentRenderer::TilemapObjectData CreateTileObjectData(const TileMapRendererComponent& tileMapRenderer,
+        const Transform2DComponent& tileMapTransform, const TileMapCell& cellData)
+    {
+        TileMapComponentRenderer::TilemapObjectData tilemapObjectData;
+        tilemapObjectData.Model = tileMapTransform.GlobalTransform;
+        tilemapObjectData.Model.M14() += (static_cast<float>(cellData.Coordinates.X()) + 0.5f) * tileMapTransform.LocalScale.X();
+        tilemapObjectData.Model.M24() += (static_cast<float>(cellData.Coordinates.Y()) + 0.5f) * tileMapTransform.LocalScale.Y();
+
+        tilemapObjectData.TintColor = Color::White.AsVector4(false);
+        tilemapObjectData.Slice = tileMapRenderer.Map->GetAtlas()->GetCellSlice(cellData.TileID);
+        tilemapObjectData.SpriteTexture = tileMapRenderer.Map->GetAtlas()->GetTexture();
+        return tilemapObjectData;
+    }
+
+    static uint64 GetTileObjectID(const Entity& tilemap, const TileMapCell& cellData)
+    {
+        return Math::CombineHashes(ToHash(tilemap), static_cast<uint64>(cellData.Coordinates.X()), static_cast<uint64>(cellData.Coordinates.Y()));
+    }
+
     void TileMapComponentRenderer::TilemapObjectData::SetDrawData(RenderContext& ctx) const
     {
         uint8 data[sizeof(Matrix4x4) + sizeof(Vector4) * 2];
@@ -29,6 +48,8 @@ namespace Coco
             !tilemap.HasComponent<Transform2DComponent>() || !tilemap.HasComponent<TileMapRendererComponent>())
             return;
 
+        COCO_ASSERT(!renderScene.IsShared(), "Tiles visible to a camera can only be rendered into a per-view scene. Use Extract() for the shared scene");
+
         auto cameraComp = camera.GetComponent<CameraComponent>();
         auto cameraTransform = camera.GetComponent<Transform2DComponent>();
 
@@ -44,18 +65,27 @@ namespace Coco
         auto spriteMesh = SpriteRendererComponent::GetOrCreateSpriteMesh();
         tileMapRenderer->CallForVisibleTiles(tilemapViewport, [&](const TileMapCell& cellData)
         {
-            TilemapObjectData tilemapObjectData;
-            tilemapObjectData.Model = tileMapTransform->GlobalTransform;
-            tilemapObjectData.Model.M14() += (static_cast<float>(cellData.Coordinates.X()) + 0.5f) * tileMapTransform->LocalScale.X();
-            tilemapObjectData.Model.M24() += (static_cast<float>(cellData.Coordinates.Y()) + 0.5f) * tileMapTransform->LocalScale.Y();
-
-            tilemapObjectData.TintColor = Color::White.AsVector4(false);
-            tilemapObjectData.Slice = tileMapRenderer->Map->GetAtlas()->GetCellSlice(cellData.TileID);
-            tilemapObjectData.SpriteTexture = tileMapRenderer->Map->GetAtlas()->GetTexture();
-
-            uint64 objectID = Math::CombineHashes(ToHash(tilemap), static_cast<uint64>(cellData.Coordinates.X()), static_cast<uint64>(cellData.Coordinates.Y()));
-            renderScene.StoreData(objectID, true, tilemapObjectData);
-            renderScene.AddObject(objectID, 0, static_cast<float>(tileMapTransform->ZIndex), *spriteMesh, 0);
+            TilemapObjectData tilemapObjectData = CreateTileObjectData(*tileMapRenderer, *tileMapTransform, cellData);
+            RenderObject& object = renderScene.AddObject(GetTileObjectID(tilemap, cellData), 0, static_cast<float>(tileMapTransform->ZIndex), *spriteMesh, 0);
+            renderScene.SetObjectData(object, tilemapObjectData);
+        });
+    }
+
+    void TileMapComponentRenderer::Extract(const Entity& tilemap, RenderScene& renderScene)
+    {
+        if (!tilemap.HasComponent<Transform2DComponent>() || !tilemap.HasComponent<TileMapRendererComponent>())
+            return;
+
+        auto tileMapRenderer = tilemap.GetComponent<TileMapRendererComponent>();
+        auto tileMapTransform = tilemap.GetComponent<Transform2DComponent>();
+        auto spriteMesh = SpriteRendererComponent::GetOrCreateSpriteMesh();
+
+        // No viewport is known yet, so each tile gets bounds that every view culls it with
+        tileMapRenderer->Map->ForEachCell([&](const TileMapCell& cellData)
+        {
+            TilemapObjectData tilemapObjectData = CreateTileObjectData(*tileMapRenderer, *tileMapTransform, cellData);
+            RenderObject& object = renderScene.AddObject(GetTileObjectID(tilemap, cellData), 0, static_cast<float>(tileMapTransform->ZIndex), *spriteMesh, tilemapObjectData.Model, 0);
+            renderScene.SetObjectData(object, tilemapObjectData);
         });
     }
 } // Coco
\ No newline at end of file
@@ -27,7 +27,18 @@ namespace Coco
             void SetDrawData(RenderContext& ctx) const;
         };
 
+        /// @brief Adds a RenderObject for each tile inside a camera's viewport, including cells filled by the map's DefaultTileID.
+        /// The viewport depends on the scene's size, so this must be called on a per-view scene
+        /// @param tilemap The entity with a TileMapRendererComponent and Transform2DComponent
+        /// @param camera The entity with a CameraComponent and Transform2DComponent
+        /// @param renderScene The scene to add the objects to
         static void Render(const Entity& tilemap, const Entity& camera, RenderScene& renderScene);
+
+        /// @brief Adds a RenderObject with world bounds for each cell of a tilemap, so the frame's shared scene can be culled by each view.
+        /// Cells only filled by the map's DefaultTileID cover an unbounded area and aren't added, so maps with a default tile should use Render() instead
+        /// @param tilemap The entity with a TileMapRendererComponent and Transform2DComponent
+        /// @param renderScene The scene to add the objects to
+        static void Extract(const Entity& tilemap, RenderScene& renderScene);
     };
 } // Coco
 
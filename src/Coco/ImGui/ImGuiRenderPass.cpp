@@ -45,10 +45,10 @@ namespace Coco
 
         for (auto renderObject : sceneData.GetRenderObjectView())
         {
-            if (!sceneData.HasData<ImGuiObjectData>(renderObject.ID, true))
+            auto objData = sceneData.GetObjectData<ImGuiObjectData>(renderObject);
+            if (!objData)
                 continue;
 
-            auto objData = sceneData.GetData<ImGuiObjectData>(renderObject.ID, true);
             ctx.SetScissor(objData->ScissorRect);
 
             ctx.SetDrawData(nullptr, 0, Span<const SharedPtr<Texture>>({objData->DrawTexture}));
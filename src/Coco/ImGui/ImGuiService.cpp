@@ -169,8 +169,8 @@ namespace Coco
                 vertexOffset = submesh.VertexOffset + cmd.VtxOffset;
 
                 uint64 drawID = Math::CombineHashes(static_cast<uint64>(cmdI), static_cast<uint64>(n), meshID);
-                scene.StoreData(drawID, true, objData);
-                scene.AddObject(drawID, 0, static_cast<float>(n), meshID, indexOffset, cmd.ElemCount, static_cast<int32>(vertexOffset));
+                RenderObject& object = scene.AddObject(drawID, 0, static_cast<float>(n), meshID, indexOffset, cmd.ElemCount, static_cast<int32>(vertexOffset));
+                scene.SetObjectData(object, objData);
             }
         }
 
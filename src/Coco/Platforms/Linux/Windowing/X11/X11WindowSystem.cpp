@@ -20,6 +20,10 @@
 #include "Vulkan/X11VulkanGraphicsSurfaceFactory.h"
 #endif
 
+#ifdef COCO_RENDERING_NULL
+#include "Coco/Rendering/RHI/Null/NullGraphicsPlatform.h"
+#endif
+
 #ifdef COCO_SERVICE_INPUT
 #include <Coco/Input/InputService.h>
 #endif
@@ -204,6 +208,14 @@ namespace Coco
         }
 #endif
 
+#ifdef COCO_RENDERING_NULL
+        // The null platform doesn't present, so its surfaces don't need anything from the window but its size
+        if (strcmp(graphicsPlatform.GetName(), NullGraphicsPlatform::Name) == 0)
+        {
+            return static_cast<NullGraphicsPlatform&>(graphicsPlatform).CreateSurface(window.GetSize());
+        }
+#endif
+
         String str = FormatString("Unsupported graphics platform: %s", graphicsPlatform.GetName());
         throw Exception(str.CStr());
     }
@@ -131,8 +131,8 @@ namespace Coco
             {
                 const auto& drawCall = batch->DrawCalls[i];
                 uint64 id = Math::CombineHashes(meshID, i);
-                scene.StoreData(id, false, drawCall);
-                scene.AddObject(id, 0, meshID, drawCall.IndexOffset, 6);
+                RenderObject& object = scene.AddObject(id, 0, meshID, drawCall.IndexOffset, 6);
+                scene.SetObjectData(object, drawCall);
             }
         }
 
@@ -168,9 +168,8 @@ namespace Coco
 
             for (const auto& obj : sceneData.GetRenderObjectView())
             {
-                if (sceneData.HasData<Render2DDrawCall>(obj.ID, false))
+                if (const Render2DDrawCall* drawCall = sceneData.GetObjectData<Render2DDrawCall>(obj))
                 {
-                    const Render2DDrawCall* drawCall = sceneData.GetData<Render2DDrawCall>(obj.ID, false);
                     ctx.SetDrawData(nullptr, 0, Span<const SharedPtr<Texture>>({drawCall->DrawTexture}));
 
                     ctx.DrawObject(obj);
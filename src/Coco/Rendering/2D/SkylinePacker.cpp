@@ -0,0 +1,149 @@
+//
+// Created by cullen on 10/18/26.
+//
+
+#include "SkylinePacker.h"
+
+#include <limits>
+
+#include "Coco/Core/Math/Math.h"
+
+namespace Coco
+{
+    SkylinePacker::SkylinePacker(uint32 width, uint32 height) :
+        _width(width),
+        _height(height),
+        _usedArea(0),
+        _skyline()
+    {
+        Reset();
+    }
+
+    bool SkylinePacker::TryPack(uint32 width, uint32 height, uint32& outX, uint32& outY)
+    {
+        if (width == 0 || height == 0)
+            return false;
+
+        uint64 bestIndex = 0;
+        uint32 bestTop = std::numeric_limits<uint32>::max();
+        uint32 bestNodeWidth = std::numeric_limits<uint32>::max();
+        uint32 bestY = 0;
+        bool found = false;
+
+        for (uint64 i = 0; i < _skyline.GetCount(); i++)
+        {
+            uint32 y;
+            if (!TryFitAt(i, width, height, y))
+                continue;
+
+            // Prefer the lowest top edge, then the narrowest segment so wide gaps are left for wide rectangles
+            const uint32 top = y + height;
+            const uint32 nodeWidth = _skyline[i].Width;
+
+            if (top < bestTop || (top == bestTop && nodeWidth < bestNodeWidth))
+            {
+                bestIndex = i;
+                bestTop = top;
+                bestNodeWidth = nodeWidth;
+                bestY = y;
+                found = true;
+            }
+        }
+
+        if (!found)
+            return false;
+
+        outX = _skyline[bestIndex].X;
+        outY = bestY;
+        AddLevel(bestIndex, outX, outY, width, height);
+        _usedArea += static_cast<uint64>(width) * height;
+
+        return true;
+    }
+
+    void SkylinePacker::Reset()
+    {
+        _skyline.Clear();
+        _skyline.Append(SkylineNode{ 0, 0, _width });
+        _usedArea = 0;
+    }
+
+    double SkylinePacker::GetOccupancy() const
+    {
+        const uint64 area = static_cast<uint64>(_width) * _height;
+        return area > 0 ? static_cast<double>(_usedArea) / static_cast<double>(area) : 0.0;
+    }
+
+    bool SkylinePacker::TryFitAt(uint64 nodeIndex, uint32 width, uint32 height, uint32& outY) const
+    {
+        const uint32 x = _skyline[nodeIndex].X;
+        if (x + width > _width)
+            return false;
+
+        // The rectangle rests on the highest segment beneath it
+        uint32 y = 0;
+        uint32 widthLeft = width;
+
+        for (uint64 i = nodeIndex; widthLeft > 0 && i < _skyline.GetCount(); i++)
+        {
+            const SkylineNode& node = _skyline[i];
+            y = Math::Max(y, node.Y);
+
+            if (y + height > _height)
+                return false;
+
+            widthLeft -= Math::Min(widthLeft, node.Width);
+        }
+
+        outY = y;
+        return true;
+    }
+
+    void SkylinePacker::AddLevel(uint64 nodeIndex, uint32 x, uint32 y, uint32 width, uint32 height)
+    {
+        // Insert the new segment before the one it was placed at
+        const SkylineNode last = _skyline.Back();
+        _skyline.Append(last);
+
+        for (uint64 i = _skyline.GetCount() - 1; i > nodeIndex; i--)
+            _skyline[i] = _skyline[i - 1];
+
+        _skyline[nodeIndex] = SkylineNode{ x, y + height, width };
+
+        // Shrink or remove the segments that are now covered by the new segment
+        const uint32 levelEnd = x + width;
+        uint64 i = nodeIndex + 1;
+
+        while (i < _skyline.GetCount())
+        {
+            SkylineNode& node = _skyline[i];
+            if (node.X >= levelEnd)
+                break;
+
+            const uint32 nodeEnd = node.X + node.Width;
+            if (nodeEnd <= levelEnd)
+            {
+                _skyline.RemoveAt(i);
+                continue;
+            }
+
+            node.Width = nodeEnd - levelEnd;
+            node.X = levelEnd;
+            break;
+        }
+
+        // Merge neighboring segments at the same height
+        for (i = 0; i + 1 < _skyline.GetCount();)
+        {
+            if (_skyline[i].Y == _skyline[i + 1].Y)
+            {
+                _skyline[i].Width += _skyline[i + 1].Width;
+                _skyline.RemoveAt(i + 1);
+            }
+            else
+            {
+                i++;
+            }
+        }
+    }
+} // Coco
\ No newline at end of file
@@ -0,0 +1,78 @@
+//
+// Created by cullen on 10/18/26.
+//
+
+#ifndef COCOENGINE_SKYLINEPACKER_H
+#define COCOENGINE_SKYLINEPACKER_H
+#include "Coco/Core/Types/Array.h"
+
+namespace Coco
+{
+    /// @brief Packs rectangles into a fixed-size area by tracking the skyline formed by the tops of the rectangles packed so far.
+    /// Each rectangle is placed where it raises the skyline the least, using the bottom-left heuristic
+    class SkylinePacker
+    {
+    public:
+        SkylinePacker(uint32 width, uint32 height);
+
+        /// @brief Finds a space for a rectangle and marks it as used
+        /// @param width The width of the rectangle
+        /// @param height The height of the rectangle
+        /// @param outX Will be set to the x position of the rectangle
+        /// @param outY Will be set to the y position of the rectangle
+        /// @return True if the rectangle fit
+        bool TryPack(uint32 width, uint32 height, uint32& outX, uint32& outY);
+
+        /// @brief Clears every packed rectangle
+        void Reset();
+
+        /// @brief Gets the width of the area
+        /// @return The width of the area
+        uint32 GetWidth() const { return _width; }
+
+        /// @brief Gets the height of the area
+        /// @return The height of the area
+        uint32 GetHeight() const { return _height; }
+
+        /// @brief Gets how much of the area is used by packed rectangles
+        /// @return The used area, between 0 and 1
+        double GetOccupancy() const;
+
+    private:
+        /// @brief A horizontal segment of the skyline
+        struct SkylineNode
+        {
+            /// @brief The x position of the left edge of the segment
+            uint32 X;
+
+            /// @brief The height of the skyline across the segment
+            uint32 Y;
+
+            /// @brief The width of the segment
+            uint32 Width;
+        };
+
+        uint32 _width;
+        uint32 _height;
+        uint64 _usedArea;
+        Array<SkylineNode> _skyline;
+
+        /// @brief Finds the y position a rectangle would rest at if its left edge was placed at the start of a skyline segment
+        /// @param nodeIndex The index of the segment
+        /// @param width The width of the rectangle
+        /// @param height The height of the rectangle
+        /// @param outY Will be set to the y position of the rectangle
+        /// @return True if the rectangle fits at the segment
+        bool TryFitAt(uint64 nodeIndex, uint32 width, uint32 height, uint32& outY) const;
+
+        /// @brief Adds the top of a packed rectangle to the skyline, shrinking or removing the segments it covers
+        /// @param nodeIndex The index of the segment the rectangle was placed at
+        /// @param x The x position of the rectangle
+        /// @param y The y position of the rectangle
+        /// @param width The width of the rectangle
+        /// @param height The height of the rectangle
+        void AddLevel(uint64 nodeIndex, uint32 x, uint32 y, uint32 width, uint32 height);
+    };
+} // Coco
+
+#endif //COCOENGINE_SKYLINEPACKER_H
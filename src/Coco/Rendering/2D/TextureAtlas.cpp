@@ -0,0 +1,191 @@
+//
+// Created by cullen on 10/18/26.
+//
+
+#include "TextureAtlas.h"
+
+#include "Coco/Core/Engine.h"
+#include "Coco/Core/Types/Sorting/QSorter.h"
+#include "Coco/Rendering/Texture.h"
+
+namespace Coco
+{
+    DEFINE_RTTI_TYPE(TextureAtlas, Resource);
+
+    TextureAtlasRegion::TextureAtlasRegion() :
+        PageIndex(0),
+        PageTexture(nullptr),
+        PixelRect(),
+        UVRect()
+    {}
+
+    TextureAtlasImage::TextureAtlasImage(Span<const uint8> pixels, uint32 width, uint32 height) :
+        Pixels(pixels),
+        Width(width),
+        Height(height)
+    {}
+
+    TextureAtlas::Page::Page(SharedPtr<Texture> pageTexture, uint32 packerSize) :
+        PageTexture(pageTexture),
+        Packer(packerSize, packerSize)
+    {}
+
+    TextureAtlas::TextureAtlas(Engine* engine, uint64 id, uint32 pageSize, uint32 padding, ImageColorSpace colorSpace,
+                               const ImageSamplerDescription& samplerDescription, bool generateMipMaps) :
+        Resource(engine, id),
+        _pageSize(pageSize),
+        _padding(padding),
+        _mipCount(1),
+        _alignment(1),
+        _colorSpace(colorSpace),
+        _samplerDescription(samplerDescription),
+        _pages()
+    {
+        if (generateMipMaps && padding > 0)
+        {
+            // Each mip level halves the padding, so only keep the levels that still have a pixel of padding between images.
+            // Cells are aligned to the smallest kept level so its texels never cover two cells
+            const uint32 paddedLevels = static_cast<uint32>(Math::Log2(static_cast<double>(padding))) + 1;
+            _mipCount = Math::Min(paddedLevels, ImageDescription::CalculateMipMapCount(pageSize, pageSize));
+            _alignment = 1u << (_mipCount - 1);
+        }
+    }
+
+    bool TextureAtlas::TryAddImage(Span<const uint8> rgbaPixels, uint32 width, uint32 height, TextureAtlasRegion& outRegion)
+    {
+        COCO_ASSERT(rgbaPixels.size() >= static_cast<uint64>(width) * height * 4, "Pixel data was smaller than a %ux%u RGBA8 image", width, height);
+
+        if (width == 0 || height == 0 || GetCellSize(width) > _pageSize || GetCellSize(height) > _pageSize)
+        {
+            COCO_ENGINE_LOG_ERROR("A %ux%u image can't fit on a %u pixel texture atlas page", width, height, _pageSize);
+            return false;
+        }
+
+        for (uint64 i = 0; i < _pages.GetCount(); i++)
+        {
+            if (TryAddImageToPage(static_cast<uint32>(i), rgbaPixels, width, height, outRegion))
+                return true;
+        }
+
+        // An empty page always has room for an image that fits within the page size
+        CreatePage();
+        return TryAddImageToPage(static_cast<uint32>(_pages.GetCount() - 1), rgbaPixels, width, height, outRegion);
+    }
+
+    Array<TextureAtlasRegion> TextureAtlas::AddImages(Span<const TextureAtlasImage> images)
+    {
+        Array<uint64> order;
+        order.Reserve(images.size());
+
+        for (uint64 i = 0; i < images.size(); i++)
+            order.Append(i);
+
+        QSorter<uint64> sorter([images](const uint64& a, const uint64& b)
+        {
+            const TextureAtlasImage& imageA = images[a];
+            const TextureAtlasImage& imageB = images[b];
+
+            if (imageA.Height != imageB.Height)
+                return imageA.Height > imageB.Height;
+
+            return imageA.Width > imageB.Width;
+        });
+
+        sorter.Sort(order);
+
+        Array<TextureAtlasRegion> regions(images.size(), TextureAtlasRegion());
+
+        for (const uint64 index : order)
+        {
+            const TextureAtlasImage& image = images[index];
+            TryAddImage(image.Pixels, image.Width, image.Height, regions[index]);
+        }
+
+        return regions;
+    }
+
+    SharedPtr<Texture> TextureAtlas::GetPageTexture(uint64 pageIndex) const
+    {
+        COCO_ASSERT(pageIndex < _pages.GetCount(), "Page index %u was out of range", pageIndex);
+        return _pages[pageIndex].PageTexture;
+    }
+
+    double TextureAtlas::GetPageOccupancy(uint64 pageIndex) const
+    {
+        COCO_ASSERT(pageIndex < _pages.GetCount(), "Page index %u was out of range", pageIndex);
+        return _pages[pageIndex].Packer.GetOccupancy();
+    }
+
+    TextureAtlas::Page& TextureAtlas::CreatePage()
+    {
+        ImageDescription pageDescription = ImageDescription::Create2D(
+            _pageSize, _pageSize,
+            ImagePixelFormat::RGBA8,
+            _colorSpace,
+            ImageUsageFlags::Sampled | ImageUsageFlags::TransferDestination,
+            _mipCount > 1);
+        pageDescription.MipCount = _mipCount;
+
+        const String pageName = FormatString("TextureAtlas%llu_Page%llu", static_cast<unsigned long long>(_id), static_cast<unsigned long long>(_pages.GetCount()));
+        SharedPtr<Texture> pageTexture = _engine->GetResourceManager()->CreateResource<Texture>(pageName.CStr(), pageDescription, _samplerDescription);
+
+        return _pages.EmplaceBack(pageTexture, _pageSize / _alignment);
+    }
+
+    bool TextureAtlas::TryAddImageToPage(uint32 pageIndex, Span<const uint8> rgbaPixels, uint32 width, uint32 height, TextureAtlasRegion& outRegion)
+    {
+        Page& page = _pages[pageIndex];
+
+        const uint32 cellWidth = GetCellSize(width);
+        const uint32 cellHeight = GetCellSize(height);
+
+        uint32 cellX, cellY;
+        if (!page.Packer.TryPack(cellWidth / _alignment, cellHeight / _alignment, cellX, cellY))
+            return false;
+
+        cellX *= _alignment;
+        cellY *= _alignment;
+
+        // The whole cell is uploaded so its padding doesn't hold stale pixels from a previous use of the page
+        Array<uint8> cellPixels = CreatePaddedCell(rgbaPixels, width, height, _padding, cellWidth, cellHeight);
+        page.PageTexture->SetPixelRegion(cellX, cellY, cellWidth, cellHeight, cellPixels.Data(), cellPixels.GetCount());
+
+        const float pageSize = static_cast<float>(_pageSize);
+        const uint32 imageX = cellX + _padding;
+        const uint32 imageY = cellY + _padding;
+
+        outRegion.PageIndex = pageIndex;
+        outRegion.PageTexture = page.PageTexture;
+        outRegion.PixelRect = Recti(Vector2i(static_cast<int>(imageX), static_cast<int>(imageY)), Sizei(static_cast<int>(width), static_cast<int>(height)));
+        outRegion.UVRect = Vector4(imageX / pageSize, imageY / pageSize, width / pageSize, height / pageSize);
+
+        return true;
+    }
+
+    uint32 TextureAtlas::GetCellSize(uint32 imageSize) const
+    {
+        return static_cast<uint32>(Math::AlignedAddress(static_cast<uint64>(imageSize) + _padding * 2, _alignment));
+    }
+
+    Array<uint8> TextureAtlas::CreatePaddedCell(Span<const uint8> rgbaPixels, uint32 width, uint32 height, uint32 padding, uint32 cellWidth, uint32 cellHeight)
+    {
+        Array<uint8> cellPixels(static_cast<uint64>(cellWidth) * cellHeight * 4, 0);
+
+        for (uint32 y = 0; y < cellHeight; y++)
+        {
+            // Rows and columns outside the image repeat the nearest edge pixel
+            const uint32 sourceY = static_cast<uint32>(Math::Clamp(static_cast<int64>(y) - padding, static_cast<int64>(0), static_cast<int64>(height) - 1));
+
+            for (uint32 x = 0; x < cellWidth; x++)
+            {
+                const uint32 sourceX = static_cast<uint32>(Math::Clamp(static_cast<int64>(x) - padding, static_cast<int64>(0), static_cast<int64>(width) - 1));
+
+                memcpy(cellPixels.Data() + (static_cast<uint64>(y) * cellWidth + x) * 4,
+                    rgbaPixels.data() + (static_cast<uint64>(sourceY) * width + sourceX) * 4,
+                    4);
+            }
+        }
+
+        return cellPixels;
+    }
+} // Coco
\ No newline at end of file
@@ -0,0 +1,166 @@
+//
+// Created by cullen on 10/18/26.
+//
+
+#ifndef COCOENGINE_TEXTUREATLAS_H
+#define COCOENGINE_TEXTUREATLAS_H
+#include "SkylinePacker.h"
+#include "Coco/Core/Math/Rect.h"
+#include "Coco/Core/Math/Vector4.h"
+#include "Coco/Core/Memory/Ptrs.h"
+#include "Coco/Core/Resources/Resource.h"
+#include "Coco/Core/Types/Span.h"
+#include "Coco/Rendering/Graphics/Resources/ImageSamplerTypes.h"
+#include "Coco/Rendering/Graphics/Resources/ImageTypes.h"
+
+namespace Coco
+{
+    class Texture;
+
+    /// @brief The region of a texture atlas page that an image was packed into
+    struct TextureAtlasRegion
+    {
+        /// @brief The index of the page the image is on
+        uint32 PageIndex;
+
+        /// @brief The texture of the page the image is on
+        SharedPtr<Texture> PageTexture;
+
+        /// @brief The position and size of the image on the page, in pixels. This doesn't include the padding around the image
+        Recti PixelRect;
+
+        /// @brief The UV rectangle of the image on the page, in the format (offsetX, offsetY, sizeX, sizeY)
+        Vector4 UVRect;
+
+        TextureAtlasRegion();
+
+        /// @brief Gets if an image was packed into this region
+        /// @return True if this region is on a page
+        bool IsValid() const { return PageTexture != nullptr; }
+    };
+
+    /// @brief An image to pack into a texture atlas
+    struct TextureAtlasImage
+    {
+        /// @brief The RGBA8 pixels of the image, with tightly packed rows
+        Span<const uint8> Pixels;
+
+        /// @brief The width of the image, in pixels
+        uint32 Width;
+
+        /// @brief The height of the image, in pixels
+        uint32 Height;
+
+        TextureAtlasImage(Span<const uint8> pixels, uint32 width, uint32 height);
+    };
+
+    /// @brief Packs many small images, such as sprites and UI images, into a few large textures so draws that use them can share the same texture.
+    /// Images can be added at any time, and are uploaded into a region of an existing page unless no page has room for them.
+    /// Each image is surrounded by padding that repeats its edge pixels, so filtering and mip maps don't blend in neighboring images
+    class TextureAtlas : public Resource
+    {
+        DECLARE_RTTI_TYPE(TextureAtlas)
+
+    public:
+        /// @brief The default width and height of a page, in pixels
+        static constexpr uint32 DefaultPageSize = 2048;
+
+        /// @brief The default padding around each image, in pixels
+        static constexpr uint32 DefaultPadding = 4;
+
+        /// @brief Creates an empty texture atlas
+        /// @param pageSize The width and height of each page, in pixels
+        /// @param padding The padding around each image, in pixels. Mip maps are limited to the levels that keep at least a pixel of padding
+        /// @param colorSpace The color space of the images
+        /// @param samplerDescription The sampler description of the pages
+        /// @param generateMipMaps If true, the pages will have mip maps
+        TextureAtlas(Engine* engine, uint64 id, uint32 pageSize, uint32 padding, ImageColorSpace colorSpace, const ImageSamplerDescription& samplerDescription, bool generateMipMaps);
+
+        /// @brief Packs an image into a page and uploads it
+        /// @param rgbaPixels The RGBA8 pixels of the image, with tightly packed rows
+        /// @param width The width of the image, in pixels
+        /// @param height The height of the image, in pixels
+        /// @param outRegion Will be set to the region the image was packed into
+        /// @return True if the image was added, or false if it is too large to fit on a page
+        bool TryAddImage(Span<const uint8> rgbaPixels, uint32 width, uint32 height, TextureAtlasRegion& outRegion);
+
+        /// @brief Packs several images at once, such as when a set of sprites is cooked or a level is loaded.
+        /// The tallest images are packed first, which wastes less space than adding them one at a time
+        /// @param images The images to add
+        /// @return The regions of the images, in the same order. Images that couldn't be added have invalid regions
+        Array<TextureAtlasRegion> AddImages(Span<const TextureAtlasImage> images);
+
+        /// @brief Gets the number of pages in this atlas
+        /// @return The number of pages
+        uint64 GetPageCount() const { return _pages.GetCount(); }
+
+        /// @brief Gets the texture of a page
+        /// @param pageIndex The index of the page
+        /// @return The page's texture
+        SharedPtr<Texture> GetPageTexture(uint64 pageIndex) const;
+
+        /// @brief Gets how much of a page is used by images and their padding
+        /// @param pageIndex The index of the page
+        /// @return The used area of the page, between 0 and 1
+        double GetPageOccupancy(uint64 pageIndex) const;
+
+        /// @brief Gets the width and height of each page
+        /// @return The page size, in pixels
+        uint32 GetPageSize() const { return _pageSize; }
+
+        /// @brief Gets the padding around each image
+        /// @return The padding, in pixels
+        uint32 GetPadding() const { return _padding; }
+
+    private:
+        /// @brief A texture that images are packed into
+        struct Page
+        {
+            /// @brief The page's texture
+            SharedPtr<Texture> PageTexture;
+
+            /// @brief The packer that tracks the free space of the page, in units of the atlas's alignment
+            SkylinePacker Packer;
+
+            Page(SharedPtr<Texture> pageTexture, uint32 packerSize);
+        };
+
+        uint32 _pageSize;
+        uint32 _padding;
+        uint32 _mipCount;
+        uint32 _alignment;
+        ImageColorSpace _colorSpace;
+        ImageSamplerDescription _samplerDescription;
+        Array<Page> _pages;
+
+        /// @brief Creates a new, empty page
+        /// @return The page
+        Page& CreatePage();
+
+        /// @brief Packs an image into a page and uploads it
+        /// @param pageIndex The index of the page
+        /// @param rgbaPixels The RGBA8 pixels of the image
+        /// @param width The width of the image, in pixels
+        /// @param height The height of the image, in pixels
+        /// @param outRegion Will be set to the region the image was packed into
+        /// @return True if the page had room for the image
+        bool TryAddImageToPage(uint32 pageIndex, Span<const uint8> rgbaPixels, uint32 width, uint32 height, TextureAtlasRegion& outRegion);
+
+        /// @brief Gets the size of the cell an image takes up on a page, which includes its padding and is rounded up to the atlas's alignment
+        /// @param imageSize The width or height of the image, in pixels
+        /// @return The width or height of the cell, in pixels
+        uint32 GetCellSize(uint32 imageSize) const;
+
+        /// @brief Copies an image into a cell, repeating its edge pixels into the padding around it
+        /// @param rgbaPixels The RGBA8 pixels of the image
+        /// @param width The width of the image, in pixels
+        /// @param height The height of the image, in pixels
+        /// @param padding The padding on the left and bottom of the image, in pixels
+        /// @param cellWidth The width of the cell, in pixels
+        /// @param cellHeight The height of the cell, in pixels
+        /// @return The RGBA8 pixels of the cell
+        static Array<uint8> CreatePaddedCell(Span<const uint8> rgbaPixels, uint32 width, uint32 height, uint32 padding, uint32 cellWidth, uint32 cellHeight);
+    };
+} // Coco
+
+#endif //COCOENGINE_TEXTUREATLAS_H
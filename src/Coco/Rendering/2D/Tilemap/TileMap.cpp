@@ -32,4 +32,10 @@ namespace Coco
     {
         return _map.TryGetValue(coords);
     }
+
+    void TileMap::ForEachCell(const std::function<void(const TileMapCell&)>& callbackFunction) const
+    {
+        for (const auto& pair : _map)
+            callbackFunction(pair.second);
+    }
 }
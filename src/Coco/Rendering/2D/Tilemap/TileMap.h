@@ -9,6 +9,8 @@
 #include "Coco/Core/Math/Vector2.h"
 #include "Coco/Core/Types/Map.h"
 
+#include <functional>
+
 namespace Coco
 {
     struct TileMapCell
@@ -27,6 +29,10 @@ namespace Coco
         void SetCell(const Vector2i& coords, uint32 tileID);
         const TileMapCell* GetCell(const Vector2i& coords) const;
 
+        /// @brief Calls a function for every cell that has been set
+        /// @param callbackFunction The function to call for each cell
+        void ForEachCell(const std::function<void(const TileMapCell&)>& callbackFunction) const;
+
         SharedPtr<TileMapAtlas> GetAtlas() const { return _atlas; }
 
     private:
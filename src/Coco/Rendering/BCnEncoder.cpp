@@ -0,0 +1,560 @@
+//
+// Created by cullen on 10/18/26.
+//
+
+#include "BCnEncoder.h"
+
+#include <cfloat>
+#include <cmath>
+#include <cstring>
+#include "Coco/Core/Asserts.h"
+#include "Coco/Core/Math/Math.h"
+
+namespace Coco
+{
+    /// @brief The weights that BC7 interpolates between endpoints with for 4 bit indices, out of 64
+    static constexpr int32 _bc7Weights[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+    /// @brief Converts an sRGB channel to linear space
+    /// @param value The sRGB channel
+    /// @return The linear channel, from 0 to 1
+    static float SRGBToLinear(uint8 value)
+    {
+        const float v = value / 255.0f;
+        return v <= 0.04045f ? v / 12.92f : std::pow((v + 0.055f) / 1.055f, 2.4f);
+    }
+
+    /// @brief Converts a linear channel to sRGB space
+    /// @param value The linear channel, from 0 to 1
+    /// @return The sRGB channel
+    static uint8 LinearToSRGB(float value)
+    {
+        const float v = value <= 0.0031308f ? value * 12.92f : 1.055f * std::pow(value, 1.0f / 2.4f) - 0.055f;
+        return static_cast<uint8>(Math::Clamp(v * 255.0f + 0.5f, 0.0f, 255.0f));
+    }
+
+    /// @brief Fits a line through the colors of a block's pixels along the axis they vary the most, found with power iteration
+    /// @param block The 16 RGBA8 pixels of the block
+    /// @param included Which of the pixels to fit the line to
+    /// @param channelCount The number of channels to fit, starting with red
+    /// @param outLow Will be set to the lowest color of the pixels projected onto the line
+    /// @param outHigh Will be set to the highest color of the pixels projected onto the line
+    /// @return False if no pixels were included
+    static bool FitEndpoints(const uint8* block, const bool* included, uint32 channelCount, float* outLow, float* outHigh)
+    {
+        float mean[4] = {};
+        uint32 count = 0;
+
+        for (uint32 i = 0; i < 16; i++)
+        {
+            if (!included[i])
+                continue;
+
+            for (uint32 c = 0; c < channelCount; c++)
+                mean[c] += block[i * 4 + c];
+
+            count++;
+        }
+
+        if (count == 0)
+            return false;
+
+        for (uint32 c = 0; c < channelCount; c++)
+            mean[c] /= static_cast<float>(count);
+
+        float covariance[4][4] = {};
+        for (uint32 i = 0; i < 16; i++)
+        {
+            if (!included[i])
+                continue;
+
+            float offset[4] = {};
+            for (uint32 c = 0; c < channelCount; c++)
+                offset[c] = block[i * 4 + c] - mean[c];
+
+            for (uint32 a = 0; a < channelCount; a++)
+                for (uint32 b = 0; b < channelCount; b++)
+                    covariance[a][b] += offset[a] * offset[b];
+        }
+
+        // Starting from the channel with the most variance avoids starting perpendicular to the axis
+        uint32 widestChannel = 0;
+        for (uint32 c = 1; c < channelCount; c++)
+        {
+            if (covariance[c][c] > covariance[widestChannel][widestChannel])
+                widestChannel = c;
+        }
+
+        float axis[4] = {};
+        axis[widestChannel] = 1.0f;
+
+        for (uint32 iteration = 0; iteration < 8; iteration++)
+        {
+            float next[4] = {};
+            float largest = 0.0f;
+
+            for (uint32 a = 0; a < channelCount; a++)
+            {
+                for (uint32 b = 0; b < channelCount; b++)
+                    next[a] += covariance[a][b] * axis[b];
+
+                largest = Math::Max(largest, std::abs(next[a]));
+            }
+
+            // Every pixel is the same color, so any axis will do
+            if (largest < 1e-6f)
+                break;
+
+            for (uint32 c = 0; c < channelCount; c++)
+                axis[c] = next[c] / largest;
+        }
+
+        float axisLengthSquared = 0.0f;
+        for (uint32 c = 0; c < channelCount; c++)
+            axisLengthSquared += axis[c] * axis[c];
+
+        float minProjection = FLT_MAX;
+        float maxProjection = -FLT_MAX;
+
+        for (uint32 i = 0; i < 16; i++)
+        {
+            if (!included[i])
+                continue;
+
+            float projection = 0.0f;
+            for (uint32 c = 0; c < channelCount; c++)
+                projection += (block[i * 4 + c] - mean[c]) * axis[c];
+
+            minProjection = Math::Min(minProjection, projection);
+            maxProjection = Math::Max(maxProjection, projection);
+        }
+
+        for (uint32 c = 0; c < channelCount; c++)
+        {
+            outLow[c] = Math::Clamp(mean[c] + axis[c] * minProjection / axisLengthSquared, 0.0f, 255.0f);
+            outHigh[c] = Math::Clamp(mean[c] + axis[c] * maxProjection / axisLengthSquared, 0.0f, 255.0f);
+        }
+
+        return true;
+    }
+
+    /// @brief Quantizes a color to 5 bits of red, 6 bits of green, and 5 bits of blue
+    /// @param color The color
+    /// @return The packed color
+    static uint16 PackColor565(const float* color)
+    {
+        const uint32 r = static_cast<uint32>(color[0] * 31.0f / 255.0f + 0.5f);
+        const uint32 g = static_cast<uint32>(color[1] * 63.0f / 255.0f + 0.5f);
+        const uint32 b = static_cast<uint32>(color[2] * 31.0f / 255.0f + 0.5f);
+
+        return static_cast<uint16>((r << 11) | (g << 5) | b);
+    }
+
+    /// @brief Expands a packed 565 color to 8 bits per channel, as the GPU decodes it
+    /// @param color The packed color
+    /// @param outColor Will be set to the red, green, and blue channels
+    static void UnpackColor565(uint16 color, int32* outColor)
+    {
+        const int32 r = (color >> 11) & 31;
+        const int32 g = (color >> 5) & 63;
+        const int32 b = color & 31;
+
+        outColor[0] = (r << 3) | (r >> 2);
+        outColor[1] = (g << 2) | (g >> 4);
+        outColor[2] = (b << 3) | (b >> 2);
+    }
+
+    /// @brief Quantizes a BC7 mode 6 endpoint to 7 bits per channel with a shared lowest bit, choosing the shared bit with the least error
+    /// @param endpoint The endpoint
+    /// @param outEndpoint Will be set to the 7 bit channels
+    /// @param outPBit Will be set to the shared bit
+    static void QuantizeBC7Endpoint(const float* endpoint, int32* outEndpoint, int32& outPBit)
+    {
+        float bestError = FLT_MAX;
+
+        for (int32 pBit = 0; pBit < 2; pBit++)
+        {
+            int32 quantized[4];
+            float error = 0.0f;
+
+            for (uint32 c = 0; c < 4; c++)
+            {
+                quantized[c] = Math::Clamp(static_cast<int32>((endpoint[c] - pBit) * 0.5f + 0.5f), 0, 127);
+                const float difference = static_cast<float>((quantized[c] << 1) | pBit) - endpoint[c];
+                error += difference * difference;
+            }
+
+            if (error < bestError)
+            {
+                bestError = error;
+                outPBit = pBit;
+                memcpy(outEndpoint, quantized, sizeof(quantized));
+            }
+        }
+    }
+
+    /// @brief Writes bits to a block, starting from the lowest bit of the first byte
+    /// @param block The block, which must start zeroed
+    /// @param bitOffset The offset of the next bit to write. Will be advanced past the written bits
+    /// @param value The value to write
+    /// @param bitCount The number of bits of the value to write
+    static void WriteBlockBits(uint8* block, uint32& bitOffset, uint32 value, uint32 bitCount)
+    {
+        for (uint32 i = 0; i < bitCount; i++, bitOffset++)
+        {
+            if ((value >> i) & 1)
+                block[bitOffset / 8] |= static_cast<uint8>(1 << (bitOffset % 8));
+        }
+    }
+
+    /// @brief Encodes every mip level of an image, generating each level from the one before it
+    /// @param format The compressed pixel format to encode to
+    /// @param colorSpace The color space of the pixels
+    /// @param rgbaPixels The RGBA8 pixels of the current mip level
+    /// @param width The width of the current mip level
+    /// @param height The height of the current mip level
+    /// @param remainingMips The number of mip levels left to encode, including the current level
+    /// @param outBlocks The array to append the encoded mip levels to
+    static void AppendMipChain(ImagePixelFormat format, ImageColorSpace colorSpace, Span<const uint8> rgbaPixels, uint32 width, uint32 height,
+        uint32 remainingMips, Array<uint8>& outBlocks)
+    {
+        Array<uint8> blocks = BCnEncoder::Encode(format, rgbaPixels, width, height);
+        outBlocks.AppendRange(blocks);
+
+        if (remainingMips <= 1)
+            return;
+
+        Array<uint8> nextPixels = BCnEncoder::Downsample(colorSpace, rgbaPixels, width, height);
+        AppendMipChain(format, colorSpace, nextPixels, ImageDescription::GetMipSize(width, 1), ImageDescription::GetMipSize(height, 1),
+            remainingMips - 1, outBlocks);
+    }
+
+    Array<uint8> BCnEncoder::Encode(ImagePixelFormat format, Span<const uint8> rgbaPixels, uint32 width, uint32 height)
+    {
+        COCO_ASSERT(ImageDescription::IsCompressed(format), "Format %d is not block compressed", static_cast<int>(format));
+        COCO_ASSERT(rgbaPixels.size() >= static_cast<uint64>(width) * height * 4, "Pixel data is smaller than the image");
+
+        const uint64 blockSize = ImageDescription::GetCompressedBlockSize(format);
+        const uint32 blocksWide = (width + 3) / 4;
+        const uint32 blocksHigh = (height + 3) / 4;
+
+        Array<uint8> blocks(static_cast<uint64>(blocksWide) * blocksHigh * blockSize, 0);
+        uint8 block[64];
+
+        for (uint32 blockY = 0; blockY < blocksHigh; blockY++)
+        {
+            for (uint32 blockX = 0; blockX < blocksWide; blockX++)
+            {
+                for (uint32 y = 0; y < 4; y++)
+                {
+                    const uint64 sourceY = Math::Min(blockY * 4 + y, height - 1);
+
+                    for (uint32 x = 0; x < 4; x++)
+                    {
+                        const uint64 sourceX = Math::Min(blockX * 4 + x, width - 1);
+                        memcpy(block + (y * 4 + x) * 4, rgbaPixels.data() + (sourceY * width + sourceX) * 4, 4);
+                    }
+                }
+
+                uint8* outBlock = blocks.Data() + (static_cast<uint64>(blockY) * blocksWide + blockX) * blockSize;
+
+                switch (format)
+                {
+                    case ImagePixelFormat::BC1_RGBA:
+                        EncodeBC1Block(block, true, outBlock);
+                        break;
+                    case ImagePixelFormat::BC3_RGBA:
+                        EncodeBC4Block(block, 3, outBlock);
+                        EncodeBC1Block(block, false, outBlock + 8);
+                        break;
+                    case ImagePixelFormat::BC5_RG:
+                        EncodeBC4Block(block, 0, outBlock);
+                        EncodeBC4Block(block, 1, outBlock + 8);
+                        break;
+                    case ImagePixelFormat::BC7_RGBA:
+                        EncodeBC7Block(block, outBlock);
+                        break;
+                    default:
+                        break;
+                }
+            }
+        }
+
+        return blocks;
+    }
+
+    Array<uint8> BCnEncoder::EncodeMipChain(ImagePixelFormat format, ImageColorSpace colorSpace, Span<const uint8> rgbaPixels, uint32 width,
+        uint32 height, uint32 mipCount)
+    {
+        Array<uint8> blocks;
+        AppendMipChain(format, colorSpace, rgbaPixels, width, height, Math::Max<uint32>(mipCount, 1), blocks);
+        return blocks;
+    }
+
+    Array<uint8> BCnEncoder::Downsample(ImageColorSpace colorSpace, Span<const uint8> rgbaPixels, uint32 width, uint32 height)
+    {
+        COCO_ASSERT(rgbaPixels.size() >= static_cast<uint64>(width) * height * 4, "Pixel data is smaller than the image");
+
+        const uint32 mipWidth = ImageDescription::GetMipSize(width, 1);
+        const uint32 mipHeight = ImageDescription::GetMipSize(height, 1);
+        const bool isSRGB = colorSpace == ImageColorSpace::sRGB;
+
+        Array<uint8> mipPixels(static_cast<uint64>(mipWidth) * mipHeight * 4, 0);
+
+        for (uint32 y = 0; y < mipHeight; y++)
+        {
+            for (uint32 x = 0; x < mipWidth; x++)
+            {
+                float sum[4] = {};
+
+                // Odd sizes repeat the last row or column rather than reading past the edge
+                for (uint32 sampleY = 0; sampleY < 2; sampleY++)
+                {
+                    const uint64 sourceY = Math::Min(y * 2 + sampleY, height - 1);
+
+                    for (uint32 sampleX = 0; sampleX < 2; sampleX++)
+                    {
+                        const uint64 sourceX = Math::Min(x * 2 + sampleX, width - 1);
+                        const uint8* pixel = rgbaPixels.data() + (sourceY * width + sourceX) * 4;
+
+                        for (uint32 c = 0; c < 3; c++)
+                            sum[c] += isSRGB ? SRGBToLinear(pixel[c]) : pixel[c] / 255.0f;
+
+                        // Alpha is always linear
+                        sum[3] += pixel[3] / 255.0f;
+                    }
+                }
+
+                uint8* outPixel = mipPixels.Data() + (static_cast<uint64>(y) * mipWidth + x) * 4;
+
+                for (uint32 c = 0; c < 4; c++)
+                {
+                    const float average = sum[c] * 0.25f;
+
+                    if (isSRGB && c < 3)
+                        outPixel[c] = LinearToSRGB(average);
+                    else
+                        outPixel[c] = static_cast<uint8>(Math::Clamp(average * 255.0f + 0.5f, 0.0f, 255.0f));
+                }
+            }
+        }
+
+        return mipPixels;
+    }
+
+    void BCnEncoder::EncodeBC1Block(const uint8* block, bool allowTransparency, uint8* outBlock)
+    {
+        bool included[16];
+        bool hasTransparency = false;
+
+        // Transparent pixels use the transparent index, so they are left out of the endpoint fit
+        for (uint32 i = 0; i < 16; i++)
+        {
+            included[i] = !allowTransparency || block[i * 4 + 3] >= 128;
+            hasTransparency |= !included[i];
+        }
+
+        float low[4];
+        float high[4];
+        if (!FitEndpoints(block, included, 3, low, high))
+        {
+            // Every pixel is transparent
+            memset(outBlock, 0, 4);
+            memset(outBlock + 4, 0xFF, 4);
+            return;
+        }
+
+        uint16 color0 = PackColor565(high);
+        uint16 color1 = PackColor565(low);
+
+        // The endpoint order selects the mode: 4 colors if color0 > color1, otherwise 3 colors and a transparent index
+        if (hasTransparency ? color0 > color1 : color0 < color1)
+        {
+            const uint16 temp = color0;
+            color0 = color1;
+            color1 = temp;
+        }
+
+        const bool fourColorMode = color0 > color1;
+        const uint32 paletteSize = fourColorMode ? 4 : 3;
+
+        int32 palette[4][3] = {};
+        UnpackColor565(color0, palette[0]);
+        UnpackColor565(color1, palette[1]);
+
+        for (uint32 c = 0; c < 3; c++)
+        {
+            if (fourColorMode)
+            {
+                palette[2][c] = (2 * palette[0][c] + palette[1][c]) / 3;
+                palette[3][c] = (palette[0][c] + 2 * palette[1][c]) / 3;
+            }
+            else
+            {
+                palette[2][c] = (palette[0][c] + palette[1][c]) / 2;
+            }
+        }
+
+        uint32 indices = 0;
+        for (uint32 i = 0; i < 16; i++)
+        {
+            uint32 index = 3;
+
+            if (included[i])
+            {
+                int32 bestError = INT32_MAX;
+
+                for (uint32 p = 0; p < paletteSize; p++)
+                {
+                    int32 error = 0;
+                    for (uint32 c = 0; c < 3; c++)
+                    {
+                        const int32 difference = block[i * 4 + c] - palette[p][c];
+                        error += difference * difference;
+                    }
+
+                    if (error < bestError)
+                    {
+                        bestError = error;
+                        index = p;
+                    }
+                }
+            }
+
+            indices |= index << (i * 2);
+        }
+
+        outBlock[0] = static_cast<uint8>(color0 & 0xFF);
+        outBlock[1] = static_cast<uint8>(color0 >> 8);
+        outBlock[2] = static_cast<uint8>(color1 & 0xFF);
+        outBlock[3] = static_cast<uint8>(color1 >> 8);
+
+        for (uint32 b = 0; b < 4; b++)
+            outBlock[4 + b] = static_cast<uint8>((indices >> (b * 8)) & 0xFF);
+    }
+
+    void BCnEncoder::EncodeBC4Block(const uint8* block, uint32 channel, uint8* outBlock)
+    {
+        int32 minValue = 255;
+        int32 maxValue = 0;
+
+        for (uint32 i = 0; i < 16; i++)
+        {
+            minValue = Math::Min<int32>(minValue, block[i * 4 + channel]);
+            maxValue = Math::Max<int32>(maxValue, block[i * 4 + channel]);
+        }
+
+        // With the first endpoint larger, the block interpolates 6 values between the endpoints
+        int32 palette[8];
+        palette[0] = maxValue;
+        palette[1] = minValue;
+
+        for (int32 p = 2; p < 8; p++)
+            palette[p] = ((8 - p) * maxValue + (p - 1) * minValue) / 7;
+
+        uint64 indices = 0;
+        for (uint32 i = 0; i < 16; i++)
+        {
+            const int32 value = block[i * 4 + channel];
+            uint64 index = 0;
+            int32 bestError = INT32_MAX;
+
+            for (uint32 p = 0; p < 8; p++)
+            {
+                const int32 error = Math::Abs(value - palette[p]);
+                if (error < bestError)
+                {
+                    bestError = error;
+                    index = p;
+                }
+            }
+
+            indices |= index << (i * 3);
+        }
+
+        outBlock[0] = static_cast<uint8>(maxValue);
+        outBlock[1] = static_cast<uint8>(minValue);
+
+        for (uint32 b = 0; b < 6; b++)
+            outBlock[2 + b] = static_cast<uint8>((indices >> (b * 8)) & 0xFF);
+    }
+
+    void BCnEncoder::EncodeBC7Block(const uint8* block, uint8* outBlock)
+    {
+        bool included[16];
+        for (uint32 i = 0; i < 16; i++)
+            included[i] = true;
+
+        float low[4];
+        float high[4];
+        FitEndpoints(block, included, 4, low, high);
+
+        int32 endpoints[2][4];
+        int32 pBits[2];
+        QuantizeBC7Endpoint(low, endpoints[0], pBits[0]);
+        QuantizeBC7Endpoint(high, endpoints[1], pBits[1]);
+
+        int32 expanded[2][4];
+        for (uint32 e = 0; e < 2; e++)
+            for (uint32 c = 0; c < 4; c++)
+                expanded[e][c] = (endpoints[e][c] << 1) | pBits[e];
+
+        uint32 indices[16];
+        for (uint32 i = 0; i < 16; i++)
+        {
+            int32 bestError = INT32_MAX;
+
+            for (uint32 w = 0; w < 16; w++)
+            {
+                int32 error = 0;
+                for (uint32 c = 0; c < 4; c++)
+                {
+                    const int32 value = ((64 - _bc7Weights[w]) * expanded[0][c] + _bc7Weights[w] * expanded[1][c] + 32) >> 6;
+                    const int32 difference = block[i * 4 + c] - value;
+                    error += difference * difference;
+                }
+
+                if (error < bestError)
+                {
+                    bestError = error;
+                    indices[i] = w;
+                }
+            }
+        }
+
+        // The highest bit of the first index isn't stored, so the endpoints are swapped if it would be set
+        if (indices[0] & 8)
+        {
+            for (uint32 c = 0; c < 4; c++)
+            {
+                const int32 temp = endpoints[0][c];
+                endpoints[0][c] = endpoints[1][c];
+                endpoints[1][c] = temp;
+            }
+
+            const int32 tempPBit = pBits[0];
+            pBits[0] = pBits[1];
+            pBits[1] = tempPBit;
+
+            for (uint32 i = 0; i < 16; i++)
+                indices[i] = 15 - indices[i];
+        }
+
+        memset(outBlock, 0, 16);
+        uint32 bitOffset = 0;
+
+        // Mode 6 is selected by 6 zero bits followed by a set bit
+        WriteBlockBits(outBlock, bitOffset, 1 << 6, 7);
+
+        for (uint32 c = 0; c < 4; c++)
+            for (uint32 e = 0; e < 2; e++)
+                WriteBlockBits(outBlock, bitOffset, static_cast<uint32>(endpoints[e][c]), 7);
+
+        WriteBlockBits(outBlock, bitOffset, static_cast<uint32>(pBits[0]), 1);
+        WriteBlockBits(outBlock, bitOffset, static_cast<uint32>(pBits[1]), 1);
+        WriteBlockBits(outBlock, bitOffset, indices[0], 3);
+
+        for (uint32 i = 1; i < 16; i++)
+            WriteBlockBits(outBlock, bitOffset, indices[i], 4);
+    }
+} // Coc
\ No newline at end of file
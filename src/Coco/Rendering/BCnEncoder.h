@@ -0,0 +1,63 @@
+//
+// Created by cullen on 10/18/26.
+//
+
+#ifndef COCOENGINE_BCNENCODER_H
+#define COCOENGINE_BCNENCODER_H
+#include "Coco/Core/Types/Array.h"
+#include "Coco/Core/Types/Span.h"
+#include "Graphics/Resources/ImageTypes.h"
+
+namespace Coco
+{
+    /// @brief Compresses RGBA8 pixels into BC1, BC3, BC5, and BC7 blocks on the CPU. Intended to run when textures are cooked, as it is too slow to run at load time
+    class BCnEncoder
+    {
+    public:
+        /// @brief Encodes a single mip level. Pixels past the right and bottom edges of partial blocks repeat the edge pixels
+        /// @param format The compressed pixel format to encode to
+        /// @param rgbaPixels The RGBA8 pixels, with tightly packed rows
+        /// @param width The width of the image
+        /// @param height The height of the image
+        /// @return The encoded blocks, with rows of blocks in the same order as the rows of pixels
+        static Array<uint8> Encode(ImagePixelFormat format, Span<const uint8> rgbaPixels, uint32 width, uint32 height);
+
+        /// @brief Encodes an image and each of its mip levels, which are generated with a box filter
+        /// @param format The compressed pixel format to encode to
+        /// @param colorSpace The color space of the pixels. sRGB pixels are filtered in linear space
+        /// @param rgbaPixels The RGBA8 pixels of the first mip level, with tightly packed rows
+        /// @param width The width of the image
+        /// @param height The height of the image
+        /// @param mipCount The number of mip levels to encode, including the first
+        /// @return The encoded mip levels, tightly packed from the largest level
+        static Array<uint8> EncodeMipChain(ImagePixelFormat format, ImageColorSpace colorSpace, Span<const uint8> rgbaPixels, uint32 width, uint32 height, uint32 mipCount);
+
+        /// @brief Generates the next mip level of RGBA8 pixels with a 2x2 box filter
+        /// @param colorSpace The color space of the pixels. sRGB pixels are filtered in linear space
+        /// @param rgbaPixels The RGBA8 pixels, with tightly packed rows
+        /// @param width The width of the image
+        /// @param height The height of the image
+        /// @return The pixels of the next mip level, which is half the size of the image
+        static Array<uint8> Downsample(ImageColorSpace colorSpace, Span<const uint8> rgbaPixels, uint32 width, uint32 height);
+
+    private:
+        /// @brief Encodes a BC1 color block
+        /// @param block The 16 RGBA8 pixels of the block
+        /// @param allowTransparency If true, pixels with an alpha below 128 are encoded as transparent
+        /// @param outBlock Will be filled with the 8 byte block
+        static void EncodeBC1Block(const uint8* block, bool allowTransparency, uint8* outBlock);
+
+        /// @brief Encodes a single channel of a block as a BC4 block, which is used for BC3 alpha and both BC5 channels
+        /// @param block The 16 RGBA8 pixels of the block
+        /// @param channel The channel to encode
+        /// @param outBlock Will be filled with the 8 byte block
+        static void EncodeBC4Block(const uint8* block, uint32 channel, uint8* outBlock);
+
+        /// @brief Encodes a BC7 block using mode 6, which fits a single line through the RGBA colors of the block
+        /// @param block The 16 RGBA8 pixels of the block
+        /// @param outBlock Will be filled with the 16 byte block
+        static void EncodeBC7Block(const uint8* block, uint8* outBlock);
+    };
+} // Coco
+
+#endif //COCOENGINE_BCNENCODER_H
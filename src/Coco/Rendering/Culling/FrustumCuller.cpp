@@ -0,0 +1,201 @@
+//
+// Created by cullen on 10/18/26.
+//
+
+#include "FrustumCuller.h"
+#include "Coco/Rendering/WorkerPool.h"
+
+#include <atomic>
+#include <limits>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define COCO_FRUSTUM_CULLER_SSE
+#include <emmintrin.h>
+#endif
+
+namespace Coco
+{
+    FrustumCuller::FrustumCuller(Allocator* allocator, uint64 initialCapacity, WorkerPool* workerPool) :
+        _workerPool(workerPool),
+        _centerX(allocator, initialCapacity),
+        _centerY(allocator, initialCapacity),
+        _centerZ(allocator, initialCapacity),
+        _extentX(allocator, initialCapacity),
+        _extentY(allocator, initialCapacity),
+        _extentZ(allocator, initialCapacity),
+        _visibility(allocator, initialCapacity)
+    {}
+
+    void FrustumCuller::AddBounds(const BoundingBox& worldBounds)
+    {
+        if (worldBounds.IsInfinite())
+        {
+            // Keep the extents finite so the plane test never produces NaNs
+            constexpr float max = std::numeric_limits<float>::max();
+
+            _centerX.Append(0.0f);
+            _centerY.Append(0.0f);
+            _centerZ.Append(0.0f);
+            _extentX.Append(max);
+            _extentY.Append(max);
+            _extentZ.Append(max);
+        }
+        else
+        {
+            const Vector3 center = worldBounds.GetCenter();
+            const Vector3 extents = worldBounds.GetExtents();
+
+            _centerX.Append(center.X());
+            _centerY.Append(center.Y());
+            _centerZ.Append(center.Z());
+            _extentX.Append(extents.X());
+            _extentY.Append(extents.Y());
+            _extentZ.Append(extents.Z());
+        }
+
+        _visibility.Append(1);
+    }
+
+    void FrustumCuller::Clear()
+    {
+        _centerX.Clear();
+        _centerY.Clear();
+        _centerZ.Clear();
+        _extentX.Clear();
+        _extentY.Clear();
+        _extentZ.Clear();
+        _visibility.Clear();
+    }
+
+    void FrustumCuller::GetBounds(uint64 index, Vector3& outCenter, Vector3& outExtents) const
+    {
+        outCenter = Vector3(_centerX[index], _centerY[index], _centerZ[index]);
+        outExtents = Vector3(_extentX[index], _extentY[index], _extentZ[index]);
+    }
+
+    uint64 FrustumCuller::Cull(const ViewFrustum& frustum, uint64 startIndex, uint64 count)
+    {
+        COCO_ASSERT(startIndex + count <= GetCount(), "Cull range is out of bounds");
+
+        const uint64 batchCount = (count + BatchSize - 1) / BatchSize;
+
+        if (!_workerPool || batchCount < MinParallelBatchCount)
+        {
+            uint64 culledCount = 0;
+
+            for (uint64 batchStart = startIndex; batchStart < startIndex + count; batchStart += BatchSize)
+            {
+                culledCount += CullBatch(frustum, batchStart, Math::Min(BatchSize, startIndex + count - batchStart));
+            }
+
+            return culledCount;
+        }
+
+        std::atomic<uint64> culledCount = 0;
+
+        _workerPool->ParallelFor(batchCount, [&](uint64 batchIndex)
+        {
+            const uint64 batchStart = startIndex + batchIndex * BatchSize;
+            culledCount.fetch_add(CullBatch(frustum, batchStart, Math::Min(BatchSize, startIndex + count - batchStart)), std::memory_order_relaxed);
+        });
+
+        return culledCount.load();
+    }
+
+    uint64 FrustumCuller::CullBatch(const ViewFrustum& frustum, uint64 startIndex, uint64 count)
+    {
+        const float* cx = _centerX.Data();
+        const float* cy = _centerY.Data();
+        const float* cz = _centerZ.Data();
+        const float* ex = _extentX.Data();
+        const float* ey = _extentY.Data();
+        const float* ez = _extentZ.Data();
+        uint8* visibility = _visibility.Data();
+
+        const uint64 endIndex = startIndex + count;
+        uint64 i = startIndex;
+        uint64 culledCount = 0;
+
+#ifdef COCO_FRUSTUM_CULLER_SSE
+        __m128 planeX[ViewFrustum::PlaneCount];
+        __m128 planeY[ViewFrustum::PlaneCount];
+        __m128 planeZ[ViewFrustum::PlaneCount];
+        __m128 planeW[ViewFrustum::PlaneCount];
+        __m128 absPlaneX[ViewFrustum::PlaneCount];
+        __m128 absPlaneY[ViewFrustum::PlaneCount];
+        __m128 absPlaneZ[ViewFrustum::PlaneCount];
+
+        for (uint8 p = 0; p < ViewFrustum::PlaneCount; p++)
+        {
+            const Vector4& plane = frustum.Planes[p];
+            planeX[p] = _mm_set1_ps(plane.X());
+            planeY[p] = _mm_set1_ps(plane.Y());
+            planeZ[p] = _mm_set1_ps(plane.Z());
+            planeW[p] = _mm_set1_ps(plane.W());
+            absPlaneX[p] = _mm_set1_ps(Math::Abs(plane.X()));
+            absPlaneY[p] = _mm_set1_ps(Math::Abs(plane.Y()));
+            absPlaneZ[p] = _mm_set1_ps(Math::Abs(plane.Z()));
+        }
+
+        const __m128 zero = _mm_setzero_ps();
+
+        // Test four boxes at a time against every plane
+        for (; i + 4 <= endIndex; i += 4)
+        {
+            const __m128 centerX = _mm_loadu_ps(cx + i);
+            const __m128 centerY = _mm_loadu_ps(cy + i);
+            const __m128 centerZ = _mm_loadu_ps(cz + i);
+            const __m128 extentX = _mm_loadu_ps(ex + i);
+            const __m128 extentY = _mm_loadu_ps(ey + i);
+            const __m128 extentZ = _mm_loadu_ps(ez + i);
+
+            __m128 outside = zero;
+
+            for (uint8 p = 0; p < ViewFrustum::PlaneCount; p++)
+            {
+                __m128 distance = _mm_add_ps(_mm_mul_ps(planeX[p], centerX), planeW[p]);
+                distance = _mm_add_ps(distance, _mm_mul_ps(planeY[p], centerY));
+                distance = _mm_add_ps(distance, _mm_mul_ps(planeZ[p], centerZ));
+
+                __m128 radius = _mm_mul_ps(absPlaneX[p], extentX);
+                radius = _mm_add_ps(radius, _mm_mul_ps(absPlaneY[p], extentY));
+                radius = _mm_add_ps(radius, _mm_mul_ps(absPlaneZ[p], extentZ));
+
+                // distance < -radius is equivalent to distance + radius < 0
+                outside = _mm_or_ps(outside, _mm_cmplt_ps(_mm_add_ps(distance, radius), zero));
+            }
+
+            const int outsideMask = _mm_movemask_ps(outside);
+
+            for (uint8 lane = 0; lane < 4; lane++)
+            {
+                const bool isOutside = (outsideMask >> lane) & 1;
+                visibility[i + lane] = isOutside ? 0 : 1;
+                culledCount += isOutside;
+            }
+        }
+#endif
+
+        for (; i < endIndex; i++)
+        {
+            bool isOutside = false;
+
+            for (const auto& plane : frustum.Planes)
+            {
+                const float distance = plane.X() * cx[i] + plane.Y() * cy[i] + plane.Z() * cz[i] + plane.W();
+                const float radius = Math::Abs(plane.X()) * ex[i] + Math::Abs(plane.Y()) * ey[i] + Math::Abs(plane.Z()) * ez[i];
+
+                if (distance + radius < 0.0f)
+                {
+                    isOutside = true;
+                    break;
+                }
+            }
+
+            visibility[i] = isOutside ? 0 : 1;
+            culledCount += isOutside;
+        }
+
+        return culledCount;
+    }
+} // Coco
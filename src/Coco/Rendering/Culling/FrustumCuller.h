@@ -0,0 +1,82 @@
+//
+// Created by cullen on 10/18/26.
+//
+
+#ifndef COCOENGINE_FRUSTUMCULLER_H
+#define COCOENGINE_FRUSTUMCULLER_H
+#include "ViewFrustum.h"
+
+#include "Coco/Core/Types/Array.h"
+
+namespace Coco
+{
+    class WorkerPool;
+
+    /// @brief Stores world-space bounding boxes as structure-of-arrays and tests them against a ViewFrustum in batches
+    class FrustumCuller
+    {
+    public:
+        /// @brief The number of bounds tested per batch. Batches touch disjoint ranges of data, so they can be distributed across worker threads
+        static constexpr uint64 BatchSize = 256;
+
+        /// @brief The number of bytes stored for each set of bounds
+        static constexpr uint64 BytesPerBounds = sizeof(float) * 6 + sizeof(uint8);
+
+        /// @brief The fewest batches a cull needs before they are split across worker threads. Smaller culls finish faster than waking the workers
+        static constexpr uint64 MinParallelBatchCount = 4;
+
+        /// @brief Creates a frustum culler
+        /// @param allocator The allocator for the bounds
+        /// @param initialCapacity The number of bounds to reserve space for
+        /// @param workerPool The worker pool to distribute batches across. If null, every batch is tested on the calling thread
+        FrustumCuller(Allocator* allocator, uint64 initialCapacity, WorkerPool* workerPool);
+
+        /// @brief Gets the number of bounds stored
+        /// @return The number of bounds
+        uint64 GetCount() const { return _visibility.GetCount(); }
+
+        /// @brief Adds world-space bounds. Bounds are visible until they are culled
+        /// @param worldBounds The world-space bounding box
+        void AddBounds(const BoundingBox& worldBounds);
+
+        /// @brief Clears all stored bounds
+        void Clear();
+
+        /// @brief Tests a range of bounds against a frustum, split into batches of BatchSize that are distributed across the worker pool
+        /// @param frustum The frustum
+        /// @param startIndex The index of the first bounds to test
+        /// @param count The number of bounds to test
+        /// @return The number of bounds that were culled
+        uint64 Cull(const ViewFrustum& frustum, uint64 startIndex, uint64 count);
+
+        /// @brief Tests a single batch of bounds against a frustum. Safe to call concurrently for non-overlapping ranges
+        /// @param frustum The frustum
+        /// @param startIndex The index of the first bounds to test
+        /// @param count The number of bounds to test
+        /// @return The number of bounds that were culled
+        uint64 CullBatch(const ViewFrustum& frustum, uint64 startIndex, uint64 count);
+
+        /// @brief Gets the bounds at the given index
+        /// @param index The index of the bounds
+        /// @param outCenter Will be set to the center of the bounds
+        /// @param outExtents Will be set to the extents of the bounds
+        void GetBounds(uint64 index, Vector3& outCenter, Vector3& outExtents) const;
+
+        /// @brief Determines if the bounds at the given index passed the last cull
+        /// @param index The index of the bounds
+        /// @return True if the bounds are visible
+        bool IsVisible(uint64 index) const { return _visibility[index] != 0; }
+
+    private:
+        WorkerPool* _workerPool;
+        Array<float> _centerX;
+        Array<float> _centerY;
+        Array<float> _centerZ;
+        Array<float> _extentX;
+        Array<float> _extentY;
+        Array<float> _extentZ;
+        Array<uint8> _visibility;
+    };
+} // Coco
+
+#endif //COCOENGINE_FRUSTUMCULLER_H
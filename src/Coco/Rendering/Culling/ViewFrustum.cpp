@@ -0,0 +1,59 @@
+//
+// Created by cullen on 10/18/26.
+//
+
+#include "ViewFrustum.h"
+
+namespace Coco
+{
+    ViewFrustum::ViewFrustum() :
+        Planes()
+    {}
+
+    ViewFrustum ViewFrustum::FromViewProjection(const Matrix4x4& viewProjection)
+    {
+        // https://www.gamedevs.org/uploads/fast-extraction-viewing-frustum-planes-from-world-view-projection-matrix.pdf
+        const Vector4& r1 = viewProjection.Row[0];
+        const Vector4& r2 = viewProjection.Row[1];
+        const Vector4& r3 = viewProjection.Row[2];
+        const Vector4& r4 = viewProjection.Row[3];
+
+        ViewFrustum frustum;
+        frustum.Planes[0] = r4 + r1; // Left
+        frustum.Planes[1] = r4 - r1; // Right
+        frustum.Planes[2] = r4 + r2; // Bottom
+        frustum.Planes[3] = r4 - r2; // Top
+        frustum.Planes[4] = r4 + r3; // Near
+        frustum.Planes[5] = r4 - r3; // Far
+
+        for (auto& plane : frustum.Planes)
+        {
+            float length = plane.XYZ().GetLength();
+
+            if (!Math::IsZero(length))
+                plane /= length;
+        }
+
+        return frustum;
+    }
+
+    bool ViewFrustum::Intersects(const BoundingBox& box) const
+    {
+        if (box.IsInfinite())
+            return true;
+
+        const Vector3 center = box.GetCenter();
+        const Vector3 extents = box.GetExtents();
+
+        for (const auto& plane : Planes)
+        {
+            const float distance = plane.X() * center.X() + plane.Y() * center.Y() + plane.Z() * center.Z() + plane.W();
+            const float radius = Math::Abs(plane.X()) * extents.X() + Math::Abs(plane.Y()) * extents.Y() + Math::Abs(plane.Z()) * extents.Z();
+
+            if (distance < -radius)
+                return false;
+        }
+
+        return true;
+    }
+} // Coco
@@ -0,0 +1,37 @@
+//
+// Created by cullen on 10/18/26.
+//
+
+#ifndef COCOENGINE_VIEWFRUSTUM_H
+#define COCOENGINE_VIEWFRUSTUM_H
+#include "Coco/Core/Math/BoundingBox.h"
+#include "Coco/Core/Math/Matrix4x4.h"
+#include "Coco/Core/Math/Vector4.h"
+
+namespace Coco
+{
+    /// @brief A set of six planes that bound the visible volume of a camera
+    struct ViewFrustum
+    {
+        /// @brief The number of planes in a frustum
+        static constexpr uint8 PlaneCount = 6;
+
+        /// @brief The frustum planes, stored as (normal.x, normal.y, normal.z, distance). Normals point into the frustum
+        Vector4 Planes[PlaneCount];
+
+        ViewFrustum();
+
+        /// @brief Extracts the frustum planes from a combined view-projection matrix.
+        /// The near plane is extracted for a [-1, 1] depth range, which is a conservative superset of a [0, 1] depth range
+        /// @param viewProjection The view-projection matrix (projection * view)
+        /// @return The frustum
+        static ViewFrustum FromViewProjection(const Matrix4x4& viewProjection);
+
+        /// @brief Determines if a box is at least partially inside this frustum
+        /// @param box The box
+        /// @return True if the box is not fully outside any of the planes
+        bool Intersects(const BoundingBox& box) const;
+    };
+} // Coco
+
+#endif //COCOENGINE_VIEWFRUSTUM_H
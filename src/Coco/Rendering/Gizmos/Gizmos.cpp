@@ -90,9 +90,8 @@ namespace Coco
 
             const auto& dc = _drawCalls[i];
             GizmoObjectData obj{dc.Transform, dc.DrawColor};
-            scene.StoreData(objID, true, obj);
-
-            scene.AddObject(objID, 0, 0.0f, *_mesh, dc.SubmeshID);
+            RenderObject& object = scene.AddObject(objID, 0, 0.0f, *_mesh, dc.Transform, dc.SubmeshID);
+            scene.SetObjectData(object, obj);
         }
 
         graph.CreateRenderPassObject<GizmosRenderPass>("Gizmos");
@@ -44,10 +44,10 @@ namespace Coco
 
         for (auto renderObject : sceneData.GetRenderObjectView())
         {
-            if (!sceneData.HasData<GizmoObjectData>(renderObject.ID, true))
+            auto objData = sceneData.GetObjectData<GizmoObjectData>(renderObject);
+            if (!objData)
                 continue;
 
-            auto objData = sceneData.GetData<GizmoObjectData>(renderObject.ID, true);
             ctx.SetDrawData(objData, sizeof(GizmoObjectData), Span<const SharedPtr<Texture>>());
 
             ctx.DrawObject(renderObject);
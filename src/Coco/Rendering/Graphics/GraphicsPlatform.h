@@ -9,9 +9,11 @@
 #include "MeshStorage.h"
 #include "RenderFrame.h"
 #include "StagingBuffer.h"
+#include "UploadScheduler.h"
 #include "Coco/Core/Memory/Refs.h"
 #include "Coco/Rendering/ShaderTypes.h"
 #include "Resources/ImageSamplerTypes.h"
+#include "Resources/TransientMemory.h"
 
 namespace Coco
 {
@@ -38,16 +40,25 @@ namespace Coco
 
         virtual Ref<RenderContext> CreateRenderContext() = 0;
         virtual Ref<Image> CreateImage(const ImageDescription& imageDescription) = 0;
+        virtual Ref<Image> CreateAliasedImage(const ImageDescription& imageDescription, Ref<TransientMemory> memory) = 0;
+        virtual Ref<TransientMemory> CreateTransientMemory(const GraphicsMemoryRequirements& requirements) = 0;
+        virtual GraphicsMemoryRequirements GetImageMemoryRequirements(const ImageDescription& imageDescription) = 0;
         virtual Ref<ImageSampler> CreateImageSampler(const ImageSamplerDescription& samplerDescription) = 0;
         virtual Ref<ShaderProgram> CreateShaderProgram(const FilePath& shaderPath) = 0;
         virtual Ref<Buffer> CreateBuffer(const BufferDescription& bufferDescription) = 0;
         virtual MeshStorage* GetMeshStorage() = 0;
         virtual StagingBuffer* GetStagingBuffer() = 0;
+        virtual UploadScheduler* GetUploadScheduler() = 0;
         virtual SlangCompiler* GetShaderProgramCompiler() = 0;
         virtual GraphicsResourceCache* GetResourceCache() = 0;
 
         virtual void InvalidateResource(uint64 resourceID) = 0;
 
+        /// @brief Releases the persistent uniform blocks of an instance, such as a material that is being destroyed.
+        /// The memory is reused once the GPU can no longer be reading it
+        /// @param instanceID The ID of the instance
+        virtual void ReleasePersistentUniforms(uint64 instanceID) = 0;
+
         RenderService* GetRenderService() { return _renderService;}
         const GraphicsDeviceDescription& GetDeviceDescription() { return _deviceDescription; }
 
@@ -9,6 +9,9 @@ namespace Coco
     GraphicsDeviceCreateParams::GraphicsDeviceCreateParams() :
         PreferredDeviceType(GraphicsDeviceType::Discrete),
         SupportPresentation(true),
-        RequireComputeCapability(false)
+        RequireComputeCapability(false),
+        EnablePipelinePrewarming(false),
+        EnableBindlessTextures(false),
+        UploadFrameBudget(1024 * 1024 * 8)
     {}
 }
@@ -24,6 +24,15 @@ namespace Coco
         bool SupportPresentation;
         bool RequireComputeCapability;
 
+        /// @brief If true, pipelines created in previous runs will be recorded and created again when their shaders are loaded
+        bool EnablePipelinePrewarming;
+
+        /// @brief If true, shaders that declare an unbounded texture array will index into a single device-wide texture table, if the device supports it
+        bool EnableBindlessTextures;
+
+        /// @brief The maximum number of bytes the upload scheduler copies to the GPU each frame
+        uint64 UploadFrameBudget;
+
         GraphicsDeviceCreateParams();
     };
 
@@ -54,6 +63,15 @@ namespace Coco
         /// @brief If true, this device supports drawing polygons in wireframe
         bool SupportsWireframe;
 
+        /// @brief If true, bindless textures were requested and this device supports them
+        bool SupportsBindlessTextures;
+
+        /// @brief If true, this device can cull objects with compute shaders and draw them with a GPU-written draw count
+        bool SupportsIndirectDrawCount;
+
+        /// @brief If true, this device can sample images with BC compressed pixel formats
+        bool SupportsBCCompression;
+
         uint32 MaxPushConstantSize;
     };
 }
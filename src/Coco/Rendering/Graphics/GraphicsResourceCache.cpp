@@ -5,49 +5,240 @@
 #include "GraphicsResourceCache.h"
 
 #include "Resources/Image.h"
+#include "Coco/Core/Engine.h"
+#include "Coco/Core/Types/Sorting/QSorter.h"
 
 namespace Coco
 {
-    GraphicsResourceCache::GraphicsResourceCache(GraphicsPlatform* platform) :
+    GraphicsResourceCacheStats::GraphicsResourceCacheStats() :
+        Hits(0),
+        Misses(0),
+        Evictions(0),
+        ResourceCount(0),
+        CachedBytes(0)
+    {}
+
+    GraphicsResourceCache::CachedResource::CachedResource(Ref<GraphicsResource> resource, CachedResourceType type, uint64 key,
+        const ImageDescription& imageDescription, const GraphicsMemoryRequirements& memoryRequirements, uint64 size, uint64 memoryID) :
+        Resource(resource),
+        Type(type),
+        Key(key),
+        ImageDesc(imageDescription),
+        MemoryRequirements(memoryRequirements),
+        Size(size),
+        MemoryID(memoryID),
+        LastUsedFrame(0),
+        InUse(false)
+    {}
+
+    GraphicsResourceCache::GraphicsResourceCache(GraphicsPlatform* platform, uint64 budget) :
         _platform(platform),
-        _images(),
-        _resourcesInUse()
+        _resources(),
+        _freeResources(),
+        _budget(budget),
+        _stats()
     {}
 
     GraphicsResourceCache::~GraphicsResourceCache()
     {
-        _resourcesInUse.Clear(true);
+        _freeResources.Clear();
 
-        for (const auto& pair : _images)
-            _platform->InvalidateResource(pair.first->GetID());
+        // Aliased images must be destroyed before the memory they are bound to
+        for (const auto& [id, resource] : _resources)
+        {
+            if (resource.Type == CachedResourceType::AliasedImage)
+                _platform->InvalidateResource(id);
+        }
+
+        for (const auto& [id, resource] : _resources)
+        {
+            if (resource.Type != CachedResourceType::AliasedImage)
+                _platform->InvalidateResource(id);
+        }
 
-        _images.Clear(true);
+        _resources.Clear();
     }
 
     Ref<Image> GraphicsResourceCache::GetOrCreateImage(const ImageDescription& imageDescription)
     {
-        int64 existingIndex = _images.Find([&](const std::pair<Ref<Image>, uint64>& item)
+        const uint64 key = Math::CombineHashes(static_cast<uint64>(CachedResourceType::Image), ToHash(imageDescription));
+
+        if (CachedResource* cached = TryAcquireFree(key, imageDescription, GraphicsMemoryRequirements()))
+            return cached->Resource.Downcast<Image>();
+
+        Ref<Image> image = _platform->CreateImage(imageDescription);
+        Add(image, CachedResourceType::Image, key, imageDescription, GraphicsMemoryRequirements(), image->GetPixelDataSize());
+        return image;
+    }
+
+    Ref<TransientMemory> GraphicsResourceCache::GetOrCreateTransientMemory(const GraphicsMemoryRequirements& requirements)
+    {
+        const uint64 key = Math::CombineHashes(
+            static_cast<uint64>(CachedResourceType::TransientMemory),
+            requirements.Size,
+            requirements.Alignment,
+            static_cast<uint64>(requirements.CompatibilityMask));
+
+        if (CachedResource* cached = TryAcquireFree(key, ImageDescription(), requirements))
+            return cached->Resource.Downcast<TransientMemory>();
+
+        Ref<TransientMemory> memory = _platform->CreateTransientMemory(requirements);
+        Add(memory, CachedResourceType::TransientMemory, key, ImageDescription(), requirements, requirements.Size);
+        return memory;
+    }
+
+    Ref<Image> GraphicsResourceCache::GetOrCreateAliasedImage(const ImageDescription& imageDescription, Ref<TransientMemory> memory)
+    {
+        const uint64 memoryID = memory->GetID();
+        const uint64 key = Math::CombineHashes(static_cast<uint64>(CachedResourceType::AliasedImage), ToHash(imageDescription), memoryID);
+
+        if (CachedResource* cached = TryAcquireFree(key, imageDescription, GraphicsMemoryRequirements(), memoryID))
+            return cached->Resource.Downcast<Image>();
+
+        // The memory is accounted for by the transient memory, so the image itself doesn't count towards the budget
+        Ref<Image> image = _platform->CreateAliasedImage(imageDescription, memory);
+        Add(image, CachedResourceType::AliasedImage, key, imageDescription, GraphicsMemoryRequirements(), 0, memoryID);
+        return image;
+    }
+
+    void GraphicsResourceCache::ReleaseResource(uint64 id)
+    {
+        CachedResource* resource = _resources.TryGetValue(id);
+        if (!resource || !resource->InUse)
+            return;
+
+        resource->InUse = false;
+
+        Array<uint64>* freeIDs = _freeResources.TryGetValue(resource->Key);
+        if (!freeIDs)
+            freeIDs = &_freeResources.Emplace(resource->Key);
+
+        freeIDs->Append(id);
+    }
+
+    void GraphicsResourceCache::PurgeUnused()
+    {
+        const uint64 currentFrameNumber = _platform->GetCurrentFrameNumber();
+
+        if (currentFrameNumber > _maxUnusedFrames)
         {
-            if (_resourcesInUse.Contains(item.first->GetID()))
-                return false;
+            Array<uint64> staleIDs;
+
+            for (const auto& [id, resource] : _resources)
+            {
+                if (!resource.InUse && resource.LastUsedFrame < currentFrameNumber - _maxUnusedFrames)
+                    staleIDs.Append(id);
+            }
+
+            for (const uint64 id : staleIDs)
+                Evict(id);
+        }
+
+        if (_stats.CachedBytes <= _budget)
+            return;
 
-            return item.first->GetDescription() == imageDescription;
-        });
+        Array<std::pair<uint64, uint64>> candidates;
 
-        if (existingIndex == -1)
+        for (const auto& [id, resource] : _resources)
         {
-            existingIndex = static_cast<int64>(_images.GetCount());
-            _images.EmplaceBack(_platform->CreateImage(imageDescription), 0);
+            if (!resource.InUse && resource.Size > 0)
+                candidates.EmplaceBack(resource.LastUsedFrame, id);
         }
 
-        auto& pair = _images[existingIndex];
-        pair.second = _platform->GetCurrentFrameNumber();
-        _resourcesInUse.Append(pair.first->GetID());
-        return pair.first;
+        QSorter<std::pair<uint64, uint64>> sorter([](const auto& a, const auto& b) { return a.first < b.first; });
+        sorter.Sort(candidates);
+
+        for (const auto& [lastUsedFrame, id] : candidates)
+        {
+            if (_stats.CachedBytes <= _budget)
+                break;
+
+            Evict(id);
+        }
+
+        if (_stats.CachedBytes > _budget)
+            COCO_ENGINE_LOG_WARN("GraphicsResourceCache is %llu bytes over budget with every unused resource evicted", _stats.CachedBytes - _budget);
     }
 
-    void GraphicsResourceCache::ReleaseResource(uint64 id)
+    GraphicsResourceCache::CachedResource* GraphicsResourceCache::TryAcquireFree(uint64 key, const ImageDescription& imageDescription,
+        const GraphicsMemoryRequirements& memoryRequirements, uint64 memoryID)
+    {
+        Array<uint64>* freeIDs = _freeResources.TryGetValue(key);
+
+        for (uint64 i = freeIDs ? freeIDs->GetCount() : 0; i > 0; i--)
+        {
+            const uint64 id = (*freeIDs)[i - 1];
+            CachedResource& resource = _resources.Get(id);
+
+            // A different description hashed to the same key
+            if (!(resource.ImageDesc == imageDescription) || !(resource.MemoryRequirements == memoryRequirements) || resource.MemoryID != memoryID)
+                continue;
+
+            freeIDs->RemoveAt(i - 1);
+
+            resource.InUse = true;
+            resource.LastUsedFrame = _platform->GetCurrentFrameNumber();
+
+            _stats.Hits++;
+            return &resource;
+        }
+
+        _stats.Misses++;
+        return nullptr;
+    }
+
+    void GraphicsResourceCache::Add(Ref<GraphicsResource> resource, CachedResourceType type, uint64 key,
+        const ImageDescription& imageDescription, const GraphicsMemoryRequirements& memoryRequirements, uint64 size, uint64 memoryID)
     {
-        _resourcesInUse.Remove(id, false);
+        CachedResource& cached = _resources.Emplace(resource->GetID(), resource, type, key, imageDescription, memoryRequirements, size, memoryID);
+        cached.InUse = true;
+        cached.LastUsedFrame = _platform->GetCurrentFrameNumber();
+
+        _stats.ResourceCount++;
+        _stats.CachedBytes += size;
+    }
+
+    void GraphicsResourceCache::Evict(uint64 id)
+    {
+        CachedResource* resource = _resources.TryGetValue(id);
+        if (!resource || resource->InUse)
+            return;
+
+        if (resource->Type == CachedResourceType::TransientMemory)
+        {
+            Array<uint64> aliasedIDs;
+
+            for (const auto& [aliasedID, aliased] : _resources)
+            {
+                if (aliased.Type != CachedResourceType::AliasedImage || aliased.MemoryID != id)
+                    continue;
+
+                // The memory can't be freed while an image bound to it is still being used
+                if (aliased.InUse)
+                    return;
+
+                aliasedIDs.Append(aliasedID);
+            }
+
+            for (const uint64 aliasedID : aliasedIDs)
+                Evict(aliasedID);
+
+            resource = &_resources.Get(id);
+        }
+
+        if (Array<uint64>* freeIDs = _freeResources.TryGetValue(resource->Key))
+        {
+            freeIDs->Remove(id, false);
+
+            if (freeIDs->IsEmpty())
+                _freeResources.Remove(resource->Key);
+        }
+
+        _stats.Evictions++;
+        _stats.ResourceCount--;
+        _stats.CachedBytes -= resource->Size;
+
+        _resources.Remove(id);
+        _platform->InvalidateResource(id);
     }
 } // Coco
\ No newline at end of file
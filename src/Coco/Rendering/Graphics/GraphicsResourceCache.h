@@ -8,20 +8,132 @@
 
 namespace Coco
 {
+    /// @brief Counters of a GraphicsResourceCache, used for tuning its budget
+    struct GraphicsResourceCacheStats
+    {
+        /// @brief The number of lookups that reused a cached resource
+        uint64 Hits;
+
+        /// @brief The number of lookups that had to create a resource
+        uint64 Misses;
+
+        /// @brief The number of resources that have been evicted
+        uint64 Evictions;
+
+        /// @brief The number of resources in the cache
+        uint64 ResourceCount;
+
+        /// @brief The approximate size of the resources in the cache, in bytes
+        uint64 CachedBytes;
+
+        GraphicsResourceCacheStats();
+    };
+
+    /// @brief Caches resources that are only used for part of a frame so they can be reused on later frames.
+    /// Resources are keyed by a hash of their description, and unused ones are evicted in least-recently-used order once the cache is over budget
     class GraphicsResourceCache
     {
     public:
-        GraphicsResourceCache(GraphicsPlatform* platform);
+        /// @brief The default budget of the cache, in bytes
+        static constexpr uint64 DefaultBudget = 512 * 1024 * 1024;
+
+        GraphicsResourceCache(GraphicsPlatform* platform, uint64 budget = DefaultBudget);
         ~GraphicsResourceCache();
 
         Ref<Image> GetOrCreateImage(const ImageDescription& imageDescription);
 
+        /// @brief Gets or creates a block of transient memory that isn't in use with the given requirements
+        /// @param requirements The memory requirements
+        /// @return The transient memory
+        Ref<TransientMemory> GetOrCreateTransientMemory(const GraphicsMemoryRequirements& requirements);
+
+        /// @brief Gets or creates an image that isn't in use and is bound to the given transient memory
+        /// @param imageDescription The image description
+        /// @param memory The memory the image is bound to
+        /// @return The aliased image
+        Ref<Image> GetOrCreateAliasedImage(const ImageDescription& imageDescription, Ref<TransientMemory> memory);
+
+        /// @brief Marks a resource as no longer being used by a frame so it can be reused
+        /// @param id The ID of the resource
         void ReleaseResource(uint64 id);
 
+        /// @brief Evicts resources that haven't been used for a while, and then the least recently used resources until the cache is within its budget.
+        /// Only resources that no frame is using are evicted
+        void PurgeUnused();
+
+        /// @brief Sets the budget of the cache
+        /// @param budget The budget, in bytes
+        void SetBudget(uint64 budget) { _budget = budget; }
+
+        /// @brief Gets the budget of the cache
+        /// @return The budget, in bytes
+        uint64 GetBudget() const { return _budget; }
+
+        /// @brief Gets the counters of this cache
+        /// @return The counters
+        const GraphicsResourceCacheStats& GetStats() const { return _stats; }
+
     private:
+        enum class CachedResourceType : uint8
+        {
+            Image,
+            TransientMemory,
+            AliasedImage
+        };
+
+        struct CachedResource
+        {
+            Ref<GraphicsResource> Resource;
+            CachedResourceType Type;
+            uint64 Key;
+
+            /// @brief The description an image or aliased image was created with
+            ImageDescription ImageDesc;
+
+            /// @brief The requirements transient memory was created with
+            GraphicsMemoryRequirements MemoryRequirements;
+
+            uint64 Size;
+            uint64 MemoryID;
+            uint64 LastUsedFrame;
+            bool InUse;
+
+            CachedResource(Ref<GraphicsResource> resource, CachedResourceType type, uint64 key,
+                const ImageDescription& imageDescription, const GraphicsMemoryRequirements& memoryRequirements, uint64 size, uint64 memoryID);
+        };
+
+        static constexpr uint64 _maxUnusedFrames = 300;
+
         GraphicsPlatform* _platform;
-        Array<std::pair<Ref<Image>, uint64>> _images;
-        Array<uint64> _resourcesInUse;
+        Map<uint64, CachedResource> _resources;
+        Map<uint64, Array<uint64>> _freeResources;
+        uint64 _budget;
+        GraphicsResourceCacheStats _stats;
+
+    private:
+        /// @brief Takes the most recently released resource with the given key that was created with the same description.
+        /// Different descriptions can hash to the same key, so resources that don't match exactly are skipped
+        /// @param key The resource key
+        /// @param imageDescription The description of the image, or a default description for transient memory
+        /// @param memoryRequirements The requirements of the transient memory, or default requirements for images
+        /// @param memoryID The ID of the transient memory an aliased image is bound to
+        /// @return The resource, or nullptr if there are no matching free resources
+        CachedResource* TryAcquireFree(uint64 key, const ImageDescription& imageDescription, const GraphicsMemoryRequirements& memoryRequirements, uint64 memoryID = 0);
+
+        /// @brief Adds a newly created resource to the cache and marks it as in use
+        /// @param resource The resource
+        /// @param type The type of the resource
+        /// @param key The resource key
+        /// @param imageDescription The description of the image, or a default description for transient memory
+        /// @param memoryRequirements The requirements of the transient memory, or default requirements for images
+        /// @param size The size of the resource, in bytes
+        /// @param memoryID The ID of the transient memory an aliased image is bound to
+        void Add(Ref<GraphicsResource> resource, CachedResourceType type, uint64 key,
+            const ImageDescription& imageDescription, const GraphicsMemoryRequirements& memoryRequirements, uint64 size, uint64 memoryID = 0);
+
+        /// @brief Evicts a resource that isn't in use
+        /// @param id The ID of the resource
+        void Evict(uint64 id);
     };
 } // Coco
 
@@ -0,0 +1,106 @@
+//
+// Created by cullen on 10/18/26.
+//
+
+#include "ImageDiff.h"
+
+#include "Coco/Core/Asserts.h"
+#include "Coco/Core/Math/Math.h"
+
+namespace Coco
+{
+    ImageDiffResult::ImageDiffResult() :
+        PixelCount(0),
+        DifferentPixelCount(0),
+        MaxChannelDifference(0),
+        MeanChannelDifference(0.0)
+    {}
+
+    double ImageDiffResult::GetDifferentPixelFraction() const
+    {
+        if (PixelCount == 0)
+            return 0.0;
+
+        return static_cast<double>(DifferentPixelCount) / static_cast<double>(PixelCount);
+    }
+
+    ImageDiffResult ImageDiff::Compare(const ImageDescription& description, Span<const uint8> expected, Span<const uint8> actual,
+        uint8 channelTolerance, Array<uint8>* outDiffImage)
+    {
+        const uint64 channelCount = ImageDescription::GetChannelCount(description.PixelFormat);
+        const uint64 bytesPerPixel = ImageDescription::GetBytesPerPixel(description.PixelFormat);
+        COCO_ASSERT(channelCount == bytesPerPixel, "Only formats with 8 bits per channel can be compared");
+
+        ImageDiffResult result;
+        result.PixelCount = static_cast<uint64>(description.Width) * description.Height;
+
+        const uint64 dataSize = result.PixelCount * bytesPerPixel;
+        COCO_ASSERT(expected.size() >= dataSize && actual.size() >= dataSize, "Pixel data is smaller than the image description");
+
+        if (outDiffImage)
+        {
+            outDiffImage->Clear();
+            outDiffImage->Resize(result.PixelCount * 4);
+        }
+
+        uint64 totalDifference = 0;
+
+        for (uint64 pixel = 0; pixel < result.PixelCount; pixel++)
+        {
+            const uint64 offset = pixel * bytesPerPixel;
+            uint8 pixelDifference = 0;
+            uint64 expectedSum = 0;
+
+            for (uint64 channel = 0; channel < channelCount; channel++)
+            {
+                const uint8 a = expected[offset + channel];
+                const uint8 b = actual[offset + channel];
+                const uint8 difference = a > b ? a - b : b - a;
+
+                pixelDifference = Math::Max(pixelDifference, difference);
+                totalDifference += difference;
+                expectedSum += a;
+            }
+
+            result.MaxChannelDifference = Math::Max(result.MaxChannelDifference, pixelDifference);
+
+            const bool isDifferent = pixelDifference > channelTolerance;
+            if (isDifferent)
+                result.DifferentPixelCount++;
+
+            if (outDiffImage)
+            {
+                uint8* diffPixel = outDiffImage->Data() + pixel * 4;
+
+                if (isDifferent)
+                {
+                    diffPixel[0] = 255;
+                    diffPixel[1] = 0;
+                    diffPixel[2] = 0;
+                }
+                else
+                {
+                    // Dim the expected image so the different pixels stand out
+                    const uint8 gray = static_cast<uint8>(expectedSum / channelCount / 4);
+                    diffPixel[0] = gray;
+                    diffPixel[1] = gray;
+                    diffPixel[2] = gray;
+                }
+
+                diffPixel[3] = 255;
+            }
+        }
+
+        const uint64 channelTotal = result.PixelCount * channelCount;
+        if (channelTotal > 0)
+            result.MeanChannelDifference = static_cast<double>(totalDifference) / static_cast<double>(channelTotal);
+
+        return result;
+    }
+
+    bool ImageDiff::Matches(const ImageDescription& description, Span<const uint8> expected, Span<const uint8> actual,
+        uint8 channelTolerance, double maxDifferentPixelFraction)
+    {
+        return Compare(description, expected, actual, channelTolerance).GetDifferentPixelFraction() <= maxDifferentPixelFraction;
+    }
+} // Coco
\ No newline at end of file
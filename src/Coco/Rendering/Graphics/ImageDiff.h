@@ -0,0 +1,58 @@
+//
+// Created by cullen on 10/18/26.
+//
+
+#ifndef COCOENGINE_IMAGEDIFF_H
+#define COCOENGINE_IMAGEDIFF_H
+#include "Coco/Core/Types/Array.h"
+#include "Resources/ImageTypes.h"
+
+namespace Coco
+{
+    /// @brief The result of comparing two images
+    struct ImageDiffResult
+    {
+        /// @brief The number of pixels that were compared
+        uint64 PixelCount;
+
+        /// @brief The number of pixels with at least one channel that differs by more than the tolerance
+        uint64 DifferentPixelCount;
+
+        /// @brief The largest difference of any channel
+        uint8 MaxChannelDifference;
+
+        /// @brief The mean absolute difference over every channel, from 0 to 255
+        double MeanChannelDifference;
+
+        ImageDiffResult();
+
+        /// @brief Gets the fraction of pixels that differ by more than the tolerance
+        /// @return The fraction of different pixels, from 0 to 1
+        double GetDifferentPixelFraction() const;
+    };
+
+    /// @brief Compares images on the CPU, such as a readback against a golden image
+    class ImageDiff
+    {
+    public:
+        /// @brief Compares two images with the same description and 8 bits per channel
+        /// @param description The description of both images
+        /// @param expected The expected pixels, with tightly packed rows
+        /// @param actual The actual pixels, with tightly packed rows
+        /// @param channelTolerance The largest difference of a channel that isn't counted as a different pixel
+        /// @param outDiffImage If given, will be filled with an RGBA8 image that highlights the different pixels in red over a dimmed copy of the expected image
+        /// @return The result of the comparison
+        static ImageDiffResult Compare(const ImageDescription& description, Span<const uint8> expected, Span<const uint8> actual, uint8 channelTolerance, Array<uint8>* outDiffImage = nullptr);
+
+        /// @brief Determines if two images match closely enough to pass a golden image test
+        /// @param description The description of both images
+        /// @param expected The expected pixels, with tightly packed rows
+        /// @param actual The actual pixels, with tightly packed rows
+        /// @param channelTolerance The largest difference of a channel that isn't counted as a different pixel
+        /// @param maxDifferentPixelFraction The largest fraction of pixels that can differ, from 0 to 1
+        /// @return True if the images match
+        static bool Matches(const ImageDescription& description, Span<const uint8> expected, Span<const uint8> actual, uint8 channelTolerance, double maxDifferentPixelFraction);
+    };
+} // Coco
+
+#endif //COCOENGINE_IMAGEDIFF_H
\ No newline at end of file
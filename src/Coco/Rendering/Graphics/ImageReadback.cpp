@@ -0,0 +1,27 @@
+//
+// Created by cullen on 10/18/26.
+//
+
+#include "ImageReadback.h"
+
+namespace Coco
+{
+    ImageReadback::ImageReadback(const ImageDescription& description, uint64 requestedFrameNumber) :
+        _description(description),
+        _requestedFrameNumber(requestedFrameNumber),
+        _pixels(),
+        _isComplete(false)
+    {}
+
+    uint64 ImageReadback::GetPixelDataSize() const
+    {
+        return static_cast<uint64>(_description.Width) * _description.Height * ImageDescription::GetBytesPerPixel(_description.PixelFormat);
+    }
+
+    void ImageReadback::Complete(Span<const uint8> pixels)
+    {
+        _pixels.Clear();
+        _pixels.AppendRange(pixels);
+        _isComplete = true;
+    }
+} // Coco
\ No newline at end of file
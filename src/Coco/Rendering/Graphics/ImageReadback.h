@@ -0,0 +1,51 @@
+//
+// Created by cullen on 10/18/26.
+//
+
+#ifndef COCOENGINE_IMAGEREADBACK_H
+#define COCOENGINE_IMAGEREADBACK_H
+#include "Coco/Core/Types/Array.h"
+#include "Resources/ImageTypes.h"
+
+namespace Coco
+{
+    /// @brief The pixels of an image copied back from the GPU. The copy is recorded at the end of the frame it was requested in,
+    /// and completes once the GPU has finished that frame without stalling the frames in between
+    class ImageReadback
+    {
+    public:
+        ImageReadback(const ImageDescription& description, uint64 requestedFrameNumber);
+
+        /// @brief Gets the description of the image that was read back
+        /// @return The image description
+        const ImageDescription& GetDescription() const { return _description; }
+
+        /// @brief Gets the number of the frame this readback was requested in
+        /// @return The frame number
+        uint64 GetRequestedFrameNumber() const { return _requestedFrameNumber; }
+
+        /// @brief Determines if the pixels have been copied back from the GPU
+        /// @return True if the pixels are available
+        bool IsComplete() const { return _isComplete; }
+
+        /// @brief Gets the pixels of the first mip level, with tightly packed rows. Empty until the readback is complete
+        /// @return The pixel data
+        Span<const uint8> GetPixels() const { return _pixels; }
+
+        /// @brief Gets the number of bytes the pixels of the image take up
+        /// @return The size of the pixel data
+        uint64 GetPixelDataSize() const;
+
+        /// @brief Called by the graphics platform once the pixels have been copied back from the GPU
+        /// @param pixels The pixel data
+        void Complete(Span<const uint8> pixels);
+
+    private:
+        ImageDescription _description;
+        uint64 _requestedFrameNumber;
+        Array<uint8> _pixels;
+        bool _isComplete;
+    };
+} // Coco
+
+#endif //COCOENGINE_IMAGEREADBACK_H
\ No newline at end of file
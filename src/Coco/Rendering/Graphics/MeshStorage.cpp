@@ -5,35 +5,95 @@
 #include "Resources/Buffer.h"
 #include "PagedLinearBuffer.h"
 #include "Coco/Rendering/Mesh.h"
+#include "Coco/Core/Engine.h"
 
 namespace Coco
 {
     MeshEntry::MeshEntry(const Mesh& mesh) :
         MeshBuffer(),
+        IndexBuffer(),
         BufferOffset(0),
         ChannelOffsets({0, 0, 0, 0, 0}),
         VertexDataSize(mesh.GetVertexDataSize()),
         IndexDataOffset(Math::AlignedAddress(VertexDataSize, alignof(uint32))),
         IndexCount(mesh.GetIndexCount()),
-        TotalDataSize(IndexDataOffset + IndexCount * sizeof(uint32))
+        TotalDataSize(IndexDataOffset + mesh.GetIndexDataSize()),
+        LocalBounds(mesh.GetBounds()),
+        LocalBoundingSphere(mesh.GetBoundingSphere()),
+        ArenaIndex(),
+        Format(mesh.GetVertexFormat()),
+        IndexType(mesh.GetIndexFormat()),
+        FirstVertex(0),
+        VertexCount(mesh.GetVertexCount()),
+        FirstIndex(0)
     {}
 
     MeshEntry::MeshEntry(uint64 vertexDataSize, uint64 indexCount) :
         MeshBuffer(),
+        IndexBuffer(),
         BufferOffset(0),
         ChannelOffsets({0, 0, 0, 0, 0}),
         VertexDataSize(vertexDataSize),
         IndexDataOffset(Math::AlignedAddress(VertexDataSize, alignof(uint32))),
         IndexCount(indexCount),
-        TotalDataSize(IndexDataOffset + IndexCount * sizeof(uint32))
+        TotalDataSize(IndexDataOffset + IndexCount * sizeof(uint32)),
+        LocalBounds(),
+        LocalBoundingSphere(),
+        ArenaIndex(),
+        Format(),
+        IndexType(IndexFormat::UInt32),
+        FirstVertex(0),
+        VertexCount(0),
+        FirstIndex(0)
         {}
 
+    VertexStream::VertexStream(uint64 offset, uint64 stride) :
+        Offset(offset),
+        Stride(stride)
+    {}
+
+    StaticMeshArena::StaticMeshArena(GraphicsPlatform* platform, const VertexFormat& format, IndexFormat indexType, uint64 vertexCapacity, uint64 indexCapacity) :
+        VertexBuffer(),
+        IndexBuffer(),
+        Format(format),
+        IndexType(indexType),
+        ChannelOffsets({0, 0, 0, 0, 0}),
+        VertexAllocator(vertexCapacity),
+        IndexAllocator(indexCapacity),
+        IsDefragmenting(false)
+    {
+        // Interleaved channels are all bound at the start of the buffer. Planar channels without data are bound to the position region
+        if (Format.LayoutMode == VertexLayoutMode::Planar)
+        {
+            for (uint8 channel = 0; channel < MaxVertexChannelCount; channel++)
+            {
+                if (Format.HasChannel(static_cast<VertexChannel>(channel)))
+                    ChannelOffsets[channel] = vertexCapacity * Format.GetInterleavedChannelOffset(static_cast<VertexChannel>(channel));
+            }
+        }
+
+        const BufferUsageFlags usage = BufferUsageFlags::TransferSource | BufferUsageFlags::TransferDestination;
+        VertexBuffer = platform->CreateBuffer(BufferDescription(vertexCapacity * Format.GetVertexSize(), BufferUsageFlags::Vertex | usage));
+        IndexBuffer = platform->CreateBuffer(BufferDescription(indexCapacity * GetIndexSize(IndexType), BufferUsageFlags::Index | usage));
+    }
+
+    RetiredMeshRange::RetiredMeshRange(uint64 arenaIndex, uint64 firstVertex, uint64 vertexCount, uint64 firstIndex, uint64 indexCount, uint64 retiredFrameNumber) :
+        ArenaIndex(arenaIndex),
+        FirstVertex(firstVertex),
+        VertexCount(vertexCount),
+        FirstIndex(firstIndex),
+        IndexCount(indexCount),
+        RetiredFrameNumber(retiredFrameNumber)
+    {}
+
     MeshStorage::MeshStorage(GraphicsPlatform* platform, uint8 dynamicBufferCount) :
         _platform(platform),
         _staticMeshes(),
         _dynamicMeshes(),
         _dynamicMeshBuffers(nullptr, dynamicBufferCount),
-        _currentDynamicMeshBufferIndex(0)
+        _currentDynamicMeshBufferIndex(0),
+        _staticMeshArenas(),
+        _retiredMeshRanges()
     {
         SetDynamicMeshBufferCount(dynamicBufferCount);
     }
@@ -43,10 +103,16 @@ namespace Coco
         _dynamicMeshes.Clear();
         _dynamicMeshBuffers.Clear(true);
 
-        for (auto& staticMesh : _staticMeshes)
-            _platform->InvalidateResource(staticMesh.second.MeshBuffer->GetID());
-
         _staticMeshes.Clear();
+        _retiredMeshRanges.Clear();
+
+        for (auto& arena : _staticMeshArenas)
+        {
+            _platform->InvalidateResource(arena.VertexBuffer->GetID());
+            _platform->InvalidateResource(arena.IndexBuffer->GetID());
+        }
+
+        _staticMeshArenas.Clear();
     }
 
     void MeshStorage::AddMesh(Mesh& mesh)
@@ -79,34 +145,44 @@ namespace Coco
             vertexDataSize += uvs->size() * sizeof(Vector2);
 
         auto& entry = _dynamicMeshes.Emplace(meshID, vertexDataSize, indices.size());
+        entry.Format = VertexFormat(VertexChannelFlags::Position, VertexLayoutMode::Planar, VertexEncoding::Full);
+        entry.LocalBounds = BoundingBox::FromPoints(positions);
+        entry.LocalBoundingSphere = BoundingSphere::FromPoints(entry.LocalBounds, positions);
+
         uint64 currentOffset = positions.size() * sizeof(Vector3);
 
         if (normals)
         {
+            entry.Format.Channels |= VertexChannelFlags::Normal;
             entry.ChannelOffsets[static_cast<uint8>(VertexChannel::Normal)] = currentOffset;
             currentOffset += normals->size() * sizeof(Vector3);
         }
 
         if (tangents)
         {
+            entry.Format.Channels |= VertexChannelFlags::Tangent;
             entry.ChannelOffsets[static_cast<uint8>(VertexChannel::Tangent)] = currentOffset;
             currentOffset += tangents->size() * sizeof(Vector4);
         }
 
         if (colors)
         {
+            entry.Format.Channels |= VertexChannelFlags::Color;
             entry.ChannelOffsets[static_cast<uint8>(VertexChannel::Color)] = currentOffset;
             currentOffset += colors->size() * sizeof(Vector4);
         }
 
         if (uvs)
         {
+            entry.Format.Channels |= VertexChannelFlags::UV0;
             entry.ChannelOffsets[static_cast<uint8>(VertexChannel::UV0)] = currentOffset;
             currentOffset += uvs->size() * sizeof(Vector2);
         }
 
         auto& dynamicBuffers = _dynamicMeshBuffers[_currentDynamicMeshBufferIndex];
         dynamicBuffers.Allocate(entry.TotalDataSize, entry.MeshBuffer, entry.BufferOffset);
+        entry.IndexBuffer = entry.MeshBuffer;
+        entry.VertexCount = positions.size();
 
         void* mappedData = entry.MeshBuffer->GetMappedPtr();
         COCO_ASSERT(mappedData, "Unable to map buffer");
@@ -134,7 +210,7 @@ namespace Coco
     {
         if (auto entry = _staticMeshes.TryGetValue(meshID))
         {
-            _platform->InvalidateResource(entry->MeshBuffer->GetID());
+            RetireArenaRanges(*entry);
             _staticMeshes.Remove(meshID);
         }
     }
@@ -161,6 +237,34 @@ namespace Coco
         _dynamicMeshes.Clear();
     }
 
+    void MeshStorage::UpdateStaticMeshArenas()
+    {
+        const uint64 currentFrameNumber = _platform->GetCurrentFrameNumber();
+
+        for (uint64 i = 0; i < _retiredMeshRanges.GetCount();)
+        {
+            const RetiredMeshRange& range = _retiredMeshRanges[i];
+
+            if (currentFrameNumber < range.RetiredFrameNumber + _framesBeforeRangeReuse)
+            {
+                i++;
+                continue;
+            }
+
+            StaticMeshArena& arena = _staticMeshArenas[range.ArenaIndex];
+
+            if (range.VertexCount > 0)
+                arena.VertexAllocator.Free(range.FirstVertex, range.VertexCount);
+
+            if (range.IndexCount > 0)
+                arena.IndexAllocator.Free(range.FirstIndex, range.IndexCount);
+
+            _retiredMeshRanges.RemoveAt(i, false);
+        }
+
+        DefragmentStaticMeshArenas();
+    }
+
     void MeshStorage::AddDynamicMesh(Mesh& mesh)
     {
         if (_dynamicMeshes.Contains(mesh.GetID()))
@@ -169,6 +273,7 @@ namespace Coco
         auto& entry = _dynamicMeshes.Emplace(mesh.GetID(), mesh);
         auto& dynamicBuffers = _dynamicMeshBuffers[_currentDynamicMeshBufferIndex];
         dynamicBuffers.Allocate(entry.TotalDataSize, entry.MeshBuffer, entry.BufferOffset);
+        entry.IndexBuffer = entry.MeshBuffer;
 
         void* mappedData = entry.MeshBuffer->GetMappedPtr();
         COCO_ASSERT(mappedData, "Unable to map buffer");
@@ -176,6 +281,9 @@ namespace Coco
         uint8* vertexDataPtr = static_cast<uint8*>(mappedData) + entry.BufferOffset;
         uint8* indexDataPtr = vertexDataPtr + entry.IndexDataOffset;
         mesh.UpdateData(vertexDataPtr, indexDataPtr, entry.ChannelOffsets);
+
+        entry.LocalBounds = mesh.GetBounds();
+        entry.LocalBoundingSphere = mesh.GetBoundingSphere();
     }
 
     void MeshStorage::AddStaticMesh(Mesh& mesh)
@@ -187,27 +295,231 @@ namespace Coco
         if (!needsUpdate)
             return;
 
-        uint64 totalDataSize = mesh.GetTotalDataSize();
+        COCO_ASSERT(mesh.GetVertexCount() > 0 && mesh.GetIndexCount() > 0, "Static meshes must have vertices and indices");
 
+        // LODs are stored in the mesh's index buffer, so they must be generated before the mesh's ranges are sized
+        mesh.UpdateLODs();
+
+        // Previous frames may still be drawing the old data, so updated meshes always get new ranges
         if (entry)
         {
-            if (entry->MeshBuffer->GetSize() < totalDataSize)
-                entry->MeshBuffer->Resize(totalDataSize);
+            RetireArenaRanges(*entry);
+            *entry = MeshEntry(mesh);
         }
         else
         {
             entry = &_staticMeshes.Emplace(mesh.GetID(), mesh);
-            BufferDescription desc(entry->TotalDataSize, BufferUsageFlags::Vertex | BufferUsageFlags::Index | BufferUsageFlags::TransferDestination);
-
-            entry->MeshBuffer = _platform->CreateBuffer(desc);
         }
 
-        StagingOperation* stagingOperation = _platform->GetStagingBuffer()->CreateStagingOperation(totalDataSize);
+        AllocateArenaRanges(*entry, mesh.GetVertexCount(), mesh.GetIndexCount());
+
+        // The mesh data is staged contiguously and then scattered into each channel's region of the arena
+        const uint64 stagedIndexDataOffset = entry->IndexDataOffset;
+        StagingOperation* stagingOperation = _platform->GetStagingBuffer()->CreateStagingOperation(entry->TotalDataSize);
 
+        StackArray<uint64, MaxVertexChannelCount> stagedChannelOffsets({0, 0, 0, 0, 0});
         uint8* vertexDataPtr = stagingOperation->BufferPtr;
-        uint8* indexDataPtr = vertexDataPtr + entry->IndexDataOffset;
-        mesh.UpdateData(vertexDataPtr, indexDataPtr, entry->ChannelOffsets);
+        uint8* indexDataPtr = vertexDataPtr + stagedIndexDataOffset;
+        mesh.UpdateData(vertexDataPtr, indexDataPtr, stagedChannelOffsets);
+
+        entry->LocalBounds = mesh.GetBounds();
+        entry->LocalBoundingSphere = mesh.GetBoundingSphere();
+
+        StaticMeshArena& arena = _staticMeshArenas[entry->ArenaIndex.value()];
+
+        // The staged data has the same streams as the arena, just sized for only this mesh's vertices
+        StackArray<VertexStream, MaxVertexChannelCount> stagedStreams;
+        StackArray<VertexStream, MaxVertexChannelCount> arenaStreams;
+        GetVertexStreams(entry->Format, entry->VertexCount, stagedStreams);
+        GetVertexStreams(arena.Format, arena.VertexAllocator.GetCapacity(), arenaStreams);
+
+        StackArray<BufferCopyRegion, MaxVertexChannelCount> vertexRegions;
+
+        for (uint64 i = 0; i < arenaStreams.GetCount(); i++)
+        {
+            const VertexStream& stream = arenaStreams[i];
+            vertexRegions.EmplaceBack(
+                stagedStreams[i].Offset,
+                stream.Offset + entry->FirstVertex * stream.Stride,
+                entry->VertexCount * stream.Stride);
+        }
 
-        entry->MeshBuffer->CopyFrom(*stagingOperation);
+        arena.VertexBuffer->CopyFrom(*stagingOperation, vertexRegions);
+
+        const uint64 indexSize = GetIndexSize(entry->IndexType);
+        BufferCopyRegion indexRegion(stagedIndexDataOffset, entry->FirstIndex * indexSize, entry->IndexCount * indexSize);
+        arena.IndexBuffer->CopyFrom(*stagingOperation, Span<const BufferCopyRegion>(&indexRegion, 1));
+    }
+
+    void MeshStorage::AllocateArenaRanges(MeshEntry& entry, uint64 vertexCount, uint64 indexCount)
+    {
+        for (uint64 i = 0; i < _staticMeshArenas.GetCount(); i++)
+        {
+            const StaticMeshArena& arena = _staticMeshArenas[i];
+
+            if (arena.Format == entry.Format && arena.IndexType == entry.IndexType && TryAllocateArenaRanges(i, entry, vertexCount, indexCount))
+                return;
+        }
+
+        // Meshes larger than the default arena size get an arena of their own
+        _staticMeshArenas.EmplaceBack(
+            _platform,
+            entry.Format,
+            entry.IndexType,
+            Math::Max(_arenaVertexCapacity, vertexCount),
+            Math::Max(_arenaIndexCapacity, indexCount));
+
+        const bool allocated = TryAllocateArenaRanges(_staticMeshArenas.GetCount() - 1, entry, vertexCount, indexCount);
+        COCO_ASSERT(allocated, "Failed to allocate mesh data from a new arena");
+    }
+
+    bool MeshStorage::TryAllocateArenaRanges(uint64 arenaIndex, MeshEntry& entry, uint64 vertexCount, uint64 indexCount)
+    {
+        StaticMeshArena& arena = _staticMeshArenas[arenaIndex];
+
+        Optional<uint64> firstVertex = arena.VertexAllocator.Allocate(vertexCount);
+        if (!firstVertex.has_value())
+            return false;
+
+        Optional<uint64> firstIndex = arena.IndexAllocator.Allocate(indexCount);
+        if (!firstIndex.has_value())
+        {
+            arena.VertexAllocator.Free(firstVertex.value(), vertexCount);
+            return false;
+        }
+
+        entry.MeshBuffer = arena.VertexBuffer;
+        entry.IndexBuffer = arena.IndexBuffer;
+        entry.BufferOffset = 0;
+        entry.IndexDataOffset = 0;
+        entry.ArenaIndex = arenaIndex;
+        entry.FirstVertex = firstVertex.value();
+        entry.FirstIndex = firstIndex.value();
+
+        for (uint8 channel = 0; channel < MaxVertexChannelCount; channel++)
+            entry.ChannelOffsets[channel] = arena.ChannelOffsets[channel];
+
+        return true;
+    }
+
+    void MeshStorage::RetireArenaRanges(MeshEntry& entry)
+    {
+        if (!entry.ArenaIndex.has_value())
+            return;
+
+        _retiredMeshRanges.EmplaceBack(
+            entry.ArenaIndex.value(),
+            entry.FirstVertex, entry.VertexCount,
+            entry.FirstIndex, entry.IndexCount,
+            _platform->GetCurrentFrameNumber());
+
+        entry.ArenaIndex.reset();
+    }
+
+    void MeshStorage::DefragmentStaticMeshArenas()
+    {
+        uint64 remainingBudget = _defragmentationFrameBudget;
+
+        for (uint64 arenaIndex = 0; arenaIndex < _staticMeshArenas.GetCount() && remainingBudget > 0; arenaIndex++)
+        {
+            StaticMeshArena& arena = _staticMeshArenas[arenaIndex];
+            const double fragmentation = Math::Max(arena.VertexAllocator.GetFragmentation(), arena.IndexAllocator.GetFragmentation());
+
+            if (!arena.IsDefragmenting && fragmentation > _defragmentationStartThreshold)
+            {
+                COCO_ENGINE_LOG_VERBOSE("Defragmenting static mesh arena %u (fragmentation: %.2f)", arenaIndex, fragmentation);
+                arena.IsDefragmenting = true;
+            }
+            else if (arena.IsDefragmenting && fragmentation < _defragmentationStopThreshold)
+            {
+                arena.IsDefragmenting = false;
+            }
+
+            if (!arena.IsDefragmenting)
+                continue;
+
+            Array<BufferCopyRegion> vertexRegions;
+            Array<BufferCopyRegion> indexRegions;
+            bool movedAny = false;
+
+            StackArray<VertexStream, MaxVertexChannelCount> streams;
+            GetVertexStreams(arena.Format, arena.VertexAllocator.GetCapacity(), streams);
+            const uint64 indexSize = GetIndexSize(arena.IndexType);
+
+            for (auto& [meshID, entry] : _staticMeshes)
+            {
+                if (remainingBudget == 0)
+                    break;
+
+                if (entry.ArenaIndex != arenaIndex)
+                    continue;
+
+                // Only move into ranges entirely below the current one so the copy source and destination never overlap
+                const uint64 vertexDataSize = entry.VertexCount * arena.Format.GetVertexSize();
+                Optional<uint64> newFirstVertex;
+
+                if (vertexDataSize <= remainingBudget)
+                    newFirstVertex = arena.VertexAllocator.AllocateBelow(entry.VertexCount, entry.FirstVertex);
+
+                if (newFirstVertex.has_value())
+                {
+                    for (const VertexStream& stream : streams)
+                    {
+                        vertexRegions.EmplaceBack(
+                            stream.Offset + entry.FirstVertex * stream.Stride,
+                            stream.Offset + newFirstVertex.value() * stream.Stride,
+                            entry.VertexCount * stream.Stride);
+                    }
+
+                    _retiredMeshRanges.EmplaceBack(arenaIndex, entry.FirstVertex, entry.VertexCount, 0, 0, _platform->GetCurrentFrameNumber());
+                    entry.FirstVertex = newFirstVertex.value();
+                    remainingBudget -= vertexDataSize;
+                    movedAny = true;
+                }
+
+                const uint64 indexDataSize = entry.IndexCount * indexSize;
+                Optional<uint64> newFirstIndex;
+
+                if (indexDataSize <= remainingBudget)
+                    newFirstIndex = arena.IndexAllocator.AllocateBelow(entry.IndexCount, entry.FirstIndex);
+
+                if (newFirstIndex.has_value())
+                {
+                    indexRegions.EmplaceBack(entry.FirstIndex * indexSize, newFirstIndex.value() * indexSize, indexDataSize);
+
+                    _retiredMeshRanges.EmplaceBack(arenaIndex, 0, 0, entry.FirstIndex, entry.IndexCount, _platform->GetCurrentFrameNumber());
+                    entry.FirstIndex = newFirstIndex.value();
+                    remainingBudget -= indexDataSize;
+                    movedAny = true;
+                }
+            }
+
+            if (!vertexRegions.IsEmpty())
+                arena.VertexBuffer->CopyWithin(vertexRegions);
+
+            if (!indexRegions.IsEmpty())
+                arena.IndexBuffer->CopyWithin(indexRegions);
+
+            // Nothing left can move lower, so further passes won't reduce fragmentation until more ranges are freed
+            if (!movedAny && remainingBudget > 0)
+                arena.IsDefragmenting = false;
+        }
+    }
+
+    void MeshStorage::GetVertexStreams(const VertexFormat& format, uint64 vertexCapacity, ArrayContainer<VertexStream>& outStreams)
+    {
+        if (format.LayoutMode == VertexLayoutMode::Interleaved)
+        {
+            outStreams.EmplaceBack(0, format.GetVertexSize());
+            return;
+        }
+
+        for (uint8 i = 0; i < MaxVertexChannelCount; i++)
+        {
+            const VertexChannel channel = static_cast<VertexChannel>(i);
+
+            if (format.HasChannel(channel))
+                outStreams.EmplaceBack(vertexCapacity * format.GetInterleavedChannelOffset(channel), format.GetChannelSize(channel));
+        }
     }
-}
+}
\ No newline at end of file
@@ -7,7 +7,10 @@
 #include <Coco/Core/Types/CoreTypes.h>
 
 #include "VertexDataTypes.h"
+#include "RangeAllocator.h"
 
+#include "Coco/Core/Math/BoundingBox.h"
+#include "Coco/Core/Math/BoundingSphere.h"
 #include "Coco/Core/Math/Vector2.h"
 #include "Coco/Core/Math/Vector3.h"
 #include "Coco/Core/Math/Vector4.h"
@@ -30,17 +33,84 @@ namespace Coco
     struct MeshEntry
     {
         Ref<Buffer> MeshBuffer;
+        Ref<Buffer> IndexBuffer;
         uint64 BufferOffset;
         StackArray<uint64, 5> ChannelOffsets;
         uint64 VertexDataSize;
         uint64 IndexDataOffset;
         uint64 IndexCount;
         uint64 TotalDataSize;
+        BoundingBox LocalBounds;
+        BoundingSphere LocalBoundingSphere;
+
+        /// @brief The index of the static mesh arena holding this mesh's data, if this mesh is static
+        Optional<uint64> ArenaIndex;
+
+        /// @brief The layout and encoding of this mesh's vertex data
+        VertexFormat Format;
+
+        /// @brief The size of this mesh's indices
+        IndexFormat IndexType;
+
+        /// @brief The offset to add to this mesh's vertex indices when drawing
+        uint64 FirstVertex;
+
+        /// @brief The number of vertices this mesh has
+        uint64 VertexCount;
+
+        /// @brief The index of this mesh's first index in its index buffer
+        uint64 FirstIndex;
 
         MeshEntry(const Mesh& mesh);
         MeshEntry(uint64 vertexDataSize, uint64 indexCount);
     };
 
+    /// @brief A contiguous stream of vertex data within a buffer
+    struct VertexStream
+    {
+        /// @brief The offset of the first vertex's data
+        uint64 Offset;
+
+        /// @brief The distance between each vertex's data
+        uint64 Stride;
+
+        VertexStream(uint64 offset, uint64 stride);
+    };
+
+    /// @brief Shared vertex and index buffers that hold the data of many static meshes with the same vertex and index formats.
+    /// Each planar vertex channel has its own region of the vertex buffer, so a mesh occupies the same range of vertices in every channel
+    /// and meshes in the same arena can be drawn without rebinding buffers
+    struct StaticMeshArena
+    {
+        Ref<Buffer> VertexBuffer;
+        Ref<Buffer> IndexBuffer;
+        VertexFormat Format;
+        IndexFormat IndexType;
+
+        /// @brief The offset of each vertex channel's region in the vertex buffer
+        StackArray<uint64, MaxVertexChannelCount> ChannelOffsets;
+        RangeAllocator VertexAllocator;
+        RangeAllocator IndexAllocator;
+
+        /// @brief If true, meshes are being moved towards the start of the arena to merge its free space
+        bool IsDefragmenting;
+
+        StaticMeshArena(GraphicsPlatform* platform, const VertexFormat& format, IndexFormat indexType, uint64 vertexCapacity, uint64 indexCapacity);
+    };
+
+    /// @brief Ranges of a static mesh arena that are freed once the GPU can no longer be using them
+    struct RetiredMeshRange
+    {
+        uint64 ArenaIndex;
+        uint64 FirstVertex;
+        uint64 VertexCount;
+        uint64 FirstIndex;
+        uint64 IndexCount;
+        uint64 RetiredFrameNumber;
+
+        RetiredMeshRange(uint64 arenaIndex, uint64 firstVertex, uint64 vertexCount, uint64 firstIndex, uint64 indexCount, uint64 retiredFrameNumber);
+    };
+
     class MeshStorage
     {
     public:
@@ -58,17 +128,57 @@ namespace Coco
         void SetDynamicMeshBufferCount(uint8 count);
         void SetCurrentDynamicMeshBuffer(uint8 index);
 
+        /// @brief Frees static mesh ranges that are no longer in use by the GPU and moves static meshes to defragment their arenas.
+        /// Should be called once per frame
+        void UpdateStaticMeshArenas();
+
     private:
         static constexpr int _bufferPageSize = 1024 * 1024;
+        static constexpr uint64 _arenaVertexCapacity = 256 * 1024;
+        static constexpr uint64 _arenaIndexCapacity = 1024 * 1024;
+        static constexpr uint64 _framesBeforeRangeReuse = 3;
+        static constexpr double _defragmentationStartThreshold = 0.5;
+        static constexpr double _defragmentationStopThreshold = 0.1;
+        static constexpr uint64 _defragmentationFrameBudget = 1024 * 1024 * 4;
+
         GraphicsPlatform* _platform;
         Map<uint64, MeshEntry> _staticMeshes;
         Map<uint64, MeshEntry> _dynamicMeshes;
         Array<PagedLinearBuffer<Buffer>> _dynamicMeshBuffers;
         uint8 _currentDynamicMeshBufferIndex;
+        Array<StaticMeshArena> _staticMeshArenas;
+        Array<RetiredMeshRange> _retiredMeshRanges;
 
     private:
         void AddDynamicMesh(Mesh& mesh);
         void AddStaticMesh(Mesh& mesh);
+
+        /// @brief Allocates a static mesh's vertex and index ranges, creating a new arena if none of the existing ones have space
+        /// @param entry The mesh entry
+        /// @param vertexCount The number of vertices to allocate
+        /// @param indexCount The number of indices to allocate
+        void AllocateArenaRanges(MeshEntry& entry, uint64 vertexCount, uint64 indexCount);
+
+        /// @brief Allocates a static mesh's vertex and index ranges from an arena
+        /// @param arenaIndex The index of the arena
+        /// @param entry The mesh entry
+        /// @param vertexCount The number of vertices to allocate
+        /// @param indexCount The number of indices to allocate
+        /// @return True if the arena had space for the mesh
+        bool TryAllocateArenaRanges(uint64 arenaIndex, MeshEntry& entry, uint64 vertexCount, uint64 indexCount);
+
+        /// @brief Retires a static mesh's ranges so they are freed once the GPU is done with them
+        /// @param entry The mesh entry
+        void RetireArenaRanges(MeshEntry& entry);
+
+        /// @brief Moves static meshes in fragmented arenas into lower free ranges, up to the defragmentation budget
+        void DefragmentStaticMeshArenas();
+
+        /// @brief Gets the streams of vertex data in a buffer holding vertices of a format
+        /// @param format The vertex format
+        /// @param vertexCapacity The number of vertices the buffer can hold
+        /// @param outStreams Will be filled with the vertex streams
+        static void GetVertexStreams(const VertexFormat& format, uint64 vertexCapacity, ArrayContainer<VertexStream>& outStreams);
     };
 } // Coco
 
@@ -46,28 +46,45 @@ namespace Coco
 
         void Allocate(uint64 size, Ref<BufferType>& outBuffer, uint64& outBufferOffset)
         {
-            COCO_ASSERT(size <= _description.Size, "Size is too big for a buffer");
+            if (TryAllocate(size, outBuffer, outBufferOffset))
+                return;
 
+            // Allocations larger than a page get a buffer of their own size
+            BufferDescription description = _description;
+            description.Size = Math::Max(description.Size, size);
+
+            outBuffer = _platform->CreateBuffer(description).Downcast<BufferType>();
+            outBufferOffset = 0;
+
+            auto& buffer = _buffers.EmplaceBack(outBuffer, _platform->GetCurrentFrameNumber());
+            buffer.RemainingBytes -= size;
+        }
+
+        /// @brief Allocates from the existing pages without creating a new one
+        /// @param size The size of the allocation
+        /// @param outBuffer Will be set to the page the allocation was made from
+        /// @param outBufferOffset Will be set to the offset of the allocation in the page
+        /// @return True if an existing page had enough space
+        bool TryAllocate(uint64 size, Ref<BufferType>& outBuffer, uint64& outBufferOffset)
+        {
             uint64 frameNumber = _platform->GetCurrentFrameNumber();
 
             for (auto& buffer : _buffers)
             {
-                if (buffer.RemainingBytes >= size)
+                uint64 bufferSize = buffer.TargetBuffer->GetSize();
+                uint64 offset = Math::AlignedAddress(bufferSize - buffer.RemainingBytes, _alignment);
+
+                if (offset + size <= bufferSize)
                 {
                     outBuffer = buffer.TargetBuffer;
-                    uint64 bufferSize = buffer.TargetBuffer->GetSize();
-                    outBufferOffset = Math::AlignedAddress(bufferSize - buffer.RemainingBytes, _alignment);
-                    buffer.RemainingBytes = bufferSize - (outBufferOffset + size);
+                    outBufferOffset = offset;
+                    buffer.RemainingBytes = bufferSize - (offset + size);
                     buffer.LastAllocationFrameNumber = frameNumber;
-                    return;
+                    return true;
                 }
             }
 
-            outBuffer = _platform->CreateBuffer(_description).Downcast<BufferType>();
-            outBufferOffset = 0;
-
-            auto& buffer = _buffers.EmplaceBack(outBuffer, frameNumber);
-            buffer.RemainingBytes -= size;
+            return false;
         }
 
         void Clear()
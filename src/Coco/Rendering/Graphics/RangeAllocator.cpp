@@ -0,0 +1,144 @@
+//
+// Created by cullen on 10/18/26.
+//
+
+#include "RangeAllocator.h"
+
+#include "Coco/Core/Asserts.h"
+
+namespace Coco
+{
+    FreeRange::FreeRange(uint64 offset, uint64 size) :
+        Offset(offset),
+        Size(size)
+    {}
+
+    RangeAllocator::RangeAllocator(uint64 capacity) :
+        _capacity(capacity),
+        _freeSize(capacity),
+        _freeRanges()
+    {
+        if (capacity > 0)
+            _freeRanges.EmplaceBack(0, capacity);
+    }
+
+    Optional<uint64> RangeAllocator::Allocate(uint64 size)
+    {
+        if (size == 0 || size > _freeSize)
+            return Optional<uint64>();
+
+        Optional<uint64> bestIndex;
+
+        for (uint64 i = 0; i < _freeRanges.GetCount(); i++)
+        {
+            const FreeRange& range = _freeRanges[i];
+
+            if (range.Size < size || (bestIndex.has_value() && range.Size >= _freeRanges[*bestIndex].Size))
+                continue;
+
+            bestIndex = i;
+
+            if (range.Size == size)
+                break;
+        }
+
+        if (!bestIndex.has_value())
+            return Optional<uint64>();
+
+        return TakeFromFreeRange(*bestIndex, size);
+    }
+
+    Optional<uint64> RangeAllocator::AllocateBelow(uint64 size, uint64 limit)
+    {
+        if (size == 0 || size > _freeSize)
+            return Optional<uint64>();
+
+        for (uint64 i = 0; i < _freeRanges.GetCount(); i++)
+        {
+            const FreeRange& range = _freeRanges[i];
+
+            if (range.Offset + size > limit)
+                break;
+
+            if (range.Size >= size)
+                return TakeFromFreeRange(i, size);
+        }
+
+        return Optional<uint64>();
+    }
+
+    void RangeAllocator::Free(uint64 offset, uint64 size)
+    {
+        COCO_ASSERT(offset + size <= _capacity, "Range is outside of the allocator");
+
+        if (size == 0)
+            return;
+
+        uint64 insertIndex = 0;
+        while (insertIndex < _freeRanges.GetCount() && _freeRanges[insertIndex].Offset < offset)
+            insertIndex++;
+
+        _freeSize += size;
+
+        const bool mergesWithPrevious = insertIndex > 0 &&
+            _freeRanges[insertIndex - 1].Offset + _freeRanges[insertIndex - 1].Size == offset;
+        const bool mergesWithNext = insertIndex < _freeRanges.GetCount() &&
+            offset + size == _freeRanges[insertIndex].Offset;
+
+        if (mergesWithPrevious && mergesWithNext)
+        {
+            _freeRanges[insertIndex - 1].Size += size + _freeRanges[insertIndex].Size;
+            _freeRanges.RemoveAt(insertIndex);
+        }
+        else if (mergesWithPrevious)
+        {
+            _freeRanges[insertIndex - 1].Size += size;
+        }
+        else if (mergesWithNext)
+        {
+            _freeRanges[insertIndex].Offset = offset;
+            _freeRanges[insertIndex].Size += size;
+        }
+        else
+        {
+            // Shift the following ranges up to keep the ranges sorted
+            _freeRanges.EmplaceBack(offset, size);
+
+            for (uint64 i = _freeRanges.GetCount() - 1; i > insertIndex; i--)
+                std::swap(_freeRanges[i], _freeRanges[i - 1]);
+        }
+    }
+
+    uint64 RangeAllocator::GetLargestFreeRange() const
+    {
+        uint64 largest = 0;
+
+        for (const FreeRange& range : _freeRanges)
+            largest = Math::Max(largest, range.Size);
+
+        return largest;
+    }
+
+    double RangeAllocator::GetFragmentation() const
+    {
+        if (_freeSize == 0)
+            return 0.0;
+
+        return 1.0 - static_cast<double>(GetLargestFreeRange()) / static_cast<double>(_freeSize);
+    }
+
+    uint64 RangeAllocator::TakeFromFreeRange(uint64 freeRangeIndex, uint64 size)
+    {
+        FreeRange& range = _freeRanges[freeRangeIndex];
+        const uint64 offset = range.Offset;
+
+        range.Offset += size;
+        range.Size -= size;
+        _freeSize -= size;
+
+        if (range.Size == 0)
+            _freeRanges.RemoveAt(freeRangeIndex);
+
+        return offset;
+    }
+} // Coco
\ No newline at end of file
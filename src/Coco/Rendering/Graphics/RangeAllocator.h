@@ -0,0 +1,76 @@
+//
+// Created by cullen on 10/18/26.
+//
+
+#ifndef COCOENGINE_RANGEALLOCATOR_H
+#define COCOENGINE_RANGEALLOCATOR_H
+#include "Coco/Core/Types/Array.h"
+#include "Coco/Core/Types/Optional.h"
+
+namespace Coco
+{
+    /// @brief A free range within a RangeAllocator
+    struct FreeRange
+    {
+        uint64 Offset;
+        uint64 Size;
+
+        FreeRange(uint64 offset, uint64 size);
+    };
+
+    /// @brief Suballocates ranges of elements out of a fixed capacity, such as vertices in a shared vertex buffer.
+    /// Freed ranges are merged with their neighbors
+    class RangeAllocator
+    {
+    public:
+        RangeAllocator(uint64 capacity);
+
+        /// @brief Allocates a range using the smallest free range that fits
+        /// @param size The number of elements to allocate
+        /// @return The offset of the allocated range, or an empty value if no free range is large enough
+        Optional<uint64> Allocate(uint64 size);
+
+        /// @brief Allocates a range that ends at or before a limit, using the lowest free range that fits
+        /// @param size The number of elements to allocate
+        /// @param limit The offset the allocated range must end at or before
+        /// @return The offset of the allocated range, or an empty value if no free range below the limit is large enough
+        Optional<uint64> AllocateBelow(uint64 size, uint64 limit);
+
+        /// @brief Frees a previously allocated range
+        /// @param offset The offset of the range
+        /// @param size The number of elements in the range
+        void Free(uint64 offset, uint64 size);
+
+        /// @brief Gets the total number of elements this allocator can allocate
+        /// @return The capacity
+        uint64 GetCapacity() const { return _capacity; }
+
+        /// @brief Gets the total number of free elements
+        /// @return The number of free elements
+        uint64 GetFreeSize() const { return _freeSize; }
+
+        /// @brief Gets the size of the largest free range
+        /// @return The number of elements in the largest free range
+        uint64 GetLargestFreeRange() const;
+
+        /// @brief Gets how fragmented the free space is
+        /// @return 0 if all free space is in one range, approaching 1 as the free space is split into smaller ranges
+        double GetFragmentation() const;
+
+    private:
+        uint64 _capacity;
+        uint64 _freeSize;
+
+        /// @brief Free ranges, sorted by offset
+        Array<FreeRange> _freeRanges;
+
+    private:
+        /// @brief Takes a range from the start of a free range
+        /// @param freeRangeIndex The index of the free range
+        /// @param size The number of elements to take
+        /// @return The offset of the taken range
+        uint64 TakeFromFreeRange(uint64 freeRangeIndex, uint64 size);
+    };
+} // Coco
+
+#endif //COCOENGINE_RANGEALLOCATOR_H
\ No newline at end of file
@@ -14,6 +14,7 @@ namespace Coco
         _renderSceneStorage.Clear();
         _rendersThisFrame = 0;
         _renderObjects.Clear();
+        _culler.Clear();
         _stats = RenderFrameStats();
     }
 
@@ -22,6 +23,11 @@ namespace Coco
         return {this, _rendersThisFrame++, frameSize};
     }
 
+    RenderScene RenderFrame::CreateSharedRenderScene()
+    {
+        return {this, _rendersThisFrame++, Sizei(), true};
+    }
+
     void RenderFrame::EnsureMeshData(Mesh& mesh)
     {
         _meshStorage->AddMesh(mesh);
@@ -41,6 +47,19 @@ namespace Coco
         _stats.VerticesDrawn += vertexCount;
     }
 
+    void RenderFrame::AddStreamDrawCalls(const RenderFrameStats& streamStats)
+    {
+        _stats.DrawCalls += streamStats.DrawCalls;
+        _stats.TrianglesDrawn += streamStats.TrianglesDrawn;
+        _stats.VerticesDrawn += streamStats.VerticesDrawn;
+    }
+
+    void RenderFrame::AddTransientMemory(uint64 peakSize, uint64 unaliasedSize)
+    {
+        _stats.PeakTransientMemory += peakSize;
+        _stats.UnaliasedTransientMemory += unaliasedSize;
+    }
+
     RenderFrameStats RenderFrame::GetStats() const
     {
         RenderFrameStats stats(_stats);
@@ -48,12 +67,13 @@ namespace Coco
         return stats;
     }
 
-    RenderFrame::RenderFrame(MeshStorage* meshStorage) :
+    RenderFrame::RenderFrame(MeshStorage* meshStorage, WorkerPool* workerPool) :
         _frameAllocator(AllocatorGroup, _frameAllocatorSize),
         _meshStorage(meshStorage),
         _renderSceneStorage(&_frameAllocator, _sceneStoragePageSize, _sceneStorageUniformPageSize),
         _rendersThisFrame(0),
         _renderObjects(&_frameAllocator, _renderObjectCount),
+        _culler(&_frameAllocator, _renderObjectCount, workerPool),
         _stats()
     {}
 } // Coco
\ No newline at end of file
@@ -9,15 +9,20 @@
 #include "Coco/Core/Math/Matrix4x4.h"
 
 #include "Resources/GraphicsSurface.h"
+#include "Resources/Image.h"
+#include "ImageReadback.h"
+#include "Coco/Core/Memory/Ptrs.h"
 #include "Coco/Core/Memory/Refs.h"
 #include "Coco/Core/Memory/Allocators/FreeListAllocator.h"
 #include "Coco/Rendering/RenderObjectView.h"
 #include "Coco/Rendering/RenderSceneStorage.h"
 #include "Coco/Rendering/RenderSceneTypes.h"
+#include "Coco/Rendering/Culling/FrustumCuller.h"
 
 namespace Coco
 {
     class MeshStorage;
+    class WorkerPool;
     class Mesh;
     class RenderGraph;
 
@@ -33,12 +38,20 @@ namespace Coco
         virtual ~RenderFrame() = default;
 
         virtual void Render(RenderGraph&& graph, RenderScene&& scene, Ref<GraphicsSurface> surface) = 0;
+        virtual void Render(RenderGraph&& graph, RenderScene&& scene, Ref<Image> targetImage) = 0;
+
+        /// @brief Requests a copy of an image's pixels after this frame has rendered. The readback completes once the GPU has finished this frame,
+        /// which is usually one or two frames later
+        /// @param image The image. It must be usable as a transfer source and can't be presented
+        /// @return The readback, which will hold the pixels once it is complete
+        virtual SharedPtr<ImageReadback> ReadbackImage(Ref<Image> image) = 0;
         virtual Matrix4x4 CreateOrthographicProjection(float left, float right, float bottom, float top, float nearClip, float farClip) const = 0;
         virtual Matrix4x4 CreatePerspectiveProjection(float verticalFOV, float aspectRatio, float nearClip, float farClip) const = 0;
 
         virtual void NewFrame();
 
         RenderScene CreateRenderScene(const Sizei& frameSize);
+        RenderScene CreateSharedRenderScene();
         void EnsureMeshData(Mesh& mesh);
         void EnsureDynamicMeshData(uint64 id, Span<const Vector3> positions, Span<const uint32> indices,
             Optional<Span<const Vector3>> normals, Optional<Span<const Vector4>> colors,
@@ -47,23 +60,29 @@ namespace Coco
         const RenderSceneStorage& GetSceneStorage() const { return _renderSceneStorage; }
         Allocator& GetFrameAllocator() { return _frameAllocator; }
         void AddDrawCall(uint32 triangleCount, uint32 vertexCount);
+
+        /// @brief Adds the draw calls that a parallel recording stream counted on its own
+        /// @param streamStats The stream's statistics
+        void AddStreamDrawCalls(const RenderFrameStats& streamStats);
+        void AddTransientMemory(uint64 peakSize, uint64 unaliasedSize);
         RenderFrameStats GetStats() const;
 
     protected:
         static constexpr uint64 _sceneStoragePageSize = 1024 * 1024;
         static constexpr uint64 _sceneStorageUniformPageSize = 1024;
         static constexpr uint64 _renderObjectCount = 1024;
-        static constexpr uint64 _frameAllocatorSize = 1024 * 1024 * 3 + sizeof(RenderObject) * _renderObjectCount;
+        static constexpr uint64 _frameAllocatorSize = 1024 * 1024 * 3 + (sizeof(RenderObject) + FrustumCuller::BytesPerBounds) * _renderObjectCount;
 
         FreeListAllocator _frameAllocator;
         MeshStorage* _meshStorage;
         RenderSceneStorage _renderSceneStorage;
         uint64 _rendersThisFrame;
         Array<RenderObject> _renderObjects;
+        FrustumCuller _culler;
         RenderFrameStats _stats;
 
     protected:
-        RenderFrame(MeshStorage* meshStorage);
+        RenderFrame(MeshStorage* meshStorage, WorkerPool* workerPool);
     };
 } // Coco
 
@@ -13,7 +13,14 @@ namespace Coco
         uint64 TrianglesDrawn;
         uint64 VerticesDrawn;
         uint64 DrawCalls;
+        uint64 ObjectsCulled;
         uint64 MemoryUsage;
+
+        /// @brief The peak memory used by transient render graph textures, in bytes
+        uint64 PeakTransientMemory;
+
+        /// @brief The memory transient render graph textures would use without aliasing, in bytes
+        uint64 UnaliasedTransientMemory;
     };
 } // Coco
 
@@ -7,6 +7,7 @@
 #include "Coco/Core/Memory/Refs.h"
 #include "Coco/Rendering/Graphics/GraphicsResource.h"
 #include "Coco/Rendering/Graphics/StagingBuffer.h"
+#include "BufferTypes.h"
 
 namespace Coco
 {
@@ -21,6 +22,15 @@ namespace Coco
         virtual void Resize(uint64 newSize) = 0;
         virtual void CopyFrom(StagingOperation& stagingOperation) = 0;
 
+        /// @brief Copies regions of a staging operation into this buffer
+        /// @param stagingOperation The staging operation
+        /// @param regions The regions to copy. Source offsets are relative to the start of the staging operation
+        virtual void CopyFrom(StagingOperation& stagingOperation, Span<const BufferCopyRegion> regions) = 0;
+
+        /// @brief Copies regions of this buffer to other regions of this buffer on the GPU. Source and destination regions must not overlap
+        /// @param regions The regions to copy
+        virtual void CopyWithin(Span<const BufferCopyRegion> regions) = 0;
+
     protected:
         Buffer(uint64 id);
     };
@@ -10,4 +10,10 @@ namespace Coco
         Size(size),
         UsageFlags(usageFlags)
     {}
+
+    BufferCopyRegion::BufferCopyRegion(uint64 sourceOffset, uint64 destinationOffset, uint64 size) :
+        SourceOffset(sourceOffset),
+        DestinationOffset(destinationOffset),
+        Size(size)
+    {}
 }
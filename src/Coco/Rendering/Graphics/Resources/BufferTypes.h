@@ -10,7 +10,7 @@
 namespace Coco
 {
     /// @brief Types of buffer usage
-    enum class BufferUsageFlags : uint8
+    enum class BufferUsageFlags : uint16
     {
         None = 0,
         TransferSource = 1 << 0,
@@ -19,6 +19,13 @@ namespace Coco
         Index = 1 << 3,
         Vertex = 1 << 4,
         HostVisible = 1 << 5,
+        HostReadable = 1 << 6,
+
+        /// @brief The buffer can be read and written by shaders as a storage buffer
+        Storage = 1 << 7,
+
+        /// @brief The buffer can hold the arguments of indirect draws
+        Indirect = 1 << 8,
     };
 
     EnumFlagOperators(BufferUsageFlags)
@@ -30,5 +37,15 @@ namespace Coco
 
         BufferDescription(uint64 size, BufferUsageFlags usageFlags);
     };
+
+    /// @brief A range of bytes to copy between buffers
+    struct BufferCopyRegion
+    {
+        uint64 SourceOffset;
+        uint64 DestinationOffset;
+        uint64 Size;
+
+        BufferCopyRegion(uint64 sourceOffset, uint64 destinationOffset, uint64 size);
+    };
 }
 #endif //COCOENGINE_BUFFERTYPES_H
\ No newline at end of file
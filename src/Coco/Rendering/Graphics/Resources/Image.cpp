@@ -11,10 +11,24 @@ namespace Coco
 {
     uint64 Image::GetPixelDataSize() const
     {
-        uint8 bytesPerPixel = ImageDescription::GetBytesPerPixel(_description.PixelFormat);
-        uint8 channelCount = ImageDescription::GetChannelCount(_description.PixelFormat);
+        return GetMipDataSize(0);
+    }
+
+    uint64 Image::GetMipDataSize(uint32 mipLevel) const
+    {
+        return ImageDescription::GetDataSize(_description.PixelFormat,
+            ImageDescription::GetMipSize(_description.Width, mipLevel),
+            ImageDescription::GetMipSize(_description.Height, mipLevel),
+            ImageDescription::GetMipSize(_description.Depth, mipLevel));
+    }
+
+    uint64 Image::GetMipChainDataSize() const
+    {
+        uint64 size = 0;
+        for (uint32 mip = 0; mip < Math::Max<uint32>(_description.MipCount, 1); mip++)
+            size += GetMipDataSize(mip);
 
-        return _description.Width * _description.Height * _description.Depth * bytesPerPixel * channelCount;
+        return size;
     }
 
     Image::Image(uint64 id, const ImageDescription& description) :
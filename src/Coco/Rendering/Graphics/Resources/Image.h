@@ -16,9 +16,28 @@ namespace Coco
 
         virtual void SetPixels(const void* pixelData, uint64 pixelDataSize) = 0;
 
+        /// @brief Sets the pixels of a region of the first mip level, leaving the rest of the image as-is. Mip maps are regenerated afterwards.
+        /// Only uncompressed images can have regions set
+        /// @param x The x offset of the region, in pixels
+        /// @param y The y offset of the region, in pixels
+        /// @param width The width of the region, in pixels
+        /// @param height The height of the region, in pixels
+        /// @param pixelData The pixels of the region, with tightly packed rows
+        /// @param pixelDataSize The size of the pixel data
+        virtual void SetPixelRegion(uint32 x, uint32 y, uint32 width, uint32 height, const void* pixelData, uint64 pixelDataSize) = 0;
+
         const ImageDescription& GetDescription() const { return _description; }
         uint64 GetPixelDataSize() const;
 
+        /// @brief Gets the size of the pixel data of a mip level
+        /// @param mipLevel The mip level
+        /// @return The size of the mip level's pixel data, in bytes
+        uint64 GetMipDataSize(uint32 mipLevel) const;
+
+        /// @brief Gets the size of the pixel data of every mip level, stored one after another from the largest level
+        /// @return The size of the pixel data of every mip level, in bytes
+        uint64 GetMipChainDataSize() const;
+
     protected:
         ImageDescription _description;
 
@@ -59,6 +59,21 @@ namespace Coco
             a.UsageFlags == b.UsageFlags;
     }
 
+    uint64 ToHash(const ImageDescription& description)
+    {
+        return Math::CombineHashes(
+            static_cast<uint64>(description.Width),
+            static_cast<uint64>(description.Height),
+            static_cast<uint64>(description.Depth),
+            static_cast<uint64>(description.Layers),
+            static_cast<uint64>(description.PixelFormat),
+            static_cast<uint64>(description.ColorSpace),
+            static_cast<uint64>(description.MipCount),
+            static_cast<uint64>(description.SampleCount),
+            static_cast<uint64>(description.UsageFlags)
+        );
+    }
+
 
     uint32 ImageDescription::CalculateMipMapCount(uint32 width, uint32 height) noexcept
     {
@@ -70,6 +85,7 @@ namespace Coco
         switch (format)
         {
             case ImagePixelFormat::RGBA8:
+            case ImagePixelFormat::BGRA8:
             case ImagePixelFormat::R32_Int:
             case ImagePixelFormat::R32_UInt:
                 return 4;
@@ -90,6 +106,45 @@ namespace Coco
         }
     }
 
+    bool ImageDescription::IsCompressed(ImagePixelFormat format) noexcept
+    {
+        return GetCompressedBlockSize(format) > 0;
+    }
+
+    uint8 ImageDescription::GetCompressedBlockSize(ImagePixelFormat format) noexcept
+    {
+        switch (format)
+        {
+            case ImagePixelFormat::BC1_RGBA:
+                return 8;
+            case ImagePixelFormat::BC3_RGBA:
+            case ImagePixelFormat::BC5_RG:
+            case ImagePixelFormat::BC7_RGBA:
+                return 16;
+            default:
+                return 0;
+        }
+    }
+
+    uint64 ImageDescription::GetDataSize(ImagePixelFormat format, uint32 width, uint32 height, uint32 depth) noexcept
+    {
+        const uint64 blockSize = GetCompressedBlockSize(format);
+
+        if (blockSize > 0)
+        {
+            const uint64 blocksWide = (static_cast<uint64>(width) + 3) / 4;
+            const uint64 blocksHigh = (static_cast<uint64>(height) + 3) / 4;
+            return blocksWide * blocksHigh * depth * blockSize;
+        }
+
+        return static_cast<uint64>(width) * height * depth * GetBytesPerPixel(format);
+    }
+
+    uint32 ImageDescription::GetMipSize(uint32 size, uint32 mipLevel) noexcept
+    {
+        return Math::Max<uint32>(size >> mipLevel, 1);
+    }
+
     uint8 ImageDescription::GetChannelCount(ImagePixelFormat format) noexcept
     {
         switch (format)
@@ -101,12 +156,18 @@ namespace Coco
             case ImagePixelFormat::R32G32_UInt:
             case ImagePixelFormat::Depth24_Stencil8:
                 return 2;
+            case ImagePixelFormat::BC5_RG:
+                return 2;
             case ImagePixelFormat::R32G32B32_Int:
             case ImagePixelFormat::R32G32B32_UInt:
                 return 3;
             case ImagePixelFormat::RGBA8:
+            case ImagePixelFormat::BGRA8:
             case ImagePixelFormat::R32G32B32A32_Int:
             case ImagePixelFormat::R32G32B32A32_UInt:
+            case ImagePixelFormat::BC1_RGBA:
+            case ImagePixelFormat::BC3_RGBA:
+            case ImagePixelFormat::BC7_RGBA:
                 return 4;
             default:
                 COCO_ASSERT(false, "Unsupported format: %d", static_cast<int>(format));
@@ -132,6 +193,10 @@ namespace Coco
         {
             case ImagePixelFormat::RGBA8:
             case ImagePixelFormat::BGRA8:
+            case ImagePixelFormat::BC1_RGBA:
+            case ImagePixelFormat::BC3_RGBA:
+            case ImagePixelFormat::BC5_RG:
+            case ImagePixelFormat::BC7_RGBA:
                 return ImagePixelType::Float;
             case ImagePixelFormat::R32_Int:
             case ImagePixelFormat::R32G32_Int:
@@ -50,6 +50,18 @@ namespace Coco
         /// @brief 32 bit depth channel with an 8 bit stencil channel
         Depth32_Stencil8,
 
+        /// @brief BC1 block compression. R, G, B, and 1 bit A channels in 8 bytes per 4x4 block
+        BC1_RGBA,
+
+        /// @brief BC3 block compression. R, G, B, and A channels in 16 bytes per 4x4 block
+        BC3_RGBA,
+
+        /// @brief BC5 block compression. R and G channels in 16 bytes per 4x4 block, suited to normal maps
+        BC5_RG,
+
+        /// @brief BC7 block compression. R, G, B, and A channels in 16 bytes per 4x4 block, with higher quality than BC1 and BC3
+        BC7_RGBA,
+
         /// @brief An unknown format
         Unknown
     };
@@ -165,6 +177,31 @@ namespace Coco
         /// @return The number of bytes per pixel
         static uint8 GetBytesPerPixel(ImagePixelFormat format) noexcept;
 
+        /// @brief Determines if a pixel format stores its pixels in compressed blocks
+        /// @param format The pixel format
+        /// @return True if the format is block compressed
+        static bool IsCompressed(ImagePixelFormat format) noexcept;
+
+        /// @brief Gets the number of bytes in each 4x4 block of a compressed pixel format
+        /// @param format The pixel format
+        /// @return The number of bytes per block, or 0 if the format isn't compressed
+        static uint8 GetCompressedBlockSize(ImagePixelFormat format) noexcept;
+
+        /// @brief Gets the size of the pixel data of a single mip level.
+        /// Compressed formats are stored in whole 4x4 blocks, so partial blocks at the edges are rounded up
+        /// @param format The pixel format
+        /// @param width The width of the mip level
+        /// @param height The height of the mip level
+        /// @param depth The depth of the mip level
+        /// @return The size of the pixel data, in bytes
+        static uint64 GetDataSize(ImagePixelFormat format, uint32 width, uint32 height, uint32 depth = 1) noexcept;
+
+        /// @brief Gets the size of a dimension of a mip level
+        /// @param size The size of the dimension at the first mip level
+        /// @param mipLevel The mip level
+        /// @return The size of the dimension at the mip level
+        static uint32 GetMipSize(uint32 size, uint32 mipLevel) noexcept;
+
         /// @brief Gets the number of channels for a pixel format
         /// @param format The pixel format
         /// @return The number of channels
@@ -180,6 +217,7 @@ namespace Coco
     };
 
     bool operator==(const ImageDescription& a, const ImageDescription& b);
+    uint64 ToHash(const ImageDescription& description);
 
     struct RenderTargetClearValue
     {
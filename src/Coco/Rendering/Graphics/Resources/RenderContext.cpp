@@ -3,9 +3,23 @@
 //
 #include "RenderContext.h"
 
+#include "Coco/Rendering/Material.h"
+#include "Coco/Rendering/RenderScene.h"
+
 namespace Coco
 {
     RenderContext::RenderContext(uint64 id) :
         GraphicsResource(id)
     {}
+
+    void RenderContext::BindMaterial(const RenderScene& scene, const MaterialHandle& material)
+    {
+        ShaderCursor cursor;
+        if (!BindPersistentInstanceBuffer(material.MaterialID, material.Version, Material::MaterialBlockName, cursor))
+            return;
+
+        // The material is only looked up when its block needs to be written
+        if (SharedPtr<Material> resource = scene.GetMaterial(material.MaterialID))
+            resource->WriteUniforms(cursor);
+    }
 }
@@ -4,6 +4,8 @@
 
 #ifndef COCOENGINE_RENDERCONTEXT_H
 #define COCOENGINE_RENDERCONTEXT_H
+#include <functional>
+
 #include "Coco/Core/Math/Rect.h"
 #include "Coco/Rendering/Graphics/GraphicsResource.h"
 #include <Coco/Core/Types/Span.h>
@@ -12,19 +14,42 @@
 #include "Coco/Rendering/RenderSceneTypes.h"
 #include "Coco/Rendering/Graphics/ShaderCursor.h"
 #include "Coco/Rendering/RenderGraph/RenderGraphTypes.h"
+#include "Coco/Rendering/Culling/ViewFrustum.h"
 
 namespace Coco
 {
     class Shader;
     class Image;
+    class RenderScene;
+
+    class RenderContext;
+
+    /// @brief An object that can be frustum culled and drawn by the GPU
+    struct IndirectDrawObject
+    {
+        /// @brief The object
+        const RenderObject* Object;
+
+        /// @brief The center of the object's world-space bounds
+        Vector3 BoundsCenter;
+
+        /// @brief The extents of the object's world-space bounds
+        Vector3 BoundsExtents;
+    };
+
+    /// @brief A function that records commands for a single stream of a parallel recording
+    using ParallelRecordFunction = std::function<void(RenderContext& streamContext, uint32 streamIndex)>;
 
     class RenderContext : public GraphicsResource
     {
     public:
+        /// @brief The maximum number of streams that can be recorded in parallel
+        static constexpr uint32 MaxParallelStreams = 8;
+
         virtual ~RenderContext() = default;
 
         virtual Sizei GetFramebufferSize() const = 0;
-        virtual void BeginPass(uint64 passIndex, Span<const RenderPassAttachmentInfo> passAttachments) = 0;
+        virtual void BeginPass(uint64 passIndex, Span<const RenderPassAttachmentInfo> passAttachments, bool recordInParallel) = 0;
         virtual void EndPass() = 0;
         virtual void SetViewport(const Recti& viewportRect) = 0;
         virtual void SetScissor(const Recti& scissorRect) = 0;
@@ -33,9 +58,56 @@ namespace Coco
         virtual void BindGlobalBuffer(const char* name) = 0;
         virtual bool CreateAndBindInstanceBuffer(uint64 instanceID, const char* name, ShaderCursor& outCursor) = 0;
         virtual void BindInstanceBuffer(uint64 instanceID, const char* name) = 0;
+
+        /// @brief Binds an instance's uniform block that persists across frames, such as a material's parameters.
+        /// The block is only rewritten when the instance's version changes, so unchanged blocks aren't uploaded again.
+        /// Blocks that contain textures may be recreated each frame instead
+        /// @param instanceID The ID of the instance
+        /// @param version The version of the instance's data. This must change whenever the data does
+        /// @param name The name of the block
+        /// @param outCursor Will be bound to the block if its data needs to be written
+        /// @return True if the block's data needs to be written through outCursor
+        virtual bool BindPersistentInstanceBuffer(uint64 instanceID, uint64 version, const char* name, ShaderCursor& outCursor) = 0;
+
+        /// @brief Binds a material's persistent uniform block, writing the material's parameters into it if they changed
+        /// @param scene The scene the material was stored in
+        /// @param material The handle of the material
+        void BindMaterial(const RenderScene& scene, const MaterialHandle& material);
+
+        /// @brief Sets the push constant data and textures for the next draws.
+        /// If the shader uses bindless textures, the table index of each texture is appended to the data as a uint32, in order
+        /// @param data The push constant data
+        /// @param dataSize The size of the data
+        /// @param textures The textures to bind. Null textures use the default texture
         virtual void SetDrawData(const void* data, uint64 dataSize, Span<const SharedPtr<Texture>> textures) = 0;
+
         virtual void DrawObject(const RenderObject& obj) = 0;
 
+        /// @brief Determines if an object can be drawn with DrawIndirect()
+        /// @param obj The object
+        /// @return True if the object's mesh is in a buffer that the GPU can draw from
+        virtual bool CanDrawIndirect(const RenderObject& obj) const = 0;
+
+        /// @brief Uploads a batch of objects and culls them against a frustum on the GPU, writing the draw commands of the visible objects.
+        /// This must be called outside of a pass, so it should be called from a pass's Prepare function
+        /// @param batchID The ID of the batch, used to draw it with DrawIndirect()
+        /// @param frustum The frustum to cull the objects against
+        /// @param objects The objects. CanDrawIndirect() must be true for each object
+        /// @param instanceData The per-instance data of each object, in the same order as the objects
+        /// @param instanceDataStride The size of each object's instance data
+        virtual void CullIndirect(uint64 batchID, const ViewFrustum& frustum, Span<const IndirectDrawObject> objects, Span<const uint8> instanceData, uint64 instanceDataStride) = 0;
+
+        /// @brief Draws the visible objects of a batch culled by CullIndirect() with the current shader.
+        /// The shader reads each object's instance data from the "indirectInstances" parameter block, indexed by the instance ID
+        /// @param batchID The ID of the batch
+        virtual void DrawIndirect(uint64 batchID) = 0;
+
+        /// @brief Records the current pass through multiple streams that may be recorded on separate threads.
+        /// Streams are executed in stream index order, so the result matches recording them sequentially
+        /// @param streamCount The number of streams. Must be at most MaxParallelStreams
+        /// @param recordFunction The function that records each stream. It may be called from multiple threads at once, so it should only use the context that it is given and read-only data
+        virtual void RecordParallel(uint32 streamCount, const ParallelRecordFunction& recordFunction) = 0;
+
     protected:
         RenderContext(uint64 id);
     };
@@ -4,18 +4,11 @@
 
 #ifndef COCOENGINE_SHADERPROGRAM_H
 #define COCOENGINE_SHADERPROGRAM_H
-#include <slang.h>
-
 #include "Coco/Rendering/Graphics/GraphicsResource.h"
 #include "Coco/Rendering/Graphics/ShaderCursor.h"
+#include "Coco/Rendering/Graphics/ShaderLayout.h"
 #include "Coco/Rendering/ShaderTypes.h"
 
-namespace slang
-{
-    class TypeLayoutReflection;
-    typedef struct ShaderReflection ProgramLayout;
-}
-
 namespace Coco
 {
     class ShaderProgram : public GraphicsResource
@@ -23,9 +16,9 @@ namespace Coco
     public:
         ~ShaderProgram() = default;
 
-        virtual slang::ProgramLayout* GetProgramLayout() = 0;
+        virtual const ShaderProgramLayout& GetProgramLayout() const = 0;
         virtual int64 GetParamBlockIndex(const char* name) = 0;
-        virtual slang::TypeLayoutReflection* GetParamBlockLayout(uint64 index) = 0;
+        virtual const ShaderTypeLayout* GetParamBlockLayout(uint64 index) = 0;
 
     protected:
         ShaderProgram(uint64 id);
@@ -0,0 +1,37 @@
+//
+// Created by cullen on 10/18/26.
+//
+
+#include "TransientMemory.h"
+
+namespace Coco
+{
+    GraphicsMemoryRequirements::GraphicsMemoryRequirements() :
+        GraphicsMemoryRequirements(0, 1, 0)
+    {}
+
+    GraphicsMemoryRequirements::GraphicsMemoryRequirements(uint64 size, uint64 alignment, uint32 compatibilityMask) :
+        Size(size),
+        Alignment(alignment),
+        CompatibilityMask(compatibilityMask)
+    {}
+
+    bool GraphicsMemoryRequirements::CanHold(const GraphicsMemoryRequirements& other) const
+    {
+        return Size >= other.Size &&
+            Alignment % other.Alignment == 0 &&
+            (CompatibilityMask & other.CompatibilityMask) != 0;
+    }
+
+    bool operator==(const GraphicsMemoryRequirements& a, const GraphicsMemoryRequirements& b)
+    {
+        return a.Size == b.Size &&
+            a.Alignment == b.Alignment &&
+            a.CompatibilityMask == b.CompatibilityMask;
+    }
+
+    TransientMemory::TransientMemory(uint64 id, const GraphicsMemoryRequirements& requirements) :
+        GraphicsResource(id),
+        _requirements(requirements)
+    {}
+} // Coco
\ No newline at end of file
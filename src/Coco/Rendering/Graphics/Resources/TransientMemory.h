@@ -0,0 +1,53 @@
+//
+// Created by cullen on 10/18/26.
+//
+
+#ifndef COCOENGINE_TRANSIENTMEMORY_H
+#define COCOENGINE_TRANSIENTMEMORY_H
+#include "Coco/Rendering/Graphics/GraphicsResource.h"
+
+namespace Coco
+{
+    /// @brief The device memory a resource needs
+    struct GraphicsMemoryRequirements
+    {
+        /// @brief The size of the memory, in bytes
+        uint64 Size;
+
+        /// @brief The required alignment of the memory, in bytes
+        uint64 Alignment;
+
+        /// @brief A backend-defined mask of the kinds of memory the resource can be placed in. Resources can only share memory if their masks overlap
+        uint32 CompatibilityMask;
+
+        GraphicsMemoryRequirements();
+        GraphicsMemoryRequirements(uint64 size, uint64 alignment, uint32 compatibilityMask);
+
+        /// @brief Determines if memory with these requirements can hold a resource with other requirements
+        /// @param other The requirements of the resource
+        /// @return True if the resource fits in this memory
+        bool CanHold(const GraphicsMemoryRequirements& other) const;
+    };
+
+    bool operator==(const GraphicsMemoryRequirements& a, const GraphicsMemoryRequirements& b);
+
+    /// @brief A block of device memory that transient images can be bound to. Images bound to the same block alias each other,
+    /// so only one of them can hold valid contents at a time
+    class TransientMemory : public GraphicsResource
+    {
+    public:
+        virtual ~TransientMemory() = default;
+
+        /// @brief Gets the requirements this memory was allocated with
+        /// @return The memory requirements
+        const GraphicsMemoryRequirements& GetRequirements() const { return _requirements; }
+
+    protected:
+        GraphicsMemoryRequirements _requirements;
+
+    protected:
+        TransientMemory(uint64 id, const GraphicsMemoryRequirements& requirements);
+    };
+} // Coco
+
+#endif //COCOENGINE_TRANSIENTMEMORY_H
\ No newline at end of file
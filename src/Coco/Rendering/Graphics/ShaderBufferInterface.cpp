@@ -6,7 +6,7 @@
 
 namespace Coco
 {
-    ShaderBufferInterface::ShaderBufferInterface(slang::TypeLayoutReflection* blockTypeLayout) :
+    ShaderBufferInterface::ShaderBufferInterface(const ShaderTypeLayout* blockTypeLayout) :
         _blockTypeLayout(blockTypeLayout)
     {}
 } // Coco
\ No newline at end of file
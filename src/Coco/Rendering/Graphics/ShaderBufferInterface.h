@@ -7,14 +7,10 @@
 
 #include <Coco/Core/Types/CoreTypes.h>
 
-namespace slang
-{
-    class TypeLayoutReflection;
-}
-
 namespace Coco
 {
     struct ShaderElementLocation;
+    struct ShaderTypeLayout;
     class Texture;
 
     class ShaderBufferInterface
@@ -24,15 +20,21 @@ namespace Coco
 
         virtual void Write(const ShaderElementLocation& location, const void* data, uint64 dataSize) = 0;
         virtual void Write(const ShaderElementLocation& location, Texture* texture) = 0;
+
+        /// @brief Writes the index of a texture in the bindless texture table to a uint field.
+        /// Unlike texture fields, this only writes uniform data, so blocks that reference textures this way can persist
+        /// @param location The location of the field
+        /// @param texture The texture. The default texture is used if this is nullptr or isn't ready
+        virtual void WriteTextureIndex(const ShaderElementLocation& location, Texture* texture) = 0;
         virtual void Flush() = 0;
 
-        slang::TypeLayoutReflection* GetTypeLayout() const { return _blockTypeLayout; }
+        const ShaderTypeLayout* GetTypeLayout() const { return _blockTypeLayout; }
 
     protected:
-        slang::TypeLayoutReflection* _blockTypeLayout;
+        const ShaderTypeLayout* _blockTypeLayout;
 
     protected:
-        ShaderBufferInterface(slang::TypeLayoutReflection* blockTypeLayout);
+        ShaderBufferInterface(const ShaderTypeLayout* blockTypeLayout);
     };
 } // Coco
 
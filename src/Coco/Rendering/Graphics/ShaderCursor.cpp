@@ -6,7 +6,6 @@
 #include "Resources/ShaderProgram.h"
 #include "Coco/Core/Engine.h"
 #include "Coco/Rendering/Texture.h"
-#include <slang.h>
 
 namespace Coco
 {
@@ -33,7 +32,7 @@ namespace Coco
         _bufferInterface(bufferInterface)
     {}
 
-    ShaderCursor::ShaderCursor(slang::TypeLayoutReflection* typeLayout, const ShaderElementLocation& location, ShaderBufferInterface* bufferInterface) :
+    ShaderCursor::ShaderCursor(const ShaderTypeLayout* typeLayout, const ShaderElementLocation& location, ShaderBufferInterface* bufferInterface) :
         _typeLayout(typeLayout),
         _currentLocation(location),
         _bufferInterface(bufferInterface)
@@ -54,7 +53,7 @@ namespace Coco
 
     ShaderCursor ShaderCursor::Field(const char* name) const
     {
-        int fieldIndex = static_cast<int>(_typeLayout->findFieldIndexByName(name));
+        int fieldIndex = static_cast<int>(_typeLayout->FindFieldIndexByName(name));
         if (fieldIndex == -1)
         {
             COCO_ENGINE_LOG_ERROR("Invalid ShaderCursor field name \"%s\"", name);
@@ -66,35 +65,35 @@ namespace Coco
 
     ShaderCursor ShaderCursor::Field(uint32 index) const
     {
-        if (index >= _typeLayout->getFieldCount())
+        if (index >= _typeLayout->Fields.GetCount())
         {
-            COCO_ENGINE_LOG_ERROR("Invalid ShaderCursor field index. 0 < %u < %u", index, _typeLayout->getFieldCount());
+            COCO_ENGINE_LOG_ERROR("Invalid ShaderCursor field index. 0 < %u < %u", index, static_cast<uint32>(_typeLayout->Fields.GetCount()));
             return ShaderCursor();
         }
 
-        auto field = _typeLayout->getFieldByIndex(index);
+        const ShaderFieldLayout& field = _typeLayout->Fields[index];
 
         ShaderElementLocation newLocation = _currentLocation;
-        newLocation.ByteOffset += field->getOffset();
-        newLocation.BindingRangeOffset += field->getBindingIndex();
+        newLocation.ByteOffset += field.Offset;
+        newLocation.BindingRangeOffset += field.BindingIndex;
 
-        return ShaderCursor(field->getTypeLayout(), newLocation, _bufferInterface);
+        return ShaderCursor(field.TypeLayout, newLocation, _bufferInterface);
     }
 
     ShaderCursor ShaderCursor::ArrayElement(uint32 index) const
     {
-        auto elementTypeLayout = _typeLayout->getElementTypeLayout();
-        if (index >= _typeLayout->getElementCount())
+        const ShaderTypeLayout* elementTypeLayout = _typeLayout->ElementTypeLayout;
+        if (index >= _typeLayout->ElementCount)
         {
-            COCO_ENGINE_LOG_ERROR("Invalid ShaderCursor array element. 0 < %u < %u", index, _typeLayout->getElementCount());
+            COCO_ENGINE_LOG_ERROR("Invalid ShaderCursor array element. 0 < %u < %u", index, static_cast<uint32>(_typeLayout->ElementCount));
             return ShaderCursor();
         }
 
         ShaderElementLocation newLocation = _currentLocation;
-        newLocation.ByteOffset += index * elementTypeLayout->getStride();
+        newLocation.ByteOffset += index * elementTypeLayout->Stride;
 
         // https://docs.shader-slang.org/en/latest/shader-cursors.html#elements
-        newLocation.ArrayIndexInBindingRange *= _currentLocation.ArrayIndexInBindingRange * _typeLayout->getElementCount();
+        newLocation.ArrayIndexInBindingRange *= _currentLocation.ArrayIndexInBindingRange * _typeLayout->ElementCount;
         newLocation.ArrayIndexInBindingRange += index;
 
         return ShaderCursor(elementTypeLayout, newLocation, _bufferInterface);
@@ -212,6 +211,10 @@ namespace Coco
         if (!_bufferInterface)
             return;
 
-        _bufferInterface->Write(_currentLocation, texture.get());
+        // uint fields hold the texture's index in the bindless texture table instead of binding the texture
+        if (_typeLayout->Kind == slang::TypeReflection::Kind::Scalar && _typeLayout->ScalarType == slang::TypeReflection::ScalarType::UInt32)
+            _bufferInterface->WriteTextureIndex(_currentLocation, texture.get());
+        else
+            _bufferInterface->Write(_currentLocation, texture.get());
     }
 } // Coco
\ No newline at end of file
@@ -14,11 +14,6 @@
 #include "Coco/Rendering/ShaderTypes.h"
 #include <Coco/Core/Memory/Ptrs.h>
 
-namespace slang
-{
-    class TypeLayoutReflection;
-}
-
 namespace Coco
 {
     class ShaderProgram;
@@ -39,7 +34,7 @@ namespace Coco
     public:
         ShaderCursor();
         ShaderCursor(ShaderBufferInterface* bufferInterface);
-        ShaderCursor(slang::TypeLayoutReflection* typeLayout, const ShaderElementLocation& location, ShaderBufferInterface* bufferInterface);
+        ShaderCursor(const ShaderTypeLayout* typeLayout, const ShaderElementLocation& location, ShaderBufferInterface* bufferInterface);
         ~ShaderCursor();
 
         operator bool() const { return IsValid(); }
@@ -68,7 +63,7 @@ namespace Coco
         bool IsValid() const { return _bufferInterface != nullptr; }
 
     private:
-        slang::TypeLayoutReflection* _typeLayout;
+        const ShaderTypeLayout* _typeLayout;
         ShaderElementLocation _currentLocation;
         ShaderBufferInterface* _bufferInterface;
     };
@@ -0,0 +1,241 @@
+//
+// Created by cullen on 10/18/26.
+//
+
+#include "ShaderLayout.h"
+
+#include "Coco/Core/Asserts.h"
+
+namespace Coco
+{
+    ShaderTypeLayout::ShaderTypeLayout(uint32 index) :
+        Index(index),
+        Kind(slang::TypeReflection::Kind::None),
+        ScalarType(slang::TypeReflection::ScalarType::None),
+        ResourceShape(SLANG_RESOURCE_NONE),
+        RowCount(0),
+        ColumnCount(0),
+        Size(0),
+        Stride(0),
+        ElementCount(0),
+        ElementTypeLayout(nullptr),
+        Fields(),
+        DescriptorSets(),
+        SubObjectRanges()
+    {}
+
+    int64 ShaderTypeLayout::FindFieldIndexByName(const char* name) const
+    {
+        for (uint64 i = 0; i < Fields.GetCount(); i++)
+        {
+            if (Fields[i].Name == name)
+                return static_cast<int64>(i);
+        }
+
+        return -1;
+    }
+
+    const ShaderSubObjectRangeLayout* ShaderTypeLayout::FindSubObjectRangeForField(const ShaderFieldLayout& field) const
+    {
+        for (const ShaderSubObjectRangeLayout& range : SubObjectRanges)
+        {
+            if (range.BindingRangeIndex == field.BindingRangeOffset)
+                return &range;
+        }
+
+        return nullptr;
+    }
+
+    ShaderProgramLayout::ShaderProgramLayout() :
+        _typeLayouts(),
+        _globalParamsTypeLayout(nullptr),
+        _entryPoints(),
+        _vertexChannels()
+    {}
+
+    ShaderTypeLayout& ShaderProgramLayout::AddTypeLayout()
+    {
+        const uint32 index = static_cast<uint32>(_typeLayouts.GetCount());
+        return *_typeLayouts.EmplaceBack(CreateDefaultUnique<ShaderTypeLayout>(index));
+    }
+
+    void ShaderProgramLayout::AddEntryPoint(SlangStage stage, const ShaderTypeLayout* typeLayout)
+    {
+        ShaderEntryPointLayout& entryPoint = _entryPoints.EmplaceBack();
+        entryPoint.Stage = stage;
+        entryPoint.TypeLayout = typeLayout;
+    }
+
+    const ShaderTypeLayout* ShaderProgramLayout::GetParamBlockLayout(uint64 index) const
+    {
+        COCO_ASSERT(_globalParamsTypeLayout && index < _globalParamsTypeLayout->Fields.GetCount(), "Invalid field index");
+
+        return _globalParamsTypeLayout->Fields[index].TypeLayout->ElementTypeLayout;
+    }
+
+    void ShaderProgramLayout::Serialize(BinaryWriter& writer) const
+    {
+        // Every layout is created before any are linked on load, so layouts may reference any other by index
+        writer.Write(static_cast<uint32>(_typeLayouts.GetCount()));
+
+        for (const auto& typeLayout : _typeLayouts)
+        {
+            writer.Write(static_cast<int32>(typeLayout->Kind));
+            writer.Write(static_cast<int32>(typeLayout->ScalarType));
+            writer.Write(static_cast<int32>(typeLayout->ResourceShape));
+            writer.Write(typeLayout->RowCount);
+            writer.Write(typeLayout->ColumnCount);
+            writer.Write(typeLayout->Size);
+            writer.Write(typeLayout->Stride);
+            writer.Write(typeLayout->ElementCount);
+            WriteTypeLayoutIndex(writer, typeLayout->ElementTypeLayout);
+
+            writer.Write(static_cast<uint32>(typeLayout->Fields.GetCount()));
+            for (const ShaderFieldLayout& field : typeLayout->Fields)
+            {
+                writer.WriteString(field.Name);
+                writer.Write(field.Offset);
+                writer.Write(field.BindingIndex);
+                writer.Write(field.BindingRangeOffset);
+                WriteTypeLayoutIndex(writer, field.TypeLayout);
+            }
+
+            writer.Write(static_cast<uint32>(typeLayout->DescriptorSets.GetCount()));
+            for (const ShaderDescriptorSetLayout& set : typeLayout->DescriptorSets)
+            {
+                writer.Write(set.SpaceOffset);
+                writer.Write(static_cast<uint32>(set.DescriptorRanges.GetCount()));
+                for (const ShaderDescriptorRangeLayout& range : set.DescriptorRanges)
+                {
+                    writer.Write(static_cast<int32>(range.BindingType));
+                    writer.Write(range.DescriptorCount);
+                }
+            }
+
+            writer.Write(static_cast<uint32>(typeLayout->SubObjectRanges.GetCount()));
+            for (const ShaderSubObjectRangeLayout& range : typeLayout->SubObjectRanges)
+            {
+                writer.Write(static_cast<int32>(range.BindingType));
+                writer.Write(range.BindingRangeIndex);
+                writer.Write(range.SpaceOffset);
+                WriteTypeLayoutIndex(writer, range.LeafTypeLayout);
+            }
+        }
+
+        WriteTypeLayoutIndex(writer, _globalParamsTypeLayout);
+
+        writer.Write(static_cast<uint32>(_entryPoints.GetCount()));
+        for (const ShaderEntryPointLayout& entryPoint : _entryPoints)
+        {
+            writer.Write(static_cast<int32>(entryPoint.Stage));
+            WriteTypeLayoutIndex(writer, entryPoint.TypeLayout);
+        }
+
+        writer.Write(static_cast<uint32>(_vertexChannels.GetCount()));
+        for (const VertexChannel channel : _vertexChannels)
+            writer.Write(static_cast<uint8>(channel));
+    }
+
+    bool ShaderProgramLayout::TryDeserialize(BinaryReader& reader, ShaderProgramLayout& outLayout)
+    {
+        COCO_ASSERT(outLayout._typeLayouts.IsEmpty(), "Layouts can only be read into an empty program layout");
+
+        const uint32 typeLayoutCount = reader.Read<uint32>();
+        if (reader.HasFailed() || typeLayoutCount > reader.GetRemaining())
+            return false;
+
+        for (uint32 i = 0; i < typeLayoutCount; i++)
+            outLayout.AddTypeLayout();
+
+        bool isValid = true;
+
+        for (const auto& typeLayout : outLayout._typeLayouts)
+        {
+            typeLayout->Kind = static_cast<slang::TypeReflection::Kind>(reader.Read<int32>());
+            typeLayout->ScalarType = static_cast<slang::TypeReflection::ScalarType>(reader.Read<int32>());
+            typeLayout->ResourceShape = static_cast<SlangResourceShape>(reader.Read<int32>());
+            typeLayout->RowCount = reader.Read<uint32>();
+            typeLayout->ColumnCount = reader.Read<uint32>();
+            typeLayout->Size = reader.Read<uint64>();
+            typeLayout->Stride = reader.Read<uint64>();
+            typeLayout->ElementCount = reader.Read<uint64>();
+            typeLayout->ElementTypeLayout = outLayout.ReadTypeLayoutIndex(reader, isValid);
+
+            const uint32 fieldCount = reader.Read<uint32>();
+            for (uint32 i = 0; i < fieldCount && isValid && !reader.HasFailed(); i++)
+            {
+                const String name = reader.ReadString();
+
+                ShaderFieldLayout& field = typeLayout->Fields.EmplaceBack();
+                field.Name = name;
+                field.Offset = reader.Read<uint64>();
+                field.BindingIndex = reader.Read<uint32>();
+                field.BindingRangeOffset = reader.Read<uint32>();
+                field.TypeLayout = outLayout.ReadTypeLayoutIndex(reader, isValid);
+            }
+
+            const uint32 setCount = reader.Read<uint32>();
+            for (uint32 i = 0; i < setCount && !reader.HasFailed(); i++)
+            {
+                ShaderDescriptorSetLayout& set = typeLayout->DescriptorSets.EmplaceBack();
+                set.SpaceOffset = reader.Read<uint32>();
+                const uint32 rangeCount = reader.Read<uint32>();
+
+                for (uint32 j = 0; j < rangeCount && !reader.HasFailed(); j++)
+                {
+                    ShaderDescriptorRangeLayout& range = set.DescriptorRanges.EmplaceBack();
+                    range.BindingType = static_cast<slang::BindingType>(reader.Read<int32>());
+                    range.DescriptorCount = reader.Read<uint64>();
+                }
+            }
+
+            const uint32 subObjectRangeCount = reader.Read<uint32>();
+            for (uint32 i = 0; i < subObjectRangeCount && isValid && !reader.HasFailed(); i++)
+            {
+                ShaderSubObjectRangeLayout& range = typeLayout->SubObjectRanges.EmplaceBack();
+                range.BindingType = static_cast<slang::BindingType>(reader.Read<int32>());
+                range.BindingRangeIndex = reader.Read<uint32>();
+                range.SpaceOffset = reader.Read<uint32>();
+                range.LeafTypeLayout = outLayout.ReadTypeLayoutIndex(reader, isValid);
+            }
+
+            if (!isValid || reader.HasFailed())
+                return false;
+        }
+
+        outLayout._globalParamsTypeLayout = outLayout.ReadTypeLayoutIndex(reader, isValid);
+
+        const uint32 entryPointCount = reader.Read<uint32>();
+        for (uint32 i = 0; i < entryPointCount && isValid && !reader.HasFailed(); i++)
+        {
+            const SlangStage stage = static_cast<SlangStage>(reader.Read<int32>());
+            outLayout.AddEntryPoint(stage, outLayout.ReadTypeLayoutIndex(reader, isValid));
+        }
+
+        const uint32 vertexChannelCount = reader.Read<uint32>();
+        for (uint32 i = 0; i < vertexChannelCount && !reader.HasFailed(); i++)
+            outLayout.AddVertexChannel(static_cast<VertexChannel>(reader.Read<uint8>()));
+
+        return isValid && !reader.HasFailed() && outLayout._globalParamsTypeLayout;
+    }
+
+    void ShaderProgramLayout::WriteTypeLayoutIndex(BinaryWriter& writer, const ShaderTypeLayout* typeLayout)
+    {
+        writer.Write(typeLayout ? typeLayout->Index : _nullTypeLayoutIndex);
+    }
+
+    const ShaderTypeLayout* ShaderProgramLayout::ReadTypeLayoutIndex(BinaryReader& reader, bool& outIsValid) const
+    {
+        const uint32 index = reader.Read<uint32>();
+        if (index == _nullTypeLayoutIndex)
+            return nullptr;
+
+        if (index >= _typeLayouts.GetCount())
+        {
+            outIsValid = false;
+            return nullptr;
+        }
+
+        return _typeLayouts[index].get();
+    }
+} // Coco
\ No newline at end of file
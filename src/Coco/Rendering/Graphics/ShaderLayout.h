@@ -0,0 +1,180 @@
+//
+// Created by cullen on 10/18/26.
+//
+
+#ifndef COCOENGINE_SHADERLAYOUT_H
+#define COCOENGINE_SHADERLAYOUT_H
+#include "Coco/Core/Types/Array.h"
+#include "Coco/Core/Types/String.h"
+#include "Coco/Core/Memory/Ptrs.h"
+#include "Coco/Core/IO/BinaryData.h"
+#include "VertexDataTypes.h"
+
+#include <slang.h>
+
+namespace Coco
+{
+    struct ShaderTypeLayout;
+
+    /// @brief The layout of a field of a struct
+    struct ShaderFieldLayout
+    {
+        String Name;
+
+        /// @brief The byte offset of the field's uniform data within its parent
+        uint64 Offset;
+
+        /// @brief The binding index of the field's first resource within its parent
+        uint32 BindingIndex;
+
+        /// @brief The index of the field's first binding range within its parent
+        uint32 BindingRangeOffset;
+
+        const ShaderTypeLayout* TypeLayout;
+    };
+
+    /// @brief A range of descriptors in a descriptor set
+    struct ShaderDescriptorRangeLayout
+    {
+        slang::BindingType BindingType;
+
+        /// @brief The number of descriptors, or SLANG_UNBOUNDED_SIZE for an unbounded array
+        uint64 DescriptorCount;
+    };
+
+    /// @brief The descriptor ranges that a type places in one descriptor set
+    struct ShaderDescriptorSetLayout
+    {
+        /// @brief The offset of the set's register space from the space of the type that owns it
+        uint32 SpaceOffset;
+
+        Array<ShaderDescriptorRangeLayout> DescriptorRanges;
+    };
+
+    /// @brief A binding range that contains a sub-object, such as a parameter block or push constant buffer
+    struct ShaderSubObjectRangeLayout
+    {
+        slang::BindingType BindingType;
+
+        /// @brief The index of the binding range that contains the sub-object
+        uint32 BindingRangeIndex;
+
+        /// @brief The offset of the sub-object's register space from the space of the type that owns it
+        uint32 SpaceOffset;
+
+        const ShaderTypeLayout* LeafTypeLayout;
+    };
+
+    /// @brief The layout of a shader type. Mirrors the parts of Slang's type layout reflection that the engine uses,
+    /// so that it can be stored in the shader cache and used without linking the program
+    struct ShaderTypeLayout
+    {
+        /// @brief The index of this layout within the program layout that owns it
+        uint32 Index;
+
+        slang::TypeReflection::Kind Kind;
+        slang::TypeReflection::ScalarType ScalarType;
+        SlangResourceShape ResourceShape;
+        uint32 RowCount;
+        uint32 ColumnCount;
+
+        /// @brief The size of the uniform data of the type
+        uint64 Size;
+
+        /// @brief The stride between elements of an array of the type
+        uint64 Stride;
+
+        /// @brief The number of elements if this is an array
+        uint64 ElementCount;
+
+        /// @brief The element type if this is an array, parameter block, or constant buffer
+        const ShaderTypeLayout* ElementTypeLayout;
+
+        Array<ShaderFieldLayout> Fields;
+        Array<ShaderDescriptorSetLayout> DescriptorSets;
+        Array<ShaderSubObjectRangeLayout> SubObjectRanges;
+
+        ShaderTypeLayout(uint32 index);
+
+        /// @brief Finds the index of a field
+        /// @param name The name of the field
+        /// @return The index of the field, or -1 if no field has the name
+        int64 FindFieldIndexByName(const char* name) const;
+
+        /// @brief Finds the sub-object range that a field occupies
+        /// @param field The field, which must belong to this type
+        /// @return The sub-object range, or nullptr if the field isn't a sub-object
+        const ShaderSubObjectRangeLayout* FindSubObjectRangeForField(const ShaderFieldLayout& field) const;
+    };
+
+    /// @brief An entry point of a shader program
+    struct ShaderEntryPointLayout
+    {
+        SlangStage Stage;
+        const ShaderTypeLayout* TypeLayout;
+    };
+
+    /// @brief The reflected layout of a linked shader program
+    class ShaderProgramLayout
+    {
+    public:
+        ShaderProgramLayout();
+
+        ShaderProgramLayout(const ShaderProgramLayout&) = delete;
+        ShaderProgramLayout& operator=(const ShaderProgramLayout&) = delete;
+
+        /// @brief Adds a new type layout owned by this program layout
+        /// @return The type layout
+        ShaderTypeLayout& AddTypeLayout();
+
+        /// @brief Gets the layout of the program's global parameters
+        /// @return The global parameters' layout
+        const ShaderTypeLayout* GetGlobalParamsTypeLayout() const { return _globalParamsTypeLayout; }
+
+        /// @brief Sets the layout of the program's global parameters
+        /// @param typeLayout The global parameters' layout
+        void SetGlobalParamsTypeLayout(const ShaderTypeLayout* typeLayout) { _globalParamsTypeLayout = typeLayout; }
+
+        /// @brief Adds an entry point to the program
+        /// @param stage The stage of the entry point
+        /// @param typeLayout The layout of the entry point's parameters
+        void AddEntryPoint(SlangStage stage, const ShaderTypeLayout* typeLayout);
+
+        Span<const ShaderEntryPointLayout> GetEntryPoints() const { return _entryPoints; }
+
+        /// @brief Adds a vertex channel that the program's vertex entry point reads
+        /// @param channel The channel
+        void AddVertexChannel(VertexChannel channel) { _vertexChannels.Append(channel); }
+
+        Span<const VertexChannel> GetVertexChannels() const { return _vertexChannels; }
+
+        /// @brief Gets the element layout of a global parameter block
+        /// @param index The index of the parameter block's field in the global parameters
+        /// @return The layout of the parameter block's element type
+        const ShaderTypeLayout* GetParamBlockLayout(uint64 index) const;
+
+        /// @brief Writes this layout
+        /// @param writer The writer
+        void Serialize(BinaryWriter& writer) const;
+
+        /// @brief Reads a layout that was written with Serialize()
+        /// @param reader The reader
+        /// @param outLayout The layout to read into. Must be empty
+        /// @return True if the layout was read successfully
+        static bool TryDeserialize(BinaryReader& reader, ShaderProgramLayout& outLayout);
+
+    private:
+        static constexpr uint32 _nullTypeLayoutIndex = std::numeric_limits<uint32>::max();
+
+        Array<UniquePtr<ShaderTypeLayout>> _typeLayouts;
+        const ShaderTypeLayout* _globalParamsTypeLayout;
+        Array<ShaderEntryPointLayout> _entryPoints;
+        Array<VertexChannel> _vertexChannels;
+
+    private:
+        static void WriteTypeLayoutIndex(BinaryWriter& writer, const ShaderTypeLayout* typeLayout);
+        const ShaderTypeLayout* ReadTypeLayoutIndex(BinaryReader& reader, bool& outIsValid) const;
+    };
+} // Coco
+
+#endif //COCOENGINE_SHADERLAYOUT_H
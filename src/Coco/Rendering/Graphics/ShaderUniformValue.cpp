@@ -4,7 +4,7 @@
 
 #include "ShaderUniformValue.h"
 #include "ShaderCursor.h"
-#include <slang.h>
+#include "ShaderLayout.h"
 
 namespace Coco
 {
@@ -108,12 +108,12 @@ namespace Coco
         _value(value)
     {}
 
-    bool ShaderUniformValue::TryCreateFromField(slang::VariableLayoutReflection* field, ShaderUniformValue& outUniform)
+    bool ShaderUniformValue::TryCreateFromField(const ShaderFieldLayout& field, ShaderUniformValue& outUniform)
     {
-        auto fieldLayout = field->getTypeLayout();
-        auto kind = fieldLayout->getKind();
-        auto columns = fieldLayout->getColumnCount();
-        auto rows = fieldLayout->getRowCount();
+        const ShaderTypeLayout* fieldLayout = field.TypeLayout;
+        auto kind = fieldLayout->Kind;
+        auto columns = fieldLayout->ColumnCount;
+        auto rows = fieldLayout->RowCount;
 
         bool isValid = true;
 
@@ -123,7 +123,7 @@ namespace Coco
             case slang::TypeReflection::Kind::Vector:
             case slang::TypeReflection::Kind::Matrix:
             {
-                auto type = fieldLayout->getScalarType();
+                auto type = fieldLayout->ScalarType;
                 switch (type)
                 {
                     case slang::TypeReflection::ScalarType::Float32:
@@ -211,7 +211,7 @@ namespace Coco
             }
             case slang::TypeReflection::Kind::Resource:
             {
-                auto shape = fieldLayout->getResourceShape();
+                auto shape = fieldLayout->ResourceShape;
                 switch (shape & SLANG_RESOURCE_BASE_SHAPE_MASK)
                 {
                     case SLANG_TEXTURE_2D:
@@ -232,14 +232,13 @@ namespace Coco
         if (!isValid)
             return false;
 
-        outUniform._name = field->getName();
+        outUniform._name = field.Name;
         return true;
     }
 
-    void ShaderUniformValue::SetValue(float value)
+    bool ShaderUniformValue::SetValue(float value)
     {
-        _type = ShaderUniformType::Float;
-        _value = value;
+        return Assign(ShaderUniformType::Float, value);
     }
 
     float ShaderUniformValue::AsFloat() const
@@ -250,10 +249,9 @@ namespace Coco
         return std::get<float>(_value);
     }
 
-    void ShaderUniformValue::SetValue(const Vector2& value)
+    bool ShaderUniformValue::SetValue(const Vector2& value)
     {
-        _type = ShaderUniformType::Float2;
-        _value = value;
+        return Assign(ShaderUniformType::Float2, value);
     }
 
     Vector2 ShaderUniformValue::AsFloat2() const
@@ -264,10 +262,9 @@ namespace Coco
         return std::get<Vector2>(_value);
     }
 
-    void ShaderUniformValue::SetValue(const Vector3& value)
+    bool ShaderUniformValue::SetValue(const Vector3& value)
     {
-        _type = ShaderUniformType::Float3;
-        _value = value;
+        return Assign(ShaderUniformType::Float3, value);
     }
 
     Vector3 ShaderUniformValue::AsFloat3() const
@@ -278,10 +275,9 @@ namespace Coco
         return std::get<Vector3>(_value);
     }
 
-    void ShaderUniformValue::SetValue(const Vector4& value)
+    bool ShaderUniformValue::SetValue(const Vector4& value)
     {
-        _type = ShaderUniformType::Float4;
-        _value = value;
+        return Assign(ShaderUniformType::Float4, value);
     }
 
     Vector4 ShaderUniformValue::AsFloat4() const
@@ -292,10 +288,9 @@ namespace Coco
         return std::get<Vector4>(_value);
     }
 
-    void ShaderUniformValue::SetValue(int value)
+    bool ShaderUniformValue::SetValue(int value)
     {
-        _type = ShaderUniformType::Int;
-        _value = value;
+        return Assign(ShaderUniformType::Int, value);
     }
 
     int ShaderUniformValue::AsInt() const
@@ -306,10 +301,9 @@ namespace Coco
         return std::get<int>(_value);
     }
 
-    void ShaderUniformValue::SetValue(const Vector2i& value)
+    bool ShaderUniformValue::SetValue(const Vector2i& value)
     {
-        _type = ShaderUniformType::Int2;
-        _value = value;
+        return Assign(ShaderUniformType::Int2, value);
     }
 
     Vector2i ShaderUniformValue::AsInt2() const
@@ -320,10 +314,9 @@ namespace Coco
         return std::get<Vector2i>(_value);
     }
 
-    void ShaderUniformValue::SetValue(const Vector3i& value)
+    bool ShaderUniformValue::SetValue(const Vector3i& value)
     {
-        _type = ShaderUniformType::Int3;
-        _value = value;
+        return Assign(ShaderUniformType::Int3, value);
     }
 
     Vector3i ShaderUniformValue::AsInt3() const
@@ -334,10 +327,9 @@ namespace Coco
         return std::get<Vector3i>(_value);
     }
 
-    void ShaderUniformValue::SetValue(const Vector4i& value)
+    bool ShaderUniformValue::SetValue(const Vector4i& value)
     {
-        _type = ShaderUniformType::Int4;
-        _value = value;
+        return Assign(ShaderUniformType::Int4, value);
     }
 
     Vector4i ShaderUniformValue::AsInt4() const
@@ -348,10 +340,9 @@ namespace Coco
         return std::get<Vector4i>(_value);
     }
 
-    void ShaderUniformValue::SetValue(uint32 value)
+    bool ShaderUniformValue::SetValue(uint32 value)
     {
-        _type = ShaderUniformType::UInt;
-        _value = value;
+        return Assign(ShaderUniformType::UInt, value);
     }
 
     uint32 ShaderUniformValue::AsUInt() const
@@ -362,10 +353,9 @@ namespace Coco
         return std::get<uint32>(_value);
     }
 
-    void ShaderUniformValue::SetValue(Span<const uint32, 2> value)
+    bool ShaderUniformValue::SetValue(Span<const uint32, 2> value)
     {
-        _type = ShaderUniformType::UInt2;
-        _value = Vector2i(static_cast<int>(value[0]), static_cast<int>(value[1]));
+        return Assign(ShaderUniformType::UInt2, Vector2i(static_cast<int>(value[0]), static_cast<int>(value[1])));
     }
 
     Span<const uint32, 2> ShaderUniformValue::AsUInt2() const
@@ -377,10 +367,9 @@ namespace Coco
         return Span<const uint32, 2>(reinterpret_cast<const uint32*>(v->Raw), 2);
     }
 
-    void ShaderUniformValue::SetValue(Span<const uint32, 3> value)
+    bool ShaderUniformValue::SetValue(Span<const uint32, 3> value)
     {
-        _type = ShaderUniformType::UInt3;
-        _value = Vector3i(static_cast<int>(value[0]), static_cast<int>(value[1]), static_cast<int>(value[2]));
+        return Assign(ShaderUniformType::UInt3, Vector3i(static_cast<int>(value[0]), static_cast<int>(value[1]), static_cast<int>(value[2])));
     }
 
     Span<const uint32, 3> ShaderUniformValue::AsUInt3() const
@@ -392,10 +381,9 @@ namespace Coco
         return Span<const uint32, 3>(reinterpret_cast<const uint32*>(v->Raw), 3);
     }
 
-    void ShaderUniformValue::SetValue(Span<const uint32, 4> value)
+    bool ShaderUniformValue::SetValue(Span<const uint32, 4> value)
     {
-        _type = ShaderUniformType::UInt4;
-        _value = Vector4i(static_cast<int>(value[0]), static_cast<int>(value[1]), static_cast<int>(value[2]), static_cast<int>(value[3]));
+        return Assign(ShaderUniformType::UInt4, Vector4i(static_cast<int>(value[0]), static_cast<int>(value[1]), static_cast<int>(value[2]), static_cast<int>(value[3])));
     }
 
     Span<const uint32, 4> ShaderUniformValue::AsUInt4() const
@@ -407,10 +395,9 @@ namespace Coco
         return Span<const uint32, 4>(reinterpret_cast<const uint32*>(v->Raw), 4);
     }
 
-    void ShaderUniformValue::SetValue(bool value)
+    bool ShaderUniformValue::SetValue(bool value)
     {
-        _type = ShaderUniformType::Bool;
-        _value = value;
+        return Assign(ShaderUniformType::Bool, value);
     }
 
     bool ShaderUniformValue::AsBool() const
@@ -421,9 +408,9 @@ namespace Coco
         return std::get<bool>(_value);
     }
 
-    void ShaderUniformValue::SetValue(const Color& color)
+    bool ShaderUniformValue::SetValue(const Color& color)
     {
-        SetValue(color.AsVector4(false));
+        return SetValue(color.AsVector4(false));
     }
 
     Color ShaderUniformValue::AsColor() const
@@ -431,10 +418,9 @@ namespace Coco
         return Color(AsFloat4(), false);
     }
 
-    void ShaderUniformValue::SetValue(const Matrix4x4& value)
+    bool ShaderUniformValue::SetValue(const Matrix4x4& value)
     {
-        _type = ShaderUniformType::Matrix4x4;
-        _value = value;
+        return Assign(ShaderUniformType::Matrix4x4, value);
     }
 
     Matrix4x4 ShaderUniformValue::AsMatrix4x4() const
@@ -445,10 +431,9 @@ namespace Coco
         return std::get<Matrix4x4>(_value);
     }
 
-    void ShaderUniformValue::SetValue(const SharedPtr<Texture>& value)
+    bool ShaderUniformValue::SetValue(const SharedPtr<Texture>& value)
     {
-        _type = ShaderUniformType::Texture;
-        _value = value;
+        return Assign(ShaderUniformType::Texture, value);
     }
 
     SharedPtr<Texture> ShaderUniformValue::AsTexture() const
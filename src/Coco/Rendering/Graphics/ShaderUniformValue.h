@@ -12,16 +12,14 @@
 #include "Coco/Core/Memory/Ptrs.h"
 #include "Coco/Rendering/Texture.h"
 #include "Coco/Rendering/RenderGraph/RenderGraphTypes.h"
+#include <cstring>
+#include <type_traits>
 #include <variant>
 
-namespace slang
-{
-    struct VariableLayoutReflection;
-}
-
 namespace Coco
 {
     class ShaderCursor;
+    struct ShaderFieldLayout;
 
     /// @brief Shader uniform types
     enum class ShaderUniformType : uint8
@@ -73,62 +71,92 @@ namespace Coco
         ShaderUniformValue(const char* name, const Matrix4x4& value);
         ShaderUniformValue(const char* name, SharedPtr<Texture> value);
 
-        static bool TryCreateFromField(slang::VariableLayoutReflection* field, ShaderUniformValue& outUniform);
+        static bool TryCreateFromField(const ShaderFieldLayout& field, ShaderUniformValue& outUniform);
 
         const String& GetName() const { return _name; }
         ShaderUniformType GetUniformType() const { return _type; }
 
-        void SetValue(float value);
+        bool SetValue(float value);
         float AsFloat() const;
 
-        void SetValue(const Vector2& value);
+        bool SetValue(const Vector2& value);
         Vector2 AsFloat2() const;
 
-        void SetValue(const Vector3& value);
+        bool SetValue(const Vector3& value);
         Vector3 AsFloat3() const;
 
-        void SetValue(const Vector4& value);
+        bool SetValue(const Vector4& value);
         Vector4 AsFloat4() const;
 
-        void SetValue(int value);
+        bool SetValue(int value);
         int AsInt() const;
 
-        void SetValue(const Vector2i& value);
+        bool SetValue(const Vector2i& value);
         Vector2i AsInt2() const;
 
-        void SetValue(const Vector3i& value);
+        bool SetValue(const Vector3i& value);
         Vector3i AsInt3() const;
 
-        void SetValue(const Vector4i& value);
+        bool SetValue(const Vector4i& value);
         Vector4i AsInt4() const;
 
-        void SetValue(uint32 value);
+        bool SetValue(uint32 value);
         uint32 AsUInt() const;
 
-        void SetValue(Span<const uint32, 2> value);
+        bool SetValue(Span<const uint32, 2> value);
         Span<const uint32, 2> AsUInt2() const;
 
-        void SetValue(Span<const uint32, 3> value);
+        bool SetValue(Span<const uint32, 3> value);
         Span<const uint32, 3> AsUInt3() const;
 
-        void SetValue(Span<const uint32, 4> value);
+        bool SetValue(Span<const uint32, 4> value);
         Span<const uint32, 4> AsUInt4() const;
 
-        void SetValue(bool value);
+        bool SetValue(bool value);
         bool AsBool() const;
 
-        void SetValue(const Color& color);
+        bool SetValue(const Color& color);
         Color AsColor() const;
 
-        void SetValue(const Matrix4x4& value);
+        bool SetValue(const Matrix4x4& value);
         Matrix4x4 AsMatrix4x4() const;
 
-        void SetValue(const SharedPtr<Texture>& value);
+        bool SetValue(const SharedPtr<Texture>& value);
         SharedPtr<Texture> AsTexture() const;
 
         void WriteInto(const ShaderCursor& cursor) const;
 
     private:
+        /// @brief Sets the value and type of this uniform if they differ from the current ones.
+        /// Plain data is compared bitwise, so a change between -0 and 0 still counts as a change
+        /// @tparam ValueType The type of value
+        /// @param type The uniform type of the value
+        /// @param value The value
+        /// @return True if the value or type changed
+        template<typename ValueType>
+        bool Assign(ShaderUniformType type, const ValueType& value)
+        {
+            if (_type == type && std::holds_alternative<ValueType>(_value))
+            {
+                const ValueType& current = std::get<ValueType>(_value);
+
+                if constexpr (std::is_trivially_copyable_v<ValueType>)
+                {
+                    if (memcmp(&current, &value, sizeof(ValueType)) == 0)
+                        return false;
+                }
+                else
+                {
+                    if (current == value)
+                        return false;
+                }
+            }
+
+            _type = type;
+            _value = value;
+            return true;
+        }
+
         String _name;
         ShaderUniformType _type;
         //ShaderUniformScalarType _scalarType;
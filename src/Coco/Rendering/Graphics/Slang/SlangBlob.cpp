@@ -12,6 +12,13 @@ namespace Coco
         _buffer.Resize(size);
     }
 
+    SlangBlob::SlangBlob(Span<const uint8> data) :
+        SlangBlob(data.size())
+    {
+        if (!data.empty())
+            memcpy(_buffer.Data(), data.data(), data.size());
+    }
+
     /*SlangResult SlangBlob::queryInterface(const SlangUUID& uuid, void** outObject)
     {
         ++_refCount;
@@ -15,6 +15,7 @@ namespace Coco
     {
     public:
         SlangBlob(uint64 size);
+        SlangBlob(Span<const uint8> data);
 
         //SlangResult queryInterface(const SlangUUID& uuid, void** outObject) override;
         //uint32_t addRef() override;
@@ -6,6 +6,7 @@
 
 #include "Coco/Core/Asserts.h"
 #include "Coco/Core/Engine.h"
+#include "SlangBlob.h"
 
 namespace Coco
 {
@@ -38,34 +39,130 @@ namespace Coco
 
         result = _globalSession->createSession(sessionDesc, _session.writeRef());
         COCO_ASSERT(SLANG_SUCCEEDED(result), "Failed to create Slang session: %s", slang::getLastInternalErrorMessage());
+
+        // Cached output is only valid for the same compiler build and settings
+        _shaderCache.emplace(Math::CombineHashes(
+            ToHash(_globalSession->getBuildTagString()),
+            static_cast<uint64>(compileTarget),
+            ToHash(profile),
+            static_cast<uint64>(sessionDesc.defaultMatrixLayoutMode),
+            ToHash(_vertexEntryPointName),
+            ToHash(_fragmentEntryPointName),
+            ToHash(_computeEntryPointName)));
     }
 
     SlangCompiler::~SlangCompiler()
     {
+        _shaderCache.reset();
         _session.setNull();
         _globalSession.setNull();
         slang::shutdown();
     }
 
-    void SlangCompiler::ReflectVertexAttributes(slang::ProgramLayout* programLayout,
-        ArrayContainer<VertexChannel>& outVertexChannels)
+    SlangCompiledProgram SlangCompiler::CompileShader(const FilePath& shaderFile)
+    {
+        const char* const entryPointNames[] = { _vertexEntryPointName, _fragmentEntryPointName };
+        return Compile(shaderFile, entryPointNames);
+    }
+
+    SlangCompiledProgram SlangCompiler::CompileComputeShader(const FilePath& shaderFile)
+    {
+        const char* const entryPointNames[] = { _computeEntryPointName };
+        return Compile(shaderFile, entryPointNames);
+    }
+
+    void SlangCompiler::PrintDiagnostics(slang::IBlob* diagnostics)
+    {
+        if (!diagnostics)
+            return;
+
+        COCO_ENGINE_LOG_INFO("%s", static_cast<const char*>(diagnostics->getBufferPointer()));
+    }
+
+    void SlangCompiler::ReflectProgramLayout(slang::ProgramLayout* programLayout, ShaderProgramLayout& outLayout)
     {
-        slang::EntryPointReflection* entryPointReflection = nullptr;
+        Map<slang::TypeLayoutReflection*, const ShaderTypeLayout*> reflectedTypeLayouts;
+
         for (uint8 i = 0; i < programLayout->getEntryPointCount(); i++)
         {
             auto entryPoint = programLayout->getEntryPointByIndex(i);
+            outLayout.AddEntryPoint(entryPoint->getStage(), ReflectTypeLayout(entryPoint->getTypeLayout(), outLayout, reflectedTypeLayouts));
+
             if (entryPoint->getStage() == SLANG_STAGE_VERTEX)
+                ReflectVertexAttributes(entryPoint, outLayout);
+        }
+
+        outLayout.SetGlobalParamsTypeLayout(ReflectTypeLayout(programLayout->getGlobalParamsTypeLayout(), outLayout, reflectedTypeLayouts));
+    }
+
+    const ShaderTypeLayout* SlangCompiler::ReflectTypeLayout(slang::TypeLayoutReflection* typeLayout, ShaderProgramLayout& outLayout,
+        Map<slang::TypeLayoutReflection*, const ShaderTypeLayout*>& reflectedTypeLayouts)
+    {
+        if (!typeLayout)
+            return nullptr;
+
+        if (const ShaderTypeLayout** existing = reflectedTypeLayouts.TryGetValue(typeLayout))
+            return *existing;
+
+        ShaderTypeLayout& layout = outLayout.AddTypeLayout();
+        reflectedTypeLayouts.Emplace(typeLayout, &layout);
+
+        layout.Kind = typeLayout->getKind();
+        layout.ScalarType = typeLayout->getScalarType();
+        layout.ResourceShape = typeLayout->getResourceShape();
+        layout.RowCount = typeLayout->getRowCount();
+        layout.ColumnCount = typeLayout->getColumnCount();
+        layout.Size = typeLayout->getSize();
+        layout.Stride = typeLayout->getStride();
+        layout.ElementCount = typeLayout->getElementCount();
+        layout.ElementTypeLayout = ReflectTypeLayout(typeLayout->getElementTypeLayout(), outLayout, reflectedTypeLayouts);
+
+        for (uint32 i = 0; i < typeLayout->getFieldCount(); i++)
+        {
+            auto field = typeLayout->getFieldByIndex(i);
+            const ShaderTypeLayout* fieldTypeLayout = ReflectTypeLayout(field->getTypeLayout(), outLayout, reflectedTypeLayouts);
+
+            ShaderFieldLayout& fieldLayout = layout.Fields.EmplaceBack();
+            fieldLayout.Name = field->getName();
+            fieldLayout.Offset = field->getOffset();
+            fieldLayout.BindingIndex = field->getBindingIndex();
+            fieldLayout.BindingRangeOffset = static_cast<uint32>(typeLayout->getFieldBindingRangeOffset(i));
+            fieldLayout.TypeLayout = fieldTypeLayout;
+        }
+
+        for (SlangInt setIndex = 0; setIndex < typeLayout->getDescriptorSetCount(); setIndex++)
+        {
+            ShaderDescriptorSetLayout& set = layout.DescriptorSets.EmplaceBack();
+            set.SpaceOffset = static_cast<uint32>(typeLayout->getDescriptorSetSpaceOffset(setIndex));
+
+            for (SlangInt rangeIndex = 0; rangeIndex < typeLayout->getDescriptorSetDescriptorRangeCount(setIndex); rangeIndex++)
             {
-                entryPointReflection = entryPoint;
-                break;
+                ShaderDescriptorRangeLayout& range = set.DescriptorRanges.EmplaceBack();
+                range.BindingType = typeLayout->getDescriptorSetDescriptorRangeType(setIndex, rangeIndex);
+                range.DescriptorCount = static_cast<uint64>(typeLayout->getDescriptorSetDescriptorRangeDescriptorCount(setIndex, rangeIndex));
             }
         }
 
-        COCO_ASSERT(entryPointReflection, "Failed to find vertex shader entry point");
+        for (SlangInt i = 0; i < typeLayout->getSubObjectRangeCount(); i++)
+        {
+            const SlangInt bindingRangeIndex = typeLayout->getSubObjectRangeBindingRangeIndex(i);
+            const ShaderTypeLayout* leafTypeLayout = ReflectTypeLayout(typeLayout->getBindingRangeLeafTypeLayout(bindingRangeIndex), outLayout, reflectedTypeLayouts);
+
+            ShaderSubObjectRangeLayout& range = layout.SubObjectRanges.EmplaceBack();
+            range.BindingType = typeLayout->getBindingRangeType(bindingRangeIndex);
+            range.BindingRangeIndex = static_cast<uint32>(bindingRangeIndex);
+            range.SpaceOffset = static_cast<uint32>(typeLayout->getSubObjectRangeSpaceOffset(i));
+            range.LeafTypeLayout = leafTypeLayout;
+        }
+
+        return &layout;
+    }
 
-        for (long i = 0; i < entryPointReflection->getParameterCount(); i++)
+    void SlangCompiler::ReflectVertexAttributes(slang::EntryPointReflection* entryPoint, ShaderProgramLayout& outLayout)
+    {
+        for (long i = 0; i < entryPoint->getParameterCount(); i++)
         {
-            auto param = entryPointReflection->getParameterByIndex(i);
+            auto param = entryPoint->getParameterByIndex(i);
             auto category = param->getCategory();
 
             if (category != slang::ParameterCategory::VaryingInput)
@@ -73,25 +170,29 @@ namespace Coco
 
             String semanticName(param->getSemanticName());
 
+            // System values, such as the instance ID, aren't read from vertex buffers
+            if (semanticName.StartsWith("SV_", false))
+                continue;
+
             if (semanticName.Contains("POSITION"))
             {
-                outVertexChannels.Append(VertexChannel::Position);
+                outLayout.AddVertexChannel(VertexChannel::Position);
             }
             else if (semanticName.Contains("NORMAL"))
             {
-                outVertexChannels.Append(VertexChannel::Normal);
+                outLayout.AddVertexChannel(VertexChannel::Normal);
             }
             else if (semanticName.Contains("TEXCOORD"))
             {
-                outVertexChannels.Append(VertexChannel::UV0);
+                outLayout.AddVertexChannel(VertexChannel::UV0);
             }
             else if (semanticName.Contains("COLOR"))
             {
-                outVertexChannels.Append(VertexChannel::Color);
+                outLayout.AddVertexChannel(VertexChannel::Color);
             }
             else if (semanticName.Contains("TANGENT"))
             {
-                outVertexChannels.Append(VertexChannel::Tangent);
+                outLayout.AddVertexChannel(VertexChannel::Tangent);
             }
             else
             {
@@ -100,16 +201,29 @@ namespace Coco
         }
     }
 
-    Slang::ComPtr<slang::IComponentType> SlangCompiler::CompileShader(const FilePath& shaderFile)
+    SlangCompiledProgram SlangCompiler::Compile(const FilePath& shaderFile, Span<const char* const> entryPointNames)
     {
-        COCO_ENGINE_LOG_VERBOSE("Loading and compiling shader \"%s\"", shaderFile.CStr());
-
         FileSystem* fs = Engine::Get()->GetFileSystem();
         File file = fs->Open(shaderFile, FileOpenFlags::Read, false);
         String fileText;
         file.ReadTextToEnd(fileText);
         file.Close();
 
+        SlangShaderCacheEntry cacheEntry;
+        SlangCompiledProgram compiledProgram;
+
+        // A cache hit skips every compilation step, since the entry holds both the generated code and the reflected layout
+        if (_shaderCache->TryLoad(shaderFile, fileText, cacheEntry))
+        {
+            COCO_ENGINE_LOG_VERBOSE("Loading cached shader \"%s\"", shaderFile.CStr());
+
+            compiledProgram.Layout = cacheEntry.Layout;
+            compiledProgram.TargetCode = new SlangBlob(cacheEntry.TargetCode);
+            return compiledProgram;
+        }
+
+        COCO_ENGINE_LOG_VERBOSE("Loading and compiling shader \"%s\"", shaderFile.CStr());
+
         String shaderName = shaderFile.GetFileName(false);
         Slang::ComPtr<slang::IBlob> diagnostics;
         Slang::ComPtr<slang::IModule> module;
@@ -119,21 +233,18 @@ namespace Coco
         if (!module)
             throw Exception("Failed to load module");
 
-        Slang::ComPtr<slang::IEntryPoint> vertexEntryPoint;
-        module->findEntryPointByName("vsMain", vertexEntryPoint.writeRef());
-        if (!vertexEntryPoint)
-            throw Exception("Failed to find vertex entry point");
+        StackArray<Slang::ComPtr<slang::IEntryPoint>, 2> entryPoints;
+        StackArray<slang::IComponentType*, 3> components = { module };
 
-        Slang::ComPtr<slang::IEntryPoint> fragmentEntryPoint;
-        module->findEntryPointByName("psMain", fragmentEntryPoint.writeRef());
-        if (!fragmentEntryPoint)
-            throw Exception("Failed to find fragment entry point");
+        for (const char* entryPointName : entryPointNames)
+        {
+            Slang::ComPtr<slang::IEntryPoint>& entryPoint = entryPoints.EmplaceBack();
+            module->findEntryPointByName(entryPointName, entryPoint.writeRef());
+            if (!entryPoint)
+                throw Exception(FormatString("Failed to find entry point \"%s\"", entryPointName));
 
-        StackArray<slang::IComponentType*, 3> components = {
-            module,
-            vertexEntryPoint,
-            fragmentEntryPoint
-        };
+            components.Append(entryPoint);
+        }
 
         Slang::ComPtr<slang::IComponentType> composedProgram;
         SlangResult result = _session->createCompositeComponentType(components.Data(), static_cast<uint32>(components.GetCount()), composedProgram.writeRef(), diagnostics.writeRef());
@@ -149,14 +260,18 @@ namespace Coco
         if (SLANG_FAILED(result))
             throw Exception("Failed to link program type");
 
-        return linkedProgram;
-    }
+        result = linkedProgram->getTargetCode(0, compiledProgram.TargetCode.writeRef(), diagnostics.writeRef());
+        PrintDiagnostics(diagnostics);
 
-    void SlangCompiler::PrintDiagnostics(slang::IBlob* diagnostics)
-    {
-        if (!diagnostics)
-            return;
+        if (SLANG_FAILED(result))
+            throw Exception("Failed to generate target code");
 
-        COCO_ENGINE_LOG_INFO("%s", static_cast<const char*>(diagnostics->getBufferPointer()));
+        compiledProgram.Layout = CreateDefaultShared<ShaderProgramLayout>();
+        ReflectProgramLayout(linkedProgram->getLayout(), *compiledProgram.Layout);
+
+        _shaderCache->Store(shaderFile, fileText, module, *compiledProgram.Layout,
+            Span<const uint8>(static_cast<const uint8*>(compiledProgram.TargetCode->getBufferPointer()), compiledProgram.TargetCode->getBufferSize()));
+
+        return compiledProgram;
     }
 } // Coco
\ No newline at end of file
@@ -12,27 +12,69 @@
 #include <slang-com-helper.h>
 
 #include "Coco/Core/Types/ArrayContainer.h"
+#include "Coco/Core/Types/Map.h"
+#include "Coco/Core/Types/Optional.h"
 #include "Coco/Rendering/ShaderTypes.h"
 #include "Coco/Rendering/Graphics/VertexDataTypes.h"
+#include "SlangShaderCache.h"
 
 namespace Coco
 {
+    /// @brief The reflected layout of a linked shader program and the code generated for it
+    struct SlangCompiledProgram
+    {
+        SharedPtr<ShaderProgramLayout> Layout;
+        Slang::ComPtr<slang::IBlob> TargetCode;
+    };
+
     class SlangCompiler
     {
     public:
         SlangCompiler(SlangCompileTarget compileTarget, const char* profile);
         ~SlangCompiler();
 
-        static void ReflectVertexAttributes(slang::ProgramLayout* programLayout, ArrayContainer<VertexChannel>& outVertexChannels);
+        SlangCompiledProgram CompileShader(const FilePath& shaderFile);
 
-        Slang::ComPtr<slang::IComponentType> CompileShader(const FilePath& shaderFile);
+        /// @brief Compiles a shader with a single compute entry point
+        /// @param shaderFile The shader file
+        /// @return The compiled program
+        SlangCompiledProgram CompileComputeShader(const FilePath& shaderFile);
 
     private:
+        static constexpr const char* _vertexEntryPointName = "vsMain";
+        static constexpr const char* _fragmentEntryPointName = "psMain";
+        static constexpr const char* _computeEntryPointName = "csMain";
+
         Slang::ComPtr<slang::IGlobalSession> _globalSession;
         Slang::ComPtr<slang::ISession> _session;
+        Optional<SlangShaderCache> _shaderCache;
 
     private:
         static void PrintDiagnostics(slang::IBlob* diagnostics);
+
+        /// @brief Copies the reflection of a linked program into a layout that can be cached
+        /// @param programLayout The program's reflection
+        /// @param outLayout The layout to fill
+        static void ReflectProgramLayout(slang::ProgramLayout* programLayout, ShaderProgramLayout& outLayout);
+
+        /// @brief Copies the reflection of a type, reusing the copy if the type has already been reflected
+        /// @param typeLayout The type's reflection
+        /// @param outLayout The program layout that owns the copy
+        /// @param reflectedTypeLayouts The types that have already been reflected
+        /// @return The copied type layout
+        static const ShaderTypeLayout* ReflectTypeLayout(slang::TypeLayoutReflection* typeLayout, ShaderProgramLayout& outLayout,
+            Map<slang::TypeLayoutReflection*, const ShaderTypeLayout*>& reflectedTypeLayouts);
+
+        /// @brief Adds the vertex channels that a vertex entry point reads to a program layout
+        /// @param entryPoint The vertex entry point
+        /// @param outLayout The program layout
+        static void ReflectVertexAttributes(slang::EntryPointReflection* entryPoint, ShaderProgramLayout& outLayout);
+
+        /// @brief Compiles a shader, loading it from the shader cache if possible
+        /// @param shaderFile The shader file
+        /// @param entryPointNames The names of the entry points to link into the program
+        /// @return The compiled program
+        SlangCompiledProgram Compile(const FilePath& shaderFile, Span<const char* const> entryPointNames);
     };
 } // Coco
 
@@ -0,0 +1,158 @@
+//
+// Created by cullen on 10/18/26.
+//
+
+#include "SlangShaderCache.h"
+
+#include "Coco/Core/Engine.h"
+#include "Coco/Core/IO/BinaryData.h"
+#include "Coco/Core/Math/Math.h"
+
+namespace Coco
+{
+    SlangShaderCache::SlangShaderCache(uint64 configurationHash) :
+        _configurationHash(configurationHash)
+    {}
+
+    bool SlangShaderCache::TryLoad(const FilePath& shaderFile, const String& source, SlangShaderCacheEntry& outEntry) const
+    {
+        const uint64 key = MakeKey(source);
+        const String fileName = GetCacheFileName(key);
+        FileSystem* fs = Engine::Get()->GetFileSystem();
+
+        if (!fs->Exists(fileName, true))
+            return false;
+
+        Array<uint8> data;
+
+        try
+        {
+            File file = fs->Open(fileName, FileOpenFlags::Read, true);
+            file.ReadToEnd(data);
+            file.Close();
+        }
+        catch (const Exception& ex)
+        {
+            COCO_ENGINE_LOG_WARN("Failed to read shader cache \"%s\": %s", fileName.CStr(), ex.what());
+            return false;
+        }
+
+        BinaryReader reader(data);
+        const uint32 magic = reader.Read<uint32>();
+        const uint32 version = reader.Read<uint32>();
+        const uint64 storedKey = reader.Read<uint64>();
+
+        if (reader.HasFailed() || magic != _magic || version != _version || storedKey != key)
+            return false;
+
+        // Any change to a dependency invalidates the entry
+        const uint32 dependencyCount = reader.Read<uint32>();
+        for (uint32 i = 0; i < dependencyCount; i++)
+        {
+            const String dependencyPath = reader.ReadString();
+            const uint64 storedHash = reader.Read<uint64>();
+            uint64 currentHash = 0;
+
+            if (reader.HasFailed())
+                return false;
+
+            if (!TryHashDependency(dependencyPath.CStr(), currentHash) || currentHash != storedHash)
+            {
+                COCO_ENGINE_LOG_VERBOSE("Cached shader \"%s\" is out of date because \"%s\" changed", shaderFile.CStr(), dependencyPath.CStr());
+                return false;
+            }
+        }
+
+        reader.ReadBytes(outEntry.TargetCode);
+        outEntry.Layout = CreateDefaultShared<ShaderProgramLayout>();
+
+        if (reader.HasFailed() || outEntry.TargetCode.IsEmpty() || !ShaderProgramLayout::TryDeserialize(reader, *outEntry.Layout))
+        {
+            outEntry.TargetCode.Clear();
+            outEntry.Layout.reset();
+            return false;
+        }
+
+        return true;
+    }
+
+    void SlangShaderCache::Store(const FilePath& shaderFile, const String& source, slang::IModule* module,
+        const ShaderProgramLayout& layout, Span<const uint8> targetCode) const
+    {
+        const uint64 key = MakeKey(source);
+
+        BinaryWriter writer;
+        writer.Write(_magic);
+        writer.Write(_version);
+        writer.Write(key);
+
+        // The shader's own source is part of the key, so only the files it includes need to be recorded
+        Array<const char*> dependencyPaths;
+        for (SlangInt32 i = 0; i < module->getDependencyFileCount(); i++)
+        {
+            const char* dependencyPath = module->getDependencyFilePath(i);
+            if (dependencyPath && strcmp(dependencyPath, shaderFile.CStr()) != 0)
+                dependencyPaths.Append(dependencyPath);
+        }
+
+        writer.Write(static_cast<uint32>(dependencyPaths.GetCount()));
+        for (const char* dependencyPath : dependencyPaths)
+        {
+            uint64 hash = 0;
+            if (!TryHashDependency(dependencyPath, hash))
+            {
+                COCO_ENGINE_LOG_WARN("Not caching shader \"%s\" as its dependency \"%s\" could not be read", shaderFile.CStr(), dependencyPath);
+                return;
+            }
+
+            writer.WriteString(dependencyPath);
+            writer.Write(hash);
+        }
+
+        writer.WriteBytes(targetCode);
+        layout.Serialize(writer);
+
+        const String fileName = GetCacheFileName(key);
+
+        try
+        {
+            File file = Engine::Get()->GetFileSystem()->Open(fileName, FileOpenFlags::Write, true);
+            file.Write(writer.GetData());
+            file.Close();
+        }
+        catch (const Exception& ex)
+        {
+            COCO_ENGINE_LOG_WARN("Failed to write shader cache \"%s\": %s", fileName.CStr(), ex.what());
+        }
+    }
+
+    uint64 SlangShaderCache::MakeKey(const String& source) const
+    {
+        return Math::CombineHashes(_configurationHash, ToHash(source));
+    }
+
+    String SlangShaderCache::GetCacheFileName(uint64 key)
+    {
+        return FormatString("ShaderCache_%016llx.bin", static_cast<unsigned long long>(key));
+    }
+
+    bool SlangShaderCache::TryHashDependency(const char* path, uint64& outHash)
+    {
+        // Slang resolves dependencies relative to its own search paths, so read them directly instead of through the FileSystem
+        if (!File::Exists(path))
+            return false;
+
+        try
+        {
+            String text;
+            File::ReadAllText(path, text);
+            outHash = ToHash(text);
+        }
+        catch (const Exception&)
+        {
+            return false;
+        }
+
+        return true;
+    }
+} // Coco
\ No newline at end of file
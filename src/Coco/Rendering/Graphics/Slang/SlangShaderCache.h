@@ -0,0 +1,69 @@
+//
+// Created by cullen on 10/18/26.
+//
+
+#ifndef COCOENGINE_SLANGSHADERCACHE_H
+#define COCOENGINE_SLANGSHADERCACHE_H
+#include "Coco/Core/Types/Array.h"
+#include "Coco/Core/Types/String.h"
+#include "Coco/Core/IO/FilePath.h"
+#include "Coco/Rendering/Graphics/ShaderLayout.h"
+
+#include <slang.h>
+
+namespace Coco
+{
+    /// @brief Compiled data for a shader that was loaded from the shader cache
+    struct SlangShaderCacheEntry
+    {
+        /// @brief The code generated for the compile target
+        Array<uint8> TargetCode;
+
+        /// @brief The reflected layout of the linked program
+        SharedPtr<ShaderProgramLayout> Layout;
+    };
+
+    /// @brief A content-addressed disk cache for compiled shaders, stored in the cache path of the engine's FileSystem.
+    /// Entries are keyed by the shader source and the compiler configuration, and record the contents of every file the
+    /// shader depends on so that a change anywhere in its include graph invalidates the entry
+    class SlangShaderCache
+    {
+    public:
+        /// @brief Creates a shader cache
+        /// @param configurationHash A hash of everything besides the shader source that affects the compiled output
+        SlangShaderCache(uint64 configurationHash);
+
+        /// @brief Attempts to load a cached shader
+        /// @param shaderFile The path of the shader
+        /// @param source The source of the shader
+        /// @param outEntry Will be filled with the cached data
+        /// @return True if a valid cache entry was found
+        bool TryLoad(const FilePath& shaderFile, const String& source, SlangShaderCacheEntry& outEntry) const;
+
+        /// @brief Stores a compiled shader in the cache
+        /// @param shaderFile The path of the shader
+        /// @param source The source of the shader
+        /// @param module The compiled module. Its dependencies will be recorded with the entry
+        /// @param layout The reflected layout of the linked program
+        /// @param targetCode The code generated for the compile target
+        void Store(const FilePath& shaderFile, const String& source, slang::IModule* module, const ShaderProgramLayout& layout, Span<const uint8> targetCode) const;
+
+    private:
+        static constexpr uint32 _magic = 0x4353434F; // "OCSC"
+        static constexpr uint32 _version = 3;
+
+        uint64 _configurationHash;
+
+    private:
+        uint64 MakeKey(const String& source) const;
+        static String GetCacheFileName(uint64 key);
+
+        /// @brief Hashes the contents of a file that a shader depends on
+        /// @param path The path of the file, as reported by Slang
+        /// @param outHash Will be set to the hash of the file contents
+        /// @return True if the file could be read
+        static bool TryHashDependency(const char* path, uint64& outHash);
+    };
+} // Coco
+
+#endif //COCOENGINE_SLANGSHADERCACHE_H
\ No newline at end of file
@@ -0,0 +1,73 @@
+//
+// Created by cullen on 10/18/26.
+//
+
+#ifndef COCOENGINE_UPLOADSCHEDULER_H
+#define COCOENGINE_UPLOADSCHEDULER_H
+#include "Coco/Core/Types/Array.h"
+#include "Coco/Core/Memory/Refs.h"
+#include <functional>
+
+namespace Coco
+{
+    class Buffer;
+    class Image;
+
+    /// @brief The order in which queued uploads are given transfer bandwidth
+    enum class UploadPriority : uint8
+    {
+        Low,
+        Normal,
+        High
+    };
+
+    /// @brief Called once an upload's data can be used by the GPU
+    using UploadCompletedCallback = std::function<void()>;
+
+    /// @brief Copies data to GPU resources in the background, spreading large uploads over several frames so no single frame exceeds its transfer budget
+    class UploadScheduler
+    {
+    public:
+        /// @brief An ID that never refers to an upload
+        static constexpr uint64 InvalidUploadID = 0;
+
+    public:
+        virtual ~UploadScheduler() = default;
+
+        /// @brief Queues data to be copied into a buffer
+        /// @param buffer The buffer to copy into
+        /// @param offset The offset in the buffer to copy to, in bytes
+        /// @param data The data to copy
+        /// @param priority The priority of the upload
+        /// @param onCompleted If given, called once the data can be used by the GPU
+        /// @return The ID of the upload
+        virtual uint64 QueueBufferUpload(Ref<Buffer> buffer, uint64 offset, Array<uint8>&& data, UploadPriority priority, UploadCompletedCallback onCompleted) = 0;
+
+        /// @brief Queues pixel data to be copied into an image, generating its mip maps once all of the pixel data has been copied
+        /// @param image The image to copy into
+        /// @param pixelData The pixel data to copy
+        /// @param priority The priority of the upload
+        /// @param onCompleted If given, called once the image can be sampled
+        /// @return The ID of the upload, or InvalidUploadID if the image can't be uploaded
+        virtual uint64 QueueImageUpload(Ref<Image> image, Array<uint8>&& pixelData, UploadPriority priority, UploadCompletedCallback onCompleted) = 0;
+
+        /// @brief Gets if an upload has completed
+        /// @param uploadID The ID of the upload
+        /// @return True if the upload's data can be used by the GPU, or if the upload doesn't exist
+        virtual bool IsUploadComplete(uint64 uploadID) const = 0;
+
+        /// @brief Sets the maximum number of bytes that are copied each frame
+        /// @param budget The budget, in bytes
+        virtual void SetFrameBudget(uint64 budget) = 0;
+
+        /// @brief Gets the maximum number of bytes that are copied each frame
+        /// @return The budget, in bytes
+        virtual uint64 GetFrameBudget() const = 0;
+
+        /// @brief Gets the number of bytes that are waiting to be copied
+        /// @return The number of queued bytes
+        virtual uint64 GetQueuedBytes() const = 0;
+    };
+} // Coco
+
+#endif //COCOENGINE_UPLOADSCHEDULER_H
\ No newline at end of file
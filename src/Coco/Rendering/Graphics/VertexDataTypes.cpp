@@ -3,6 +3,9 @@
 //
 #include "VertexDataTypes.h"
 
+#include <cstring>
+#include "Coco/Core/Math/Math.h"
+
 namespace Coco
 {
     uint8 GetVertexChannelElementCount(VertexChannel channel)
@@ -21,4 +24,199 @@ namespace Coco
                 return 0;
         }
     }
-}
+
+    uint8 GetVertexChannelElementSize(VertexChannel channel)
+    {
+        return GetVertexChannelElementCount(channel) * sizeof(float);
+    }
+
+    uint8 GetIndexSize(IndexFormat format)
+    {
+        return format == IndexFormat::UInt16 ? sizeof(uint16) : sizeof(uint32);
+    }
+
+    IndexFormat GetIndexFormatForVertexCount(uint64 vertexCount)
+    {
+        return vertexCount <= std::numeric_limits<uint16>::max() ? IndexFormat::UInt16 : IndexFormat::UInt32;
+    }
+
+    VertexFormat::VertexFormat() :
+        VertexFormat(VertexChannelFlags::Position, VertexLayoutMode::Planar, VertexEncoding::Full)
+    {}
+
+    VertexFormat::VertexFormat(VertexChannelFlags channels, VertexLayoutMode layoutMode, VertexEncoding encoding) :
+        Channels(channels | VertexChannelFlags::Position),
+        LayoutMode(layoutMode),
+        ChannelFormats({
+            VertexAttributeFormat::Float32,
+            VertexAttributeFormat::Float32,
+            VertexAttributeFormat::Float32,
+            VertexAttributeFormat::Float32,
+            VertexAttributeFormat::Float32
+        })
+    {
+        if (encoding == VertexEncoding::Compact)
+        {
+            ChannelFormats[static_cast<uint8>(VertexChannel::Position)] = VertexAttributeFormat::Float16;
+            ChannelFormats[static_cast<uint8>(VertexChannel::Normal)] = VertexAttributeFormat::SNorm8;
+            ChannelFormats[static_cast<uint8>(VertexChannel::Tangent)] = VertexAttributeFormat::SNorm8;
+            ChannelFormats[static_cast<uint8>(VertexChannel::Color)] = VertexAttributeFormat::UNorm8;
+            ChannelFormats[static_cast<uint8>(VertexChannel::UV0)] = VertexAttributeFormat::Float16;
+        }
+    }
+
+    bool VertexFormat::operator==(const VertexFormat& other) const
+    {
+        if (Channels != other.Channels || LayoutMode != other.LayoutMode)
+            return false;
+
+        for (uint8 i = 0; i < MaxVertexChannelCount; i++)
+        {
+            if (ChannelFormats[i] != other.ChannelFormats[i])
+                return false;
+        }
+
+        return true;
+    }
+
+    bool VertexFormat::HasChannel(VertexChannel channel) const
+    {
+        return (Channels & ToVertexChannelFlag(channel)) != VertexChannelFlags::None;
+    }
+
+    uint8 VertexFormat::GetChannelSize(VertexChannel channel) const
+    {
+        const uint8 elementCount = GetVertexChannelElementCount(channel);
+
+        switch (ChannelFormats[static_cast<uint8>(channel)])
+        {
+            case VertexAttributeFormat::Float32:
+                return elementCount * sizeof(float);
+            case VertexAttributeFormat::Float16:
+                return (elementCount == 3 ? 4 : elementCount) * sizeof(uint16);
+            case VertexAttributeFormat::SNorm8:
+            case VertexAttributeFormat::UNorm8:
+                return 4;
+            default:
+                return 0;
+        }
+    }
+
+    uint8 VertexFormat::GetInterleavedChannelOffset(VertexChannel channel) const
+    {
+        uint8 offset = 0;
+
+        for (uint8 i = 0; i < static_cast<uint8>(channel); i++)
+        {
+            if (HasChannel(static_cast<VertexChannel>(i)))
+                offset += GetChannelSize(static_cast<VertexChannel>(i));
+        }
+
+        return offset;
+    }
+
+    uint8 VertexFormat::GetVertexSize() const
+    {
+        return GetInterleavedChannelOffset(static_cast<VertexChannel>(MaxVertexChannelCount));
+    }
+
+    uint64 VertexFormat::GetHash() const
+    {
+        uint64 hash = Math::CombineHashes(static_cast<uint64>(Channels), static_cast<uint64>(LayoutMode));
+
+        for (const VertexAttributeFormat format : ChannelFormats)
+            hash = Math::CombineHashes(hash, static_cast<uint64>(format));
+
+        return hash;
+    }
+
+    /// @brief Converts a float to a 16-bit float, rounding to the nearest value
+    /// @param value The value
+    /// @return The 16-bit float bits
+    static uint16 FloatToHalf(float value)
+    {
+        uint32 bits;
+        memcpy(&bits, &value, sizeof(bits));
+
+        const uint16 sign = static_cast<uint16>((bits >> 16) & 0x8000);
+        const int32 exponent = static_cast<int32>((bits >> 23) & 0xFF) - 127 + 15;
+        uint32 mantissa = bits & 0x7FFFFF;
+
+        // Infinity and NaN
+        if ((bits & 0x7FFFFFFF) >= 0x7F800000)
+            return sign | 0x7C00 | (mantissa ? 0x200 : 0);
+
+        // Too large, so clamp to infinity
+        if (exponent >= 31)
+            return sign | 0x7C00;
+
+        // Too small for a normalized half, so store as a subnormal
+        if (exponent <= 0)
+        {
+            if (exponent < -10)
+                return sign;
+
+            mantissa |= 0x800000;
+            const uint32 shift = static_cast<uint32>(14 - exponent);
+            uint16 half = static_cast<uint16>(mantissa >> shift);
+
+            if ((mantissa >> (shift - 1)) & 1)
+                half++;
+
+            return sign | half;
+        }
+
+        // Rounding may carry into the exponent, which correctly rounds up to the next power of 2
+        uint16 half = static_cast<uint16>((exponent << 10) | (mantissa >> 13));
+
+        if (mantissa & 0x1000)
+            half++;
+
+        return sign | half;
+    }
+
+    void EncodeVertexAttribute(VertexAttributeFormat format, const float* source, uint8 elementCount, uint8* destination)
+    {
+        switch (format)
+        {
+            case VertexAttributeFormat::Float32:
+            {
+                memcpy(destination, source, elementCount * sizeof(float));
+                break;
+            }
+            case VertexAttributeFormat::Float16:
+            {
+                const uint8 paddedCount = elementCount == 3 ? 4 : elementCount;
+
+                for (uint8 i = 0; i < paddedCount; i++)
+                {
+                    // The padding element is 1 so padded positions decode as homogeneous points
+                    const uint16 half = i < elementCount ? FloatToHalf(source[i]) : 0x3C00;
+                    memcpy(destination + i * sizeof(uint16), &half, sizeof(uint16));
+                }
+                break;
+            }
+            case VertexAttributeFormat::SNorm8:
+            {
+                for (uint8 i = 0; i < 4; i++)
+                {
+                    const float value = i < elementCount ? Math::Clamp(source[i], -1.f, 1.f) : 0.f;
+                    const int8 encoded = static_cast<int8>(Math::Round(value * 127.f));
+                    memcpy(destination + i, &encoded, sizeof(int8));
+                }
+                break;
+            }
+            case VertexAttributeFormat::UNorm8:
+            {
+                for (uint8 i = 0; i < 4; i++)
+                {
+                    const float value = i < elementCount ? Math::Clamp(source[i], 0.f, 1.f) : 1.f;
+                    destination[i] = static_cast<uint8>(Math::Round(value * 255.f));
+                }
+                break;
+            }
+            default:
+                break;
+        }
+    }
+}
\ No newline at end of file
@@ -6,6 +6,7 @@
 #define COCOENGINE_VERTEXDATATYPES_H
 #include <Coco/Core/Types/CoreTypes.h>
 #include <Coco/Core/Types/EnumTypes.h>
+#include <Coco/Core/Types/StackArray.h>
 
 namespace Coco
 {
@@ -36,6 +37,117 @@ namespace Coco
     EnumFlagOperators(VertexChannelFlags)
 
     uint8 GetVertexChannelElementCount(VertexChannel channel);
+
+    /// @brief Gets the size of a single vertex's data for a channel
+    /// @param channel The vertex channel
+    /// @return The size of the channel's data per vertex, in bytes
+    uint8 GetVertexChannelElementSize(VertexChannel channel);
+
+    /// @brief Gets the flag for a vertex channel
+    /// @param channel The vertex channel
+    /// @return The channel's flag
+    constexpr VertexChannelFlags ToVertexChannelFlag(VertexChannel channel) { return static_cast<VertexChannelFlags>(1 << static_cast<uint8>(channel)); }
+
+    /// @brief Encodings for the elements of a vertex channel
+    enum class VertexAttributeFormat : uint8
+    {
+        /// @brief 32-bit floats
+        Float32,
+
+        /// @brief 16-bit floats. 3-element channels are padded to 4 elements
+        Float16,
+
+        /// @brief 8-bit signed normalized integers in the range [-1, 1]. Channels are padded to 4 elements
+        SNorm8,
+
+        /// @brief 8-bit unsigned normalized integers in the range [0, 1]. Channels are padded to 4 elements
+        UNorm8
+    };
+
+    /// @brief How the channels of vertex data are arranged in a buffer
+    enum class VertexLayoutMode : uint8
+    {
+        /// @brief Each channel's data is stored contiguously, one channel after another
+        Planar,
+
+        /// @brief All channels of a vertex are stored together
+        Interleaved
+    };
+
+    /// @brief Sets of encodings for vertex channels
+    enum class VertexEncoding : uint8
+    {
+        /// @brief All channels are stored as 32-bit floats
+        Full,
+
+        /// @brief Positions and UVs are stored as 16-bit floats, normals and tangents as 8-bit signed normalized integers,
+        /// and colors as 8-bit unsigned normalized integers. Positions lose precision far from the origin
+        Compact
+    };
+
+    /// @brief The size of an index
+    enum class IndexFormat : uint8
+    {
+        UInt16,
+        UInt32
+    };
+
+    /// @brief Gets the size of an index
+    /// @param format The index format
+    /// @return The size of a single index, in bytes
+    uint8 GetIndexSize(IndexFormat format);
+
+    /// @brief Gets the index format needed to index a number of vertices
+    /// @param vertexCount The number of vertices
+    /// @return The smallest index format that can index all the vertices
+    IndexFormat GetIndexFormatForVertexCount(uint64 vertexCount);
+
+    /// @brief Describes how a mesh's vertex data is stored
+    struct VertexFormat
+    {
+        /// @brief The channels that have data
+        VertexChannelFlags Channels;
+
+        VertexLayoutMode LayoutMode;
+
+        /// @brief The encoding of each channel, indexed by VertexChannel
+        StackArray<VertexAttributeFormat, MaxVertexChannelCount> ChannelFormats;
+
+        VertexFormat();
+        VertexFormat(VertexChannelFlags channels, VertexLayoutMode layoutMode, VertexEncoding encoding);
+
+        bool operator==(const VertexFormat& other) const;
+
+        /// @brief Determines if this format has data for a channel
+        /// @param channel The vertex channel
+        /// @return True if the channel has data
+        bool HasChannel(VertexChannel channel) const;
+
+        /// @brief Gets the size of a single vertex's data for a channel
+        /// @param channel The vertex channel
+        /// @return The encoded size of the channel's data per vertex, in bytes
+        uint8 GetChannelSize(VertexChannel channel) const;
+
+        /// @brief Gets the offset of a channel's data within an interleaved vertex
+        /// @param channel The vertex channel
+        /// @return The offset of the channel's data, in bytes
+        uint8 GetInterleavedChannelOffset(VertexChannel channel) const;
+
+        /// @brief Gets the size of a single vertex's data across all channels
+        /// @return The size of a vertex, in bytes
+        uint8 GetVertexSize() const;
+
+        /// @brief Gets a hash of this format
+        /// @return The hash
+        uint64 GetHash() const;
+    };
+
+    /// @brief Encodes a single vertex's data for a channel
+    /// @param format The encoding
+    /// @param source The channel's elements
+    /// @param elementCount The number of elements
+    /// @param destination The destination of the encoded data. Must have room for the encoded size of the channel
+    void EncodeVertexAttribute(VertexAttributeFormat format, const float* source, uint8 elementCount, uint8* destination);
 }
 
 #endif //COCOENGINE_VERTEXDATATYPES_H
\ No newline at end of file
@@ -0,0 +1,449 @@
+//
+// Created by cullen on 10/18/26.
+//
+
+#include "KTX2File.h"
+
+#include <cstring>
+#include "Coco/Core/Asserts.h"
+#include "Coco/Core/Math/Math.h"
+#include "Coco/Core/Types/String.h"
+
+namespace Coco
+{
+    /// @brief The bytes every KTX2 file starts with
+    static constexpr uint8 _identifier[12] = { 0xAB, 0x4B, 0x54, 0x58, 0x20, 0x32, 0x30, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A };
+
+    /// @brief The size of the header and index, which are followed by the level index
+    static constexpr uint64 _headerSize = 80;
+
+    /// @brief The size of each mip level's entry in the level index
+    static constexpr uint64 _levelIndexEntrySize = 24;
+
+    /// @brief The key of the metadata entry that describes which way the rows and columns of pixels are ordered
+    static constexpr char _orientationKey[] = "KTXorientation";
+
+    /// @brief Reads a little-endian value from file data
+    /// @tparam ValueType The type of value
+    /// @param data The file data
+    /// @param offset The offset of the value
+    /// @return The value
+    template<typename ValueType>
+    static ValueType ReadValue(Span<const uint8> data, uint64 offset)
+    {
+        if (offset + sizeof(ValueType) > data.size())
+            throw Exception("The file is truncated");
+
+        ValueType value;
+        memcpy(&value, data.data() + offset, sizeof(ValueType));
+        return value;
+    }
+
+    /// @brief Writes a little-endian value to file data
+    /// @tparam ValueType The type of value
+    /// @param data The file data
+    /// @param offset The offset to write the value to
+    /// @param value The value
+    template<typename ValueType>
+    static void WriteValue(Array<uint8>& data, uint64 offset, ValueType value)
+    {
+        memcpy(data.Data() + offset, &value, sizeof(ValueType));
+    }
+
+    /// @brief Determines if a file's rows of pixels are ordered from the top, which is the default if it has no orientation metadata
+    /// @param fileData The file data
+    /// @param kvdOffset The offset of the key/value data
+    /// @param kvdLength The length of the key/value data
+    /// @return True if the first row is the top of the image
+    static bool IsTopDownOrientation(Span<const uint8> fileData, uint64 kvdOffset, uint64 kvdLength)
+    {
+        const uint64 end = kvdOffset + kvdLength;
+        if (end > fileData.size())
+            throw Exception("The file is truncated");
+
+        uint64 offset = kvdOffset;
+        while (offset + 4 <= end)
+        {
+            const uint32 entryLength = ReadValue<uint32>(fileData, offset);
+            const uint64 entryStart = offset + 4;
+
+            if (entryStart + entryLength > end)
+                break;
+
+            // Entries are the key and value, each null terminated. The value's second character is 'd' for top-down rows or 'u' for bottom-up rows
+            const char* entry = reinterpret_cast<const char*>(fileData.data() + entryStart);
+            if (entryLength > sizeof(_orientationKey) + 1 && memcmp(entry, _orientationKey, sizeof(_orientationKey)) == 0)
+                return entry[sizeof(_orientationKey) + 1] != 'u';
+
+            offset = Math::AlignedAddress(entryStart + entryLength, 4);
+        }
+
+        return true;
+    }
+
+    /// @brief Appends a sample to a data format descriptor, which describes where a channel is stored in a texel block
+    /// @param words The words of the data format descriptor
+    /// @param bitOffset The offset of the channel in the texel block, in bits
+    /// @param bitLength The size of the channel, in bits
+    /// @param channelType The channel ID, combined with any qualifier flags
+    /// @param upper The value the channel has at its maximum
+    static void AppendDFDSample(Array<uint32>& words, uint32 bitOffset, uint32 bitLength, uint32 channelType, uint32 upper)
+    {
+        words.Append(bitOffset | ((bitLength - 1) << 16) | (channelType << 24));
+        words.Append(0);
+        words.Append(0);
+        words.Append(upper);
+    }
+
+    /// @brief Creates the data format descriptor for a pixel format, which KTX2 readers use to interpret the pixel data
+    /// @param format The pixel format
+    /// @param colorSpace The color space
+    /// @return The data format descriptor
+    static Array<uint8> CreateDataFormatDescriptor(ImagePixelFormat format, ImageColorSpace colorSpace)
+    {
+        constexpr uint32 colorModelRGBSDA = 1;
+        constexpr uint32 colorModelBC1A = 128;
+        constexpr uint32 colorModelBC3 = 130;
+        constexpr uint32 colorModelBC5 = 132;
+        constexpr uint32 colorModelBC7 = 134;
+        constexpr uint32 channelRed = 0;
+        constexpr uint32 channelGreen = 1;
+        constexpr uint32 channelBlue = 2;
+        constexpr uint32 channelAlpha = 15;
+        constexpr uint32 channelBC1AAlphaPresent = 1;
+        constexpr uint32 sampleQualifierLinear = 0x10;
+
+        const bool isSRGB = colorSpace == ImageColorSpace::sRGB;
+        const bool isCompressed = ImageDescription::IsCompressed(format);
+
+        // Alpha is always linear, even when the color channels are sRGB
+        const uint32 alphaChannel = channelAlpha | (isSRGB ? sampleQualifierLinear : 0);
+        const uint32 upper = isCompressed ? 0xFFFFFFFF : 255;
+
+        uint32 colorModel;
+        Array<uint32> samples;
+
+        switch (format)
+        {
+            case ImagePixelFormat::RGBA8:
+                colorModel = colorModelRGBSDA;
+                AppendDFDSample(samples, 0, 8, channelRed, upper);
+                AppendDFDSample(samples, 8, 8, channelGreen, upper);
+                AppendDFDSample(samples, 16, 8, channelBlue, upper);
+                AppendDFDSample(samples, 24, 8, alphaChannel, upper);
+                break;
+            case ImagePixelFormat::BGRA8:
+                colorModel = colorModelRGBSDA;
+                AppendDFDSample(samples, 0, 8, channelBlue, upper);
+                AppendDFDSample(samples, 8, 8, channelGreen, upper);
+                AppendDFDSample(samples, 16, 8, channelRed, upper);
+                AppendDFDSample(samples, 24, 8, alphaChannel, upper);
+                break;
+            case ImagePixelFormat::BC1_RGBA:
+                colorModel = colorModelBC1A;
+                AppendDFDSample(samples, 0, 64, channelBC1AAlphaPresent, upper);
+                break;
+            case ImagePixelFormat::BC3_RGBA:
+                colorModel = colorModelBC3;
+                AppendDFDSample(samples, 0, 64, alphaChannel, upper);
+                AppendDFDSample(samples, 64, 64, channelRed, upper);
+                break;
+            case ImagePixelFormat::BC5_RG:
+                colorModel = colorModelBC5;
+                AppendDFDSample(samples, 0, 64, channelRed, upper);
+                AppendDFDSample(samples, 64, 64, channelGreen, upper);
+                break;
+            case ImagePixelFormat::BC7_RGBA:
+                colorModel = colorModelBC7;
+                AppendDFDSample(samples, 0, 128, channelRed, upper);
+                break;
+            default:
+                COCO_ASSERT(false, "Unsupported format: %d", static_cast<int>(format));
+                return Array<uint8>();
+        }
+
+        constexpr uint32 primariesBT709 = 1;
+        const uint32 transferFunction = isSRGB ? 2 : 1;
+        const uint32 blockSize = isCompressed ? ImageDescription::GetCompressedBlockSize(format) : ImageDescription::GetBytesPerPixel(format);
+        const uint32 descriptorBlockSize = 24 + static_cast<uint32>(samples.GetCount()) * 4;
+
+        Array<uint32> words;
+        words.Append(4 + descriptorBlockSize);
+        words.Append(0);
+        words.Append(2 | (descriptorBlockSize << 16));
+        words.Append(colorModel | (primariesBT709 << 8) | (transferFunction << 16));
+        words.Append(isCompressed ? (3 | (3 << 8)) : 0);
+        words.Append(blockSize);
+        words.Append(0);
+        words.AppendRange(samples);
+
+        return Array<uint8>(Span<const uint8>(reinterpret_cast<const uint8*>(words.Data()), words.GetCount() * sizeof(uint32)));
+    }
+
+    KTX2Image::KTX2Image() :
+        Description(),
+        PixelData(),
+        IsTopDown(true)
+    {}
+
+    bool KTX2Image::FlipVertically()
+    {
+        if (ImageDescription::IsCompressed(Description.PixelFormat))
+            return false;
+
+        const uint64 bytesPerPixel = ImageDescription::GetBytesPerPixel(Description.PixelFormat);
+        Array<uint8> row;
+        uint64 mipOffset = 0;
+
+        for (uint32 mip = 0; mipOffset < PixelData.GetCount(); mip++)
+        {
+            const uint64 rowSize = ImageDescription::GetMipSize(Description.Width, mip) * bytesPerPixel;
+            const uint32 height = ImageDescription::GetMipSize(Description.Height, mip);
+            row.Resize(rowSize);
+
+            for (uint32 y = 0; y < height / 2; y++)
+            {
+                uint8* top = PixelData.Data() + mipOffset + y * rowSize;
+                uint8* bottom = PixelData.Data() + mipOffset + (height - 1 - y) * rowSize;
+
+                memcpy(row.Data(), top, rowSize);
+                memcpy(top, bottom, rowSize);
+                memcpy(bottom, row.Data(), rowSize);
+            }
+
+            mipOffset += rowSize * height;
+        }
+
+        IsTopDown = !IsTopDown;
+        return true;
+    }
+
+    bool KTX2File::IsKTX2(Span<const uint8> fileData)
+    {
+        return fileData.size() >= sizeof(_identifier) && memcmp(fileData.data(), _identifier, sizeof(_identifier)) == 0;
+    }
+
+    KTX2Image KTX2File::Read(Span<const uint8> fileData)
+    {
+        if (!IsKTX2(fileData))
+            throw Exception("The data is not a KTX2 file");
+
+        const uint32 vkFormat = ReadValue<uint32>(fileData, 12);
+        const uint32 width = ReadValue<uint32>(fileData, 20);
+        const uint32 height = ReadValue<uint32>(fileData, 24);
+        const uint32 depth = ReadValue<uint32>(fileData, 28);
+        const uint32 layerCount = ReadValue<uint32>(fileData, 32);
+        const uint32 faceCount = ReadValue<uint32>(fileData, 36);
+        const uint32 levelCount = ReadValue<uint32>(fileData, 40);
+        const uint32 supercompressionScheme = ReadValue<uint32>(fileData, 44);
+        const uint32 kvdOffset = ReadValue<uint32>(fileData, 56);
+        const uint32 kvdLength = ReadValue<uint32>(fileData, 60);
+
+        if (supercompressionScheme != 0)
+            throw Exception(FormatString("Supercompression scheme %u is not supported. Files must be written without Basis Universal or Zstandard supercompression", supercompressionScheme));
+
+        if (width == 0 || height == 0 || depth > 0 || layerCount > 1 || faceCount != 1)
+            throw Exception("Only 2D images are supported, not 1D or 3D images, arrays, or cube maps");
+
+        ImageColorSpace colorSpace;
+        const ImagePixelFormat format = ToPixelFormat(vkFormat, colorSpace);
+
+        if (format == ImagePixelFormat::Unknown)
+            throw Exception(FormatString("VkFormat %u is not supported", vkFormat));
+
+        // A level count of 0 asks for the mip levels to be generated, which compressed formats don't support
+        const bool generateMipMaps = levelCount == 0;
+        if (generateMipMaps && ImageDescription::IsCompressed(format))
+            throw Exception("Compressed images must store all of their mip levels");
+
+        if (levelCount > ImageDescription::CalculateMipMapCount(width, height))
+            throw Exception(FormatString("The file has %u mip levels, which is more than a %ux%u image can have", levelCount, width, height));
+
+        KTX2Image image;
+        image.Description = ImageDescription(width, height, format, colorSpace, ImageUsageFlags::Sampled, generateMipMaps);
+
+        if (!generateMipMaps)
+            image.Description.MipCount = static_cast<uint8>(levelCount);
+
+        const uint32 storedLevels = Math::Max<uint32>(levelCount, 1);
+        uint64 pixelDataSize = 0;
+        for (uint32 level = 0; level < storedLevels; level++)
+        {
+            pixelDataSize += ImageDescription::GetDataSize(format,
+                ImageDescription::GetMipSize(width, level),
+                ImageDescription::GetMipSize(height, level));
+        }
+
+        image.PixelData.Reserve(pixelDataSize);
+
+        // The level index starts with the largest level, although the levels themselves are stored from the smallest
+        for (uint32 level = 0; level < storedLevels; level++)
+        {
+            const uint64 entryOffset = _headerSize + level * _levelIndexEntrySize;
+            const uint64 byteOffset = ReadValue<uint64>(fileData, entryOffset);
+            const uint64 byteLength = ReadValue<uint64>(fileData, entryOffset + 8);
+            const uint64 expectedLength = ImageDescription::GetDataSize(format,
+                ImageDescription::GetMipSize(width, level),
+                ImageDescription::GetMipSize(height, level));
+
+            if (byteLength != expectedLength)
+                throw Exception(FormatString("Mip level %u is %llu bytes, but should be %llu bytes", level, byteLength, expectedLength));
+
+            if (byteOffset + byteLength > fileData.size())
+                throw Exception("The file is truncated");
+
+            image.PixelData.AppendRange(fileData.subspan(byteOffset, byteLength));
+        }
+
+        image.IsTopDown = IsTopDownOrientation(fileData, kvdOffset, kvdLength);
+
+        return image;
+    }
+
+    Array<uint8> KTX2File::Write(const ImageDescription& description, Span<const uint8> pixelData, bool isTopDown)
+    {
+        const uint32 vkFormat = ToVkFormat(description.PixelFormat, description.ColorSpace);
+        COCO_ASSERT(vkFormat != 0, "Format %d can't be written to a KTX2 file", static_cast<int>(description.PixelFormat));
+
+        const uint32 levelCount = Math::Max<uint32>(description.MipCount, 1);
+        Array<uint64> levelSizes;
+        uint64 pixelDataSize = 0;
+
+        for (uint32 level = 0; level < levelCount; level++)
+        {
+            levelSizes.Append(ImageDescription::GetDataSize(description.PixelFormat,
+                ImageDescription::GetMipSize(description.Width, level),
+                ImageDescription::GetMipSize(description.Height, level)));
+            pixelDataSize += levelSizes.Back();
+        }
+
+        COCO_ASSERT(pixelData.size() >= pixelDataSize, "Pixel data must hold every mip level");
+
+        const Array<uint8> dfd = CreateDataFormatDescriptor(description.PixelFormat, description.ColorSpace);
+
+        // The orientation entry is the key and value, each null terminated, padded to 4 bytes
+        const char* orientation = isTopDown ? "rd" : "ru";
+        const uint32 orientationEntryLength = sizeof(_orientationKey) + 3;
+
+        const uint64 dfdOffset = _headerSize + levelCount * _levelIndexEntrySize;
+        const uint64 kvdOffset = dfdOffset + dfd.GetCount();
+        const uint64 kvdLength = Math::AlignedAddress(4 + orientationEntryLength, 4);
+
+        // Levels are stored from the smallest, each aligned to the least common multiple of the texel block size and 4
+        const uint64 blockSize = ImageDescription::GetCompressedBlockSize(description.PixelFormat);
+        const uint64 levelAlignment = blockSize > 0 ? blockSize : 4;
+
+        Array<uint64> levelOffsets(levelCount, 0);
+        uint64 fileSize = kvdOffset + kvdLength;
+
+        for (uint32 level = levelCount; level > 0; level--)
+        {
+            fileSize = Math::AlignedAddress(fileSize, levelAlignment);
+            levelOffsets[level - 1] = fileSize;
+            fileSize += levelSizes[level - 1];
+        }
+
+        Array<uint8> file(fileSize, 0);
+        memcpy(file.Data(), _identifier, sizeof(_identifier));
+        WriteValue<uint32>(file, 12, vkFormat);
+        WriteValue<uint32>(file, 16, 1);
+        WriteValue<uint32>(file, 20, description.Width);
+        WriteValue<uint32>(file, 24, description.Height);
+        WriteValue<uint32>(file, 28, 0);
+        WriteValue<uint32>(file, 32, 0);
+        WriteValue<uint32>(file, 36, 1);
+        WriteValue<uint32>(file, 40, levelCount);
+        WriteValue<uint32>(file, 44, 0);
+        WriteValue<uint32>(file, 48, static_cast<uint32>(dfdOffset));
+        WriteValue<uint32>(file, 52, static_cast<uint32>(dfd.GetCount()));
+        WriteValue<uint32>(file, 56, static_cast<uint32>(kvdOffset));
+        WriteValue<uint32>(file, 60, static_cast<uint32>(kvdLength));
+
+        memcpy(file.Data() + dfdOffset, dfd.Data(), dfd.GetCount());
+
+        WriteValue<uint32>(file, kvdOffset, orientationEntryLength);
+        memcpy(file.Data() + kvdOffset + 4, _orientationKey, sizeof(_orientationKey));
+        memcpy(file.Data() + kvdOffset + 4 + sizeof(_orientationKey), orientation, 3);
+
+        uint64 sourceOffset = 0;
+        for (uint32 level = 0; level < levelCount; level++)
+        {
+            const uint64 entryOffset = _headerSize + level * _levelIndexEntrySize;
+            WriteValue<uint64>(file, entryOffset, levelOffsets[level]);
+            WriteValue<uint64>(file, entryOffset + 8, levelSizes[level]);
+            WriteValue<uint64>(file, entryOffset + 16, levelSizes[level]);
+
+            memcpy(file.Data() + levelOffsets[level], pixelData.data() + sourceOffset, levelSizes[level]);
+            sourceOffset += levelSizes[level];
+        }
+
+        return file;
+    }
+
+    ImagePixelFormat KTX2File::ToPixelFormat(uint32 vkFormat, ImageColorSpace& outColorSpace)
+    {
+        // KTX2 files store VkFormat values, so these match vulkan_core.h without depending on the Vulkan RHI
+        switch (vkFormat)
+        {
+            case 37: // VK_FORMAT_R8G8B8A8_UNORM
+                outColorSpace = ImageColorSpace::Linear;
+                return ImagePixelFormat::RGBA8;
+            case 43: // VK_FORMAT_R8G8B8A8_SRGB
+                outColorSpace = ImageColorSpace::sRGB;
+                return ImagePixelFormat::RGBA8;
+            case 44: // VK_FORMAT_B8G8R8A8_UNORM
+                outColorSpace = ImageColorSpace::Linear;
+                return ImagePixelFormat::BGRA8;
+            case 50: // VK_FORMAT_B8G8R8A8_SRGB
+                outColorSpace = ImageColorSpace::sRGB;
+                return ImagePixelFormat::BGRA8;
+            case 133: // VK_FORMAT_BC1_RGBA_UNORM_BLOCK
+                outColorSpace = ImageColorSpace::Linear;
+                return ImagePixelFormat::BC1_RGBA;
+            case 134: // VK_FORMAT_BC1_RGBA_SRGB_BLOCK
+                outColorSpace = ImageColorSpace::sRGB;
+                return ImagePixelFormat::BC1_RGBA;
+            case 137: // VK_FORMAT_BC3_UNORM_BLOCK
+                outColorSpace = ImageColorSpace::Linear;
+                return ImagePixelFormat::BC3_RGBA;
+            case 138: // VK_FORMAT_BC3_SRGB_BLOCK
+                outColorSpace = ImageColorSpace::sRGB;
+                return ImagePixelFormat::BC3_RGBA;
+            case 141: // VK_FORMAT_BC5_UNORM_BLOCK
+                outColorSpace = ImageColorSpace::Linear;
+                return ImagePixelFormat::BC5_RG;
+            case 145: // VK_FORMAT_BC7_UNORM_BLOCK
+                outColorSpace = ImageColorSpace::Linear;
+                return ImagePixelFormat::BC7_RGBA;
+            case 146: // VK_FORMAT_BC7_SRGB_BLOCK
+                outColorSpace = ImageColorSpace::sRGB;
+                return ImagePixelFormat::BC7_RGBA;
+            default:
+                outColorSpace = ImageColorSpace::Unknown;
+                return ImagePixelFormat::Unknown;
+        }
+    }
+
+    uint32 KTX2File::ToVkFormat(ImagePixelFormat format, ImageColorSpace colorSpace)
+    {
+        const bool isSRGB = colorSpace == ImageColorSpace::sRGB;
+
+        switch (format)
+        {
+            case ImagePixelFormat::RGBA8:
+                return isSRGB ? 43 : 37;
+            case ImagePixelFormat::BGRA8:
+                return isSRGB ? 50 : 44;
+            case ImagePixelFormat::BC1_RGBA:
+                return isSRGB ? 134 : 133;
+            case ImagePixelFormat::BC3_RGBA:
+                return isSRGB ? 138 : 137;
+            case ImagePixelFormat::BC5_RG:
+                return 141;
+            case ImagePixelFormat::BC7_RGBA:
+                return isSRGB ? 146 : 145;
+            default:
+                return 0;
+        }
+    }
+} // Coc
\ No newline at end of file
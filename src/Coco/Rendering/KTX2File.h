@@ -0,0 +1,71 @@
+//
+// Created by cullen on 10/18/26.
+//
+
+#ifndef COCOENGINE_KTX2FILE_H
+#define COCOENGINE_KTX2FILE_H
+#include "Coco/Core/Types/Array.h"
+#include "Coco/Core/Types/Span.h"
+#include "Graphics/Resources/ImageTypes.h"
+
+namespace Coco
+{
+    /// @brief An image read from a KTX2 file
+    struct KTX2Image
+    {
+        /// @brief The description of the image
+        ImageDescription Description;
+
+        /// @brief The pixel data of every mip level in the file, tightly packed from the largest level.
+        /// If the file didn't store its mip levels, this only holds the first level and the description expects them to be generated
+        Array<uint8> PixelData;
+
+        /// @brief If true, the first row of pixels is the top of the image. Coco's images otherwise put the bottom row first
+        bool IsTopDown;
+
+        KTX2Image();
+
+        /// @brief Flips the rows of every mip level so the first row is the bottom of the image.
+        /// Compressed images can't be flipped without re-encoding them, so they are left as-is
+        /// @return True if the image was flipped
+        bool FlipVertically();
+    };
+
+    /// @brief Reads and writes KTX2 files, which hold images in GPU pixel formats along with their precomputed mip levels.
+    /// Only 2D images without supercompression are supported, in the RGBA8, BGRA8, BC1, BC3, BC5, and BC7 formats
+    class KTX2File
+    {
+    public:
+        /// @brief Determines if data starts with the KTX2 file identifier
+        /// @param fileData The file data
+        /// @return True if the data is a KTX2 file
+        static bool IsKTX2(Span<const uint8> fileData);
+
+        /// @brief Reads an image from a KTX2 file. Throws an exception if the file is invalid or uses unsupported features
+        /// @param fileData The file data
+        /// @return The image
+        static KTX2Image Read(Span<const uint8> fileData);
+
+        /// @brief Writes an image to a KTX2 file, such as one encoded with the BCnEncoder when textures are cooked
+        /// @param description The description of the image
+        /// @param pixelData The pixel data of every mip level in the description, tightly packed from the largest level
+        /// @param isTopDown If true, the first row of pixels is the top of the image
+        /// @return The file data
+        static Array<uint8> Write(const ImageDescription& description, Span<const uint8> pixelData, bool isTopDown);
+
+    private:
+        /// @brief Gets the pixel format and color space of a Vulkan format stored in a KTX2 file
+        /// @param vkFormat The Vulkan format
+        /// @param outColorSpace Will be set to the color space
+        /// @return The pixel format, or ImagePixelFormat::Unknown if the format isn't supported
+        static ImagePixelFormat ToPixelFormat(uint32 vkFormat, ImageColorSpace& outColorSpace);
+
+        /// @brief Gets the Vulkan format to store a pixel format and color space as in a KTX2 file
+        /// @param format The pixel format
+        /// @param colorSpace The color space
+        /// @return The Vulkan format, or 0 if the format isn't supported
+        static uint32 ToVkFormat(ImagePixelFormat format, ImageColorSpace colorSpace);
+    };
+} // Coco
+
+#endif //COCOENGINE_KTX2FILE_H
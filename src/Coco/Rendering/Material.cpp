@@ -4,6 +4,7 @@
 
 #include "Material.h"
 
+#include "RenderService.h"
 #include "Coco/Core/Engine.h"
 
 namespace Coco
@@ -13,110 +14,108 @@ namespace Coco
     Material::Material(Engine* engine, uint64 id, SharedPtr<Shader> shader) :
         Resource(engine, id),
         _shader(shader),
-        _uniformValues()
+        _uniformValues(),
+        _version(0)
     {
         CreateUniformValues();
     }
 
     Material::~Material()
     {
+        if (RenderService* rendering = _engine->TryGetService<RenderService>())
+        {
+            GraphicsPlatform* platform = rendering->GetGraphicsPlatform();
+            if (platform)
+                platform->ReleasePersistentUniforms(_id);
+        }
+
         _uniformValues.Clear(true);
     }
 
     void Material::SetValue(const char* name, float value)
     {
-        if (auto uniform = TryGetUniformValue(name))
-            uniform->SetValue(value);
+        SetUniformValue(name, value);
     }
 
     void Material::SetValue(const char* name, const Vector2& value)
     {
-        if (auto uniform = TryGetUniformValue(name))
-            uniform->SetValue(value);
+        SetUniformValue(name, value);
     }
 
     void Material::SetValue(const char* name, const Vector3& value)
     {
-        if (auto uniform = TryGetUniformValue(name))
-            uniform->SetValue(value);
+        SetUniformValue(name, value);
     }
 
     void Material::SetValue(const char* name, const Vector4& value)
     {
-        if (auto uniform = TryGetUniformValue(name))
-            uniform->SetValue(value);
+        SetUniformValue(name, value);
     }
 
     void Material::SetValue(const char* name, int value)
     {
-        if (auto uniform = TryGetUniformValue(name))
-            uniform->SetValue(value);
+        SetUniformValue(name, value);
     }
 
     void Material::SetValue(const char* name, const Vector2i& value)
     {
-        if (auto uniform = TryGetUniformValue(name))
-            uniform->SetValue(value);
+        SetUniformValue(name, value);
     }
 
     void Material::SetValue(const char* name, const Vector3i& value)
     {
-        if (auto uniform = TryGetUniformValue(name))
-            uniform->SetValue(value);
+        SetUniformValue(name, value);
     }
 
     void Material::SetValue(const char* name, const Vector4i& value)
     {
-        if (auto uniform = TryGetUniformValue(name))
-            uniform->SetValue(value);
+        SetUniformValue(name, value);
     }
 
     void Material::SetValue(const char* name, uint32 value)
     {
-        if (auto uniform = TryGetUniformValue(name))
-            uniform->SetValue(value);
+        SetUniformValue(name, value);
     }
 
     void Material::SetValue(const char* name, Span<const uint32, 2> value)
     {
-        if (auto uniform = TryGetUniformValue(name))
-            uniform->SetValue(value);
+        SetUniformValue(name, value);
     }
 
     void Material::SetValue(const char* name, Span<const uint32, 3> value)
     {
-        if (auto uniform = TryGetUniformValue(name))
-            uniform->SetValue(value);
+        SetUniformValue(name, value);
     }
 
     void Material::SetValue(const char* name, Span<const uint32, 4> value)
     {
-        if (auto uniform = TryGetUniformValue(name))
-            uniform->SetValue(value);
+        SetUniformValue(name, value);
     }
 
     void Material::SetValue(const char* name, bool value)
     {
-        if (auto uniform = TryGetUniformValue(name))
-            uniform->SetValue(value);
+        SetUniformValue(name, value);
     }
 
     void Material::SetValue(const char* name, const Color& value)
     {
-        if (auto uniform = TryGetUniformValue(name))
-            uniform->SetValue(value);
+        SetUniformValue(name, value);
     }
 
     void Material::SetValue(const char* name, const Matrix4x4& value)
     {
-        if (auto uniform = TryGetUniformValue(name))
-            uniform->SetValue(value);
+        SetUniformValue(name, value);
     }
 
     void Material::SetValue(const char* name, SharedPtr<Texture> value)
     {
-        if (auto uniform = TryGetUniformValue(name))
-            uniform->SetValue(value);
+        SetUniformValue(name, value);
+    }
+
+    void Material::WriteUniforms(const ShaderCursor& cursor) const
+    {
+        for (const auto& uniform : _uniformValues)
+            uniform.WriteInto(cursor);
     }
 
     void Material::CreateUniformValues()
@@ -128,20 +127,16 @@ namespace Coco
         if (!program)
             return;
 
-        auto programLayout = program->GetProgramLayout();
-        auto globalTypeLayout = programLayout->getGlobalParamsTypeLayout();
-        int64 materialBlockIndex = globalTypeLayout->findFieldIndexByName(MaterialBlockName);
+        int64 materialBlockIndex = program->GetParamBlockIndex(MaterialBlockName);
         if (materialBlockIndex == -1)
         {
             COCO_ENGINE_LOG_ERROR("Failed to find material block named \"%s\" on shader \"%u\"", MaterialBlockName, _shader->GetID());
             return;
         }
 
-        auto materialLayout = globalTypeLayout->getFieldByIndex(materialBlockIndex)->getTypeLayout()->getElementTypeLayout();
-        auto fieldCount = materialLayout->getFieldCount();
-        for (uint64 i = 0; i < fieldCount; i++)
+        const ShaderTypeLayout* materialLayout = program->GetParamBlockLayout(materialBlockIndex);
+        for (const ShaderFieldLayout& field : materialLayout->Fields)
         {
-            auto field = materialLayout->getFieldByIndex(i);
             ShaderUniformValue uniform;
             if (!ShaderUniformValue::TryCreateFromField(field, uniform))
                 continue;
@@ -44,12 +44,34 @@ namespace Coco
         Span<const ShaderUniformValue> GetUniformValues() const { return _uniformValues; }
         SharedPtr<Shader> GetShader() const { return _shader; }
 
+        /// @brief Gets the version of this material's parameters. This only changes when a SetValue() call changes a value,
+        /// so the material's persistent uniform block is only rewritten when it needs to be
+        /// @return The version
+        uint64 GetVersion() const { return _version; }
+
+        /// @brief Writes this material's parameters into its uniform block
+        /// @param cursor The cursor of the block
+        void WriteUniforms(const ShaderCursor& cursor) const;
+
     private:
         Array<ShaderUniformValue> _uniformValues;
         SharedPtr<Shader> _shader;
+        uint64 _version;
 
         void CreateUniformValues();
         ShaderUniformValue* TryGetUniformValue(const char* name);
+
+        /// @brief Sets the value of a parameter, bumping the version if the value changed
+        /// @tparam ValueType The type of value
+        /// @param name The name of the parameter
+        /// @param value The value
+        template<typename ValueType>
+        void SetUniformValue(const char* name, const ValueType& value)
+        {
+            ShaderUniformValue* uniform = TryGetUniformValue(name);
+            if (uniform && uniform->SetValue(value))
+                _version++;
+        }
     };
 } // Coco
 
@@ -6,6 +6,7 @@
 
 #include <cstring>
 
+#include "MeshSimplifier.h"
 #include "RenderService.h"
 #include "Coco/Core/Engine.h"
 
@@ -16,7 +17,22 @@ namespace Coco
         IndexCount(indexCount),
         VertexOffset(vertexOffset)
     {}
+
+    MeshLOD::MeshLOD(uint32 indexOffset, float screenSize) :
+        IndexOffset(indexOffset),
+        ScreenSize(screenSize),
+        Submeshes()
+    {}
     
+    MeshLODSettings::MeshLODSettings() :
+        MaxLODCount(3),
+        TriangleRatio(0.5f),
+        MaxError(0.05f),
+        FirstLODScreenSize(0.5f),
+        ScreenSizeFalloff(0.5f),
+        MinReduction(0.1f)
+    {}
+
     DEFINE_RTTI_TYPE(Mesh, Resource);
 
     Mesh::Mesh(Engine* engine, uint64 id, bool isDynamic) :
@@ -24,8 +40,14 @@ namespace Coco
         _isDirty(false),
         _isDynamic(isDynamic),
         _channels(VertexChannelFlags::None),
+        _vertexLayoutMode(VertexLayoutMode::Planar),
+        _vertexEncoding(VertexEncoding::Full),
         _positions(),
-        _indices()
+        _indices(),
+        _lodSettings(),
+        _needsLODGeneration(false),
+        _bounds(),
+        _boundingSphere()
     {}
 
     Mesh::~Mesh()
@@ -122,6 +144,7 @@ namespace Coco
 
     void Mesh::AppendIndices(Span<const uint32> indices)
     {
+        ClearLODs();
         _indices.AppendRange(indices);
 
         _submeshes.Clear();
@@ -188,6 +211,7 @@ namespace Coco
         COCO_ASSERT(indices.size() % 3 == 0, "Indices must be a multiple of 3");
 
         _indices.Set(indices);
+        _lods.Clear();
 
         _submeshes.Clear();
         _submeshes.EmplaceBack(0, indices.size());
@@ -197,6 +221,7 @@ namespace Coco
 
     void Mesh::SetSubmeshes(Span<const Submesh> submeshes)
     {
+        ClearLODs();
         _submeshes.Clear();
 
         for (const auto& s : submeshes)
@@ -210,58 +235,126 @@ namespace Coco
         }
     }
 
-    uint64 Mesh::GetVertexDataSize() const
+    void Mesh::AddLOD(Span<const uint32> indices, Span<const Submesh> submeshes, float screenSize)
     {
-        uint64 size = _positions.GetCount() * sizeof(Vector3);
+        COCO_ASSERT(submeshes.size() == _submeshes.GetCount(), "LODs must have a submesh for each of the mesh's submeshes");
+        COCO_ASSERT(_lods.IsEmpty() || screenSize < _lods[_lods.GetCount() - 1].ScreenSize, "LODs must be added from finest to coarsest");
 
-        if (!_normals.IsEmpty())
-            size += _normals.GetCount() * sizeof(Vector3);
+        MeshLOD& lod = _lods.EmplaceBack(static_cast<uint32>(_indices.GetCount()), screenSize);
 
-        if (!_tangents.IsEmpty())
-            size += _tangents.GetCount() * sizeof(Vector4);
+        for (const Submesh& submesh : submeshes)
+        {
+            if (submesh.IndexOffset + submesh.IndexCount > indices.size())
+                throw Exception("LOD submesh is out of the range of indices");
 
-        if (!_colors.IsEmpty())
-            size += _colors.GetCount() * sizeof(Vector4);
+            lod.Submeshes.EmplaceBack(lod.IndexOffset + submesh.IndexOffset, submesh.IndexCount, submesh.VertexOffset);
+        }
 
-        if (!_uvs.IsEmpty())
-            size += _uvs.GetCount() * sizeof(Vector2);
+        _indices.AppendRange(indices);
 
-        return size;
+        MarkDirty();
     }
 
-    uint64 Mesh::GetVertexDataOffset(VertexChannel channel) const
+    void Mesh::ClearLODs()
+    {
+        if (_lods.IsEmpty())
+            return;
+
+        _indices.Resize(_lods[0].IndexOffset);
+        _lods.Clear();
+
+        MarkDirty();
+    }
+
+    Span<const Submesh> Mesh::GetLODSubmeshes(uint32 lod) const
     {
-        if (channel == VertexChannel::Position)
-            return 0;
+        if (lod == 0 || lod > _lods.GetCount())
+            return _submeshes;
 
-        uint64 offset = _positions.GetCount() * sizeof(Vector3);
+        return _lods[lod - 1].Submeshes;
+    }
 
-        if (channel == VertexChannel::Normal)
-            return offset;
+    uint32 Mesh::SelectLOD(float screenSize, uint32 currentLOD, float hysteresis) const
+    {
+        uint32 lod = Math::Min(currentLOD, static_cast<uint32>(_lods.GetCount()));
 
-        offset += _normals.GetCount() * sizeof(Vector3);
+        // Only switch once the size is past a threshold by the hysteresis margin so objects near a threshold don't flicker between LODs
+        while (lod < _lods.GetCount() && screenSize < _lods[lod].ScreenSize * (1.0f - hysteresis))
+            lod++;
 
-        if (channel == VertexChannel::Tangent)
-            return offset;
+        while (lod > 0 && screenSize > _lods[lod - 1].ScreenSize * (1.0f + hysteresis))
+            lod--;
 
-        offset += _tangents.GetCount() * sizeof(Vector4);
+        return lod;
+    }
 
-        if (channel == VertexChannel::Color)
-            return offset;
+    void Mesh::EnableLODGeneration(const MeshLODSettings& settings)
+    {
+        _lodSettings = settings;
+        MarkDirty();
+    }
 
-        offset += _colors.GetCount() * sizeof(Vector4);
+    void Mesh::DisableLODGeneration()
+    {
+        _lodSettings.reset();
+        _needsLODGeneration = false;
+    }
 
-        if (channel == VertexChannel::UV0)
-            return offset;
+    void Mesh::UpdateLODs()
+    {
+        if (!_lodSettings.has_value() || !_needsLODGeneration || _indices.IsEmpty())
+            return;
 
-        offset += _uvs.GetCount() * sizeof(Vector2);
+        MeshSimplifier::GenerateLODs(*this, _lodSettings.value());
+
+        // Adding the LODs marks the mesh dirty again, but they don't need to be regenerated from themselves
+        _needsLODGeneration = false;
+    }
 
-        return offset;
+    uint64 Mesh::GetVertexDataSize() const
+    {
+        return _positions.GetCount() * GetVertexFormat().GetVertexSize();
+    }
+
+    void Mesh::SetVertexLayout(VertexLayoutMode layoutMode, VertexEncoding encoding)
+    {
+        if (_vertexLayoutMode == layoutMode && _vertexEncoding == encoding)
+            return;
+
+        _vertexLayoutMode = layoutMode;
+        _vertexEncoding = encoding;
+
+        MarkDirty();
+    }
+
+    VertexFormat Mesh::GetVertexFormat() const
+    {
+        VertexChannelFlags channels = VertexChannelFlags::Position;
+
+        for (uint8 i = 1; i < MaxVertexChannelCount; i++)
+        {
+            const VertexChannel channel = static_cast<VertexChannel>(i);
+            uint64 vertexCount = 0;
+            GetChannelData(channel, vertexCount);
+
+            if (vertexCount > 0 && vertexCount == _positions.GetCount())
+                channels |= ToVertexChannelFlag(channel);
+        }
+
+        return VertexFormat(channels, _vertexLayoutMode, _vertexEncoding);
+    }
+
+    uint64 Mesh::GetVertexDataOffset(VertexChannel channel) const
+    {
+        const VertexFormat format = GetVertexFormat();
+        const uint64 offset = format.GetInterleavedChannelOffset(channel);
+
+        return format.LayoutMode == VertexLayoutMode::Interleaved ? offset : offset * _positions.GetCount();
     }
 
     uint64 Mesh::GetIndexDataSize() const
     {
-        return sizeof(uint32) * _indices.GetCount();
+        return GetIndexSize(GetIndexFormat()) * _indices.GetCount();
     }
 
     uint64 Mesh::GetTotalDataSize() const
@@ -359,51 +452,54 @@ namespace Coco
 
     void Mesh::UpdateData(void* vertexDataDestination, void* indexDataDestination, ArrayContainer<uint64>& outChannelDataOffsets)
     {
-        uint64 currentOffset = _positions.GetCount() * sizeof(Vector3);
+        const VertexFormat format = GetVertexFormat();
+        const uint64 vertexCount = _positions.GetCount();
+        const uint64 vertexSize = format.GetVertexSize();
         uint8* dst = static_cast<uint8*>(vertexDataDestination);
-        memcpy(dst, _positions.Data(), currentOffset);
-        outChannelDataOffsets[static_cast<uint8>(VertexChannel::Position)] = 0;
-        dst += currentOffset;
 
-        if (!_normals.IsEmpty())
+        for (uint8 i = 0; i < MaxVertexChannelCount; i++)
         {
-            uint64 normalsSize = _normals.GetCount() * sizeof(Vector3);
-            memcpy(dst, _normals.Data(), normalsSize);
-
-            outChannelDataOffsets[static_cast<uint8>(VertexChannel::Normal)] = currentOffset;
-            currentOffset += normalsSize;
-            dst += normalsSize;
-        }
+            const VertexChannel channel = static_cast<VertexChannel>(i);
+            if (!format.HasChannel(channel))
+                continue;
+
+            uint64 channelVertexCount = 0;
+            const float* src = GetChannelData(channel, channelVertexCount);
+            const uint8 elementCount = GetVertexChannelElementCount(channel);
+            const VertexAttributeFormat attributeFormat = format.ChannelFormats[i];
+            const uint64 channelSize = format.GetChannelSize(channel);
+            const uint64 channelOffset = GetVertexDataOffset(channel);
+
+            if (format.LayoutMode == VertexLayoutMode::Planar && attributeFormat == VertexAttributeFormat::Float32)
+            {
+                memcpy(dst + channelOffset, src, vertexCount * channelSize);
+            }
+            else
+            {
+                // Planar channels are packed tightly, while interleaved channels are spaced by a whole vertex
+                const uint64 stride = format.LayoutMode == VertexLayoutMode::Planar ? channelSize : vertexSize;
 
-        if (!_tangents.IsEmpty())
-        {
-            uint64 tangentsSize = _tangents.GetCount() * sizeof(Vector4);
-            memcpy(dst, _tangents.Data(), tangentsSize);
+                for (uint64 v = 0; v < vertexCount; v++)
+                    EncodeVertexAttribute(attributeFormat, src + v * elementCount, elementCount, dst + channelOffset + v * stride);
+            }
 
-            outChannelDataOffsets[static_cast<uint8>(VertexChannel::Tangent)] = currentOffset;
-            currentOffset += tangentsSize;
-            dst += tangentsSize;
+            outChannelDataOffsets[i] = format.LayoutMode == VertexLayoutMode::Planar ? channelOffset : 0;
         }
 
-        if (!_colors.IsEmpty())
+        if (GetIndexFormat() == IndexFormat::UInt16)
         {
-            uint64 colorsSize = _colors.GetCount() * sizeof(Vector4);
-            memcpy(dst, _colors.Data(), colorsSize);
+            uint16* indexDst = static_cast<uint16*>(indexDataDestination);
 
-            outChannelDataOffsets[static_cast<uint8>(VertexChannel::Color)] = currentOffset;
-            currentOffset += colorsSize;
-            dst += colorsSize;
+            for (uint64 i = 0; i < _indices.GetCount(); i++)
+                indexDst[i] = static_cast<uint16>(_indices[i]);
         }
-
-        if (!_uvs.IsEmpty())
+        else
         {
-            uint64 uvSize = _uvs.GetCount() * sizeof(Vector2);
-            memcpy(dst, _uvs.Data(), uvSize);
-
-            outChannelDataOffsets[static_cast<uint8>(VertexChannel::UV0)] = currentOffset;
+            memcpy(indexDataDestination, _indices.Data(), sizeof(uint32) * _indices.GetCount());
         }
 
-        memcpy(indexDataDestination, _indices.Data(), sizeof(uint32) * _indices.GetCount());
+        _bounds = BoundingBox::FromPoints(_positions);
+        _boundingSphere = BoundingSphere::FromPoints(_bounds, _positions);
 
         _isDirty = false;
     }
@@ -417,6 +513,7 @@ namespace Coco
         _uvs.Clear();
         _indices.Clear();
         _submeshes.Clear();
+        _lods.Clear();
 
         _channels = VertexChannelFlags::None;
 
@@ -426,5 +523,31 @@ namespace Coco
     void Mesh::MarkDirty()
     {
         _isDirty = true;
+        _needsLODGeneration = _lodSettings.has_value();
+    }
+
+    const float* Mesh::GetChannelData(VertexChannel channel, uint64& outVertexCount) const
+    {
+        switch (channel)
+        {
+            case VertexChannel::Position:
+                outVertexCount = _positions.GetCount();
+                return reinterpret_cast<const float*>(_positions.Data());
+            case VertexChannel::Normal:
+                outVertexCount = _normals.GetCount();
+                return reinterpret_cast<const float*>(_normals.Data());
+            case VertexChannel::Tangent:
+                outVertexCount = _tangents.GetCount();
+                return reinterpret_cast<const float*>(_tangents.Data());
+            case VertexChannel::Color:
+                outVertexCount = _colors.GetCount();
+                return reinterpret_cast<const float*>(_colors.Data());
+            case VertexChannel::UV0:
+                outVertexCount = _uvs.GetCount();
+                return reinterpret_cast<const float*>(_uvs.Data());
+            default:
+                outVertexCount = 0;
+                return nullptr;
+        }
     }
 } // Coco
\ No newline at end of file
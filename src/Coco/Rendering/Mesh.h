@@ -4,11 +4,14 @@
 
 #ifndef COCOENGINE_MESH_H
 #define COCOENGINE_MESH_H
+#include "Coco/Core/Math/BoundingBox.h"
+#include "Coco/Core/Math/BoundingSphere.h"
 #include "Coco/Core/Math/Vector2.h"
 #include "Coco/Core/Math/Vector3.h"
 #include "Coco/Core/Math/Vector4.h"
 #include "Coco/Core/Resources/Resource.h"
 #include "Coco/Core/Types/Array.h"
+#include "Coco/Core/Types/Optional.h"
 #include "Graphics/VertexDataTypes.h"
 #include "Graphics/Resources/Buffer.h"
 
@@ -31,6 +34,45 @@ namespace Coco
         Submesh(uint32 indexOffset, uint32 indexCount, int32 vertexOffset = 0);
     };
 
+    /// @brief A simplified level of detail of a mesh. LODs share the mesh's vertices and store their indices after the mesh's own indices
+    struct MeshLOD
+    {
+        /// @brief The offset of this LOD's first index in the index buffer
+        uint32 IndexOffset;
+
+        /// @brief The projected screen size, as a fraction of the viewport height, below which this LOD is used
+        float ScreenSize;
+
+        /// @brief The submeshes of this LOD, one for each submesh of the mesh
+        Array<Submesh> Submeshes;
+
+        MeshLOD(uint32 indexOffset, float screenSize);
+    };
+
+    /// @brief Settings for generating a mesh's levels of detail
+    struct MeshLODSettings
+    {
+        /// @brief The maximum number of LODs to generate, not including the full detail mesh
+        uint32 MaxLODCount;
+
+        /// @brief The fraction of the full detail mesh's triangles each LOD keeps compared to the previous LOD
+        float TriangleRatio;
+
+        /// @brief The maximum error of the coarsest LOD, relative to the size of the mesh. Finer LODs are allowed proportionally less error
+        float MaxError;
+
+        /// @brief The projected screen size, as a fraction of the viewport height, below which the first LOD is used
+        float FirstLODScreenSize;
+
+        /// @brief The amount the screen size threshold is scaled by for each subsequent LOD
+        float ScreenSizeFalloff;
+
+        /// @brief The minimum fraction of triangles a LOD must remove compared to the previous LOD. LOD generation stops once a LOD can't reduce this much
+        float MinReduction;
+
+        MeshLODSettings();
+    };
+
     /// @brief A Resource that defines mesh data
     class Mesh : public Resource
     {
@@ -106,7 +148,7 @@ namespace Coco
         /// @return The vertex UVs
         Span<const Vector2> GetUVs() const { return _uvs; }
 
-        /// @brief Sets the vertex indices of this mesh. Triangles are built by indices into the vertex buffer
+        /// @brief Sets the vertex indices of this mesh. Triangles are built by indices into the vertex buffer. NOTE: this also clears this mesh's LODs
         /// @param indices The vertex indices
         void SetIndices(Span<const uint32> indices);
 
@@ -114,7 +156,8 @@ namespace Coco
         /// @return The vertex indices
         Span<const uint32> GetIndices() const { return _indices; }
 
-        /// @brief Sets the submeshes of this mesh. Each submesh represents a portion of the vertices to draw. Meshes always have at least one submesh
+        /// @brief Sets the submeshes of this mesh. Each submesh represents a portion of the vertices to draw. Meshes always have at least one submesh.
+        /// NOTE: this also clears this mesh's LODs
         /// @param submeshes The submeshes
         void SetSubmeshes(Span<const Submesh> submeshes);
 
@@ -122,6 +165,46 @@ namespace Coco
         /// @return The submeshes
         Span<const Submesh> GetSubmeshes() const { return _submeshes; }
 
+        /// @brief Adds a level of detail to this mesh. Its indices are appended to this mesh's indices, and it must be coarser than the previous LOD
+        /// @param indices The indices of the LOD
+        /// @param submeshes The submeshes of the LOD, relative to the given indices. There must be one for each of this mesh's submeshes
+        /// @param screenSize The projected screen size, as a fraction of the viewport height, below which the LOD is used
+        void AddLOD(Span<const uint32> indices, Span<const Submesh> submeshes, float screenSize);
+
+        /// @brief Removes all levels of detail from this mesh
+        void ClearLODs();
+
+        /// @brief Gets the number of levels of detail this mesh has, including the full detail mesh
+        /// @return The number of LODs
+        uint32 GetLODCount() const { return static_cast<uint32>(_lods.GetCount()) + 1; }
+
+        /// @brief Gets the submeshes of a level of detail
+        /// @param lod The level of detail. LOD 0 is the full detail mesh
+        /// @return The submeshes of the LOD
+        Span<const Submesh> GetLODSubmeshes(uint32 lod) const;
+
+        /// @brief Selects the level of detail to render this mesh with
+        /// @param screenSize The projected screen size of the mesh, as a fraction of the viewport height
+        /// @param currentLOD The LOD the mesh was last rendered with
+        /// @param hysteresis The fraction the screen size must pass a LOD's threshold by before switching to or from it
+        /// @return The level of detail to render with
+        uint32 SelectLOD(float screenSize, uint32 currentLOD, float hysteresis) const;
+
+        /// @brief Makes this mesh generate its levels of detail when its data is uploaded, replacing any LODs added manually.
+        /// The LODs are regenerated whenever the mesh's data changes
+        /// @param settings The LOD settings
+        void EnableLODGeneration(const MeshLODSettings& settings = MeshLODSettings());
+
+        /// @brief Stops this mesh from generating its levels of detail. Any LODs it already has are kept
+        void DisableLODGeneration();
+
+        /// @brief Determines if this mesh generates its levels of detail when its data is uploaded
+        /// @return True if this mesh generates its LODs
+        bool IsLODGenerationEnabled() const { return _lodSettings.has_value(); }
+
+        /// @brief Generates this mesh's levels of detail if LOD generation is enabled and its data has changed since they were last generated
+        void UpdateLODs();
+
         /// @brief Gets the number of vertices in this mesh
         /// @return The number of vertices
         uint64 GetVertexCount() const { return _positions.GetCount(); }
@@ -134,7 +217,22 @@ namespace Coco
         /// @return The vertex channels of this mesh
         VertexChannelFlags GetVertexChannels() const { return _channels; }
 
-        /// @brief Gets the offset within the vertex buffer for a specific channel's data. Channel datas are packed contiguously
+        /// @brief Sets how this mesh's vertex data is laid out and encoded when it is uploaded
+        /// @param layoutMode The layout of the vertex channels
+        /// @param encoding The encoding of the vertex channels
+        void SetVertexLayout(VertexLayoutMode layoutMode, VertexEncoding encoding);
+
+        /// @brief Gets the format this mesh's vertex data will be uploaded with.
+        /// Only channels with data for every vertex are included
+        /// @return The vertex format
+        VertexFormat GetVertexFormat() const;
+
+        /// @brief Gets the format this mesh's indices will be uploaded with. Meshes with few enough vertices use 16-bit indices
+        /// @return The index format
+        IndexFormat GetIndexFormat() const { return GetIndexFormatForVertexCount(_positions.GetCount()); }
+
+        /// @brief Gets the offset within the vertex buffer for a specific channel's data.
+        /// Planar channel datas are packed contiguously, and interleaved channel offsets are relative to the start of each vertex
         /// @param channel The vertex channel
         /// @return The offset in the vertex buffer for the channel's specific data, in bytes
         uint64 GetVertexDataOffset(VertexChannel channel) const;
@@ -162,10 +260,19 @@ namespace Coco
         /// @return True if this mesh's data needs to be updated on the GPU
         bool NeedsUpdate() const { return _isDirty; }
 
-        /// @brief Updates the data from this mesh to pointers into a vertex and index buffer
+        /// @brief Gets the local-space bounding box of this mesh's vertices. This is updated when the mesh data is applied via UpdateData()
+        /// @return The local bounding box
+        const BoundingBox& GetBounds() const { return _bounds; }
+
+        /// @brief Gets the local-space bounding sphere of this mesh's vertices. This is updated when the mesh data is applied via UpdateData()
+        /// @return The local bounding sphere
+        const BoundingSphere& GetBoundingSphere() const { return _boundingSphere; }
+
+        /// @brief Updates the data from this mesh to pointers into a vertex and index buffer, encoded with this mesh's vertex and index formats
         /// @param vertexDataDestination A pointer to the vertex buffer where the vertex data will be stored
         /// @param indexDataDestination A pointer to the index buffer where the index buffer will be stored
-        /// @param outChannelDataOffsets Will be filled with the offsets into the vertex buffer where each channel's data is stored
+        /// @param outChannelDataOffsets Will be filled with the offsets into the vertex buffer where each channel's data starts.
+        /// All channels of interleaved data start at 0
         void UpdateData(void* vertexDataDestination, void* indexDataDestination, ArrayContainer<uint64>& outChannelDataOffsets);
 
         /// @brief Clears all vertex and index data in this mesh
@@ -175,6 +282,8 @@ namespace Coco
         bool _isDirty;
         bool _isDynamic;
         VertexChannelFlags _channels;
+        VertexLayoutMode _vertexLayoutMode;
+        VertexEncoding _vertexEncoding;
         Array<Vector3> _positions;
         Array<Vector3> _normals;
         Array<Vector4> _tangents;
@@ -182,9 +291,20 @@ namespace Coco
         Array<Vector2> _uvs;
         Array<uint32> _indices;
         Array<Submesh> _submeshes;
+        Array<MeshLOD> _lods;
+        Optional<MeshLODSettings> _lodSettings;
+        bool _needsLODGeneration;
+        BoundingBox _bounds;
+        BoundingSphere _boundingSphere;
 
         /// @brief Marks this mesh as needing to be updated
         void MarkDirty();
+
+        /// @brief Gets the elements of a channel's data
+        /// @param channel The vertex channel
+        /// @param outVertexCount Will be set to the number of vertices the channel has data for
+        /// @return The channel's elements
+        const float* GetChannelData(VertexChannel channel, uint64& outVertexCount) const;
     };
 } // Coco
 
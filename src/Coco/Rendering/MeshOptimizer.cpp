@@ -0,0 +1,585 @@
+//
+// Created by cullen on 10/18/26.
+//
+
+#include "MeshOptimizer.h"
+
+#include <cstring>
+#include "Coco/Core/Engine.h"
+#include "Coco/Core/Math/Math.h"
+#include "Coco/Core/Types/Map.h"
+#include "Coco/Core/Types/StackArray.h"
+#include "Coco/Core/Types/Sorting/QSorter.h"
+
+namespace Coco
+{
+    MeshOptimizationSettings::MeshOptimizationSettings() :
+        RemoveDuplicateVertices(true),
+        OptimizeVertexCache(true),
+        OptimizeOverdraw(false),
+        OptimizeVertexFetch(true),
+        CacheSize(16)
+    {}
+
+    MeshOptimizationStats::MeshOptimizationStats() :
+        ACMRBefore(0.0),
+        ACMRAfter(0.0),
+        VertexCountBefore(0),
+        VertexCountAfter(0)
+    {}
+
+    /// @brief The size of the LRU cache Forsyth's algorithm scores vertices with
+    static constexpr uint32 _forsythCacheSize = 32;
+
+    /// @brief Scores a vertex for Forsyth's algorithm. Vertices that were recently used or have few remaining triangles score higher
+    /// @param cachePosition The position of the vertex in the LRU cache, or -1 if it isn't in the cache
+    /// @param remainingValence The number of triangles using the vertex that haven't been added yet
+    /// @return The vertex score
+    static float CalculateForsythVertexScore(int32 cachePosition, uint32 remainingValence)
+    {
+        constexpr float cacheDecayPower = 1.5f;
+        constexpr float lastTriangleScore = 0.75f;
+        constexpr float valenceBoostScale = 2.0f;
+        constexpr float valenceBoostPower = 0.5f;
+
+        if (remainingValence == 0)
+            return -1.0f;
+
+        float score = 0.0f;
+
+        if (cachePosition >= 0)
+        {
+            // Vertices of the last triangle get a fixed score so the next triangle doesn't just reuse the same edge
+            if (cachePosition < 3)
+            {
+                score = lastTriangleScore;
+            }
+            else
+            {
+                const float scaler = 1.0f / (_forsythCacheSize - 3);
+                score = powf(1.0f - (cachePosition - 3) * scaler, cacheDecayPower);
+            }
+        }
+
+        // Boost vertices with few triangles left so they get finished and don't leave lone triangles behind
+        score += valenceBoostScale * powf(static_cast<float>(remainingValence), -valenceBoostPower);
+
+        return score;
+    }
+
+    /// @brief Hashes a vertex's data across every channel of a mesh
+    /// @param mesh The mesh
+    /// @param vertexIndex The index of the vertex
+    /// @return The hash of the vertex's data
+    static uint64 HashVertex(const Mesh& mesh, uint64 vertexIndex)
+    {
+        // FNV-1a
+        uint64 hash = 14695981039346656037ull;
+
+        const auto hashBytes = [&hash](const void* data, uint64 size)
+        {
+            const uint8* bytes = static_cast<const uint8*>(data);
+
+            for (uint64 i = 0; i < size; i++)
+            {
+                hash ^= bytes[i];
+                hash *= 1099511628211ull;
+            }
+        };
+
+        hashBytes(&mesh.GetPositions()[vertexIndex], sizeof(Vector3));
+
+        if (!mesh.GetNormals().empty())
+            hashBytes(&mesh.GetNormals()[vertexIndex], sizeof(Vector3));
+
+        if (!mesh.GetTangents().empty())
+            hashBytes(&mesh.GetTangents()[vertexIndex], sizeof(Vector4));
+
+        if (!mesh.GetColors().empty())
+            hashBytes(&mesh.GetColors()[vertexIndex], sizeof(Vector4));
+
+        if (!mesh.GetUVs().empty())
+            hashBytes(&mesh.GetUVs()[vertexIndex], sizeof(Vector2));
+
+        return hash;
+    }
+
+    /// @brief Determines if two vertices have identical data in every channel of a mesh
+    /// @param mesh The mesh
+    /// @param a The index of the first vertex
+    /// @param b The index of the second vertex
+    /// @return True if the vertices are identical
+    static bool AreVerticesEqual(const Mesh& mesh, uint64 a, uint64 b)
+    {
+        if (memcmp(&mesh.GetPositions()[a], &mesh.GetPositions()[b], sizeof(Vector3)) != 0)
+            return false;
+
+        if (!mesh.GetNormals().empty() && memcmp(&mesh.GetNormals()[a], &mesh.GetNormals()[b], sizeof(Vector3)) != 0)
+            return false;
+
+        if (!mesh.GetTangents().empty() && memcmp(&mesh.GetTangents()[a], &mesh.GetTangents()[b], sizeof(Vector4)) != 0)
+            return false;
+
+        if (!mesh.GetColors().empty() && memcmp(&mesh.GetColors()[a], &mesh.GetColors()[b], sizeof(Vector4)) != 0)
+            return false;
+
+        return mesh.GetUVs().empty() || memcmp(&mesh.GetUVs()[a], &mesh.GetUVs()[b], sizeof(Vector2)) == 0;
+    }
+
+    /// @brief Gathers a channel's data into new positions
+    /// @tparam ValueType The type of the channel's data
+    /// @param data The channel's data
+    /// @param remap The new index of each vertex
+    /// @param newVertexCount The number of vertices after remapping
+    /// @param outData Will be filled with the remapped data
+    template<typename ValueType>
+    static void RemapChannel(Span<const ValueType> data, Span<const uint32> remap, uint64 newVertexCount, Array<ValueType>& outData)
+    {
+        outData.Resize(newVertexCount);
+
+        for (uint64 i = 0; i < data.size(); i++)
+            outData[remap[i]] = data[i];
+    }
+
+    MeshOptimizationStats MeshOptimizer::Optimize(Mesh& mesh, const MeshOptimizationSettings& settings)
+    {
+        mesh.ClearLODs();
+
+        MeshOptimizationStats stats;
+        stats.VertexCountBefore = mesh.GetVertexCount();
+        stats.ACMRBefore = CalculateACMR(mesh.GetIndices(), mesh.GetVertexCount(), settings.CacheSize);
+
+        const bool canModifyVertices = !HasSubmeshVertexOffsets(mesh);
+
+        if (!canModifyVertices && (settings.RemoveDuplicateVertices || settings.OptimizeVertexFetch))
+            COCO_ENGINE_LOG_WARN("Mesh %u has submeshes with vertex offsets. Only its triangle order will be optimized", mesh.GetID());
+
+        if (settings.RemoveDuplicateVertices && canModifyVertices)
+            RemoveDuplicateVertices(mesh);
+
+        if (settings.OptimizeVertexCache || settings.OptimizeOverdraw)
+        {
+            Array<uint32> indices(mesh.GetIndices());
+            Array<uint32> submeshIndices;
+            Array<uint32> optimizedIndices;
+
+            // Reorder within each submesh so the submesh ranges stay valid
+            for (const Submesh& submesh : mesh.GetSubmeshes())
+            {
+                Span<const uint32> range(indices.Data() + submesh.IndexOffset, submesh.IndexCount);
+                submeshIndices.Set(range);
+
+                if (settings.OptimizeVertexCache)
+                {
+                    optimizedIndices.Clear();
+                    OptimizeVertexCache(submeshIndices, mesh.GetVertexCount() - submesh.VertexOffset, optimizedIndices);
+                    submeshIndices.Set(optimizedIndices);
+                }
+
+                if (settings.OptimizeOverdraw)
+                {
+                    optimizedIndices.Clear();
+                    OptimizeOverdraw(submeshIndices, mesh.GetPositions().subspan(submesh.VertexOffset), settings.CacheSize, optimizedIndices);
+                    submeshIndices.Set(optimizedIndices);
+                }
+
+                memcpy(indices.Data() + submesh.IndexOffset, submeshIndices.Data(), submeshIndices.GetCount() * sizeof(uint32));
+            }
+
+            Array<Submesh> submeshes(mesh.GetSubmeshes());
+            mesh.SetIndices(indices);
+            mesh.SetSubmeshes(submeshes);
+        }
+
+        if (settings.OptimizeVertexFetch && canModifyVertices)
+            OptimizeVertexFetch(mesh);
+
+        stats.VertexCountAfter = mesh.GetVertexCount();
+        stats.ACMRAfter = CalculateACMR(mesh.GetIndices(), mesh.GetVertexCount(), settings.CacheSize);
+
+        return stats;
+    }
+
+    uint64 MeshOptimizer::RemoveDuplicateVertices(Mesh& mesh)
+    {
+        const uint64 vertexCount = mesh.GetVertexCount();
+        Map<uint64, uint64> firstVertexByHash;
+        Array<uint32> remap(nullptr, vertexCount);
+        uint32 uniqueVertexCount = 0;
+
+        // Vertices keep their relative order, so the unique vertices are compacted towards the start
+        for (uint64 i = 0; i < vertexCount; i++)
+        {
+            const uint64 hash = HashVertex(mesh, i);
+
+            if (const uint64* firstVertex = firstVertexByHash.TryGetValue(hash))
+            {
+                // Hash collisions between different vertices are rare enough to just keep the vertex unique
+                if (AreVerticesEqual(mesh, *firstVertex, i))
+                {
+                    remap.Append(remap[*firstVertex]);
+                    continue;
+                }
+            }
+            else
+            {
+                firstVertexByHash.Emplace(hash, i);
+            }
+
+            remap.Append(uniqueVertexCount++);
+        }
+
+        if (uniqueVertexCount == vertexCount)
+            return 0;
+
+        RemapVertices(mesh, remap, uniqueVertexCount);
+
+        return vertexCount - uniqueVertexCount;
+    }
+
+    void MeshOptimizer::OptimizeVertexCache(Span<const uint32> indices, uint64 vertexCount, ArrayContainer<uint32>& outIndices)
+    {
+        COCO_ASSERT(indices.size() % 3 == 0, "Indices must be a multiple of 3");
+
+        const uint64 triangleCount = indices.size() / 3;
+        if (triangleCount == 0)
+            return;
+
+        // Build the list of triangles that use each vertex
+        Array<uint32> adjacencyOffsets;
+        adjacencyOffsets.Resize(vertexCount + 1, 0);
+
+        for (const uint32 index : indices)
+            adjacencyOffsets[index + 1]++;
+
+        for (uint64 v = 0; v < vertexCount; v++)
+            adjacencyOffsets[v + 1] += adjacencyOffsets[v];
+
+        Array<uint32> remainingValence;
+        remainingValence.Resize(vertexCount, 0);
+
+        Array<uint32> adjacency;
+        adjacency.Resize(indices.size(), 0);
+
+        for (uint64 t = 0; t < triangleCount; t++)
+        {
+            for (uint64 c = 0; c < 3; c++)
+            {
+                const uint32 v = indices[t * 3 + c];
+                adjacency[adjacencyOffsets[v] + remainingValence[v]++] = static_cast<uint32>(t);
+            }
+        }
+
+        Array<int32> cachePositions;
+        cachePositions.Resize(vertexCount, -1);
+
+        Array<float> vertexScores;
+        vertexScores.Resize(vertexCount, 0.0f);
+
+        for (uint64 v = 0; v < vertexCount; v++)
+            vertexScores[v] = CalculateForsythVertexScore(-1, remainingValence[v]);
+
+        Array<float> triangleScores;
+        triangleScores.Resize(triangleCount, 0.0f);
+
+        Array<uint8> triangleAdded;
+        triangleAdded.Resize(triangleCount, 0);
+
+        uint64 bestTriangle = 0;
+
+        for (uint64 t = 0; t < triangleCount; t++)
+        {
+            triangleScores[t] = vertexScores[indices[t * 3]] + vertexScores[indices[t * 3 + 1]] + vertexScores[indices[t * 3 + 2]];
+
+            if (triangleScores[t] > triangleScores[bestTriangle])
+                bestTriangle = t;
+        }
+
+        StackArray<uint32, _forsythCacheSize + 3> cache;
+        StackArray<uint32, _forsythCacheSize + 3> newCache;
+        uint64 nextUnaddedTriangle = 0;
+        bool hasBestTriangle = true;
+
+        outIndices.Reserve(outIndices.GetCount() + indices.size());
+
+        for (uint64 added = 0; added < triangleCount; added++)
+        {
+            // Nothing in the cache has triangles left, so start over from the next triangle in the original order
+            if (!hasBestTriangle)
+            {
+                while (triangleAdded[nextUnaddedTriangle])
+                    nextUnaddedTriangle++;
+
+                bestTriangle = nextUnaddedTriangle;
+            }
+
+            triangleAdded[bestTriangle] = 1;
+            const uint32* triangle = indices.data() + bestTriangle * 3;
+
+            newCache.Clear();
+
+            for (uint64 c = 0; c < 3; c++)
+            {
+                const uint32 v = triangle[c];
+                outIndices.Append(v);
+                newCache.Append(v);
+
+                // Remove the triangle from the vertex's remaining triangles
+                const uint32 start = adjacencyOffsets[v];
+                const uint32 end = start + remainingValence[v];
+
+                for (uint32 i = start; i < end; i++)
+                {
+                    if (adjacency[i] == bestTriangle)
+                    {
+                        adjacency[i] = adjacency[end - 1];
+                        remainingValence[v]--;
+                        break;
+                    }
+                }
+            }
+
+            for (const uint32 v : cache)
+            {
+                if (v != triangle[0] && v != triangle[1] && v != triangle[2])
+                    newCache.Append(v);
+            }
+
+            // Rescore the cached vertices, including ones that were just pushed out, and the triangles that use them
+            hasBestTriangle = false;
+            float bestScore = -1.0f;
+
+            for (uint64 i = 0; i < newCache.GetCount(); i++)
+            {
+                const uint32 v = newCache[i];
+                cachePositions[v] = i < _forsythCacheSize ? static_cast<int32>(i) : -1;
+                vertexScores[v] = CalculateForsythVertexScore(cachePositions[v], remainingValence[v]);
+
+                const uint32 start = adjacencyOffsets[v];
+                const uint32 end = start + remainingValence[v];
+
+                for (uint32 a = start; a < end; a++)
+                {
+                    const uint32 t = adjacency[a];
+                    triangleScores[t] = vertexScores[indices[t * 3]] + vertexScores[indices[t * 3 + 1]] + vertexScores[indices[t * 3 + 2]];
+
+                    if (triangleScores[t] > bestScore)
+                    {
+                        bestScore = triangleScores[t];
+                        bestTriangle = t;
+                        hasBestTriangle = true;
+                    }
+                }
+            }
+
+            if (newCache.GetCount() > _forsythCacheSize)
+                newCache.Resize(_forsythCacheSize);
+
+            cache = newCache;
+        }
+    }
+
+    void MeshOptimizer::OptimizeOverdraw(Span<const uint32> indices, Span<const Vector3> positions, uint32 cacheSize, ArrayContainer<uint32>& outIndices)
+    {
+        COCO_ASSERT(indices.size() % 3 == 0, "Indices must be a multiple of 3");
+
+        const uint64 triangleCount = indices.size() / 3;
+        if (triangleCount == 0)
+            return;
+
+        struct TriangleCluster
+        {
+            uint64 FirstTriangle;
+            uint64 TriangleCount;
+            float SortKey;
+        };
+
+        // Split into clusters where every vertex of a triangle misses the cache. Reordering clusters at those points barely changes the ACMR
+        Array<TriangleCluster> clusters;
+        Array<uint64> cacheTimestamps;
+        cacheTimestamps.Resize(positions.size(), std::numeric_limits<uint64>::max());
+        uint64 cacheTime = cacheSize + 1;
+
+        for (uint64 t = 0; t < triangleCount; t++)
+        {
+            uint32 misses = 0;
+
+            for (uint64 c = 0; c < 3; c++)
+            {
+                const uint32 v = indices[t * 3 + c];
+
+                if (cacheTimestamps[v] == std::numeric_limits<uint64>::max() || cacheTime - cacheTimestamps[v] > cacheSize)
+                {
+                    cacheTimestamps[v] = cacheTime++;
+                    misses++;
+                }
+            }
+
+            if (clusters.IsEmpty() || misses == 3)
+                clusters.Append(TriangleCluster{t, 0, 0.0f});
+
+            clusters[clusters.GetCount() - 1].TriangleCount++;
+        }
+
+        if (clusters.GetCount() == 1)
+        {
+            outIndices.AppendRange(indices);
+            return;
+        }
+
+        // Sort clusters so the ones facing away from the mesh's center are drawn first, since they are likely to occlude inner triangles
+        Vector3 meshCenter;
+        float meshArea = 0.0f;
+        Array<Vector3> clusterCenters(nullptr, clusters.GetCount());
+        Array<Vector3> clusterNormals(nullptr, clusters.GetCount());
+
+        for (const TriangleCluster& cluster : clusters)
+        {
+            Vector3 center;
+            Vector3 normal;
+            float area = 0.0f;
+
+            for (uint64 t = cluster.FirstTriangle; t < cluster.FirstTriangle + cluster.TriangleCount; t++)
+            {
+                const Vector3& a = positions[indices[t * 3]];
+                const Vector3& b = positions[indices[t * 3 + 1]];
+                const Vector3& c = positions[indices[t * 3 + 2]];
+
+                const Vector3 triangleNormal = (b - a).Cross(c - a);
+                const float triangleArea = triangleNormal.GetLength();
+
+                center += (a + b + c) * (triangleArea / 3.0f);
+                normal += triangleNormal;
+                area += triangleArea;
+            }
+
+            meshCenter += center;
+            meshArea += area;
+
+            clusterCenters.Append(area > 0.0f ? center / area : center);
+            clusterNormals.Append(normal.Normalized());
+        }
+
+        if (meshArea > 0.0f)
+            meshCenter /= meshArea;
+
+        for (uint64 i = 0; i < clusters.GetCount(); i++)
+            clusters[i].SortKey = (clusterCenters[i] - meshCenter).Dot(clusterNormals[i]);
+
+        QSorter<TriangleCluster> sorter([](const TriangleCluster& a, const TriangleCluster& b) { return a.SortKey > b.SortKey; });
+        sorter.Sort(clusters);
+
+        outIndices.Reserve(outIndices.GetCount() + indices.size());
+
+        for (const TriangleCluster& cluster : clusters)
+            outIndices.AppendRange(indices.subspan(cluster.FirstTriangle * 3, cluster.TriangleCount * 3));
+    }
+
+    void MeshOptimizer::OptimizeVertexFetch(Mesh& mesh)
+    {
+        if (HasSubmeshVertexOffsets(mesh))
+        {
+            COCO_ENGINE_LOG_WARN("Cannot reorder the vertices of mesh %u because its submeshes use vertex offsets", mesh.GetID());
+            return;
+        }
+
+        const uint64 vertexCount = mesh.GetVertexCount();
+        constexpr uint32 unassigned = std::numeric_limits<uint32>::max();
+
+        Array<uint32> remap;
+        remap.Resize(vertexCount, unassigned);
+        uint32 nextVertex = 0;
+
+        for (const uint32 index : mesh.GetIndices())
+        {
+            if (remap[index] == unassigned)
+                remap[index] = nextVertex++;
+        }
+
+        // Keep unreferenced vertices at the end
+        for (uint64 v = 0; v < vertexCount; v++)
+        {
+            if (remap[v] == unassigned)
+                remap[v] = nextVertex++;
+        }
+
+        RemapVertices(mesh, remap, vertexCount);
+    }
+
+    double MeshOptimizer::CalculateACMR(Span<const uint32> indices, uint64 vertexCount, uint32 cacheSize)
+    {
+        const uint64 triangleCount = indices.size() / 3;
+        if (triangleCount == 0)
+            return 0.0;
+
+        // A vertex is in the FIFO cache if fewer than cacheSize vertices have been added since it was added
+        Array<uint64> cacheTimestamps;
+        cacheTimestamps.Resize(vertexCount, std::numeric_limits<uint64>::max());
+        uint64 misses = 0;
+
+        for (const uint32 index : indices)
+        {
+            if (cacheTimestamps[index] == std::numeric_limits<uint64>::max() || misses - cacheTimestamps[index] >= cacheSize)
+            {
+                cacheTimestamps[index] = misses;
+                misses++;
+            }
+        }
+
+        return static_cast<double>(misses) / triangleCount;
+    }
+
+    void MeshOptimizer::RemapVertices(Mesh& mesh, Span<const uint32> remap, uint64 newVertexCount)
+    {
+        Array<Vector3> positions;
+        RemapChannel(mesh.GetPositions(), remap, newVertexCount, positions);
+
+        Array<Vector3> normals;
+        RemapChannel(mesh.GetNormals(), remap, mesh.GetNormals().empty() ? 0 : newVertexCount, normals);
+
+        Array<Vector4> tangents;
+        RemapChannel(mesh.GetTangents(), remap, mesh.GetTangents().empty() ? 0 : newVertexCount, tangents);
+
+        Array<Vector4> colors;
+        RemapChannel(mesh.GetColors(), remap, mesh.GetColors().empty() ? 0 : newVertexCount, colors);
+
+        Array<Vector2> uvs;
+        RemapChannel(mesh.GetUVs(), remap, mesh.GetUVs().empty() ? 0 : newVertexCount, uvs);
+
+        Array<uint32> indices(nullptr, mesh.GetIndexCount());
+
+        for (const uint32 index : mesh.GetIndices())
+            indices.Append(remap[index]);
+
+        Array<Submesh> submeshes(mesh.GetSubmeshes());
+
+        // Positions set the vertex count, so they need to be set before the other channels
+        mesh.SetPositions(positions);
+
+        if (!normals.IsEmpty())
+            mesh.SetNormals(normals);
+
+        if (!tangents.IsEmpty())
+            mesh.SetTangents(tangents);
+
+        if (!colors.IsEmpty())
+            mesh.SetColors(colors);
+
+        if (!uvs.IsEmpty())
+            mesh.SetUVs(uvs);
+
+        mesh.SetIndices(indices);
+        mesh.SetSubmeshes(submeshes);
+    }
+
+    bool MeshOptimizer::HasSubmeshVertexOffsets(const Mesh& mesh)
+    {
+        for (const Submesh& submesh : mesh.GetSubmeshes())
+        {
+            if (submesh.VertexOffset != 0)
+                return true;
+        }
+
+        return false;
+    }
+} // Coco
\ No newline at end of file
@@ -0,0 +1,107 @@
+//
+// Created by cullen on 10/18/26.
+//
+
+#ifndef COCOENGINE_MESHOPTIMIZER_H
+#define COCOENGINE_MESHOPTIMIZER_H
+#include "Mesh.h"
+#include "Coco/Core/Types/ArrayContainer.h"
+#include "Coco/Core/Types/Span.h"
+
+namespace Coco
+{
+    /// @brief Settings for optimizing a mesh
+    struct MeshOptimizationSettings
+    {
+        /// @brief If true, vertices with identical data in every channel are merged
+        bool RemoveDuplicateVertices;
+
+        /// @brief If true, triangles are reordered so vertices are reused while they are still in the post-transform vertex cache
+        bool OptimizeVertexCache;
+
+        /// @brief If true, groups of triangles are reordered so outward-facing triangles are drawn first to reduce overdraw
+        bool OptimizeOverdraw;
+
+        /// @brief If true, vertices are reordered in the order they are first used to improve vertex fetch locality
+        bool OptimizeVertexFetch;
+
+        /// @brief The size of the FIFO vertex cache to simulate when measuring and optimizing for overdraw
+        uint32 CacheSize;
+
+        MeshOptimizationSettings();
+    };
+
+    /// @brief The results of optimizing a mesh
+    struct MeshOptimizationStats
+    {
+        /// @brief The average cache miss ratio (transformed vertices per triangle) before optimizing
+        double ACMRBefore;
+
+        /// @brief The average cache miss ratio (transformed vertices per triangle) after optimizing
+        double ACMRAfter;
+
+        /// @brief The number of vertices before optimizing
+        uint64 VertexCountBefore;
+
+        /// @brief The number of vertices after optimizing
+        uint64 VertexCountAfter;
+
+        MeshOptimizationStats();
+    };
+
+    /// @brief Reorders and deduplicates mesh data so it renders more efficiently. Intended to run when meshes are imported or cooked
+    class MeshOptimizer
+    {
+    public:
+        /// @brief Optimizes a mesh's vertices and indices. Each submesh's triangles are reordered separately.
+        /// Vertex passes are skipped for meshes with submeshes that use vertex offsets. Any LODs are cleared, so this should run before generating them
+        /// @param mesh The mesh
+        /// @param settings The optimization settings
+        /// @return The optimization results
+        static MeshOptimizationStats Optimize(Mesh& mesh, const MeshOptimizationSettings& settings = MeshOptimizationSettings());
+
+        /// @brief Merges vertices with identical data in every channel and remaps the indices to the merged vertices
+        /// @param mesh The mesh
+        /// @return The number of vertices that were removed
+        static uint64 RemoveDuplicateVertices(Mesh& mesh);
+
+        /// @brief Reorders triangles to improve post-transform vertex cache hits using Tom Forsyth's linear-speed vertex cache optimization
+        /// @param indices The triangle indices
+        /// @param vertexCount The number of vertices the indices reference
+        /// @param outIndices Will be filled with the reordered indices
+        static void OptimizeVertexCache(Span<const uint32> indices, uint64 vertexCount, ArrayContainer<uint32>& outIndices);
+
+        /// @brief Reorders clusters of triangles so triangles facing away from the mesh's center are drawn first.
+        /// Clusters are split where the vertex cache would miss every vertex of a triangle, so this should run after OptimizeVertexCache()
+        /// @param indices The triangle indices
+        /// @param positions The vertex positions
+        /// @param cacheSize The size of the FIFO vertex cache to simulate
+        /// @param outIndices Will be filled with the reordered indices
+        static void OptimizeOverdraw(Span<const uint32> indices, Span<const Vector3> positions, uint32 cacheSize, ArrayContainer<uint32>& outIndices);
+
+        /// @brief Reorders vertices in the order they are first referenced by the indices and remaps the indices
+        /// @param mesh The mesh
+        static void OptimizeVertexFetch(Mesh& mesh);
+
+        /// @brief Calculates the average cache miss ratio of triangle indices by simulating a FIFO vertex cache
+        /// @param indices The triangle indices
+        /// @param vertexCount The number of vertices the indices reference
+        /// @param cacheSize The size of the vertex cache
+        /// @return The average number of vertices transformed per triangle. 0.5 is ideal for large grids, and 3 is the worst case
+        static double CalculateACMR(Span<const uint32> indices, uint64 vertexCount, uint32 cacheSize = 16);
+
+    private:
+        /// @brief Moves a mesh's vertices to new positions and remaps its indices
+        /// @param mesh The mesh
+        /// @param remap The new index of each vertex. Multiple vertices may move to the same index
+        /// @param newVertexCount The number of vertices after remapping
+        static void RemapVertices(Mesh& mesh, Span<const uint32> remap, uint64 newVertexCount);
+
+        /// @brief Determines if any of a mesh's submeshes use a vertex offset
+        /// @param mesh The mesh
+        /// @return True if a submesh has a vertex offset
+        static bool HasSubmeshVertexOffsets(const Mesh& mesh);
+    };
+} // Coco
+
+#endif //COCOENGINE_MESHOPTIMIZER_H
\ No newline at end of file
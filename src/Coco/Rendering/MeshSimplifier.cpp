@@ -0,0 +1,445 @@
+//
+// Created by cullen on 10/18/26.
+//
+
+#include "MeshSimplifier.h"
+
+#include <cstring>
+#include "MeshOptimizer.h"
+#include "Coco/Core/Engine.h"
+#include "Coco/Core/Math/Math.h"
+#include "Coco/Core/Types/Map.h"
+
+namespace Coco
+{
+    /// @brief A symmetric 4x4 matrix that measures the squared distance of a point to a set of planes
+    struct Quadric
+    {
+        double XX, XY, XZ, XW;
+        double YY, YZ, YW;
+        double ZZ, ZW;
+        double WW;
+
+        /// @brief The total area of the planes, used to normalize the error
+        double Weight;
+
+        Quadric() :
+            XX(0.0), XY(0.0), XZ(0.0), XW(0.0),
+            YY(0.0), YZ(0.0), YW(0.0),
+            ZZ(0.0), ZW(0.0),
+            WW(0.0),
+            Weight(0.0)
+        {}
+
+        Quadric(const Vector3& normal, double distance, double weight) :
+            XX(normal.X() * normal.X() * weight), XY(normal.X() * normal.Y() * weight), XZ(normal.X() * normal.Z() * weight), XW(normal.X() * distance * weight),
+            YY(normal.Y() * normal.Y() * weight), YZ(normal.Y() * normal.Z() * weight), YW(normal.Y() * distance * weight),
+            ZZ(normal.Z() * normal.Z() * weight), ZW(normal.Z() * distance * weight),
+            WW(distance * distance * weight),
+            Weight(weight)
+        {}
+
+        void operator+=(const Quadric& other)
+        {
+            XX += other.XX; XY += other.XY; XZ += other.XZ; XW += other.XW;
+            YY += other.YY; YZ += other.YZ; YW += other.YW;
+            ZZ += other.ZZ; ZW += other.ZW;
+            WW += other.WW;
+            Weight += other.Weight;
+        }
+
+        /// @brief Gets the area-weighted average squared distance of a point to this quadric's planes
+        /// @param p The point
+        /// @return The squared error
+        double Evaluate(const Vector3& p) const
+        {
+            const double x = p.X();
+            const double y = p.Y();
+            const double z = p.Z();
+
+            const double error =
+                XX * x * x + 2.0 * XY * x * y + 2.0 * XZ * x * z + 2.0 * XW * x +
+                YY * y * y + 2.0 * YZ * y * z + 2.0 * YW * y +
+                ZZ * z * z + 2.0 * ZW * z +
+                WW;
+
+            return Weight > 0.0 ? Math::Abs(error) / Weight : 0.0;
+        }
+    };
+
+    /// @brief A potential collapse of one vertex into another
+    struct EdgeCollapse
+    {
+        uint32 From;
+        uint32 To;
+        double Error;
+    };
+
+    /// @brief Hashes a position's bytes so positions shared by multiple vertices can be found
+    /// @param position The position
+    /// @return The hash of the position
+    static uint64 HashPosition(const Vector3& position)
+    {
+        // FNV-1a
+        uint64 hash = 14695981039346656037ull;
+        const uint8* bytes = reinterpret_cast<const uint8*>(&position);
+
+        for (uint64 i = 0; i < sizeof(Vector3); i++)
+        {
+            hash ^= bytes[i];
+            hash *= 1099511628211ull;
+        }
+
+        return hash;
+    }
+
+    /// @brief Builds the list of triangles that use each vertex
+    /// @param indices The triangle indices
+    /// @param vertexCount The number of vertices
+    /// @param outOffsets Will be filled with the offset of each vertex's triangles in outTriangles, plus the total count at the end
+    /// @param outTriangles Will be filled with the triangles of each vertex
+    static void BuildVertexTriangles(Span<const uint32> indices, uint64 vertexCount, Array<uint32>& outOffsets, Array<uint32>& outTriangles)
+    {
+        outOffsets.Clear();
+        outOffsets.Resize(vertexCount + 1, 0);
+
+        for (const uint32 index : indices)
+            outOffsets[index + 1]++;
+
+        for (uint64 v = 0; v < vertexCount; v++)
+            outOffsets[v + 1] += outOffsets[v];
+
+        outTriangles.Resize(indices.size());
+
+        // Fill using the start offsets, which shifts each offset to the end of its range, then shift them back
+        for (uint64 i = 0; i < indices.size(); i++)
+            outTriangles[outOffsets[indices[i]]++] = static_cast<uint32>(i / 3);
+
+        for (uint64 v = vertexCount; v > 0; v--)
+            outOffsets[v] = outOffsets[v - 1];
+
+        outOffsets[0] = 0;
+    }
+
+    /// @brief Checks if collapsing a vertex would flip or fold any of its remaining triangles, and counts the triangles the collapse removes
+    /// @param collapse The collapse
+    /// @param indices The triangle indices
+    /// @param positions The vertex positions
+    /// @param triangles The triangles of the collapsed vertex
+    /// @param outRemovedTriangles Will be set to the number of triangles the collapse removes
+    /// @return True if the collapse doesn't flip or fold any triangles
+    static bool IsCollapseValid(const EdgeCollapse& collapse, Span<const uint32> indices, Span<const Vector3> positions, Span<const uint32> triangles, uint64& outRemovedTriangles)
+    {
+        outRemovedTriangles = 0;
+
+        for (const uint32 t : triangles)
+        {
+            const uint32* triangle = indices.data() + t * 3;
+
+            if (triangle[0] == collapse.To || triangle[1] == collapse.To || triangle[2] == collapse.To)
+            {
+                outRemovedTriangles++;
+                continue;
+            }
+
+            Vector3 p[3] = { positions[triangle[0]], positions[triangle[1]], positions[triangle[2]] };
+            const Vector3 normal = (p[1] - p[0]).Cross(p[2] - p[0]);
+
+            for (uint64 c = 0; c < 3; c++)
+            {
+                if (triangle[c] == collapse.From)
+                    p[c] = positions[collapse.To];
+            }
+
+            const Vector3 collapsedNormal = (p[1] - p[0]).Cross(p[2] - p[0]);
+
+            // Reject large rotations as well as flips since they leave thin slivers that fold over the surface
+            if (normal.Dot(collapsedNormal) <= 0.25f * normal.GetLength() * collapsedNormal.GetLength())
+                return false;
+        }
+
+        return true;
+    }
+
+    float MeshSimplifier::Simplify(Span<const uint32> indices, Span<const Vector3> positions, uint64 targetIndexCount, float maxError, ArrayContainer<uint32>& outIndices)
+    {
+        COCO_ASSERT(indices.size() % 3 == 0, "Indices must be a multiple of 3");
+
+        if (indices.size() <= targetIndexCount)
+        {
+            outIndices.AppendRange(indices);
+            return 0.0f;
+        }
+
+        const uint64 vertexCount = positions.size();
+
+        // Measure error relative to the size of the referenced vertices so the limit doesn't depend on the mesh's scale
+        BoundingBox bounds(positions[indices[0]], positions[indices[0]]);
+
+        for (const uint32 index : indices)
+            bounds.Expand(positions[index]);
+
+        const Vector3 size = bounds.Maximum - bounds.Minimum;
+        const double extent = Math::Max(size.X(), Math::Max(size.Y(), size.Z()));
+        const double maxErrorSquared = (maxError * extent) * (maxError * extent);
+
+        // Vertices that share a position with another vertex are on an attribute seam, so moving them would tear the mesh
+        constexpr uint32 unassigned = std::numeric_limits<uint32>::max();
+        Array<uint32> positionIDs;
+        positionIDs.Resize(vertexCount, unassigned);
+
+        Array<uint8> locked;
+        locked.Resize(vertexCount, 0);
+
+        Map<uint64, uint32> firstVertexByPosition;
+
+        for (const uint32 v : indices)
+        {
+            if (positionIDs[v] != unassigned)
+                continue;
+
+            positionIDs[v] = v;
+            const uint64 hash = HashPosition(positions[v]);
+
+            if (const uint32* firstVertex = firstVertexByPosition.TryGetValue(hash))
+            {
+                if (memcmp(&positions[*firstVertex], &positions[v], sizeof(Vector3)) == 0)
+                {
+                    positionIDs[v] = *firstVertex;
+                    locked[v] = 1;
+                    locked[*firstVertex] = 1;
+                }
+            }
+            else
+            {
+                firstVertexByPosition.Emplace(hash, v);
+            }
+        }
+
+        // Edges that aren't shared by exactly two triangles are on an open border or are non-manifold, so lock them to preserve the silhouette
+        Map<uint64, uint32> edgeUseCounts;
+
+        for (uint64 i = 0; i < indices.size(); i++)
+        {
+            const uint32 a = positionIDs[indices[i]];
+            const uint32 b = positionIDs[indices[i - i % 3 + (i + 1) % 3]];
+            const uint64 key = (static_cast<uint64>(Math::Min(a, b)) << 32) | Math::Max(a, b);
+
+            if (uint32* count = edgeUseCounts.TryGetValue(key))
+                (*count)++;
+            else
+                edgeUseCounts.Emplace(key, 1);
+        }
+
+        for (const auto& [key, count] : edgeUseCounts)
+        {
+            if (count != 2)
+            {
+                locked[static_cast<uint32>(key >> 32)] = 1;
+                locked[static_cast<uint32>(key)] = 1;
+            }
+        }
+
+        // Accumulate each triangle's plane on its vertices, weighted by the triangle's area
+        Array<Quadric> quadrics;
+        quadrics.Resize(vertexCount, Quadric());
+
+        for (uint64 i = 0; i < indices.size(); i += 3)
+        {
+            const Vector3& p0 = positions[indices[i]];
+            const Vector3 cross = (positions[indices[i + 1]] - p0).Cross(positions[indices[i + 2]] - p0);
+            const float doubleArea = cross.GetLength();
+
+            if (doubleArea <= 0.0f)
+                continue;
+
+            const Vector3 normal = cross / doubleArea;
+            const Quadric quadric(normal, -normal.Dot(p0), doubleArea * 0.5);
+
+            for (uint64 c = 0; c < 3; c++)
+                quadrics[indices[i + c]] += quadric;
+        }
+
+        Array<uint32> result(indices);
+        const uint64 targetTriangleCount = targetIndexCount / 3;
+        double largestError = 0.0;
+
+        Array<uint32> triangleOffsets;
+        Array<uint32> vertexTriangles;
+        Array<EdgeCollapse> collapses;
+        Array<uint32> bucketOffsets;
+        Array<uint32> sortedCollapses;
+        Array<uint32> remap;
+        Array<uint8> touched;
+
+        while (result.GetCount() / 3 > targetTriangleCount)
+        {
+            const uint64 triangleCount = result.GetCount() / 3;
+            BuildVertexTriangles(result, vertexCount, triangleOffsets, vertexTriangles);
+
+            // Gather the collapses along every triangle edge that are within the error limit
+            collapses.Clear();
+
+            for (uint64 i = 0; i < result.GetCount(); i++)
+            {
+                const uint32 a = result[i];
+                const uint32 b = result[i - i % 3 + (i + 1) % 3];
+
+                for (const auto& [from, to] : { std::pair(a, b), std::pair(b, a) })
+                {
+                    if (locked[from])
+                        continue;
+
+                    Quadric quadric = quadrics[from];
+                    quadric += quadrics[to];
+                    const double error = quadric.Evaluate(positions[to]);
+
+                    if (error <= maxErrorSquared)
+                        collapses.Append(EdgeCollapse{from, to, error});
+                }
+            }
+
+            if (collapses.IsEmpty())
+                break;
+
+            // Bucket the collapses by error instead of fully sorting them, since the order within a bucket barely affects quality
+            constexpr uint32 bucketCount = 1024;
+            const double bucketScale = maxErrorSquared > 0.0 ? (bucketCount - 1) / maxErrorSquared : 0.0;
+
+            bucketOffsets.Clear();
+            bucketOffsets.Resize(bucketCount + 1, 0);
+
+            for (const EdgeCollapse& collapse : collapses)
+                bucketOffsets[static_cast<uint32>(collapse.Error * bucketScale) + 1]++;
+
+            for (uint32 b = 0; b < bucketCount; b++)
+                bucketOffsets[b + 1] += bucketOffsets[b];
+
+            sortedCollapses.Resize(collapses.GetCount());
+
+            for (uint64 i = 0; i < collapses.GetCount(); i++)
+                sortedCollapses[bucketOffsets[static_cast<uint32>(collapses[i].Error * bucketScale)]++] = static_cast<uint32>(i);
+
+            remap.Resize(vertexCount);
+            for (uint64 v = 0; v < vertexCount; v++)
+                remap[v] = static_cast<uint32>(v);
+
+            touched.Clear();
+            touched.Resize(vertexCount, 0);
+
+            const uint64 trianglesToRemove = triangleCount - targetTriangleCount;
+            uint64 removedTriangles = 0;
+            uint64 collapseCount = 0;
+
+            for (const uint32 collapseIndex : sortedCollapses)
+            {
+                const EdgeCollapse& collapse = collapses[collapseIndex];
+
+                // Each vertex only moves once per pass so the flip checks stay valid
+                if (touched[collapse.From] || touched[collapse.To])
+                    continue;
+
+                Span<const uint32> triangles(vertexTriangles.Data() + triangleOffsets[collapse.From], triangleOffsets[collapse.From + 1] - triangleOffsets[collapse.From]);
+                uint64 collapseRemovedTriangles = 0;
+
+                if (!IsCollapseValid(collapse, result, positions, triangles, collapseRemovedTriangles))
+                    continue;
+
+                remap[collapse.From] = collapse.To;
+                quadrics[collapse.To] += quadrics[collapse.From];
+
+                for (const uint32 t : triangles)
+                {
+                    for (uint64 c = 0; c < 3; c++)
+                        touched[result[t * 3 + c]] = 1;
+                }
+
+                removedTriangles += collapseRemovedTriangles;
+                largestError = Math::Max(largestError, collapse.Error);
+                collapseCount++;
+
+                if (removedTriangles >= trianglesToRemove)
+                    break;
+            }
+
+            if (collapseCount == 0)
+                break;
+
+            // Apply the collapses and remove the triangles that became degenerate
+            uint64 writeIndex = 0;
+
+            for (uint64 i = 0; i < result.GetCount(); i += 3)
+            {
+                const uint32 a = remap[result[i]];
+                const uint32 b = remap[result[i + 1]];
+                const uint32 c = remap[result[i + 2]];
+
+                if (a == b || b == c || a == c)
+                    continue;
+
+                result[writeIndex++] = a;
+                result[writeIndex++] = b;
+                result[writeIndex++] = c;
+            }
+
+            result.Resize(writeIndex);
+        }
+
+        outIndices.AppendRange(result);
+
+        return extent > 0.0 ? static_cast<float>(Math::Sqrt(largestError) / extent) : 0.0f;
+    }
+
+    uint32 MeshSimplifier::GenerateLODs(Mesh& mesh, const MeshLODSettings& settings)
+    {
+        mesh.ClearLODs();
+
+        Array<uint32> baseIndices(mesh.GetIndices());
+        Array<Submesh> submeshes(mesh.GetSubmeshes());
+        Array<uint32> simplifiedIndices;
+        Array<uint32> lodIndices;
+        Array<Submesh> lodSubmeshes;
+
+        uint64 previousIndexCount = baseIndices.GetCount();
+        float triangleRatio = 1.0f;
+        float screenSize = settings.FirstLODScreenSize;
+        uint32 lodCount = 0;
+
+        for (uint32 lod = 1; lod <= settings.MaxLODCount; lod++)
+        {
+            // Simplify from the full detail mesh each time so errors from coarser LODs don't compound
+            triangleRatio *= settings.TriangleRatio;
+            const float maxError = settings.MaxError * lod / settings.MaxLODCount;
+
+            lodIndices.Clear();
+            lodSubmeshes.Clear();
+
+            for (const Submesh& submesh : submeshes)
+            {
+                Span<const uint32> indices(baseIndices.Data() + submesh.IndexOffset, submesh.IndexCount);
+                Span<const Vector3> positions = mesh.GetPositions().subspan(submesh.VertexOffset);
+                const uint64 targetIndexCount = static_cast<uint64>(submesh.IndexCount / 3 * triangleRatio) * 3;
+
+                simplifiedIndices.Clear();
+                Simplify(indices, positions, targetIndexCount, maxError, simplifiedIndices);
+
+                const uint64 offset = lodIndices.GetCount();
+                MeshOptimizer::OptimizeVertexCache(simplifiedIndices, positions.size(), lodIndices);
+                lodSubmeshes.EmplaceBack(static_cast<uint32>(offset), static_cast<uint32>(lodIndices.GetCount() - offset), submesh.VertexOffset);
+            }
+
+            if (lodIndices.GetCount() > previousIndexCount * (1.0f - settings.MinReduction))
+                break;
+
+            mesh.AddLOD(lodIndices, lodSubmeshes, screenSize);
+
+            previousIndexCount = lodIndices.GetCount();
+            screenSize *= settings.ScreenSizeFalloff;
+            lodCount++;
+        }
+
+        COCO_ENGINE_LOG_VERBOSE("Generated %u LODs for mesh %u", lodCount, mesh.GetID());
+
+        return lodCount;
+    }
+} // Coco
\ No newline at end of file
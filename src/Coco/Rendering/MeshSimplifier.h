@@ -0,0 +1,36 @@
+//
+// Created by cullen on 10/18/26.
+//
+
+#ifndef COCOENGINE_MESHSIMPLIFIER_H
+#define COCOENGINE_MESHSIMPLIFIER_H
+#include "Mesh.h"
+#include "Coco/Core/Types/ArrayContainer.h"
+#include "Coco/Core/Types/Span.h"
+
+namespace Coco
+{
+    /// @brief Simplifies meshes by collapsing edges in the order of least quadric error
+    class MeshSimplifier
+    {
+    public:
+        /// @brief Simplifies triangles by collapsing vertices into their neighbors. Vertices are never moved or created, so the result indexes the same vertices.
+        /// Vertices on open borders or attribute seams are kept in place to preserve the mesh's silhouette and UVs
+        /// @param indices The triangle indices
+        /// @param positions The vertex positions
+        /// @param targetIndexCount The number of indices to simplify down to
+        /// @param maxError The maximum error of a collapse, relative to the size of the referenced vertices' bounds
+        /// @param outIndices Will be filled with the simplified indices
+        /// @return The largest error of the collapses that were made, relative to the size of the referenced vertices' bounds
+        static float Simplify(Span<const uint32> indices, Span<const Vector3> positions, uint64 targetIndexCount, float maxError, ArrayContainer<uint32>& outIndices);
+
+        /// @brief Generates a chain of levels of detail for a mesh, replacing any it already has.
+        /// Each LOD is simplified from the full detail mesh, and its triangles are optimized for the vertex cache
+        /// @param mesh The mesh
+        /// @param settings The LOD settings
+        /// @return The number of LODs that were generated
+        static uint32 GenerateLODs(Mesh& mesh, const MeshLODSettings& settings = MeshLODSettings());
+    };
+} // Coco
+
+#endif //COCOENGINE_MESHSIMPLIFIER_H
\ No newline at end of file
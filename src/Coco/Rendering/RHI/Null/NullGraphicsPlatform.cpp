@@ -0,0 +1,231 @@
+//
+// Created by cullen on 10/18/26.
+//
+
+#include "NullGraphicsPlatform.h"
+
+#include "Coco/Core/Engine.h"
+#include "Coco/Rendering/Graphics/Slang/SlangCompiler.h"
+#include "Coco/Rendering/Graphics/GraphicsResourceCache.h"
+#include "Resources/NullBuffer.h"
+#include "Resources/NullGraphicsSurface.h"
+#include "Resources/NullImage.h"
+#include "Resources/NullImageSampler.h"
+#include "Resources/NullRenderContext.h"
+#include "Resources/NullShaderProgram.h"
+#include "Resources/NullTransientMemory.h"
+#include "NullRenderFrame.h"
+#include "NullUploadScheduler.h"
+
+namespace Coco
+{
+    NullGraphicsPlatform::PersistentUniformBlock::PersistentUniformBlock(uint64 instanceID, uint64 version, UniquePtr<NullShaderBufferInterface>&& interface) :
+        InstanceID(instanceID),
+        Version(version),
+        Interface(std::move(interface))
+    {}
+
+    NullGraphicsPlatform::NullGraphicsPlatform(RenderService* renderService, const GraphicsDeviceCreateParams& createParams) :
+        GraphicsPlatform(renderService),
+        _resourceManager(),
+        _meshStorage(),
+        _shaderProgramCompiler(),
+        _graphicsResourceCache(),
+        _uploadScheduler(),
+        _renderFrames(nullptr, 2),
+        _currentRenderFrameIndex(0),
+        _currentFrameNumber(0),
+        _stats(),
+        _lastFrameStats(),
+        _persistentUniformBlocks()
+    {
+        CreateDeviceDescription();
+
+        // Shaders are compiled for the same target as the Vulkan backend so their uniform layouts match
+        _shaderProgramCompiler = CreateDefaultUnique<SlangCompiler>(SLANG_SPIRV, "spirv_1_5");
+        _resourceManager = CreateDefaultUnique<GraphicsResourceManager>();
+        _meshStorage = CreateDefaultUnique<MeshStorage>(this, 2);
+        _graphicsResourceCache = CreateDefaultUnique<GraphicsResourceCache>(this);
+        _uploadScheduler = CreateDefaultUnique<NullUploadScheduler>(this, createParams.UploadFrameBudget);
+
+        for (uint8 i = 0; i < 2; ++i)
+            _renderFrames.EmplaceBack(CreateDefaultManagedRef<NullRenderFrame>(this));
+
+        _renderFrames.Front()->NewFrame();
+
+        COCO_ENGINE_LOG_INFO("Using the null graphics platform. Nothing will be rendered");
+        COCO_ENGINE_LOG_VERBOSE("Created NullGraphicsPlatform");
+    }
+
+    NullGraphicsPlatform::~NullGraphicsPlatform()
+    {
+        _uploadScheduler.reset();
+        _persistentUniformBlocks.Clear();
+        _renderFrames.Clear(true);
+        _graphicsResourceCache.reset();
+        _meshStorage.reset();
+        _resourceManager.reset();
+        _shaderProgramCompiler.reset();
+
+        COCO_ENGINE_LOG_VERBOSE("Destroyed NullGraphicsPlatform");
+    }
+
+    Ref<RenderFrame> NullGraphicsPlatform::GetCurrentRenderFrame()
+    {
+        return Ref<NullRenderFrame>(_renderFrames[_currentRenderFrameIndex]);
+    }
+
+    void NullGraphicsPlatform::NextFrame()
+    {
+        _renderFrames[_currentRenderFrameIndex]->EndFrame();
+
+        _lastFrameStats = _stats;
+        _stats.Reset();
+
+        _currentRenderFrameIndex = (_currentRenderFrameIndex + 1) % _renderFrames.GetCount();
+        ++_currentFrameNumber;
+
+        _renderFrames[_currentRenderFrameIndex]->NewFrame();
+        _meshStorage->SetCurrentDynamicMeshBuffer(_currentRenderFrameIndex);
+        _meshStorage->UpdateStaticMeshArenas();
+        _graphicsResourceCache->PurgeUnused();
+        _uploadScheduler->Process();
+    }
+
+    Ref<RenderContext> NullGraphicsPlatform::CreateRenderContext()
+    {
+        return _resourceManager->Create<NullRenderContext>(this);
+    }
+
+    Ref<Image> NullGraphicsPlatform::CreateImage(const ImageDescription& imageDescription)
+    {
+        return _resourceManager->Create<NullImage>(this, imageDescription);
+    }
+
+    Ref<Image> NullGraphicsPlatform::CreateAliasedImage(const ImageDescription& imageDescription, Ref<TransientMemory> memory)
+    {
+        COCO_ASSERT(memory.IsValid(), "Transient memory was invalid");
+        COCO_ASSERT(memory->GetRequirements().CanHold(GetImageMemoryRequirements(imageDescription)), "Transient memory is too small for the image");
+
+        return _resourceManager->Create<NullImage>(this, imageDescription);
+    }
+
+    Ref<TransientMemory> NullGraphicsPlatform::CreateTransientMemory(const GraphicsMemoryRequirements& requirements)
+    {
+        return _resourceManager->Create<NullTransientMemory>(requirements);
+    }
+
+    GraphicsMemoryRequirements NullGraphicsPlatform::GetImageMemoryRequirements(const ImageDescription& imageDescription)
+    {
+        uint64 size = 0;
+
+        // Sum the size of every mip level, as a device would need to store them all
+        for (uint8 mip = 0; mip < Math::Max<uint8>(imageDescription.MipCount, 1); mip++)
+        {
+            size += ImageDescription::GetDataSize(imageDescription.PixelFormat,
+                ImageDescription::GetMipSize(imageDescription.Width, mip),
+                ImageDescription::GetMipSize(imageDescription.Height, mip),
+                imageDescription.Depth);
+        }
+
+        size *= Math::Max<uint32>(imageDescription.Layers, 1);
+
+        return GraphicsMemoryRequirements(Math::AlignedAddress(size, _imageMemoryAlignment), _imageMemoryAlignment, ~0u);
+    }
+
+    Ref<ImageSampler> NullGraphicsPlatform::CreateImageSampler(const ImageSamplerDescription& samplerDescription)
+    {
+        return _resourceManager->Create<NullImageSampler>(samplerDescription);
+    }
+
+    Ref<ShaderProgram> NullGraphicsPlatform::CreateShaderProgram(const FilePath& shaderPath)
+    {
+        return _resourceManager->Create<NullShaderProgram>(this, shaderPath);
+    }
+
+    Ref<Buffer> NullGraphicsPlatform::CreateBuffer(const BufferDescription& bufferDescription)
+    {
+        return _resourceManager->Create<NullBuffer>(this, bufferDescription);
+    }
+
+    StagingBuffer* NullGraphicsPlatform::GetStagingBuffer()
+    {
+        return &_renderFrames[_currentRenderFrameIndex]->GetStagingBuffer();
+    }
+
+    UploadScheduler* NullGraphicsPlatform::GetUploadScheduler()
+    {
+        return _uploadScheduler.get();
+    }
+
+    void NullGraphicsPlatform::InvalidateResource(uint64 resourceID)
+    {
+        _resourceManager->Invalidate(resourceID);
+    }
+
+    void NullGraphicsPlatform::ReleasePersistentUniforms(uint64 instanceID)
+    {
+        Array<uint64> blockIDs;
+
+        for (const auto& block : _persistentUniformBlocks)
+        {
+            if (block.second.InstanceID == instanceID)
+                blockIDs.Append(block.first);
+        }
+
+        for (const uint64 blockID : blockIDs)
+            _persistentUniformBlocks.Remove(blockID);
+    }
+
+    NullShaderBufferInterface* NullGraphicsPlatform::GetOrUpdatePersistentShaderBufferInterface(const char* blockName, uint64 instanceID, uint64 version,
+        NullShaderProgram& shaderProgram, bool& outNeedsWrite)
+    {
+        outNeedsWrite = false;
+
+        const uint64 blockID = Math::CombineHashes(shaderProgram.GetID(), instanceID, ToHash(blockName));
+        if (PersistentUniformBlock* existing = _persistentUniformBlocks.TryGetValue(blockID))
+        {
+            if (existing->Version == version)
+                return existing->Interface.get();
+
+            _persistentUniformBlocks.Remove(blockID);
+        }
+
+        const int64 blockIndex = shaderProgram.GetParamBlockIndex(blockName);
+        if (blockIndex == -1)
+        {
+            COCO_ENGINE_LOG_ERROR("Invalid uniform block \"%s\"", blockName);
+            return nullptr;
+        }
+
+        PersistentUniformBlock& block = _persistentUniformBlocks.Emplace(blockID, instanceID, version,
+            CreateDefaultUnique<NullShaderBufferInterface>(this, shaderProgram.GetParamBlockLayout(blockIndex)));
+
+        outNeedsWrite = true;
+        return block.Interface.get();
+    }
+
+    Ref<GraphicsSurface> NullGraphicsPlatform::CreateSurface(const Sizei& framebufferSize)
+    {
+        return _resourceManager->Create<NullGraphicsSurface>(this, framebufferSize);
+    }
+
+    void NullGraphicsPlatform::CreateDeviceDescription()
+    {
+        // Limits are typical of a desktop GPU so the renderer takes the same paths it would on a real device
+        _deviceDescription.Type = GraphicsDeviceType::Other;
+        _deviceDescription.Name = "Null Device";
+        _deviceDescription.DriverVersion = Version{1, 0, 0};
+        _deviceDescription.MaximumMSAASamples = MSAASamples::Eight;
+        _deviceDescription.MaxImageWidth = 16384;
+        _deviceDescription.MaxImageHeight = 16384;
+        _deviceDescription.MaxImageDepth = 2048;
+        _deviceDescription.MinimumBufferAlignment = 256;
+        _deviceDescription.MaxAnisotropicLevel = 16;
+        _deviceDescription.SupportsWireframe = true;
+        _deviceDescription.SupportsBindlessTextures = false;
+        _deviceDescription.SupportsIndirectDrawCount = true;
+        _deviceDescription.SupportsBCCompression = true;
+        _deviceDescription.MaxPushConstantSize = 256;
+    }
+} // Coco
\ No newline at end of file
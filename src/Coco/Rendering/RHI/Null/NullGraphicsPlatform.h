@@ -0,0 +1,106 @@
+//
+// Created by cullen on 10/18/26.
+//
+
+#ifndef COCOENGINE_NULLGRAPHICSPLATFORM_H
+#define COCOENGINE_NULLGRAPHICSPLATFORM_H
+
+#include "Coco/Core/Memory/Ptrs.h"
+#include "Coco/Core/Types/Map.h"
+#include "Coco/Rendering/Graphics/GraphicsPlatform.h"
+#include "Coco/Rendering/Graphics/GraphicsResourceManager.h"
+#include "Coco/Rendering/Graphics/GraphicsPlatformTypes.h"
+#include "NullGraphicsPlatformTypes.h"
+#include "NullShaderBufferInterface.h"
+
+namespace Coco
+{
+    class NullRenderFrame;
+    class NullShaderProgram;
+    class NullUploadScheduler;
+
+    /// @brief A graphics platform that does no GPU work. Every call is validated and counted as a GPU backend would record it,
+    /// so the CPU cost of the renderer can be measured without a graphics device
+    class NullGraphicsPlatform : public GraphicsPlatform
+    {
+    public:
+        static constexpr const char* Name = "Null";
+
+    public:
+        NullGraphicsPlatform(RenderService* renderService, const GraphicsDeviceCreateParams& createParams);
+        ~NullGraphicsPlatform();
+
+        const char* GetName() const override { return Name; }
+        Ref<RenderFrame> GetCurrentRenderFrame() override;
+        uint64 GetCurrentFrameNumber() const override { return _currentFrameNumber; }
+        void NextFrame() override;
+        Ref<RenderContext> CreateRenderContext() override;
+        Ref<Image> CreateImage(const ImageDescription& imageDescription) override;
+        Ref<Image> CreateAliasedImage(const ImageDescription& imageDescription, Ref<TransientMemory> memory) override;
+        Ref<TransientMemory> CreateTransientMemory(const GraphicsMemoryRequirements& requirements) override;
+        GraphicsMemoryRequirements GetImageMemoryRequirements(const ImageDescription& imageDescription) override;
+        Ref<ImageSampler> CreateImageSampler(const ImageSamplerDescription& samplerDescription) override;
+        Ref<ShaderProgram> CreateShaderProgram(const FilePath& shaderPath) override;
+        Ref<Buffer> CreateBuffer(const BufferDescription& bufferDescription) override;
+        MeshStorage* GetMeshStorage() override { return _meshStorage.get(); }
+        StagingBuffer* GetStagingBuffer() override;
+        UploadScheduler* GetUploadScheduler() override;
+        SlangCompiler* GetShaderProgramCompiler() override { return _shaderProgramCompiler.get(); }
+        GraphicsResourceCache* GetResourceCache() override { return _graphicsResourceCache.get(); }
+        void InvalidateResource(uint64 resourceID) override;
+        void ReleasePersistentUniforms(uint64 instanceID) override;
+
+        /// @brief Creates a surface that renders to an image instead of a window
+        /// @param framebufferSize The size of the surface
+        /// @return The surface
+        Ref<GraphicsSurface> CreateSurface(const Sizei& framebufferSize);
+
+        /// @brief Gets the work that has been counted so far in the current frame
+        /// @return The stats of the current frame
+        NullGraphicsStats& GetStats() { return _stats; }
+
+        /// @brief Gets the work that was counted in the previous frame
+        /// @return The stats of the previous frame
+        const NullGraphicsStats& GetLastFrameStats() const { return _lastFrameStats; }
+
+        /// @brief Gets an instance's uniform block that persists across frames, recreating it if the instance's version changed
+        /// @param blockName The name of the block
+        /// @param instanceID The ID of the instance
+        /// @param version The version of the instance's data
+        /// @param shaderProgram The shader program the block is for
+        /// @param outNeedsWrite Will be set to true if the block was created and its data needs to be written
+        /// @return The block's interface, or nullptr if the shader has no block with the given name
+        NullShaderBufferInterface* GetOrUpdatePersistentShaderBufferInterface(const char* blockName, uint64 instanceID, uint64 version,
+            NullShaderProgram& shaderProgram, bool& outNeedsWrite);
+
+    private:
+        /// @brief A uniform block that persists across frames
+        struct PersistentUniformBlock
+        {
+            uint64 InstanceID;
+            uint64 Version;
+            UniquePtr<NullShaderBufferInterface> Interface;
+
+            PersistentUniformBlock(uint64 instanceID, uint64 version, UniquePtr<NullShaderBufferInterface>&& interface);
+        };
+
+        static constexpr uint64 _imageMemoryAlignment = 256;
+
+        UniquePtr<GraphicsResourceManager> _resourceManager;
+        UniquePtr<MeshStorage> _meshStorage;
+        UniquePtr<SlangCompiler> _shaderProgramCompiler;
+        UniquePtr<GraphicsResourceCache> _graphicsResourceCache;
+        UniquePtr<NullUploadScheduler> _uploadScheduler;
+        Array<ManagedRef<NullRenderFrame>> _renderFrames;
+        uint8 _currentRenderFrameIndex;
+        uint64 _currentFrameNumber;
+        NullGraphicsStats _stats;
+        NullGraphicsStats _lastFrameStats;
+        Map<uint64, PersistentUniformBlock> _persistentUniformBlocks;
+
+    private:
+        void CreateDeviceDescription();
+    };
+} // Coco
+
+#endif //COCOENGINE_NULLGRAPHICSPLATFORM_H
\ No newline at end of file
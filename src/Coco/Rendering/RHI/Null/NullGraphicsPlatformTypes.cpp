@@ -0,0 +1,36 @@
+//
+// Created by cullen on 10/18/26.
+//
+
+#include "NullGraphicsPlatformTypes.h"
+
+namespace Coco
+{
+    NullGraphicsStats::NullGraphicsStats() :
+        GraphsExecuted(0),
+        PassesBegun(0),
+        ParallelStreams(0),
+        DrawCalls(0),
+        IndirectBatchesCulled(0),
+        IndirectObjectsCulled(0),
+        IndirectDrawCalls(0),
+        ShaderChanges(0),
+        DynamicStateChanges(0),
+        PipelineBinds(0),
+        VertexBufferBinds(0),
+        IndexBufferBinds(0),
+        UniformBlockBinds(0),
+        UniformBlocksCreated(0),
+        TextureBinds(0),
+        DrawDataUpdates(0),
+        UniformBytesWritten(0),
+        BytesUploaded(0),
+        BytesCopiedOnDevice(0),
+        ImagesReadBack(0)
+    {}
+
+    void NullGraphicsStats::Reset()
+    {
+        *this = NullGraphicsStats();
+    }
+} // Coco
\ No newline at end of file
@@ -0,0 +1,80 @@
+//
+// Created by cullen on 10/18/26.
+//
+
+#ifndef COCOENGINE_NULLGRAPHICSPLATFORMTYPES_H
+#define COCOENGINE_NULLGRAPHICSPLATFORMTYPES_H
+#include <Coco/Core/Types/CoreTypes.h>
+
+namespace Coco
+{
+    /// @brief Counts the work a NullGraphicsPlatform was given in a frame, as it would have been recorded by a GPU backend
+    struct NullGraphicsStats
+    {
+        /// @brief The number of render graphs that were executed
+        uint64 GraphsExecuted;
+
+        /// @brief The number of render passes that were begun
+        uint64 PassesBegun;
+
+        /// @brief The number of streams that passes were recorded through in parallel
+        uint64 ParallelStreams;
+
+        /// @brief The number of draw calls
+        uint64 DrawCalls;
+
+        /// @brief The number of batches that were culled on the GPU for indirect drawing
+        uint64 IndirectBatchesCulled;
+
+        /// @brief The number of objects that were uploaded for GPU culling
+        uint64 IndirectObjectsCulled;
+
+        /// @brief The number of indirect draw calls, one per group of objects that share vertex and index buffers
+        uint64 IndirectDrawCalls;
+
+        /// @brief The number of times a different shader or pipeline state was set
+        uint64 ShaderChanges;
+
+        /// @brief The number of times the viewport or scissor was set
+        uint64 DynamicStateChanges;
+
+        /// @brief The number of pipelines bound for a new shader, pipeline state, or vertex format
+        uint64 PipelineBinds;
+
+        /// @brief The number of times the vertex buffer or its offset changed between draws
+        uint64 VertexBufferBinds;
+
+        /// @brief The number of times the index buffer or its offset changed between draws
+        uint64 IndexBufferBinds;
+
+        /// @brief The number of uniform blocks that were bound, including ones created this frame
+        uint64 UniformBlockBinds;
+
+        /// @brief The number of uniform blocks that were created and needed their data written
+        uint64 UniformBlocksCreated;
+
+        /// @brief The number of textures that were bound through uniform blocks or draw data
+        uint64 TextureBinds;
+
+        /// @brief The number of times draw data was set
+        uint64 DrawDataUpdates;
+
+        /// @brief The bytes of uniform and draw data that were written
+        uint64 UniformBytesWritten;
+
+        /// @brief The bytes that would have been copied to GPU resources from staging memory or the upload scheduler
+        uint64 BytesUploaded;
+
+        /// @brief The bytes that would have been copied between regions of GPU buffers
+        uint64 BytesCopiedOnDevice;
+
+        /// @brief The number of images that were read back
+        uint64 ImagesReadBack;
+
+        NullGraphicsStats();
+
+        /// @brief Sets all counts to zero
+        void Reset();
+    };
+}
+#endif //COCOENGINE_NULLGRAPHICSPLATFORMTYPES_H
\ No newline at end of file
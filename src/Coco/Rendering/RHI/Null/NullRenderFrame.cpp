@@ -0,0 +1,232 @@
+//
+// Created by cullen on 10/18/26.
+//
+
+#include "NullRenderFrame.h"
+
+#include "NullGraphicsPlatform.h"
+#include "Coco/Core/Engine.h"
+#include "Coco/Rendering/RenderGraph/RenderGraph.h"
+#include "Coco/Rendering/RenderScene.h"
+#include "Coco/Rendering/RenderService.h"
+#include "Coco/Rendering/Graphics/GraphicsResourceCache.h"
+#include "Resources/NullGraphicsSurface.h"
+#include "Resources/NullImage.h"
+#include "Resources/NullRenderContext.h"
+#include "Resources/NullShaderProgram.h"
+
+namespace Coco
+{
+    NullRenderFrame::NullRenderFrame(NullGraphicsPlatform* platform) :
+        RenderFrame(platform->GetMeshStorage(), platform->GetRenderService()->GetWorkerPool()),
+        _platform(platform),
+        _renderContexts(nullptr, 2),
+        _nextRenderContextIndex(0),
+        _transientResources(),
+        _shaderBufferInterfaces(),
+        _stagingBuffer(platform),
+        _indirectBatches(),
+        _readbacks()
+    {}
+
+    NullRenderFrame::~NullRenderFrame()
+    {
+        _shaderBufferInterfaces.Clear();
+
+        for (auto& renderContext : _renderContexts)
+            _platform->InvalidateResource(renderContext->GetID());
+
+        _renderContexts.Clear(true);
+
+        for (auto& renderContext : _streamRenderContexts)
+            _platform->InvalidateResource(renderContext->GetID());
+
+        _streamRenderContexts.Clear();
+    }
+
+    void NullRenderFrame::NewFrame()
+    {
+        CompleteReadbacks();
+
+        RenderFrame::NewFrame();
+        _nextRenderContextIndex = 0;
+        _shaderBufferInterfaces.Clear();
+        _indirectBatches.Clear();
+
+        auto resourceCache = _platform->GetResourceCache();
+        for (const auto& id : _transientResources)
+            resourceCache->ReleaseResource(id);
+
+        _transientResources.Clear();
+
+        _stagingBuffer.NewFrame();
+    }
+
+    void NullRenderFrame::Render(RenderGraph&& graph, RenderScene&& scene, Ref<GraphicsSurface> surface)
+    {
+        Ref<NullGraphicsSurface> nullSurface = surface.Downcast<NullGraphicsSurface>();
+        COCO_ASSERT(nullSurface, "Surface was null");
+
+        Execute(graph, scene, nullSurface->GetImage());
+    }
+
+    void NullRenderFrame::Render(RenderGraph&& graph, RenderScene&& scene, Ref<Image> targetImage)
+    {
+        Execute(graph, scene, targetImage);
+    }
+
+    SharedPtr<ImageReadback> NullRenderFrame::ReadbackImage(Ref<Image> image)
+    {
+        COCO_ASSERT(image, "Image was null");
+
+        const ImageDescription& description = image->GetDescription();
+        COCO_ASSERT((description.UsageFlags & ImageUsageFlags::TransferSource) == ImageUsageFlags::TransferSource, "Image is not a transfer source");
+        COCO_ASSERT((description.UsageFlags & ImageUsageFlags::Presented) == ImageUsageFlags::None, "Presented images can't be read back");
+        COCO_ASSERT(description.AttachmentType == ImageAttachmentType::Color, "Only color images can be read back");
+
+        SharedPtr<ImageReadback> readback = CreateDefaultShared<ImageReadback>(description, _platform->GetCurrentFrameNumber());
+        _readbacks.Append(readback);
+
+        NullGraphicsStats& stats = _platform->GetStats();
+        stats.ImagesReadBack++;
+
+        return readback;
+    }
+
+    Matrix4x4 NullRenderFrame::CreateOrthographicProjection(float left, float right, float bottom, float top,
+                                                            float nearClip, float farClip) const
+    {
+        Matrix4x4 ortho;
+
+        float w = 2.0f / (right - left);
+        float h = 2.0f / (top - bottom);
+        float a = 1.0f / (nearClip - farClip);
+
+        // Matches the Vulkan backend so culling and sorting see the same clip space: right = X, up = -Y, forward = Z
+        ortho.M11() = w;
+        ortho.M22() = -h;
+        ortho.M33() = a;
+
+        ortho.M14() = -(right + left) / (right - left);
+        ortho.M24() = (top + bottom) / (top - bottom);
+        ortho.M34() = nearClip * a;
+
+        ortho.M44() = 1.0f;
+
+        return ortho;
+    }
+
+    Matrix4x4 NullRenderFrame::CreatePerspectiveProjection(float verticalFOV, float aspectRatio, float nearClip,
+        float farClip) const
+    {
+        Matrix4x4 perspective;
+
+        float h = 1.0f / std::tan(verticalFOV * 0.5f);
+        float w = h / aspectRatio;
+        float a = -farClip / (farClip - nearClip);
+        float b = nearClip * a;
+
+        // Matches the Vulkan backend so culling and sorting see the same clip space: right = X, up = -Y, forward = Z
+        perspective.M11() = w;
+        perspective.M22() = -h;
+        perspective.M33() = a;
+        perspective.M44() = 0.0f;
+
+        perspective.M34() = b;
+        perspective.M43() = -1.0f;
+
+        return perspective;
+    }
+
+    void NullRenderFrame::EndFrame()
+    {
+        for (const auto& renderContext : _renderContexts)
+            COCO_ASSERT(!renderContext->IsRendering(), "Render context %u did not finish rendering", renderContext->GetID());
+    }
+
+    NullShaderBufferInterface* NullRenderFrame::GetOrCreateShaderBufferInterface(const char* blockName, uint64 instanceID,
+        NullShaderProgram& shaderProgram, bool& outCreated)
+    {
+        outCreated = false;
+
+        const uint64 interfaceID = Math::CombineHashes(shaderProgram.GetID(), instanceID, ToHash(blockName));
+        if (auto existing = _shaderBufferInterfaces.TryGetValue(interfaceID))
+            return existing->get();
+
+        const int64 blockIndex = shaderProgram.GetParamBlockIndex(blockName);
+        if (blockIndex == -1)
+        {
+            COCO_ENGINE_LOG_ERROR("Invalid uniform block \"%s\"", blockName);
+            return nullptr;
+        }
+
+        UniquePtr<NullShaderBufferInterface>& interface = _shaderBufferInterfaces.Emplace(interfaceID,
+            CreateDefaultUnique<NullShaderBufferInterface>(_platform, shaderProgram.GetParamBlockLayout(blockIndex)));
+
+        outCreated = true;
+        return interface.get();
+    }
+
+    Ref<NullRenderContext> NullRenderFrame::GetStreamRenderContext(uint32 streamIndex)
+    {
+        while (streamIndex >= _streamRenderContexts.GetCount())
+            _streamRenderContexts.EmplaceBack(_platform->CreateRenderContext().Downcast<NullRenderContext>());
+
+        return _streamRenderContexts[streamIndex];
+    }
+
+    void NullRenderFrame::AddIndirectBatch(uint64 batchID, Array<uint64>&& groupMeshIDs)
+    {
+        _indirectBatches.Remove(batchID);
+        _indirectBatches.Emplace(batchID, std::move(groupMeshIDs));
+    }
+
+    const Array<uint64>* NullRenderFrame::GetIndirectBatch(uint64 batchID) const
+    {
+        return _indirectBatches.TryGetValue(batchID);
+    }
+
+    Ref<NullRenderContext> NullRenderFrame::GetNextRenderContext()
+    {
+        if (_nextRenderContextIndex >= _renderContexts.GetCount())
+            _renderContexts.EmplaceBack(_platform->CreateRenderContext().Downcast<NullRenderContext>());
+
+        COCO_ASSERT(_nextRenderContextIndex < _renderContexts.GetCount(), "Not enough render contexts");
+        return _renderContexts[_nextRenderContextIndex++];
+    }
+
+    void NullRenderFrame::Execute(RenderGraph& graph, RenderScene& scene, Ref<Image> targetImage)
+    {
+        COCO_ASSERT(targetImage, "Image was null");
+        COCO_ASSERT((targetImage->GetDescription().UsageFlags & ImageUsageFlags::RenderTarget) == ImageUsageFlags::RenderTarget,
+            "Image %u can't be rendered to", targetImage->GetID());
+
+        graph.LinkAttachment(0, targetImage);
+
+        Ref<NullRenderContext> renderContext = GetNextRenderContext();
+        renderContext->Begin(*this, graph, scene);
+
+        graph.Execute(scene, *renderContext);
+
+        renderContext->End();
+        _transientResources.AppendRange(graph.GetTransientResources());
+
+        NullGraphicsStats& stats = _platform->GetStats();
+        stats.GraphsExecuted++;
+    }
+
+    void NullRenderFrame::CompleteReadbacks()
+    {
+        if (_readbacks.IsEmpty())
+            return;
+
+        Array<uint8> pixels;
+        for (const auto& readback : _readbacks)
+        {
+            pixels.Resize(readback->GetPixelDataSize(), 0);
+            readback->Complete(pixels);
+        }
+
+        _readbacks.Clear();
+    }
+} // Coco
\ No newline at end of file
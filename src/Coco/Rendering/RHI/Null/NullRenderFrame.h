@@ -0,0 +1,83 @@
+//
+// Created by cullen on 10/18/26.
+//
+
+#ifndef COCOENGINE_NULLRENDERFRAME_H
+#define COCOENGINE_NULLRENDERFRAME_H
+
+#include "NullStagingBuffer.h"
+#include "NullShaderBufferInterface.h"
+#include "Coco/Core/Types/Map.h"
+#include "Coco/Rendering/Graphics/RenderFrame.h"
+#include "Coco/Rendering/Graphics/Resources/RenderContext.h"
+
+namespace Coco
+{
+    class NullRenderContext;
+    class NullGraphicsPlatform;
+    class NullShaderProgram;
+
+    class NullRenderFrame : public RenderFrame
+    {
+    public:
+        NullRenderFrame(NullGraphicsPlatform* platform);
+        ~NullRenderFrame();
+
+        void NewFrame() override;
+        void Render(RenderGraph&& graph, RenderScene&& scene, Ref<GraphicsSurface> surface) override;
+        void Render(RenderGraph&& graph, RenderScene&& scene, Ref<Image> targetImage) override;
+        SharedPtr<ImageReadback> ReadbackImage(Ref<Image> image) override;
+        Matrix4x4 CreateOrthographicProjection(float left, float right, float bottom, float top, float nearClip, float farClip) const override;
+        Matrix4x4 CreatePerspectiveProjection(float verticalFOV, float aspectRatio, float nearClip, float farClip) const override;
+
+        /// @brief Ends the frame. Validates that every context finished recording
+        void EndFrame();
+        NullStagingBuffer& GetStagingBuffer() { return _stagingBuffer; }
+
+        /// @brief Gets a uniform block's interface, creating it if it doesn't exist this frame
+        /// @param blockName The name of the uniform block
+        /// @param instanceID The ID of the instance, or 0 for a global block
+        /// @param shaderProgram The shader program the block belongs to
+        /// @param outCreated Will be set to true if the interface was created and needs its data written
+        /// @return The interface, or nullptr if the shader program has no such block
+        NullShaderBufferInterface* GetOrCreateShaderBufferInterface(const char* blockName, uint64 instanceID, NullShaderProgram& shaderProgram, bool& outCreated);
+
+        /// @brief Gets the render context used to record a parallel recording stream
+        /// @param streamIndex The index of the stream
+        /// @return The render context
+        Ref<NullRenderContext> GetStreamRenderContext(uint32 streamIndex);
+
+        /// @brief Records a batch culled with RenderContext::CullIndirect(), replacing a batch with the same ID that was culled earlier this frame
+        /// @param batchID The ID of the batch
+        /// @param groupMeshIDs A mesh from each group of objects that share vertex and index buffers, which are each drawn with one indirect draw
+        void AddIndirectBatch(uint64 batchID, Array<uint64>&& groupMeshIDs);
+
+        /// @brief Gets a batch that was culled this frame
+        /// @param batchID The ID of the batch
+        /// @return A mesh from each of the batch's groups, or nullptr if the batch wasn't culled this frame
+        const Array<uint64>* GetIndirectBatch(uint64 batchID) const;
+
+    private:
+        NullGraphicsPlatform* _platform;
+
+        StackArray<Ref<NullRenderContext>, RenderContext::MaxParallelStreams> _streamRenderContexts;
+        Array<Ref<NullRenderContext>> _renderContexts;
+        uint64 _nextRenderContextIndex;
+
+        Array<uint64> _transientResources;
+        Map<uint64, UniquePtr<NullShaderBufferInterface>> _shaderBufferInterfaces;
+        NullStagingBuffer _stagingBuffer;
+        Map<uint64, Array<uint64>> _indirectBatches;
+        Array<SharedPtr<ImageReadback>> _readbacks;
+
+    private:
+        Ref<NullRenderContext> GetNextRenderContext();
+        void Execute(RenderGraph& graph, RenderScene& scene, Ref<Image> targetImage);
+
+        /// @brief Completes the readbacks that were requested the last time this frame was rendered.
+        /// Nothing is rendered, so the readbacks hold zeroed pixels
+        void CompleteReadbacks();
+    };
+} // Coco
+
+#endif //COCOENGINE_NULLRENDERFRAME_H
\ No newline at end of file
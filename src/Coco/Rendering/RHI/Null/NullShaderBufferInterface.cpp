@@ -0,0 +1,47 @@
+//
+// Created by cullen on 10/18/26.
+//
+
+#include "NullShaderBufferInterface.h"
+
+#include "NullGraphicsPlatform.h"
+#include "Coco/Core/Engine.h"
+#include "Coco/Rendering/Graphics/ShaderCursor.h"
+#include "Coco/Rendering/Graphics/ShaderLayout.h"
+
+namespace Coco
+{
+    NullShaderBufferInterface::NullShaderBufferInterface(NullGraphicsPlatform* platform, const ShaderTypeLayout* blockTypeLayout) :
+        ShaderBufferInterface(blockTypeLayout),
+        _platform(platform),
+        _data(blockTypeLayout->Size, 0)
+    {}
+
+    void NullShaderBufferInterface::Write(const ShaderElementLocation& location, const void* data, uint64 dataSize)
+    {
+        COCO_ASSERT(location.ByteOffset + dataSize <= _data.GetCount(), "Write must fit within the uniform block");
+        memcpy(_data.Data() + location.ByteOffset, data, dataSize);
+
+        NullGraphicsStats& stats = _platform->GetStats();
+        stats.UniformBytesWritten += dataSize;
+    }
+
+    void NullShaderBufferInterface::Write(const ShaderElementLocation& location, Texture* texture)
+    {
+        NullGraphicsStats& stats = _platform->GetStats();
+        stats.TextureBinds++;
+    }
+
+    void NullShaderBufferInterface::WriteTextureIndex(const ShaderElementLocation& location, Texture* texture)
+    {
+        // There is no bindless texture table, so every texture is at the first index
+        const uint32 textureIndex = 0;
+        Write(location, &textureIndex, sizeof(uint32));
+
+        NullGraphicsStats& stats = _platform->GetStats();
+        stats.TextureBinds++;
+    }
+
+    void NullShaderBufferInterface::Flush()
+    {}
+} // Coco
\ No newline at end of file
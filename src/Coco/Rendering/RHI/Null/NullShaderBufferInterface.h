@@ -0,0 +1,31 @@
+//
+// Created by cullen on 10/18/26.
+//
+
+#ifndef COCOENGINE_NULLSHADERBUFFERINTERFACE_H
+#define COCOENGINE_NULLSHADERBUFFERINTERFACE_H
+#include "Coco/Rendering/Graphics/ShaderBufferInterface.h"
+#include "Coco/Core/Types/Array.h"
+
+namespace Coco
+{
+    class NullGraphicsPlatform;
+
+    /// @brief Writes a uniform block's data to system memory, as a GPU backend would write it to a mapped uniform buffer
+    class NullShaderBufferInterface : public ShaderBufferInterface
+    {
+    public:
+        NullShaderBufferInterface(NullGraphicsPlatform* platform, const ShaderTypeLayout* blockTypeLayout);
+
+        void Write(const ShaderElementLocation& location, const void* data, uint64 dataSize) override;
+        void Write(const ShaderElementLocation& location, Texture* texture) override;
+        void WriteTextureIndex(const ShaderElementLocation& location, Texture* texture) override;
+        void Flush() override;
+
+    private:
+        NullGraphicsPlatform* _platform;
+        Array<uint8> _data;
+    };
+} // Coco
+
+#endif //COCOENGINE_NULLSHADERBUFFERINTERFACE_H
\ No newline at end of file
@@ -0,0 +1,37 @@
+//
+// Created by cullen on 10/18/26.
+//
+
+#include "NullStagingBuffer.h"
+
+#include "NullGraphicsPlatform.h"
+
+namespace Coco
+{
+    NullStagingBuffer::NullStagingBuffer(NullGraphicsPlatform* platform) :
+        _buffers(platform, BufferDescription(_pageSize, BufferUsageFlags::HostVisible | BufferUsageFlags::TransferSource), platform->GetDeviceDescription().MinimumBufferAlignment),
+        _stagingOperations()
+    {}
+
+    NullStagingBuffer::~NullStagingBuffer()
+    {
+        _stagingOperations.Clear(true);
+        _buffers.Clear();
+    }
+
+    StagingOperation* NullStagingBuffer::CreateStagingOperation(uint64 size)
+    {
+        StagingOperation& operation = _stagingOperations.EmplaceBack(size);
+        Ref<NullBuffer> buffer;
+        _buffers.Allocate(size, buffer, operation.BufferOffset);
+        operation.StagingBuffer = buffer;
+        operation.BufferPtr = static_cast<uint8*>(buffer->GetMappedPtr()) + operation.BufferOffset;
+        return &operation;
+    }
+
+    void NullStagingBuffer::NewFrame()
+    {
+        _stagingOperations.Clear();
+        _buffers.Clear();
+    }
+} // Coco
\ No newline at end of file
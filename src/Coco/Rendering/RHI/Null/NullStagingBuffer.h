@@ -0,0 +1,35 @@
+//
+// Created by cullen on 10/18/26.
+//
+
+#ifndef COCOENGINE_NULLSTAGINGBUFFER_H
+#define COCOENGINE_NULLSTAGINGBUFFER_H
+
+#include "Coco/Rendering/Graphics/StagingBuffer.h"
+#include "Coco/Rendering/Graphics/PagedLinearBuffer.h"
+#include "Resources/NullBuffer.h"
+
+namespace Coco
+{
+    class NullGraphicsPlatform;
+
+    /// @brief Hands out staging memory from host buffers. Copies out of staging memory are counted by the resources they are copied to
+    class NullStagingBuffer : public StagingBuffer
+    {
+    public:
+        NullStagingBuffer(NullGraphicsPlatform* platform);
+        ~NullStagingBuffer();
+
+        StagingOperation* CreateStagingOperation(uint64 size) override;
+
+        void NewFrame();
+
+    private:
+        static constexpr uint64 _pageSize = 1024 * 1024 * 10;
+
+        PagedLinearBuffer<NullBuffer> _buffers;
+        Array<StagingOperation> _stagingOperations;
+    };
+} // Coco
+
+#endif //COCOENGINE_NULLSTAGINGBUFFER_H
\ No newline at end of file
@@ -0,0 +1,146 @@
+//
+// Created by cullen on 10/18/26.
+//
+
+#include "NullUploadScheduler.h"
+
+#include "NullGraphicsPlatform.h"
+#include "Coco/Core/Engine.h"
+
+namespace Coco
+{
+    NullQueuedUpload::NullQueuedUpload(uint64 id, Array<uint8>&& data, UploadCompletedCallback onCompleted) :
+        ID(id),
+        TargetBuffer(),
+        TargetOffset(0),
+        TargetImage(),
+        Data(std::move(data)),
+        BytesCopied(0),
+        OnCompleted(std::move(onCompleted))
+    {}
+
+    NullUploadScheduler::NullUploadScheduler(NullGraphicsPlatform* platform, uint64 frameBudget) :
+        _platform(platform),
+        _pendingUploads(),
+        _nextUploadID(InvalidUploadID + 1),
+        _frameBudget(frameBudget),
+        _queuedBytes(0)
+    {}
+
+    NullUploadScheduler::~NullUploadScheduler()
+    {
+        for (auto& queue : _queuedUploads)
+            queue.Clear(true);
+
+        _pendingUploads.Clear();
+    }
+
+    uint64 NullUploadScheduler::QueueBufferUpload(Ref<Buffer> buffer, uint64 offset, Array<uint8>&& data, UploadPriority priority,
+        UploadCompletedCallback onCompleted)
+    {
+        COCO_ASSERT(buffer.IsValid(), "Buffer was invalid");
+        COCO_ASSERT(offset + data.GetCount() <= buffer->GetSize(), "Upload must fit within the buffer");
+
+        NullQueuedUpload upload(_nextUploadID, std::move(data), std::move(onCompleted));
+        upload.TargetBuffer = buffer.Downcast<NullBuffer>();
+        upload.TargetOffset = offset;
+
+        return AddQueuedUpload(priority, std::move(upload));
+    }
+
+    uint64 NullUploadScheduler::QueueImageUpload(Ref<Image> image, Array<uint8>&& pixelData, UploadPriority priority,
+        UploadCompletedCallback onCompleted)
+    {
+        COCO_ASSERT(image.IsValid(), "Image was invalid");
+        COCO_ASSERT(pixelData.GetCount() >= image->GetPixelDataSize(), "Pixel data must cover the whole image");
+        COCO_ASSERT((image->GetDescription().UsageFlags & ImageUsageFlags::TransferDestination) == ImageUsageFlags::TransferDestination,
+            "Image %u is not a transfer destination", image->GetID());
+
+        const ImageDescription& description = image->GetDescription();
+        const uint64 mipChainSize = image->GetMipChainDataSize();
+        const bool uploadsMips = description.MipCount > 1 && pixelData.GetCount() >= mipChainSize;
+
+        // Matches the Vulkan RHI, which generates mip maps with blits that compressed formats don't support
+        if (description.MipCount > 1 && !uploadsMips && ImageDescription::IsCompressed(description.PixelFormat))
+        {
+            COCO_ENGINE_LOG_ERROR("Compressed image %u must be uploaded with all of its mip levels", image->GetID());
+            return InvalidUploadID;
+        }
+
+        pixelData.Resize(uploadsMips ? mipChainSize : image->GetPixelDataSize());
+
+        NullQueuedUpload upload(_nextUploadID, std::move(pixelData), std::move(onCompleted));
+        upload.TargetImage = image.Downcast<NullImage>();
+
+        return AddQueuedUpload(priority, std::move(upload));
+    }
+
+    bool NullUploadScheduler::IsUploadComplete(uint64 uploadID) const
+    {
+        return !_pendingUploads.Contains(uploadID);
+    }
+
+    void NullUploadScheduler::Process()
+    {
+        if (_queuedBytes == 0)
+            return;
+
+        NullGraphicsStats& stats = _platform->GetStats();
+        Array<UploadCompletedCallback> completedCallbacks;
+        uint64 remainingBudget = _frameBudget;
+
+        for (uint64 p = _priorityCount; p > 0 && remainingBudget > 0; p--)
+        {
+            Array<NullQueuedUpload>& queue = _queuedUploads[p - 1];
+
+            while (!queue.IsEmpty() && remainingBudget > 0)
+            {
+                NullQueuedUpload& upload = queue.Front();
+                const uint64 chunkSize = Math::Min(upload.Data.GetCount() - upload.BytesCopied, remainingBudget);
+
+                // Host visible buffers keep their data, so copy into them as the GPU would
+                if (upload.TargetBuffer.IsValid() && upload.TargetBuffer->IsHostVisible())
+                {
+                    uint8* dst = static_cast<uint8*>(upload.TargetBuffer->GetMappedPtr()) + upload.TargetOffset + upload.BytesCopied;
+                    memcpy(dst, upload.Data.Data() + upload.BytesCopied, chunkSize);
+                }
+
+                upload.BytesCopied += chunkSize;
+                remainingBudget -= chunkSize;
+                _queuedBytes -= chunkSize;
+                stats.BytesUploaded += chunkSize;
+
+                if (upload.BytesCopied < upload.Data.GetCount())
+                    break;
+
+                if (upload.OnCompleted)
+                    completedCallbacks.Append(std::move(upload.OnCompleted));
+
+                _pendingUploads.Remove(upload.ID);
+                queue.RemoveAt(0);
+            }
+        }
+
+        // Called last as callbacks are free to queue more uploads
+        for (const auto& callback : completedCallbacks)
+            callback();
+    }
+
+    uint64 NullUploadScheduler::AddQueuedUpload(UploadPriority priority, NullQueuedUpload&& upload)
+    {
+        if (upload.Data.IsEmpty())
+        {
+            if (upload.OnCompleted)
+                upload.OnCompleted();
+
+            return InvalidUploadID;
+        }
+
+        const uint64 id = _nextUploadID++;
+        _queuedBytes += upload.Data.GetCount();
+        _pendingUploads.Emplace(id, priority);
+        _queuedUploads[static_cast<uint8>(priority)].EmplaceBack(std::move(upload));
+
+        return id;
+    }
+} // Coco
\ No newline at end of file
@@ -0,0 +1,69 @@
+//
+// Created by cullen on 10/18/26.
+//
+
+#ifndef COCOENGINE_NULLUPLOADSCHEDULER_H
+#define COCOENGINE_NULLUPLOADSCHEDULER_H
+#include "Coco/Core/Types/Array.h"
+#include "Coco/Core/Types/Map.h"
+#include "Coco/Rendering/Graphics/UploadScheduler.h"
+#include "Resources/NullBuffer.h"
+#include "Resources/NullImage.h"
+
+namespace Coco
+{
+    class NullGraphicsPlatform;
+
+    /// @brief An upload that is waiting for transfer bandwidth
+    struct NullQueuedUpload
+    {
+        uint64 ID;
+        Ref<NullBuffer> TargetBuffer;
+        uint64 TargetOffset;
+        Ref<NullImage> TargetImage;
+        Array<uint8> Data;
+
+        /// @brief The number of bytes of Data that have already been copied
+        uint64 BytesCopied;
+        UploadCompletedCallback OnCompleted;
+
+        NullQueuedUpload(uint64 id, Array<uint8>&& data, UploadCompletedCallback onCompleted);
+    };
+
+    /// @brief Spends the same per-frame byte budget as a GPU upload scheduler, but completes each upload as soon as its last byte is copied
+    class NullUploadScheduler : public UploadScheduler
+    {
+    public:
+        NullUploadScheduler(NullGraphicsPlatform* platform, uint64 frameBudget);
+        ~NullUploadScheduler();
+
+        NullUploadScheduler(const NullUploadScheduler&) = delete;
+        NullUploadScheduler& operator=(const NullUploadScheduler&) = delete;
+
+        uint64 QueueBufferUpload(Ref<Buffer> buffer, uint64 offset, Array<uint8>&& data, UploadPriority priority, UploadCompletedCallback onCompleted) override;
+        uint64 QueueImageUpload(Ref<Image> image, Array<uint8>&& pixelData, UploadPriority priority, UploadCompletedCallback onCompleted) override;
+        bool IsUploadComplete(uint64 uploadID) const override;
+        void SetFrameBudget(uint64 budget) override { _frameBudget = budget; }
+        uint64 GetFrameBudget() const override { return _frameBudget; }
+        uint64 GetQueuedBytes() const override { return _queuedBytes; }
+
+        /// @brief Copies queued uploads, highest priority first, until the frame budget is spent, and calls the callbacks of completed uploads.
+        /// Should be called once per frame
+        void Process();
+
+    private:
+        static constexpr uint64 _priorityCount = 3;
+
+        NullGraphicsPlatform* _platform;
+        Array<NullQueuedUpload> _queuedUploads[_priorityCount];
+        Map<uint64, UploadPriority> _pendingUploads;
+        uint64 _nextUploadID;
+        uint64 _frameBudget;
+        uint64 _queuedBytes;
+
+    private:
+        uint64 AddQueuedUpload(UploadPriority priority, NullQueuedUpload&& upload);
+    };
+} // Coco
+
+#endif //COCOENGINE_NULLUPLOADSCHEDULER_H
\ No newline at end of file
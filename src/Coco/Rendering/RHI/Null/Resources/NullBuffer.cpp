@@ -0,0 +1,99 @@
+//
+// Created by cullen on 10/18/26.
+//
+
+#include "NullBuffer.h"
+
+#include "../NullGraphicsPlatform.h"
+#include "Coco/Core/Engine.h"
+
+namespace Coco
+{
+    NullBuffer::NullBuffer(uint64 id, NullGraphicsPlatform* platform, const BufferDescription& description) :
+        Buffer(id),
+        _platform(platform),
+        _description(description),
+        _hostData()
+    {
+        if (IsHostVisible())
+            _hostData.Resize(_description.Size, 0);
+
+        COCO_ENGINE_LOG_VERBOSE("Created NullBuffer %u with size %u", id, description.Size);
+    }
+
+    NullBuffer::~NullBuffer()
+    {
+        _hostData.Clear(true);
+
+        COCO_ENGINE_LOG_VERBOSE("Destroyed NullBuffer %u", GetID());
+    }
+
+    void NullBuffer::SetData(uint64 offset, Span<const uint8> data)
+    {
+        COCO_ASSERT(offset + data.size() <= _description.Size, "Data must fit within the buffer");
+
+        if (IsHostVisible())
+            memcpy(_hostData.Data() + offset, data.data(), data.size());
+
+        NullGraphicsStats& stats = _platform->GetStats();
+        stats.BytesUploaded += data.size();
+    }
+
+    void* NullBuffer::GetMappedPtr()
+    {
+        return IsHostVisible() ? _hostData.Data() : nullptr;
+    }
+
+    void NullBuffer::Resize(uint64 newSize)
+    {
+        _description.Size = newSize;
+
+        if (IsHostVisible())
+            _hostData.Resize(newSize, 0);
+    }
+
+    void NullBuffer::CopyFrom(StagingOperation& stagingOperation)
+    {
+        BufferCopyRegion region(0, 0, stagingOperation.Size);
+        CopyFrom(stagingOperation, Span<const BufferCopyRegion>(&region, 1));
+    }
+
+    void NullBuffer::CopyFrom(StagingOperation& stagingOperation, Span<const BufferCopyRegion> regions)
+    {
+        NullGraphicsStats& stats = _platform->GetStats();
+
+        for (const BufferCopyRegion& region : regions)
+        {
+            COCO_ASSERT(region.SourceOffset + region.Size <= stagingOperation.Size, "Copy region must fit within the staging operation");
+            COCO_ASSERT(region.DestinationOffset + region.Size <= _description.Size, "Copy region must fit within the buffer");
+
+            if (IsHostVisible())
+                memcpy(_hostData.Data() + region.DestinationOffset, stagingOperation.BufferPtr + region.SourceOffset, region.Size);
+
+            stats.BytesUploaded += region.Size;
+        }
+    }
+
+    void NullBuffer::CopyWithin(Span<const BufferCopyRegion> regions)
+    {
+        NullGraphicsStats& stats = _platform->GetStats();
+
+        for (const BufferCopyRegion& region : regions)
+        {
+            COCO_ASSERT(region.SourceOffset + region.Size <= _description.Size, "Source region must fit within the buffer");
+            COCO_ASSERT(region.DestinationOffset + region.Size <= _description.Size, "Destination region must fit within the buffer");
+            COCO_ASSERT(region.SourceOffset + region.Size <= region.DestinationOffset || region.DestinationOffset + region.Size <= region.SourceOffset,
+                "Source and destination regions must not overlap");
+
+            if (IsHostVisible())
+                memcpy(_hostData.Data() + region.DestinationOffset, _hostData.Data() + region.SourceOffset, region.Size);
+
+            stats.BytesCopiedOnDevice += region.Size;
+        }
+    }
+
+    bool NullBuffer::IsHostVisible() const
+    {
+        return (_description.UsageFlags & (BufferUsageFlags::HostVisible | BufferUsageFlags::HostReadable)) != BufferUsageFlags::None;
+    }
+} // Coco
\ No newline at end of file
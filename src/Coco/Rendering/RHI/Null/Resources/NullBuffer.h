@@ -0,0 +1,41 @@
+//
+// Created by cullen on 10/18/26.
+//
+
+#ifndef COCOENGINE_NULLBUFFER_H
+#define COCOENGINE_NULLBUFFER_H
+#include "Coco/Rendering/Graphics/Resources/Buffer.h"
+#include "Coco/Rendering/Graphics/Resources/BufferTypes.h"
+#include "Coco/Core/Types/Array.h"
+
+namespace Coco
+{
+    class NullGraphicsPlatform;
+
+    /// @brief A buffer with no device memory. Host visible buffers are backed by system memory so they can still be written through their mapped pointer
+    class NullBuffer : public Buffer
+    {
+    public:
+        NullBuffer(uint64 id, NullGraphicsPlatform* platform, const BufferDescription& description);
+        ~NullBuffer();
+
+        uint64 GetSize() const override { return _description.Size; }
+        void SetData(uint64 offset, Span<const uint8> data) override;
+        void* GetMappedPtr() override;
+        void Resize(uint64 newSize) override;
+        void CopyFrom(StagingOperation& stagingOperation) override;
+        void CopyFrom(StagingOperation& stagingOperation, Span<const BufferCopyRegion> regions) override;
+        void CopyWithin(Span<const BufferCopyRegion> regions) override;
+
+        /// @brief Gets if this buffer is backed by system memory
+        /// @return True if the buffer can be mapped
+        bool IsHostVisible() const;
+
+    private:
+        NullGraphicsPlatform* _platform;
+        BufferDescription _description;
+        Array<uint8> _hostData;
+    };
+} // Coco
+
+#endif //COCOENGINE_NULLBUFFER_H
\ No newline at end of file
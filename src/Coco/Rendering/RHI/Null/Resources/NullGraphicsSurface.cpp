@@ -0,0 +1,46 @@
+//
+// Created by cullen on 10/18/26.
+//
+
+#include "NullGraphicsSurface.h"
+
+#include "../NullGraphicsPlatform.h"
+#include "Coco/Core/Engine.h"
+
+namespace Coco
+{
+    NullGraphicsSurface::NullGraphicsSurface(uint64 id, NullGraphicsPlatform* platform, const Sizei& framebufferSize) :
+        GraphicsSurface(id),
+        _platform(platform),
+        _framebufferSize(),
+        _vsyncMode(VSyncMode::EveryVBlank),
+        _image()
+    {
+        SetFramebufferSize(framebufferSize);
+
+        COCO_ENGINE_LOG_VERBOSE("Created NullGraphicsSurface %u", id);
+    }
+
+    NullGraphicsSurface::~NullGraphicsSurface()
+    {
+        COCO_ENGINE_LOG_VERBOSE("Destroyed NullGraphicsSurface %u", GetID());
+    }
+
+    void NullGraphicsSurface::SetFramebufferSize(const Sizei& framebufferSize)
+    {
+        if (_image.Get() && framebufferSize == _framebufferSize)
+            return;
+
+        _framebufferSize = framebufferSize;
+
+        // Matches the format and usage of a Vulkan swapchain image
+        ImageDescription imageDescription = ImageDescription::Create2D(
+            static_cast<uint32>(_framebufferSize.Width), static_cast<uint32>(_framebufferSize.Height),
+            ImagePixelFormat::BGRA8, ImageColorSpace::sRGB,
+            ImageUsageFlags::RenderTarget | ImageUsageFlags::Presented | ImageUsageFlags::TransferDestination | ImageUsageFlags::TransferSource,
+            false);
+
+        uint64 imageID = Math::CombineHashes(_platform->GetCurrentFrameNumber(), GetID());
+        _image = CreateDefaultManagedRef<NullImage>(imageID, _platform, imageDescription);
+    }
+} // Coco
\ No newline at end of file
@@ -0,0 +1,39 @@
+//
+// Created by cullen on 10/18/26.
+//
+
+#ifndef COCOENGINE_NULLGRAPHICSSURFACE_H
+#define COCOENGINE_NULLGRAPHICSSURFACE_H
+#include "Coco/Rendering/Graphics/Resources/GraphicsSurface.h"
+#include "NullImage.h"
+#include "Coco/Core/Memory/Refs.h"
+
+namespace Coco
+{
+    class NullGraphicsPlatform;
+
+    /// @brief A surface that isn't attached to a window. It renders to a single image that is never presented
+    class NullGraphicsSurface : public GraphicsSurface
+    {
+    public:
+        NullGraphicsSurface(uint64 id, NullGraphicsPlatform* platform, const Sizei& framebufferSize);
+        ~NullGraphicsSurface();
+
+        void SetFramebufferSize(const Sizei& framebufferSize) override;
+        Sizei GetFramebufferSize() const override { return _framebufferSize; }
+        void SetVSyncMode(VSyncMode mode) override { _vsyncMode = mode; }
+        VSyncMode GetVSyncMode() const override { return _vsyncMode; }
+
+        /// @brief Gets the image that this surface is rendered to
+        /// @return The image
+        Ref<NullImage> GetImage() { return _image; }
+
+    private:
+        NullGraphicsPlatform* _platform;
+        Sizei _framebufferSize;
+        VSyncMode _vsyncMode;
+        ManagedRef<NullImage> _image;
+    };
+} // Coco
+
+#endif //COCOENGINE_NULLGRAPHICSSURFACE_H
\ No newline at end of file
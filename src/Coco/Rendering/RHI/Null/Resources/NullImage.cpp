@@ -0,0 +1,50 @@
+//
+// Created by cullen on 10/18/26.
+//
+
+#include "NullImage.h"
+
+#include "../NullGraphicsPlatform.h"
+#include "Coco/Core/Engine.h"
+
+namespace Coco
+{
+    NullImage::NullImage(uint64 id, NullGraphicsPlatform* platform, const ImageDescription& description) :
+        Image(id, description),
+        _platform(platform)
+    {
+        const GraphicsDeviceDescription& deviceDescription = _platform->GetDeviceDescription();
+        COCO_ASSERT(description.Width <= deviceDescription.MaxImageWidth &&
+            description.Height <= deviceDescription.MaxImageHeight &&
+            description.Depth <= deviceDescription.MaxImageDepth, "Image is larger than the device supports");
+
+        COCO_ENGINE_LOG_VERBOSE("Created NullImage %u", id);
+    }
+
+    NullImage::~NullImage()
+    {
+        COCO_ENGINE_LOG_VERBOSE("Destroyed NullImage %u", GetID());
+    }
+
+    void NullImage::SetPixels(const void* pixelData, uint64 pixelDataSize)
+    {
+        COCO_ASSERT(pixelData, "Pixel data was null");
+        COCO_ASSERT((_description.UsageFlags & ImageUsageFlags::TransferDestination) == ImageUsageFlags::TransferDestination,
+            "Image %u is not a transfer destination", GetID());
+
+        NullGraphicsStats& stats = _platform->GetStats();
+        stats.BytesUploaded += Math::Min(GetMipChainDataSize(), pixelDataSize);
+    }
+
+    void NullImage::SetPixelRegion(uint32 x, uint32 y, uint32 width, uint32 height, const void* pixelData, uint64 pixelDataSize)
+    {
+        COCO_ASSERT(pixelData, "Pixel data was null");
+        COCO_ASSERT((_description.UsageFlags & ImageUsageFlags::TransferDestination) == ImageUsageFlags::TransferDestination,
+            "Image %u is not a transfer destination", GetID());
+        COCO_ASSERT(!ImageDescription::IsCompressed(_description.PixelFormat), "Regions of compressed images can't be set");
+        COCO_ASSERT(x + width <= _description.Width && y + height <= _description.Height, "Region was outside of image %u", GetID());
+
+        NullGraphicsStats& stats = _platform->GetStats();
+        stats.BytesUploaded += Math::Min(ImageDescription::GetDataSize(_description.PixelFormat, width, height), pixelDataSize);
+    }
+} // Coco
\ No newline at end of file
@@ -0,0 +1,28 @@
+//
+// Created by cullen on 10/18/26.
+//
+
+#ifndef COCOENGINE_NULLIMAGE_H
+#define COCOENGINE_NULLIMAGE_H
+#include "Coco/Rendering/Graphics/Resources/Image.h"
+
+namespace Coco
+{
+    class NullGraphicsPlatform;
+
+    /// @brief An image with no device memory. Pixel data written to it is counted and discarded
+    class NullImage : public Image
+    {
+    public:
+        NullImage(uint64 id, NullGraphicsPlatform* platform, const ImageDescription& description);
+        ~NullImage();
+
+        void SetPixels(const void* pixelData, uint64 pixelDataSize) override;
+        void SetPixelRegion(uint32 x, uint32 y, uint32 width, uint32 height, const void* pixelData, uint64 pixelDataSize) override;
+
+    private:
+        NullGraphicsPlatform* _platform;
+    };
+} // Coco
+
+#endif //COCOENGINE_NULLIMAGE_H
\ No newline at end of file
@@ -0,0 +1,13 @@
+//
+// Created by cullen on 10/18/26.
+//
+
+#include "NullImageSampler.h"
+
+namespace Coco
+{
+    NullImageSampler::NullImageSampler(uint64 id, const ImageSamplerDescription& samplerDescription) :
+        ImageSampler(id),
+        _description(samplerDescription)
+    {}
+} // Coco
\ No newline at end of file
@@ -0,0 +1,24 @@
+//
+// Created by cullen on 10/18/26.
+//
+
+#ifndef COCOENGINE_NULLIMAGESAMPLER_H
+#define COCOENGINE_NULLIMAGESAMPLER_H
+#include "Coco/Rendering/Graphics/Resources/ImageSampler.h"
+#include "Coco/Rendering/Graphics/Resources/ImageSamplerTypes.h"
+
+namespace Coco
+{
+    class NullImageSampler : public ImageSampler
+    {
+    public:
+        NullImageSampler(uint64 id, const ImageSamplerDescription& samplerDescription);
+
+        const ImageSamplerDescription& GetDescription() const { return _description; }
+
+    private:
+        ImageSamplerDescription _description;
+    };
+} // Coco
+
+#endif //COCOENGINE_NULLIMAGESAMPLER_H
\ No newline at end of file
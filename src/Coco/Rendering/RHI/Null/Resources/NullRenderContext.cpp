@@ -0,0 +1,396 @@
+//
+// Created by cullen on 10/18/26.
+//
+
+#include "NullRenderContext.h"
+
+#include "Coco/Core/Engine.h"
+#include "Coco/Core/Types/StackArray.h"
+#include "Coco/Rendering/RenderGraph/RenderGraph.h"
+#include "Coco/Rendering/RenderScene.h"
+#include "Coco/Rendering/Shader.h"
+#include "Coco/Rendering/Graphics/ShaderCursor.h"
+#include "../NullRenderFrame.h"
+#include "../NullGraphicsPlatform.h"
+#include "NullShaderProgram.h"
+
+namespace Coco
+{
+    NullBoundShaderInfo::NullBoundShaderInfo(Ref<NullShaderProgram> shaderProgram, const GraphicsPipelineState& pipelineState) :
+        BoundShader(std::move(shaderProgram)),
+        BoundPipelineState(pipelineState),
+        IsPipelineBound(false),
+        BoundVertexFormat(),
+        BoundVertexBufferID(0),
+        BoundVertexBufferOffset(0),
+        BoundIndexBufferID(0),
+        BoundIndexBufferOffset(0)
+    {}
+
+    NullRenderOperation::NullRenderOperation(NullRenderFrame& frame, RenderGraph& graph, RenderScene& scene, bool isStream) :
+        Frame(&frame),
+        Graph(&graph),
+        Scene(&scene),
+        IsStream(isStream),
+        IsInPass(isStream),
+        IsRecordingPassInParallel(false)
+    {}
+
+    NullRenderContext::NullRenderContext(uint64 id, NullGraphicsPlatform* platform) :
+        RenderContext(id),
+        _platform(platform)
+    {
+        COCO_ENGINE_LOG_VERBOSE("Created NullRenderContext %u", id);
+    }
+
+    NullRenderContext::~NullRenderContext()
+    {
+        COCO_ENGINE_LOG_VERBOSE("Destroyed NullRenderContext %u", GetID());
+    }
+
+    Sizei NullRenderContext::GetFramebufferSize() const
+    {
+        if (_currentRenderOperation)
+            return _currentRenderOperation->Graph->GetAttachmentSize();
+
+        COCO_ASSERT(false, "Context wasn't rendering");
+        return Sizei();
+    }
+
+    void NullRenderContext::BeginPass(uint64 passIndex, Span<const RenderPassAttachmentInfo> passAttachments, bool recordInParallel)
+    {
+        COCO_ASSERT(_currentRenderOperation, "Context was not rendering");
+        COCO_ASSERT(!_currentRenderOperation->IsStream, "Passes cannot be started from a parallel stream");
+        COCO_ASSERT(!_currentRenderOperation->IsInPass, "The previous pass was not ended");
+        COCO_ASSERT(passAttachments.size() <= 16, "Up to 16 attachments are supported per pass");
+
+        const Sizei framebufferSize = GetFramebufferSize();
+        uint64 depthStencilAttachmentCount = 0;
+
+        for (const auto& attachmentInfo : passAttachments)
+        {
+            COCO_ASSERT(attachmentInfo.AttachmentImage, "Pass %u has an attachment with no image", passIndex);
+
+            const ImageDescription& imageDesc = attachmentInfo.AttachmentImage->GetDescription();
+            COCO_ASSERT((imageDesc.UsageFlags & ImageUsageFlags::RenderTarget) == ImageUsageFlags::RenderTarget,
+                "Image %u is not a render target", attachmentInfo.AttachmentImage->GetID());
+            COCO_ASSERT(imageDesc.Width >= static_cast<uint32>(framebufferSize.Width) && imageDesc.Height >= static_cast<uint32>(framebufferSize.Height),
+                "Image %u is smaller than the framebuffer", attachmentInfo.AttachmentImage->GetID());
+
+            if (attachmentInfo.Type != ImageAttachmentType::Color)
+                depthStencilAttachmentCount++;
+        }
+
+        COCO_ASSERT(depthStencilAttachmentCount <= 1, "Pass %u has more than one depth/stencil attachment", passIndex);
+
+        _currentRenderOperation->IsInPass = true;
+        _currentRenderOperation->IsRecordingPassInParallel = recordInParallel;
+
+        NullGraphicsStats& stats = _platform->GetStats();
+        stats.PassesBegun++;
+    }
+
+    void NullRenderContext::EndPass()
+    {
+        COCO_ASSERT(_currentRenderOperation, "Context was not rendering");
+        COCO_ASSERT(_currentRenderOperation->IsInPass && !_currentRenderOperation->IsStream, "No pass was started");
+
+        _currentRenderOperation->IsInPass = false;
+        _currentRenderOperation->IsRecordingPassInParallel = false;
+    }
+
+    void NullRenderContext::SetViewport(const Recti& viewportRect)
+    {
+        COCO_ASSERT(_currentRenderOperation, "Context was not rendering");
+        COCO_ASSERT(!_currentRenderOperation->IsRecordingPassInParallel, "Commands for this pass must be recorded through RecordParallel()");
+        COCO_ASSERT(viewportRect.Size.Width > 0 && viewportRect.Size.Height > 0, "Viewport must have a positive size");
+
+        NullGraphicsStats& stats = _platform->GetStats();
+        stats.DynamicStateChanges++;
+    }
+
+    void NullRenderContext::SetScissor(const Recti& scissorRect)
+    {
+        COCO_ASSERT(_currentRenderOperation, "Context was not rendering");
+        COCO_ASSERT(!_currentRenderOperation->IsRecordingPassInParallel, "Commands for this pass must be recorded through RecordParallel()");
+        COCO_ASSERT(scissorRect.Offset.X() >= 0 && scissorRect.Offset.Y() >= 0, "Scissor offset must not be negative");
+
+        NullGraphicsStats& stats = _platform->GetStats();
+        stats.DynamicStateChanges++;
+    }
+
+    void NullRenderContext::SetShader(Shader& shader, const GraphicsPipelineState& pipelineState)
+    {
+        COCO_ASSERT(_currentRenderOperation, "Context was not rendering");
+        COCO_ASSERT(!_currentRenderOperation->IsRecordingPassInParallel, "Commands for this pass must be recorded through RecordParallel()");
+
+        Ref<NullShaderProgram> shaderProgram = shader.GetProgram().Downcast<NullShaderProgram>();
+        COCO_ASSERT(shaderProgram, "Shader has no program");
+
+        if (_currentRenderOperation->BoundShaderInfo &&
+            _currentRenderOperation->BoundShaderInfo->BoundShader.Get() == shaderProgram.Get() &&
+            _currentRenderOperation->BoundShaderInfo->BoundPipelineState == pipelineState)
+            return;
+
+        _currentRenderOperation->BoundShaderInfo.emplace(shaderProgram, pipelineState);
+
+        NullGraphicsStats& stats = _platform->GetStats();
+        stats.ShaderChanges++;
+    }
+
+    bool NullRenderContext::CreateAndBindGlobalBuffer(const char* name, ShaderCursor& outCursor)
+    {
+        return BindOrCreateUniformBlock(name, 0, &outCursor);
+    }
+
+    void NullRenderContext::BindGlobalBuffer(const char* name)
+    {
+        BindOrCreateUniformBlock(name, 0, nullptr);
+    }
+
+    bool NullRenderContext::CreateAndBindInstanceBuffer(uint64 instanceID, const char* name, ShaderCursor& outCursor)
+    {
+        return BindOrCreateUniformBlock(name, instanceID, &outCursor);
+    }
+
+    void NullRenderContext::BindInstanceBuffer(uint64 instanceID, const char* name)
+    {
+        BindOrCreateUniformBlock(name, instanceID, nullptr);
+    }
+
+    bool NullRenderContext::BindPersistentInstanceBuffer(uint64 instanceID, uint64 version, const char* name, ShaderCursor& outCursor)
+    {
+        COCO_ASSERT(_currentRenderOperation, "Context wasn't rendering");
+        COCO_ASSERT(_currentRenderOperation->BoundShaderInfo, "No shader has been bound");
+
+        bool needsWrite = false;
+        NullShaderBufferInterface* interface = _platform->GetOrUpdatePersistentShaderBufferInterface(name, instanceID, version,
+            *_currentRenderOperation->BoundShaderInfo->BoundShader, needsWrite);
+
+        if (!interface)
+            return false;
+
+        NullGraphicsStats& stats = _platform->GetStats();
+        stats.UniformBlockBinds++;
+
+        if (!needsWrite)
+            return false;
+
+        stats.UniformBlocksCreated++;
+        outCursor.BindToInterface(*interface);
+
+        return true;
+    }
+
+    void NullRenderContext::SetDrawData(const void* data, uint64 dataSize, Span<const SharedPtr<Texture>> textures)
+    {
+        COCO_ASSERT(_currentRenderOperation, "Context wasn't rendering");
+        COCO_ASSERT(_currentRenderOperation->BoundShaderInfo, "No shader has been bound");
+        COCO_ASSERT(dataSize == 0 || data, "Draw data was null");
+        COCO_ASSERT(dataSize <= _platform->GetDeviceDescription().MaxPushConstantSize, "Draw data must fit in %u bytes", _platform->GetDeviceDescription().MaxPushConstantSize);
+
+        NullGraphicsStats& stats = _platform->GetStats();
+        stats.DrawDataUpdates++;
+        stats.UniformBytesWritten += dataSize;
+        stats.TextureBinds += textures.size();
+    }
+
+    void NullRenderContext::DrawObject(const RenderObject& obj)
+    {
+        COCO_ASSERT(_currentRenderOperation, "Context wasn't rendering");
+        COCO_ASSERT(_currentRenderOperation->IsInPass, "Objects can only be drawn in a pass");
+        COCO_ASSERT(!_currentRenderOperation->IsRecordingPassInParallel, "Commands for this pass must be recorded through RecordParallel()");
+        COCO_ASSERT(_currentRenderOperation->BoundShaderInfo, "No shader has been bound");
+
+        const MeshEntry* meshEntry = _platform->GetMeshStorage()->GetMesh(obj.MeshID);
+        COCO_ASSERT(meshEntry, "Mesh %u has no data", obj.MeshID);
+        COCO_ASSERT(obj.DrawSubmesh.IndexOffset + obj.DrawSubmesh.IndexCount <= meshEntry->IndexCount, "Submesh indices are out of the mesh's range");
+
+        BindMesh(*meshEntry);
+
+        NullGraphicsStats& stats = _platform->GetStats();
+        stats.DrawCalls++;
+        _currentRenderOperation->Frame->AddDrawCall(obj.DrawSubmesh.IndexCount / 3, obj.DrawSubmesh.IndexCount);
+    }
+
+    bool NullRenderContext::CanDrawIndirect(const RenderObject& obj) const
+    {
+        if (!_platform->GetDeviceDescription().SupportsIndirectDrawCount)
+            return false;
+
+        const MeshEntry* meshEntry = _platform->GetMeshStorage()->GetMesh(obj.MeshID);
+        return meshEntry && meshEntry->ArenaIndex.has_value();
+    }
+
+    void NullRenderContext::CullIndirect(uint64 batchID, const ViewFrustum& frustum, Span<const IndirectDrawObject> objects, Span<const uint8> instanceData, uint64 instanceDataStride)
+    {
+        COCO_ASSERT(_currentRenderOperation, "Context wasn't rendering");
+        COCO_ASSERT(!_currentRenderOperation->IsInPass, "Objects must be culled outside of a pass");
+        COCO_ASSERT(instanceData.size() == objects.size() * instanceDataStride, "Instance data size must match the object count and stride");
+
+        // Objects are drawn in one group per arena, as the Vulkan backend does
+        Array<uint64> groupArenas;
+        Array<uint64> groupMeshIDs;
+
+        for (const IndirectDrawObject& obj : objects)
+        {
+            COCO_ASSERT(CanDrawIndirect(*obj.Object), "Object cannot be drawn indirectly");
+
+            const uint64 arenaIndex = _platform->GetMeshStorage()->GetMesh(obj.Object->MeshID)->ArenaIndex.value();
+            if (groupArenas.Contains(arenaIndex))
+                continue;
+
+            groupArenas.Append(arenaIndex);
+            groupMeshIDs.Append(obj.Object->MeshID);
+        }
+
+        _currentRenderOperation->Frame->AddIndirectBatch(batchID, std::move(groupMeshIDs));
+
+        NullGraphicsStats& stats = _platform->GetStats();
+        stats.IndirectBatchesCulled++;
+        stats.IndirectObjectsCulled += objects.size();
+        stats.BytesUploaded += instanceData.size();
+    }
+
+    void NullRenderContext::DrawIndirect(uint64 batchID)
+    {
+        COCO_ASSERT(_currentRenderOperation, "Context wasn't rendering");
+        COCO_ASSERT(_currentRenderOperation->IsInPass, "Objects can only be drawn in a pass");
+        COCO_ASSERT(!_currentRenderOperation->IsRecordingPassInParallel, "Commands for this pass must be recorded through RecordParallel()");
+        COCO_ASSERT(_currentRenderOperation->BoundShaderInfo, "No shader has been bound");
+
+        const Array<uint64>* groupMeshIDs = _currentRenderOperation->Frame->GetIndirectBatch(batchID);
+        if (!groupMeshIDs)
+        {
+            COCO_ENGINE_LOG_ERROR("Indirect batch %u was not culled this frame", batchID);
+            return;
+        }
+
+        NullGraphicsStats& stats = _platform->GetStats();
+
+        // The number of visible objects is only known by the GPU
+        for (const uint64 meshID : *groupMeshIDs)
+        {
+            BindMesh(*_platform->GetMeshStorage()->GetMesh(meshID));
+
+            stats.IndirectDrawCalls++;
+            _currentRenderOperation->Frame->AddDrawCall(0, 0);
+        }
+    }
+
+    void NullRenderContext::RecordParallel(uint32 streamCount, const ParallelRecordFunction& recordFunction)
+    {
+        COCO_ASSERT(_currentRenderOperation, "Context was not rendering");
+        COCO_ASSERT(_currentRenderOperation->IsRecordingPassInParallel, "The current pass was not set up for parallel recording");
+        COCO_ASSERT(streamCount > 0 && streamCount <= MaxParallelStreams, "Stream count must be between 1 and %u", MaxParallelStreams);
+
+        NullRenderFrame& frame = *_currentRenderOperation->Frame;
+        StackArray<Ref<NullRenderContext>, MaxParallelStreams> streamContexts;
+
+        for (uint32 i = 0; i < streamCount; i++)
+        {
+            Ref<NullRenderContext> streamContext = frame.GetStreamRenderContext(i);
+            streamContext->BeginStream(frame, *_currentRenderOperation->Graph, *_currentRenderOperation->Scene);
+            streamContexts.Append(streamContext);
+        }
+
+        // Nothing is recorded on the GPU, so streams run in order on this thread. This keeps the null backend's statistics deterministic
+        for (uint32 i = 0; i < streamCount; i++)
+        {
+            recordFunction(*streamContexts[i], i);
+            streamContexts[i]->EndStream();
+        }
+
+        NullGraphicsStats& stats = _platform->GetStats();
+        stats.ParallelStreams += streamCount;
+    }
+
+    void NullRenderContext::Begin(NullRenderFrame& frame, RenderGraph& graph, RenderScene& scene)
+    {
+        COCO_ASSERT(!_currentRenderOperation, "Context was already rendering");
+
+        _currentRenderOperation.emplace(frame, graph, scene, false);
+    }
+
+    void NullRenderContext::BeginStream(NullRenderFrame& frame, RenderGraph& graph, RenderScene& scene)
+    {
+        COCO_ASSERT(!_currentRenderOperation, "Context was already rendering");
+
+        _currentRenderOperation.emplace(frame, graph, scene, true);
+    }
+
+    void NullRenderContext::EndStream()
+    {
+        COCO_ASSERT(_currentRenderOperation && _currentRenderOperation->IsStream, "Context was not recording a stream");
+
+        _currentRenderOperation.reset();
+    }
+
+    void NullRenderContext::End()
+    {
+        COCO_ASSERT(_currentRenderOperation && !_currentRenderOperation->IsStream, "Context was not rendering");
+        COCO_ASSERT(!_currentRenderOperation->IsInPass, "The last pass was not ended");
+
+        _currentRenderOperation.reset();
+    }
+
+    void NullRenderContext::BindMesh(const MeshEntry& meshEntry)
+    {
+        NullGraphicsStats& stats = _platform->GetStats();
+        NullBoundShaderInfo& boundShaderInfo = _currentRenderOperation->BoundShaderInfo.value();
+
+        if (!boundShaderInfo.IsPipelineBound || !(boundShaderInfo.BoundVertexFormat == meshEntry.Format))
+        {
+            boundShaderInfo.IsPipelineBound = true;
+            boundShaderInfo.BoundVertexFormat = meshEntry.Format;
+            boundShaderInfo.BoundVertexBufferID = 0;
+            stats.PipelineBinds++;
+        }
+
+        const uint64 vertexBufferID = meshEntry.MeshBuffer->GetID();
+        if (vertexBufferID != boundShaderInfo.BoundVertexBufferID || meshEntry.BufferOffset != boundShaderInfo.BoundVertexBufferOffset)
+        {
+            boundShaderInfo.BoundVertexBufferID = vertexBufferID;
+            boundShaderInfo.BoundVertexBufferOffset = meshEntry.BufferOffset;
+            stats.VertexBufferBinds++;
+        }
+
+        const uint64 indexBufferID = meshEntry.IndexBuffer->GetID();
+        const uint64 indexDataOffset = meshEntry.BufferOffset + meshEntry.IndexDataOffset;
+        if (indexBufferID != boundShaderInfo.BoundIndexBufferID || indexDataOffset != boundShaderInfo.BoundIndexBufferOffset)
+        {
+            boundShaderInfo.BoundIndexBufferID = indexBufferID;
+            boundShaderInfo.BoundIndexBufferOffset = indexDataOffset;
+            stats.IndexBufferBinds++;
+        }
+    }
+
+    bool NullRenderContext::BindOrCreateUniformBlock(const char* name, uint64 instanceID, ShaderCursor* outCursor)
+    {
+        COCO_ASSERT(_currentRenderOperation, "Context wasn't rendering");
+        COCO_ASSERT(_currentRenderOperation->BoundShaderInfo, "No shader has been bound");
+
+        bool created = false;
+        NullShaderBufferInterface* interface = _currentRenderOperation->Frame->GetOrCreateShaderBufferInterface(name, instanceID,
+            *_currentRenderOperation->BoundShaderInfo->BoundShader, created);
+
+        if (!interface)
+            return false;
+
+        // Binding without a cursor can only bind a block that was already created this frame
+        COCO_ASSERT(outCursor || !created, "Uniform block \"%s\" was bound before it was created", name);
+
+        NullGraphicsStats& stats = _platform->GetStats();
+        stats.UniformBlockBinds++;
+
+        if (!created)
+            return false;
+
+        stats.UniformBlocksCreated++;
+
+        if (outCursor)
+            outCursor->BindToInterface(*interface);
+
+        return true;
+    }
+} // Coco
\ No newline at end of file
@@ -0,0 +1,118 @@
+//
+// Created by cullen on 10/18/26.
+//
+
+#ifndef COCOENGINE_NULLRENDERCONTEXT_H
+#define COCOENGINE_NULLRENDERCONTEXT_H
+
+#include "Coco/Core/Types/Optional.h"
+#include "Coco/Rendering/Graphics/Resources/RenderContext.h"
+#include "Coco/Rendering/Graphics/VertexDataTypes.h"
+#include "Coco/Rendering/ShaderTypes.h"
+
+namespace Coco
+{
+    class NullShaderProgram;
+    class NullGraphicsPlatform;
+    class NullRenderFrame;
+    class RenderGraph;
+    class RenderScene;
+    struct MeshEntry;
+
+    struct NullBoundShaderInfo
+    {
+        Ref<NullShaderProgram> BoundShader;
+        GraphicsPipelineState BoundPipelineState;
+
+        /// @brief If true, a pipeline has been bound for this shader and BoundVertexFormat
+        bool IsPipelineBound;
+        VertexFormat BoundVertexFormat;
+
+        /// @brief The ID and offset of the vertex buffer currently bound, or 0 if none is bound
+        uint64 BoundVertexBufferID;
+        uint64 BoundVertexBufferOffset;
+
+        /// @brief The ID and offset of the index buffer currently bound, or 0 if none is bound
+        uint64 BoundIndexBufferID;
+        uint64 BoundIndexBufferOffset;
+
+        NullBoundShaderInfo(Ref<NullShaderProgram> shaderProgram, const GraphicsPipelineState& pipelineState);
+    };
+
+    struct NullRenderOperation
+    {
+        NullRenderFrame* Frame;
+        RenderGraph* Graph;
+        RenderScene* Scene;
+        Optional<NullBoundShaderInfo> BoundShaderInfo;
+        bool IsStream;
+        bool IsInPass;
+        bool IsRecordingPassInParallel;
+
+        NullRenderOperation(NullRenderFrame& frame, RenderGraph& graph, RenderScene& scene, bool isStream);
+    };
+
+    /// @brief A render context that records nothing. Commands are validated against the order a GPU backend requires,
+    /// and binds are tracked the same way the Vulkan backend tracks them so the counted work matches what it would record
+    class NullRenderContext : public RenderContext
+    {
+    public:
+        NullRenderContext(uint64 id, NullGraphicsPlatform* platform);
+        ~NullRenderContext();
+
+        Sizei GetFramebufferSize() const override;
+        void BeginPass(uint64 passIndex, Span<const RenderPassAttachmentInfo> passAttachments, bool recordInParallel) override;
+        void EndPass() override;
+        void SetViewport(const Recti& viewportRect) override;
+        void SetScissor(const Recti& scissorRect) override;
+        void SetShader(Shader& shader, const GraphicsPipelineState& pipelineState) override;
+
+        bool CreateAndBindGlobalBuffer(const char* name, ShaderCursor& outCursor) override;
+        void BindGlobalBuffer(const char* name) override;
+        bool CreateAndBindInstanceBuffer(uint64 instanceID, const char* name, ShaderCursor& outCursor) override;
+        void BindInstanceBuffer(uint64 instanceID, const char* name) override;
+        bool BindPersistentInstanceBuffer(uint64 instanceID, uint64 version, const char* name, ShaderCursor& outCursor) override;
+        void SetDrawData(const void* data, uint64 dataSize, Span<const SharedPtr<Texture>> textures) override;
+        void DrawObject(const RenderObject& obj) override;
+        bool CanDrawIndirect(const RenderObject& obj) const override;
+        void CullIndirect(uint64 batchID, const ViewFrustum& frustum, Span<const IndirectDrawObject> objects, Span<const uint8> instanceData, uint64 instanceDataStride) override;
+        void DrawIndirect(uint64 batchID) override;
+        void RecordParallel(uint32 streamCount, const ParallelRecordFunction& recordFunction) override;
+
+        void Begin(NullRenderFrame& frame, RenderGraph& graph, RenderScene& scene);
+
+        /// @brief Begins recording a stream of a parallel pass
+        /// @param frame The frame being rendered
+        /// @param graph The graph being rendered
+        /// @param scene The scene being rendered
+        void BeginStream(NullRenderFrame& frame, RenderGraph& graph, RenderScene& scene);
+
+        /// @brief Ends recording a stream started with BeginStream()
+        void EndStream();
+
+        /// @brief Ends recording started with Begin()
+        void End();
+
+        /// @brief Gets if this context is recording
+        /// @return True if Begin() or BeginStream() was called without a matching End() or EndStream()
+        bool IsRendering() const { return _currentRenderOperation.has_value(); }
+
+    private:
+        NullGraphicsPlatform* _platform;
+        Optional<NullRenderOperation> _currentRenderOperation;
+
+    private:
+        /// @brief Tracks the binds for drawing a mesh with the bound shader, mirroring the binds the Vulkan backend would record
+        /// @param meshEntry The mesh
+        void BindMesh(const MeshEntry& meshEntry);
+
+        /// @brief Binds a uniform block, creating it if it doesn't exist yet this frame
+        /// @param name The name of the block
+        /// @param instanceID The ID of the instance, or 0 for a global block
+        /// @param outCursor If given, will be bound to the block if it was created
+        /// @return True if the block was created and needs its data written
+        bool BindOrCreateUniformBlock(const char* name, uint64 instanceID, ShaderCursor* outCursor);
+    };
+} // Coco
+
+#endif //COCOENGINE_NULLRENDERCONTEXT_H
\ No newline at end of file
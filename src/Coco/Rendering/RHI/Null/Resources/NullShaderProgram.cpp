@@ -0,0 +1,40 @@
+//
+// Created by cullen on 10/18/26.
+//
+
+#include "NullShaderProgram.h"
+
+#include "../NullGraphicsPlatform.h"
+
+#include "Coco/Core/Engine.h"
+#include "Coco/Rendering/Graphics/Slang/SlangCompiler.h"
+
+namespace Coco
+{
+    NullShaderProgram::NullShaderProgram(uint64 id, NullGraphicsPlatform* platform, const FilePath& shaderPath) :
+        ShaderProgram(id),
+        _shaderPath(shaderPath),
+        _layout()
+    {
+        SlangCompiledProgram compiledProgram = platform->GetShaderProgramCompiler()->CompileShader(shaderPath);
+        _layout = compiledProgram.Layout;
+        COCO_ASSERT(_layout, "Failed to link shader program");
+
+        COCO_ENGINE_LOG_VERBOSE("Created NullShaderProgram %u for module \"%s\"", id, shaderPath.CStr());
+    }
+
+    NullShaderProgram::~NullShaderProgram()
+    {
+        COCO_ENGINE_LOG_VERBOSE("Destroyed NullShaderProgram %u", GetID());
+    }
+
+    int64 NullShaderProgram::GetParamBlockIndex(const char* name)
+    {
+        return _layout->GetGlobalParamsTypeLayout()->FindFieldIndexByName(name);
+    }
+
+    const ShaderTypeLayout* NullShaderProgram::GetParamBlockLayout(uint64 index)
+    {
+        return _layout->GetParamBlockLayout(index);
+    }
+} // Coco
\ No newline at end of file
@@ -0,0 +1,33 @@
+//
+// Created by cullen on 10/18/26.
+//
+
+#ifndef COCOENGINE_NULLSHADERPROGRAM_H
+#define COCOENGINE_NULLSHADERPROGRAM_H
+#include "Coco/Rendering/Graphics/Resources/ShaderProgram.h"
+#include "Coco/Core/IO/FilePath.h"
+
+namespace Coco
+{
+    class NullGraphicsPlatform;
+
+    /// @brief A shader program that is compiled for reflection only. No device shader modules or pipeline layouts are created
+    class NullShaderProgram : public ShaderProgram
+    {
+    public:
+        NullShaderProgram(uint64 id, NullGraphicsPlatform* platform, const FilePath& shaderPath);
+        ~NullShaderProgram();
+
+        const ShaderProgramLayout& GetProgramLayout() const override { return *_layout; }
+        int64 GetParamBlockIndex(const char* name) override;
+        const ShaderTypeLayout* GetParamBlockLayout(uint64 index) override;
+
+        const FilePath& GetShaderPath() const { return _shaderPath; }
+
+    private:
+        FilePath _shaderPath;
+        SharedPtr<ShaderProgramLayout> _layout;
+    };
+} // Coco
+
+#endif //COCOENGINE_NULLSHADERPROGRAM_H
\ No newline at end of file
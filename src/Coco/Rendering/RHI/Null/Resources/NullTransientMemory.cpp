@@ -0,0 +1,12 @@
+//
+// Created by cullen on 10/18/26.
+//
+
+#include "NullTransientMemory.h"
+
+namespace Coco
+{
+    NullTransientMemory::NullTransientMemory(uint64 id, const GraphicsMemoryRequirements& requirements) :
+        TransientMemory(id, requirements)
+    {}
+} // Coco
\ No newline at end of file
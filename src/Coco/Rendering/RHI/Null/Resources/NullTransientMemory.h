@@ -0,0 +1,19 @@
+//
+// Created by cullen on 10/18/26.
+//
+
+#ifndef COCOENGINE_NULLTRANSIENTMEMORY_H
+#define COCOENGINE_NULLTRANSIENTMEMORY_H
+#include "Coco/Rendering/Graphics/Resources/TransientMemory.h"
+
+namespace Coco
+{
+    /// @brief Transient memory that only records its requirements, so render graph aliasing can still be measured
+    class NullTransientMemory : public TransientMemory
+    {
+    public:
+        NullTransientMemory(uint64 id, const GraphicsMemoryRequirements& requirements);
+    };
+} // Coco
+
+#endif //COCOENGINE_NULLTRANSIENTMEMORY_H
\ No newline at end of file
@@ -76,6 +76,9 @@ namespace Coco
         if (!needsUpdate)
             return;
 
+        if (!mesh.IsDynamic())
+            mesh.UpdateLODs();
+
         Ref<OpenGLBuffer> meshBuffer;
         uint64 vertexDataSize = mesh.GetVertexDataSize();
         uint64 indexDataSize = mesh.GetIndexDataSize();
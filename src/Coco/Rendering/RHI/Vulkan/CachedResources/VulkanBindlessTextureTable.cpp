@@ -0,0 +1,297 @@
+//
+// Created by cullen on 10/18/26.
+//
+
+#include "VulkanBindlessTextureTable.h"
+
+#include "../VulkanGraphicsPlatform.h"
+#include "../VulkanUtils.h"
+#include "../Resources/VulkanImage.h"
+#include "../Resources/VulkanImageSampler.h"
+#include "Coco/Core/Engine.h"
+#include "Coco/Rendering/RenderService.h"
+#include "Coco/Rendering/Texture.h"
+
+namespace Coco
+{
+    VulkanBindlessTextureTable::VulkanBindlessTextureTable(VulkanGraphicsPlatform* platform) :
+        _platform(platform),
+        _capacity(0),
+        _setLayout(nullptr),
+        _pool(nullptr),
+        _descriptorSet(nullptr),
+        _slots(),
+        _freeIndices(),
+        _pendingFrees(),
+        _lastUsedFrameNumbers(),
+        _nextIndex(0),
+        _releaseCount(0),
+        _nextEvictionFrameNumber(0),
+        _hasLoggedFull(false)
+    {
+        VkPhysicalDeviceDescriptorIndexingProperties indexingProperties{VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_PROPERTIES};
+        VkPhysicalDeviceProperties2 deviceProperties{VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2};
+        deviceProperties.pNext = &indexingProperties;
+        vkGetPhysicalDeviceProperties2(_platform->GetPhysicalDevice(), &deviceProperties);
+
+        _capacity = Math::Min(MaxTextures,
+            Math::Min(indexingProperties.maxDescriptorSetUpdateAfterBindSampledImages,
+                Math::Min(indexingProperties.maxDescriptorSetUpdateAfterBindSamplers, indexingProperties.maxPerStageDescriptorUpdateAfterBindSampledImages)));
+
+        VkDescriptorSetLayoutBinding binding{};
+        binding.binding = 0;
+        binding.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+        binding.descriptorCount = _capacity;
+        binding.stageFlags = VK_SHADER_STAGE_ALL;
+
+        _lastUsedFrameNumbers.Resize(_capacity);
+
+        // Slots are written while previously recorded command buffers may still reference the set, and unused slots are never written
+        const VkDescriptorBindingFlags bindingFlags = VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT | VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT;
+
+        VkDescriptorSetLayoutBindingFlagsCreateInfo bindingFlagsInfo{VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO};
+        bindingFlagsInfo.bindingCount = 1;
+        bindingFlagsInfo.pBindingFlags = &bindingFlags;
+
+        VkDescriptorSetLayoutCreateInfo layoutCreateInfo{VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO};
+        layoutCreateInfo.pNext = &bindingFlagsInfo;
+        layoutCreateInfo.flags = VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT;
+        layoutCreateInfo.bindingCount = 1;
+        layoutCreateInfo.pBindings = &binding;
+
+        AssertVkSuccess(vkCreateDescriptorSetLayout(_platform->GetDevice(), &layoutCreateInfo, _platform->GetAllocationCallbacks(), &_setLayout));
+
+        VkDescriptorPoolSize poolSize{};
+        poolSize.type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+        poolSize.descriptorCount = _capacity;
+
+        VkDescriptorPoolCreateInfo poolCreateInfo{VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO};
+        poolCreateInfo.flags = VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT;
+        poolCreateInfo.maxSets = 1;
+        poolCreateInfo.poolSizeCount = 1;
+        poolCreateInfo.pPoolSizes = &poolSize;
+
+        AssertVkSuccess(vkCreateDescriptorPool(_platform->GetDevice(), &poolCreateInfo, _platform->GetAllocationCallbacks(), &_pool));
+
+        VkDescriptorSetAllocateInfo allocInfo{VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO};
+        allocInfo.descriptorPool = _pool;
+        allocInfo.descriptorSetCount = 1;
+        allocInfo.pSetLayouts = &_setLayout;
+
+        AssertVkSuccess(vkAllocateDescriptorSets(_platform->GetDevice(), &allocInfo, &_descriptorSet));
+
+        COCO_ENGINE_LOG_VERBOSE("Created VulkanBindlessTextureTable with %u slots", _capacity);
+    }
+
+    VulkanBindlessTextureTable::~VulkanBindlessTextureTable()
+    {
+        _slots.Clear();
+        _freeIndices.Clear();
+        _pendingFrees.Clear();
+        _lastUsedFrameNumbers.Clear();
+
+        // Destroying the pool frees the set
+        if (_pool)
+        {
+            vkDestroyDescriptorPool(_platform->GetDevice(), _pool, _platform->GetAllocationCallbacks());
+            _pool = nullptr;
+            _descriptorSet = nullptr;
+        }
+
+        if (_setLayout)
+        {
+            vkDestroyDescriptorSetLayout(_platform->GetDevice(), _setLayout, _platform->GetAllocationCallbacks());
+            _setLayout = nullptr;
+        }
+
+        COCO_ENGINE_LOG_VERBOSE("Destroyed VulkanBindlessTextureTable");
+    }
+
+    bool VulkanBindlessTextureTable::IsSupported(const VkPhysicalDeviceDescriptorIndexingFeatures& features)
+    {
+        return features.runtimeDescriptorArray &&
+            features.descriptorBindingPartiallyBound &&
+            features.descriptorBindingSampledImageUpdateAfterBind &&
+            features.shaderSampledImageArrayNonUniformIndexing;
+    }
+
+    void VulkanBindlessTextureTable::EnableRequiredFeatures(VkPhysicalDeviceDescriptorIndexingFeatures& features)
+    {
+        features.runtimeDescriptorArray = VK_TRUE;
+        features.descriptorBindingPartiallyBound = VK_TRUE;
+        features.descriptorBindingSampledImageUpdateAfterBind = VK_TRUE;
+        features.shaderSampledImageArrayNonUniformIndexing = VK_TRUE;
+    }
+
+    Optional<uint32> VulkanBindlessTextureTable::GetOrAddTexture(uint64 imageID, uint64 samplerID, const VkDescriptorImageInfo& imageInfo)
+    {
+        const uint64 key = MakeKey(imageID, samplerID);
+        const uint64 currentFrameNumber = _platform->GetCurrentFrameNumber();
+
+        if (Slot* existing = _slots.TryGetValue(key))
+        {
+            if (existing->ImageID == imageID && existing->SamplerID == samplerID)
+            {
+                _lastUsedFrameNumbers[existing->Index] = currentFrameNumber;
+                return existing->Index;
+            }
+        }
+
+        uint32 index;
+        if (!_freeIndices.IsEmpty())
+        {
+            index = _freeIndices.Back();
+            _freeIndices.RemoveAt(_freeIndices.GetCount() - 1, false);
+        }
+        else if (_nextIndex < _capacity)
+        {
+            index = _nextIndex++;
+        }
+        else if (Optional<uint32> evictedIndex = TryEvictLeastRecentlyUsed())
+        {
+            index = evictedIndex.value();
+        }
+        else
+        {
+            if (!_hasLoggedFull)
+            {
+                COCO_ENGINE_LOG_ERROR("Bindless texture table is full (%u textures) and every texture is still in use", _capacity);
+                _hasLoggedFull = true;
+            }
+
+            return {};
+        }
+
+        VkWriteDescriptorSet write{VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET};
+        write.dstSet = _descriptorSet;
+        write.dstBinding = 0;
+        write.dstArrayElement = index;
+        write.descriptorCount = 1;
+        write.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+        write.pImageInfo = &imageInfo;
+
+        vkUpdateDescriptorSets(_platform->GetDevice(), 1, &write, 0, nullptr);
+
+        // A colliding key gets overwritten, and the previous pair is added again in its own slot the next time it's used
+        if (const Slot* collided = _slots.TryGetValue(key))
+        {
+            _pendingFrees.Append(PendingFree{collided->Index, _platform->GetCurrentFrameNumber()});
+            _slots.Remove(key);
+            _releaseCount++;
+        }
+
+        _slots.Emplace(key, Slot{imageID, samplerID, index});
+        _lastUsedFrameNumbers[index] = currentFrameNumber;
+        return index;
+    }
+
+    uint32 VulkanBindlessTextureTable::GetTextureIndex(Texture* texture)
+    {
+        Texture* defaultTexture = _platform->GetRenderService()->GetDefaultCheckerTexture().get();
+        if (!texture || !texture->IsReady())
+            texture = defaultTexture;
+
+        if (Optional<uint32> index = TryGetTextureIndex(*texture))
+            return index.value();
+
+        // The table is full of textures that frames in flight still use, so the default texture is drawn instead.
+        // A full table always has its first slot written, so that is used if the default texture isn't in the table either
+        if (texture != defaultTexture)
+        {
+            if (Optional<uint32> index = TryGetTextureIndex(*defaultTexture))
+                return index.value();
+        }
+
+        return 0;
+    }
+
+    void VulkanBindlessTextureTable::MarkUsed(uint32 index)
+    {
+        _lastUsedFrameNumbers[index] = _platform->GetCurrentFrameNumber();
+    }
+
+    void VulkanBindlessTextureTable::OnResourceInvalidated(uint64 resourceID)
+    {
+        Array<uint64> staleKeys;
+
+        for (const auto& [key, slot] : _slots)
+        {
+            if (slot.ImageID == resourceID || slot.SamplerID == resourceID)
+                staleKeys.Append(key);
+        }
+
+        for (const uint64 key : staleKeys)
+        {
+            _pendingFrees.Append(PendingFree{_slots.Get(key).Index, _platform->GetCurrentFrameNumber()});
+            _slots.Remove(key);
+            _releaseCount++;
+        }
+    }
+
+    void VulkanBindlessTextureTable::PurgeUnused()
+    {
+        const uint64 currentFrameNumber = _platform->GetCurrentFrameNumber();
+
+        for (uint64 i = _pendingFrees.GetCount(); i > 0; i--)
+        {
+            const PendingFree& pending = _pendingFrees[i - 1];
+            if (currentFrameNumber < pending.FrameNumber + _freeDelayFrames)
+                continue;
+
+            _freeIndices.Append(pending.Index);
+            _pendingFrees.RemoveAt(i - 1, false);
+        }
+    }
+
+    uint64 VulkanBindlessTextureTable::MakeKey(uint64 imageID, uint64 samplerID)
+    {
+        return Math::CombineHashes(imageID, samplerID);
+    }
+
+    Optional<uint32> VulkanBindlessTextureTable::TryGetTextureIndex(Texture& texture)
+    {
+        Ref<VulkanImage> image = texture.GetImage().Downcast<VulkanImage>();
+        Ref<VulkanImageSampler> imageSampler = texture.GetSampler().Downcast<VulkanImageSampler>();
+
+        VkDescriptorImageInfo imageInfo{};
+        imageInfo.imageView = image->GetNativeView();
+        imageInfo.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+        imageInfo.sampler = imageSampler->GetSampler();
+
+        return GetOrAddTexture(image->GetID(), imageSampler->GetID(), imageInfo);
+    }
+
+    Optional<uint32> VulkanBindlessTextureTable::TryEvictLeastRecentlyUsed()
+    {
+        const uint64 currentFrameNumber = _platform->GetCurrentFrameNumber();
+        if (currentFrameNumber < _nextEvictionFrameNumber)
+            return {};
+
+        const std::pair<const uint64, Slot>* oldest = nullptr;
+
+        for (const auto& pair : _slots)
+        {
+            if (!oldest || _lastUsedFrameNumbers[pair.second.Index] < _lastUsedFrameNumbers[oldest->second.Index])
+                oldest = &pair;
+        }
+
+        if (!oldest)
+            return {};
+
+        // Frames in flight may still sample the slot, so it can only be rewritten once they have finished
+        const uint64 lastUsedFrameNumber = _lastUsedFrameNumbers[oldest->second.Index];
+        if (currentFrameNumber < lastUsedFrameNumber + _freeDelayFrames)
+        {
+            _nextEvictionFrameNumber = lastUsedFrameNumber + _freeDelayFrames;
+            return {};
+        }
+
+        const uint64 key = oldest->first;
+        const uint32 index = oldest->second.Index;
+        _slots.Remove(key);
+        _releaseCount++;
+        _hasLoggedFull = false;
+
+        return index;
+    }
+} // Coco
\ No newline at end of file
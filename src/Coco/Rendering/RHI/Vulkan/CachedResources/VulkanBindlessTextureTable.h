@@ -0,0 +1,125 @@
+//
+// Created by cullen on 10/18/26.
+//
+
+#ifndef COCOENGINE_VULKANBINDLESSTEXTURETABLE_H
+#define COCOENGINE_VULKANBINDLESSTEXTURETABLE_H
+#include "Coco/Core/Types/CoreTypes.h"
+#include "Coco/Core/Types/Array.h"
+#include "Coco/Core/Types/Map.h"
+#include "Coco/Core/Types/Optional.h"
+#include "../VulkanIncludes.h"
+
+namespace Coco
+{
+    class VulkanGraphicsPlatform;
+    class Texture;
+
+    /// @brief A single update-after-bind descriptor set holding an array of every image and sampler pair used by bindless shaders.
+    /// Shaders index into the array, so draws with different textures don't need to bind different descriptor sets
+    class VulkanBindlessTextureTable
+    {
+    public:
+        /// @brief The maximum number of textures the table holds, if the device allows it
+        static constexpr uint32 MaxTextures = 4096;
+
+        VulkanBindlessTextureTable(VulkanGraphicsPlatform* platform);
+        ~VulkanBindlessTextureTable();
+
+        VulkanBindlessTextureTable(const VulkanBindlessTextureTable&) = delete;
+        VulkanBindlessTextureTable& operator=(const VulkanBindlessTextureTable&) = delete;
+
+        /// @brief Checks if a device supports the descriptor indexing features that the table needs
+        /// @param features The descriptor indexing features of the device
+        /// @return True if the table can be used on the device
+        static bool IsSupported(const VkPhysicalDeviceDescriptorIndexingFeatures& features);
+
+        /// @brief Enables the descriptor indexing features that the table needs
+        /// @param features The features to enable
+        static void EnableRequiredFeatures(VkPhysicalDeviceDescriptorIndexingFeatures& features);
+
+        VkDescriptorSetLayout GetSetLayout() const { return _setLayout; }
+        VkDescriptorSet GetDescriptorSet() const { return _descriptorSet; }
+        uint32 GetCapacity() const { return _capacity; }
+        uint32 GetTextureCount() const { return static_cast<uint32>(_slots.GetCount()); }
+
+        /// @brief Gets the index of an image and sampler pair in the table, writing it into a free slot if it isn't in the table yet.
+        /// If the table is full, the least recently used pair is evicted if no frame in flight can still be using it
+        /// @param imageID The ID of the image
+        /// @param samplerID The ID of the sampler
+        /// @param imageInfo The image info to write if the pair isn't in the table
+        /// @return The index of the pair in the table, or an empty value if the table is full of pairs that are still in use
+        Optional<uint32> GetOrAddTexture(uint64 imageID, uint64 samplerID, const VkDescriptorImageInfo& imageInfo);
+
+        /// @brief Gets the index of a texture in the table, adding it if needed
+        /// @param texture The texture. The default texture is used if this is nullptr or isn't ready
+        /// @return The index of the texture in the table. If the table is full, the index of the default texture is returned instead
+        uint32 GetTextureIndex(Texture* texture);
+
+        /// @brief Marks a slot as used this frame so it isn't evicted while frames in flight may still sample it.
+        /// Indices kept across frames, such as in persistent uniform blocks, must be marked each frame they're used
+        /// @param index The index of the slot
+        void MarkUsed(uint32 index);
+
+        /// @brief Gets the number of slots that have been released from the table.
+        /// An index kept from before this changed may now refer to a different texture
+        /// @return The number of released slots
+        uint64 GetReleaseCount() const { return _releaseCount; }
+
+        /// @brief Releases the slots of all pairs that reference a resource
+        /// @param resourceID The ID of the resource
+        void OnResourceInvalidated(uint64 resourceID);
+
+        /// @brief Returns released slots to the free list once frames in flight are done with them
+        void PurgeUnused();
+
+    private:
+        /// @brief The number of frames to wait before reusing a released slot
+        static constexpr uint64 _freeDelayFrames = 3;
+
+        struct Slot
+        {
+            uint64 ImageID;
+            uint64 SamplerID;
+            uint32 Index;
+        };
+
+        struct PendingFree
+        {
+            uint32 Index;
+            uint64 FrameNumber;
+        };
+
+        VulkanGraphicsPlatform* _platform;
+        uint32 _capacity;
+        VkDescriptorSetLayout _setLayout;
+        VkDescriptorPool _pool;
+        VkDescriptorSet _descriptorSet;
+        Map<uint64, Slot> _slots;
+        Array<uint32> _freeIndices;
+        Array<PendingFree> _pendingFrees;
+
+        /// @brief The frame each slot was last used on, indexed by slot
+        Array<uint64> _lastUsedFrameNumbers;
+        uint32 _nextIndex;
+        uint64 _releaseCount;
+
+        /// @brief The first frame that a slot could be evicted on, which saves searching every slot on each miss while the table is full
+        uint64 _nextEvictionFrameNumber;
+        bool _hasLoggedFull;
+
+    private:
+        static uint64 MakeKey(uint64 imageID, uint64 samplerID);
+
+        /// @brief Gets the index of a texture in the table, adding it if there is room
+        /// @param texture The texture
+        /// @return The index of the texture in the table, or an empty value if the table is full
+        Optional<uint32> TryGetTextureIndex(Texture& texture);
+
+        /// @brief Evicts the least recently used pair if no frame in flight can still be using it
+        /// @return The index of the evicted pair's slot, or an empty value if every pair may still be in use
+        Optional<uint32> TryEvictLeastRecentlyUsed();
+    };
+} // Coco
+
+#endif //COCOENGINE_VULKANBINDLESSTEXTURETABLE_H
\ No newline at end of file
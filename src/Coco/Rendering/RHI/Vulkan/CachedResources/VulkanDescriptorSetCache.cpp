@@ -0,0 +1,193 @@
+//
+// Created by cullen on 10/18/26.
+//
+
+#include "VulkanDescriptorSetCache.h"
+
+#include "../VulkanGraphicsPlatform.h"
+#include "../VulkanDescriptorSetPool.h"
+#include "../VulkanDescriptorSetLayout.h"
+#include "../Resources/VulkanShaderProgram.h"
+#include "Coco/Core/Engine.h"
+
+namespace Coco
+{
+    VulkanDescriptorSetCache::VulkanDescriptorSetCache(VulkanGraphicsPlatform* platform) :
+        _platform(platform),
+        _pools(),
+        _sets(),
+        _pendingFrees()
+    {}
+
+    VulkanDescriptorSetCache::~VulkanDescriptorSetCache()
+    {
+        // Destroying the pools frees every set allocated from them
+        _pendingFrees.Clear();
+        _sets.Clear();
+        _pools.Clear();
+    }
+
+    VkDescriptorSet VulkanDescriptorSetCache::GetOrCreateImageSet(Ref<VulkanShaderProgram> shaderProgram,
+        const VulkanDescriptorSetLayout& setLayout, Span<const VulkanDescriptorImageBinding> bindings)
+    {
+        COCO_ASSERT(bindings.size() <= MaxBindings, "Cached descriptor sets can have up to %u bindings", MaxBindings);
+        COCO_ASSERT(bindings.size() == setLayout.LayoutBindings.GetCount(), "Every binding in the set must be bound");
+
+        const uint64 shaderProgramID = shaderProgram->GetID();
+        const uint64 key = MakeKey(shaderProgramID, setLayout.DescriptorSetIndex, bindings);
+
+        CachedSet* cached = _sets.TryGetValue(key);
+        if (cached && Matches(*cached, shaderProgramID, setLayout.DescriptorSetIndex, bindings))
+        {
+            cached->LastUsedFrameNumber = _platform->GetCurrentFrameNumber();
+            return cached->DescriptorSet;
+        }
+
+        // A different set hashed to the same key, so replace it
+        if (cached)
+        {
+            DeferFree(*cached);
+            _sets.Remove(key);
+        }
+
+        UniquePtr<VulkanDescriptorSetPool>* pool = _pools.TryGetValue(shaderProgramID);
+        if (!pool)
+            pool = &_pools.Emplace(shaderProgramID, CreateDefaultUnique<VulkanDescriptorSetPool>(_platform, shaderProgram, true));
+
+        CachedSet set{};
+        set.ShaderProgramID = shaderProgramID;
+        set.DescriptorSetIndex = setLayout.DescriptorSetIndex;
+        set.LastUsedFrameNumber = _platform->GetCurrentFrameNumber();
+        set.DescriptorSet = (*pool)->AllocateDescriptorSet(setLayout.DescriptorSetIndex, &set.Pool);
+
+        StackArray<VkWriteDescriptorSet, MaxBindings> writes;
+
+        for (uint64 i = 0; i < bindings.size(); i++)
+        {
+            const VulkanDescriptorImageBinding& binding = bindings[i];
+            set.ResourceIDs.Append(binding.ImageID);
+            set.ResourceIDs.Append(binding.SamplerID);
+
+            VkWriteDescriptorSet& write = writes.EmplaceBack(VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET);
+            write.dstSet = set.DescriptorSet;
+            write.dstBinding = setLayout.LayoutBindings[i].binding;
+            write.dstArrayElement = 0;
+            write.descriptorCount = 1;
+            write.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+            write.pImageInfo = &binding.ImageInfo;
+        }
+
+        vkUpdateDescriptorSets(_platform->GetDevice(), static_cast<uint32>(writes.GetCount()), writes.Data(), 0, nullptr);
+
+        return _sets.Emplace(key, set).DescriptorSet;
+    }
+
+    void VulkanDescriptorSetCache::OnResourceInvalidated(uint64 resourceID)
+    {
+        Array<uint64> staleKeys;
+
+        for (const auto& [key, set] : _sets)
+        {
+            if (set.ShaderProgramID == resourceID)
+            {
+                staleKeys.Append(key);
+                continue;
+            }
+
+            for (const uint64 id : set.ResourceIDs)
+            {
+                if (id == resourceID)
+                {
+                    staleKeys.Append(key);
+                    break;
+                }
+            }
+        }
+
+        for (const uint64 key : staleKeys)
+        {
+            DeferFree(_sets.Get(key));
+            _sets.Remove(key);
+        }
+
+        if (UniquePtr<VulkanDescriptorSetPool>* pool = _pools.TryGetValue(resourceID))
+        {
+            // Take the pool out of the map first, since destroying it invalidates the shader program again
+            UniquePtr<VulkanDescriptorSetPool> removedPool = std::move(*pool);
+            _pools.Remove(resourceID);
+
+            for (uint64 i = _pendingFrees.GetCount(); i > 0; i--)
+            {
+                if (_pendingFrees[i - 1].ShaderProgramID == resourceID)
+                    _pendingFrees.RemoveAt(i - 1, false);
+            }
+
+            _platform->WaitForIdle();
+            removedPool.reset();
+        }
+    }
+
+    void VulkanDescriptorSetCache::PurgeUnused()
+    {
+        const uint64 currentFrameNumber = _platform->GetCurrentFrameNumber();
+
+        if (currentFrameNumber > _maxUnusedFrames)
+        {
+            Array<uint64> staleKeys;
+
+            for (const auto& [key, set] : _sets)
+            {
+                if (set.LastUsedFrameNumber < currentFrameNumber - _maxUnusedFrames)
+                    staleKeys.Append(key);
+            }
+
+            for (const uint64 key : staleKeys)
+            {
+                DeferFree(_sets.Get(key));
+                _sets.Remove(key);
+            }
+        }
+
+        for (uint64 i = _pendingFrees.GetCount(); i > 0; i--)
+        {
+            const PendingFree& pending = _pendingFrees[i - 1];
+            if (currentFrameNumber < pending.FrameNumber + _freeDelayFrames)
+                continue;
+
+            if (UniquePtr<VulkanDescriptorSetPool>* pool = _pools.TryGetValue(pending.ShaderProgramID))
+                (*pool)->FreeDescriptorSet(pending.Pool, pending.DescriptorSet);
+
+            _pendingFrees.RemoveAt(i - 1, false);
+        }
+    }
+
+    uint64 VulkanDescriptorSetCache::MakeKey(uint64 shaderProgramID, uint32 descriptorSetIndex, Span<const VulkanDescriptorImageBinding> bindings)
+    {
+        uint64 key = Math::CombineHashes(shaderProgramID, static_cast<uint64>(descriptorSetIndex));
+
+        for (const auto& binding : bindings)
+            key = Math::CombineHashes(key, binding.ImageID, binding.SamplerID);
+
+        return key;
+    }
+
+    bool VulkanDescriptorSetCache::Matches(const CachedSet& set, uint64 shaderProgramID, uint32 descriptorSetIndex,
+        Span<const VulkanDescriptorImageBinding> bindings)
+    {
+        if (set.ShaderProgramID != shaderProgramID || set.DescriptorSetIndex != descriptorSetIndex || set.ResourceIDs.GetCount() != bindings.size() * 2)
+            return false;
+
+        for (uint64 i = 0; i < bindings.size(); i++)
+        {
+            if (set.ResourceIDs[i * 2] != bindings[i].ImageID || set.ResourceIDs[i * 2 + 1] != bindings[i].SamplerID)
+                return false;
+        }
+
+        return true;
+    }
+
+    void VulkanDescriptorSetCache::DeferFree(const CachedSet& set)
+    {
+        _pendingFrees.Append(PendingFree{set.DescriptorSet, set.Pool, set.ShaderProgramID, _platform->GetCurrentFrameNumber()});
+    }
+} // Coco
\ No newline at end of file
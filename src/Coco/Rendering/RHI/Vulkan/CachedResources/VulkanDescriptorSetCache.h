@@ -0,0 +1,101 @@
+//
+// Created by cullen on 10/18/26.
+//
+
+#ifndef COCOENGINE_VULKANDESCRIPTORSETCACHE_H
+#define COCOENGINE_VULKANDESCRIPTORSETCACHE_H
+#include "Coco/Core/Types/CoreTypes.h"
+#include "Coco/Core/Types/Array.h"
+#include "Coco/Core/Types/Map.h"
+#include "Coco/Core/Types/Span.h"
+#include "Coco/Core/Types/StackArray.h"
+#include "Coco/Core/Memory/Ptrs.h"
+#include "Coco/Core/Memory/Refs.h"
+#include "../VulkanIncludes.h"
+
+namespace Coco
+{
+    class VulkanGraphicsPlatform;
+    class VulkanShaderProgram;
+    class VulkanDescriptorSetPool;
+    struct VulkanDescriptorSetLayout;
+
+    /// @brief An image and sampler bound to a single binding of a descriptor set
+    struct VulkanDescriptorImageBinding
+    {
+        uint64 ImageID;
+        uint64 SamplerID;
+        VkDescriptorImageInfo ImageInfo;
+    };
+
+    /// @brief Caches descriptor sets by the shader program, set layout and bound resources, so that sets are written once and reused
+    /// across frames. Sets are freed when a resource they reference is invalidated or when they haven't been used for a while
+    class VulkanDescriptorSetCache
+    {
+    public:
+        /// @brief The maximum number of bindings a cached descriptor set can have
+        static constexpr uint64 MaxBindings = 32;
+
+        VulkanDescriptorSetCache(VulkanGraphicsPlatform* platform);
+        ~VulkanDescriptorSetCache();
+
+        VulkanDescriptorSetCache(const VulkanDescriptorSetCache&) = delete;
+        VulkanDescriptorSetCache& operator=(const VulkanDescriptorSetCache&) = delete;
+
+        /// @brief Gets a descriptor set with the given images bound, allocating and writing a new set if one doesn't exist
+        /// @param shaderProgram The shader program
+        /// @param setLayout The layout of the descriptor set
+        /// @param bindings The images bound to the set, in the order of the layout's bindings
+        /// @return The descriptor set
+        VkDescriptorSet GetOrCreateImageSet(Ref<VulkanShaderProgram> shaderProgram, const VulkanDescriptorSetLayout& setLayout, Span<const VulkanDescriptorImageBinding> bindings);
+
+        /// @brief Frees all descriptor sets that reference a resource
+        /// @param resourceID The ID of the resource
+        void OnResourceInvalidated(uint64 resourceID);
+
+        /// @brief Frees descriptor sets that have been unused for too long and any sets whose release has been deferred long enough
+        void PurgeUnused();
+
+        uint64 GetCachedSetCount() const { return _sets.GetCount(); }
+
+    private:
+        /// @brief The number of frames a descriptor set can go unused before it is freed
+        static constexpr uint64 _maxUnusedFrames = 300;
+
+        /// @brief The number of frames to wait before freeing a set, so that frames in flight are done with it
+        static constexpr uint64 _freeDelayFrames = 3;
+
+        struct CachedSet
+        {
+            VkDescriptorSet DescriptorSet;
+            VkDescriptorPool Pool;
+            uint64 ShaderProgramID;
+            uint32 DescriptorSetIndex;
+            StackArray<uint64, MaxBindings * 2> ResourceIDs;
+            uint64 LastUsedFrameNumber;
+        };
+
+        struct PendingFree
+        {
+            VkDescriptorSet DescriptorSet;
+            VkDescriptorPool Pool;
+            uint64 ShaderProgramID;
+            uint64 FrameNumber;
+        };
+
+        VulkanGraphicsPlatform* _platform;
+        Map<uint64, UniquePtr<VulkanDescriptorSetPool>> _pools;
+        Map<uint64, CachedSet> _sets;
+        Array<PendingFree> _pendingFrees;
+
+    private:
+        static uint64 MakeKey(uint64 shaderProgramID, uint32 descriptorSetIndex, Span<const VulkanDescriptorImageBinding> bindings);
+        static bool Matches(const CachedSet& set, uint64 shaderProgramID, uint32 descriptorSetIndex, Span<const VulkanDescriptorImageBinding> bindings);
+
+        /// @brief Queues a cached set to be freed once frames in flight are done with it
+        /// @param set The cached set
+        void DeferFree(const CachedSet& set);
+    };
+} // Coco
+
+#endif //COCOENGINE_VULKANDESCRIPTORSETCACHE_H
\ No newline at end of file
@@ -0,0 +1,109 @@
+//
+// Created by cullen on 10/18/26.
+//
+
+#include "VulkanIndirectCullingPipeline.h"
+
+#include "../VulkanGraphicsPlatform.h"
+#include "../VulkanUtils.h"
+#include "Coco/Core/Engine.h"
+#include "Coco/Core/Types/StackArray.h"
+#include "Coco/Rendering/Graphics/Slang/SlangCompiler.h"
+
+namespace Coco
+{
+    VulkanIndirectCullingPipeline::VulkanIndirectCullingPipeline(VulkanGraphicsPlatform* platform) :
+        _platform(platform),
+        _shaderModule(nullptr),
+        _setLayout(nullptr),
+        _pipelineLayout(nullptr),
+        _pipeline(nullptr)
+    {
+        SlangCompiledProgram compiledProgram = _platform->GetShaderProgramCompiler()->CompileComputeShader(_shaderPath);
+        COCO_ASSERT(compiledProgram.TargetCode, "Failed to get program code");
+
+        VkShaderModuleCreateInfo moduleCreateInfo{VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO};
+        moduleCreateInfo.codeSize = compiledProgram.TargetCode->getBufferSize();
+        moduleCreateInfo.pCode = static_cast<const uint32_t*>(compiledProgram.TargetCode->getBufferPointer());
+        AssertVkSuccess(vkCreateShaderModule(_platform->GetDevice(), &moduleCreateInfo, _platform->GetAllocationCallbacks(), &_shaderModule));
+
+        // The objects, the draw commands, and the draw counts. The shader declares these bindings explicitly
+        StackArray<VkDescriptorSetLayoutBinding, 3> bindings;
+        for (uint32 i = 0; i < 3; i++)
+        {
+            VkDescriptorSetLayoutBinding& binding = bindings.EmplaceBack();
+            binding.binding = i;
+            binding.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+            binding.descriptorCount = 1;
+            binding.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+            binding.pImmutableSamplers = nullptr;
+        }
+
+        VkDescriptorSetLayoutCreateInfo layoutCreateInfo{VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO};
+        layoutCreateInfo.bindingCount = static_cast<uint32>(bindings.GetCount());
+        layoutCreateInfo.pBindings = bindings.Data();
+        AssertVkSuccess(vkCreateDescriptorSetLayout(_platform->GetDevice(), &layoutCreateInfo, _platform->GetAllocationCallbacks(), &_setLayout));
+
+        VkPushConstantRange pushConstantRange{};
+        pushConstantRange.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+        pushConstantRange.offset = 0;
+        pushConstantRange.size = sizeof(VulkanIndirectCullConstants);
+
+        VkPipelineLayoutCreateInfo pipelineLayoutCreateInfo{VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO};
+        pipelineLayoutCreateInfo.setLayoutCount = 1;
+        pipelineLayoutCreateInfo.pSetLayouts = &_setLayout;
+        pipelineLayoutCreateInfo.pushConstantRangeCount = 1;
+        pipelineLayoutCreateInfo.pPushConstantRanges = &pushConstantRange;
+        AssertVkSuccess(vkCreatePipelineLayout(_platform->GetDevice(), &pipelineLayoutCreateInfo, _platform->GetAllocationCallbacks(), &_pipelineLayout));
+
+        VkComputePipelineCreateInfo pipelineCreateInfo{VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO};
+        pipelineCreateInfo.stage.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+        pipelineCreateInfo.stage.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+        pipelineCreateInfo.stage.module = _shaderModule;
+        pipelineCreateInfo.stage.pName = "csMain";
+        pipelineCreateInfo.layout = _pipelineLayout;
+
+        AssertVkSuccess(
+            vkCreateComputePipelines(
+                _platform->GetDevice(),
+                _platform->GetVulkanCache()->GetPipelineCache().GetCache(),
+                1, &pipelineCreateInfo,
+                _platform->GetAllocationCallbacks(),
+                &_pipeline
+            )
+        );
+
+        COCO_ENGINE_LOG_VERBOSE("Created VulkanIndirectCullingPipeline");
+    }
+
+    VulkanIndirectCullingPipeline::~VulkanIndirectCullingPipeline()
+    {
+        _platform->WaitForIdle();
+
+        if (_pipeline)
+        {
+            vkDestroyPipeline(_platform->GetDevice(), _pipeline, _platform->GetAllocationCallbacks());
+            _pipeline = nullptr;
+        }
+
+        if (_pipelineLayout)
+        {
+            vkDestroyPipelineLayout(_platform->GetDevice(), _pipelineLayout, _platform->GetAllocationCallbacks());
+            _pipelineLayout = nullptr;
+        }
+
+        if (_setLayout)
+        {
+            vkDestroyDescriptorSetLayout(_platform->GetDevice(), _setLayout, _platform->GetAllocationCallbacks());
+            _setLayout = nullptr;
+        }
+
+        if (_shaderModule)
+        {
+            vkDestroyShaderModule(_platform->GetDevice(), _shaderModule, _platform->GetAllocationCallbacks());
+            _shaderModule = nullptr;
+        }
+
+        COCO_ENGINE_LOG_VERBOSE("Destroyed VulkanIndirectCullingPipeline");
+    }
+} // Coco
\ No newline at end of file
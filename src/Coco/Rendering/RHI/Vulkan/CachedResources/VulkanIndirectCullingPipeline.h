@@ -0,0 +1,73 @@
+//
+// Created by cullen on 10/18/26.
+//
+
+#ifndef COCOENGINE_VULKANINDIRECTCULLINGPIPELINE_H
+#define COCOENGINE_VULKANINDIRECTCULLINGPIPELINE_H
+#include "Coco/Core/Types/CoreTypes.h"
+#include "../VulkanIncludes.h"
+
+namespace Coco
+{
+    class VulkanGraphicsPlatform;
+
+    /// @brief An object for the culling shader to test, matching the shader's CullObject struct
+    struct VulkanIndirectCullObject
+    {
+        float Center[3];
+        uint32 IndexCount;
+        float Extents[3];
+        uint32 FirstIndex;
+        int32 VertexOffset;
+
+        /// @brief The index of the object's instance data, which is drawn as the first instance
+        uint32 InstanceIndex;
+
+        /// @brief The index of the first command of the object's draw group
+        uint32 CommandOffset;
+
+        /// @brief The index of the object's draw group, which is also the index of the group's draw count
+        uint32 DrawGroup;
+    };
+
+    static_assert(sizeof(VulkanIndirectCullObject) == 48);
+
+    /// @brief The push constants of the culling shader
+    struct VulkanIndirectCullConstants
+    {
+        float Planes[6][4];
+        uint32 ObjectCount;
+    };
+
+    /// @brief The compute pipeline that frustum culls objects and writes indexed indirect draw commands for the visible ones
+    class VulkanIndirectCullingPipeline
+    {
+    public:
+        /// @brief The number of objects each workgroup culls
+        static constexpr uint32 WorkgroupSize = 64;
+
+        /// @brief The size of each indirect draw command
+        static constexpr uint32 CommandStride = sizeof(VkDrawIndexedIndirectCommand);
+
+        VulkanIndirectCullingPipeline(VulkanGraphicsPlatform* platform);
+        ~VulkanIndirectCullingPipeline();
+
+        VulkanIndirectCullingPipeline(const VulkanIndirectCullingPipeline&) = delete;
+        VulkanIndirectCullingPipeline& operator=(const VulkanIndirectCullingPipeline&) = delete;
+
+        VkDescriptorSetLayout GetSetLayout() const { return _setLayout; }
+        VkPipelineLayout GetPipelineLayout() const { return _pipelineLayout; }
+        VkPipeline GetPipeline() const { return _pipeline; }
+
+    private:
+        static constexpr const char* _shaderPath = "Shaders/BuiltIn/IndirectCulling.slang";
+
+        VulkanGraphicsPlatform* _platform;
+        VkShaderModule _shaderModule;
+        VkDescriptorSetLayout _setLayout;
+        VkPipelineLayout _pipelineLayout;
+        VkPipeline _pipeline;
+    };
+} // Coco
+
+#endif //COCOENGINE_VULKANINDIRECTCULLINGPIPELINE_H
\ No newline at end of file
@@ -16,29 +16,47 @@
 
 namespace Coco
 {
-    VulkanPipeline::VulkanPipeline(uint64 key, VulkanGraphicsPlatform* platform, const VulkanShaderProgram& shaderProgram,
-        const RenderGraph& graph, const GraphicsPipelineState& pipelineState) :
-        _key(key),
-        _platform(platform),
-        _pipeline(nullptr),
-        _lastUsedFrameNumber(platform->GetCurrentFrameNumber())
+    VulkanPipelineAttachmentFormats::VulkanPipelineAttachmentFormats() :
+        ColorFormats(),
+        DepthStencilFormat(VK_FORMAT_UNDEFINED)
+    {}
+
+    VulkanPipelineAttachmentFormats VulkanPipelineAttachmentFormats::FromPassAttachments(Span<const RenderPassAttachmentInfo> attachments)
     {
-        auto attachments = graph.GetCurrentPassAttachments();
-        Array<VkFormat> colorFormats(nullptr, attachments.size());
-        VkFormat depthStencilFormat = VK_FORMAT_UNDEFINED;
+        VulkanPipelineAttachmentFormats formats;
 
         for (const auto& attachment : attachments)
         {
             const auto& imageDesc = attachment.AttachmentImage->GetDescription();
-            VkFormat& format = attachment.Type == ImageAttachmentType::Color ? colorFormats.EmplaceBack() : depthStencilFormat;
+            VkFormat& format = attachment.Type == ImageAttachmentType::Color ? formats.ColorFormats.EmplaceBack() : formats.DepthStencilFormat;
             format = VulkanUtils::ToVkFormat(imageDesc.PixelFormat, imageDesc.ColorSpace);
         }
 
+        return formats;
+    }
+
+    uint64 VulkanPipelineAttachmentFormats::GetHash() const
+    {
+        uint64 hash = static_cast<uint64>(DepthStencilFormat);
+
+        for (const auto& format : ColorFormats)
+            hash = Math::CombineHashes(hash, static_cast<uint64>(format));
+
+        return hash;
+    }
+
+    VulkanPipeline::VulkanPipeline(uint64 key, VulkanGraphicsPlatform* platform, const VulkanShaderProgram& shaderProgram,
+        const VulkanPipelineAttachmentFormats& attachmentFormats, const GraphicsPipelineState& pipelineState, const VertexFormat& vertexFormat) :
+        _key(key),
+        _platform(platform),
+        _pipeline(nullptr),
+        _lastUsedFrameNumber(platform->GetCurrentFrameNumber())
+    {
         VkPipelineRenderingCreateInfoKHR pipelineCreateInfo { VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO_KHR };
-        pipelineCreateInfo.pColorAttachmentFormats = colorFormats.Data();
-        pipelineCreateInfo.colorAttachmentCount = static_cast<uint32>(colorFormats.GetCount());
-        pipelineCreateInfo.depthAttachmentFormat = depthStencilFormat;
-        pipelineCreateInfo.stencilAttachmentFormat = depthStencilFormat;
+        pipelineCreateInfo.pColorAttachmentFormats = attachmentFormats.ColorFormats.Data();
+        pipelineCreateInfo.colorAttachmentCount = static_cast<uint32>(attachmentFormats.ColorFormats.GetCount());
+        pipelineCreateInfo.depthAttachmentFormat = attachmentFormats.DepthStencilFormat;
+        pipelineCreateInfo.stencilAttachmentFormat = attachmentFormats.DepthStencilFormat;
 
         // Dynamic state
         StackArray<VkDynamicState, 3> dynamicStates = {
@@ -87,14 +105,10 @@ namespace Coco
         depthStencilState.depthBoundsTestEnable = VK_FALSE;
         depthStencilState.stencilTestEnable = VK_FALSE; // TODO: stencils
 
-        // Attachment blend states
-        Array<VkPipelineColorBlendAttachmentState> colorBlendAttachments(nullptr, attachments.size());
-        for (const auto& attachment : attachments)
+        // Attachment blend states. Only color attachments are blended
+        Array<VkPipelineColorBlendAttachmentState> colorBlendAttachments(nullptr, attachmentFormats.ColorFormats.GetCount());
+        for (uint64 i = 0; i < attachmentFormats.ColorFormats.GetCount(); ++i)
         {
-            // Only blend color attachments
-            if (attachment.Type != ImageAttachmentType::Color)
-                continue;
-
             VkPipelineColorBlendAttachmentState& blendState = colorBlendAttachments.EmplaceBack();
             blendState.colorWriteMask = VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT | VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT;
 
@@ -129,7 +143,16 @@ namespace Coco
         graphicsPipelineCreateInfo.pStages = shaderStageInfos.Data();
         graphicsPipelineCreateInfo.stageCount = static_cast<uint32_t>(shaderStageInfos.GetCount());
 
-        VkPipelineVertexInputStateCreateInfo vertexInputState = shaderProgram.GetVertexInputStateCreateInfo();
+        // Vertex input state
+        StackArray<VkVertexInputBindingDescription, MaxVertexChannelCount> vertexBindings;
+        StackArray<VkVertexInputAttributeDescription, MaxVertexChannelCount> vertexAttributes;
+        shaderProgram.GetVertexInputDescriptions(vertexFormat, vertexBindings, vertexAttributes);
+
+        VkPipelineVertexInputStateCreateInfo vertexInputState{ VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO };
+        vertexInputState.pVertexBindingDescriptions = vertexBindings.Data();
+        vertexInputState.vertexBindingDescriptionCount = static_cast<uint32_t>(vertexBindings.GetCount());
+        vertexInputState.pVertexAttributeDescriptions = vertexAttributes.Data();
+        vertexInputState.vertexAttributeDescriptionCount = static_cast<uint32_t>(vertexAttributes.GetCount());
 
         graphicsPipelineCreateInfo.pVertexInputState = &vertexInputState;
         graphicsPipelineCreateInfo.pInputAssemblyState = &inputState;
@@ -151,7 +174,7 @@ namespace Coco
         AssertVkSuccess(
             vkCreateGraphicsPipelines(
                 _platform->GetDevice(),
-                nullptr,
+                _platform->GetVulkanCache()->GetPipelineCache().GetCache(),
                 1,
                 &graphicsPipelineCreateInfo,
                 _platform->GetAllocationCallbacks(),
@@ -174,10 +197,10 @@ namespace Coco
         COCO_ENGINE_LOG_VERBOSE("Destroyed VulkanPipeline %u", _key);
     }
 
-    uint64 VulkanPipeline::MakeKey(const VulkanShaderProgram& shaderProgram, const RenderGraph& graph,
-        const GraphicsPipelineState& pipelineState)
+    uint64 VulkanPipeline::MakeKey(const VulkanShaderProgram& shaderProgram, const VulkanPipelineAttachmentFormats& attachmentFormats,
+        const GraphicsPipelineState& pipelineState, const VertexFormat& vertexFormat)
     {
-        return Math::CombineHashes(shaderProgram.GetID(), graph.GetCurrentPassAttachmentHash(), ToHash(pipelineState));
+        return Math::CombineHashes(shaderProgram.GetID(), attachmentFormats.GetHash(), ToHash(pipelineState), vertexFormat.GetHash());
     }
 
     void VulkanPipeline::MarkUsed()
@@ -6,25 +6,47 @@
 #define COCOENGINE_VULKANPIPELINE_H
 
 #include "Coco/Core/Types/CoreTypes.h"
+#include "Coco/Core/Types/Span.h"
+#include "Coco/Core/Types/StackArray.h"
+#include "Coco/Rendering/Graphics/VertexDataTypes.h"
 #include "../VulkanForwardDeclarations.h"
+#include "../VulkanIncludes.h"
 
 namespace Coco
 {
     struct GraphicsPipelineState;
+    struct RenderPassAttachmentInfo;
     class VulkanGraphicsPlatform;
-    class RenderGraph;
     class VulkanShaderProgram;
 
+    /// @brief The formats of the attachments that a pipeline renders to
+    struct VulkanPipelineAttachmentFormats
+    {
+        StackArray<VkFormat, 16> ColorFormats;
+        VkFormat DepthStencilFormat;
+
+        VulkanPipelineAttachmentFormats();
+
+        /// @brief Gets the attachment formats of a render pass
+        /// @param attachments The attachments of the pass
+        /// @return The attachment formats
+        static VulkanPipelineAttachmentFormats FromPassAttachments(Span<const RenderPassAttachmentInfo> attachments);
+
+        /// @brief Gets a hash of these attachment formats
+        /// @return The hash
+        uint64 GetHash() const;
+    };
+
     class VulkanPipeline
     {
     public:
-        VulkanPipeline(uint64 key, VulkanGraphicsPlatform* platform, const VulkanShaderProgram& shaderProgram, const RenderGraph& graph, const GraphicsPipelineState& pipelineState);
+        VulkanPipeline(uint64 key, VulkanGraphicsPlatform* platform, const VulkanShaderProgram& shaderProgram, const VulkanPipelineAttachmentFormats& attachmentFormats, const GraphicsPipelineState& pipelineState, const VertexFormat& vertexFormat);
         ~VulkanPipeline();
 
         VulkanPipeline(const VulkanPipeline&) = delete;
         VulkanPipeline& operator=(const VulkanPipeline&) = delete;
 
-        static uint64 MakeKey(const VulkanShaderProgram& shaderProgram, const RenderGraph& graph, const GraphicsPipelineState& pipelineState);
+        static uint64 MakeKey(const VulkanShaderProgram& shaderProgram, const VulkanPipelineAttachmentFormats& attachmentFormats, const GraphicsPipelineState& pipelineState, const VertexFormat& vertexFormat);
 
         VkPipeline GetPipeline() const { return _pipeline; }
         void MarkUsed();
@@ -0,0 +1,117 @@
+//
+// Created by cullen on 10/18/26.
+//
+
+#include "VulkanSamplerCache.h"
+
+#include "../VulkanGraphicsPlatform.h"
+#include "../VulkanUtils.h"
+#include "Coco/Core/Engine.h"
+
+#include <bit>
+
+namespace Coco
+{
+    VulkanSamplerKey::VulkanSamplerKey(const VkSamplerCreateInfo& createInfo) :
+        MagFilter(createInfo.magFilter),
+        MinFilter(createInfo.minFilter),
+        MipmapMode(createInfo.mipmapMode),
+        AddressModeU(createInfo.addressModeU),
+        AddressModeV(createInfo.addressModeV),
+        AddressModeW(createInfo.addressModeW),
+        MipLodBias(createInfo.mipLodBias),
+        AnisotropyEnable(createInfo.anisotropyEnable),
+        MaxAnisotropy(createInfo.maxAnisotropy),
+        CompareEnable(createInfo.compareEnable),
+        CompareOp(createInfo.compareOp),
+        MinLod(createInfo.minLod),
+        MaxLod(createInfo.maxLod),
+        BorderColor(createInfo.borderColor),
+        UnnormalizedCoordinates(createInfo.unnormalizedCoordinates)
+    {}
+
+    VkSamplerCreateInfo VulkanSamplerKey::ToCreateInfo() const
+    {
+        VkSamplerCreateInfo createInfo{VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO};
+        createInfo.magFilter = MagFilter;
+        createInfo.minFilter = MinFilter;
+        createInfo.mipmapMode = MipmapMode;
+        createInfo.addressModeU = AddressModeU;
+        createInfo.addressModeV = AddressModeV;
+        createInfo.addressModeW = AddressModeW;
+        createInfo.mipLodBias = MipLodBias;
+        createInfo.anisotropyEnable = AnisotropyEnable;
+        createInfo.maxAnisotropy = MaxAnisotropy;
+        createInfo.compareEnable = CompareEnable;
+        createInfo.compareOp = CompareOp;
+        createInfo.minLod = MinLod;
+        createInfo.maxLod = MaxLod;
+        createInfo.borderColor = BorderColor;
+        createInfo.unnormalizedCoordinates = UnnormalizedCoordinates;
+
+        return createInfo;
+    }
+
+    uint64 ToHash(const VulkanSamplerKey& key)
+    {
+        return Math::CombineHashes(
+            static_cast<uint64>(key.MagFilter),
+            static_cast<uint64>(key.MinFilter),
+            static_cast<uint64>(key.MipmapMode),
+            static_cast<uint64>(key.AddressModeU),
+            static_cast<uint64>(key.AddressModeV),
+            static_cast<uint64>(key.AddressModeW),
+            static_cast<uint64>(std::bit_cast<uint32>(key.MipLodBias)),
+            static_cast<uint64>(key.AnisotropyEnable),
+            static_cast<uint64>(std::bit_cast<uint32>(key.MaxAnisotropy)),
+            static_cast<uint64>(key.CompareEnable),
+            static_cast<uint64>(key.CompareOp),
+            static_cast<uint64>(std::bit_cast<uint32>(key.MinLod)),
+            static_cast<uint64>(std::bit_cast<uint32>(key.MaxLod)),
+            static_cast<uint64>(key.BorderColor),
+            static_cast<uint64>(key.UnnormalizedCoordinates));
+    }
+
+    VulkanSamplerCache::VulkanSamplerCache(VulkanGraphicsPlatform* platform) :
+        _platform(platform),
+        _samplers()
+    {}
+
+    VulkanSamplerCache::~VulkanSamplerCache()
+    {
+        for (auto& [key, cached] : _samplers)
+            vkDestroySampler(_platform->GetDevice(), cached.Sampler, _platform->GetAllocationCallbacks());
+
+        _samplers.Clear();
+    }
+
+    VkSampler VulkanSamplerCache::Acquire(const VulkanSamplerKey& key)
+    {
+        if (CachedSampler* existing = _samplers.TryGetValue(key))
+        {
+            existing->UseCount++;
+            return existing->Sampler;
+        }
+
+        const VkSamplerCreateInfo createInfo = key.ToCreateInfo();
+        VkSampler sampler = nullptr;
+        AssertVkSuccess(vkCreateSampler(_platform->GetDevice(), &createInfo, _platform->GetAllocationCallbacks(), &sampler));
+
+        _samplers.Emplace(key, CachedSampler{sampler, 1});
+
+        COCO_ENGINE_LOG_VERBOSE("Created cached VkSampler (%u unique samplers)", _samplers.GetCount());
+        return sampler;
+    }
+
+    void VulkanSamplerCache::Release(const VulkanSamplerKey& key)
+    {
+        CachedSampler* existing = _samplers.TryGetValue(key);
+        COCO_ASSERT(existing, "Sampler was not acquired from this cache");
+
+        if (--existing->UseCount > 0)
+            return;
+
+        vkDestroySampler(_platform->GetDevice(), existing->Sampler, _platform->GetAllocationCallbacks());
+        _samplers.Remove(key);
+    }
+} // Coco
\ No newline at end of file
@@ -0,0 +1,91 @@
+//
+// Created by cullen on 10/18/26.
+//
+
+#ifndef COCOENGINE_VULKANSAMPLERCACHE_H
+#define COCOENGINE_VULKANSAMPLERCACHE_H
+#include "Coco/Core/Types/CoreTypes.h"
+#include "Coco/Core/Types/Map.h"
+#include "../VulkanIncludes.h"
+
+namespace Coco
+{
+    class VulkanGraphicsPlatform;
+
+    /// @brief The state of a sampler that determines if two samplers are interchangeable
+    struct VulkanSamplerKey
+    {
+        VkFilter MagFilter;
+        VkFilter MinFilter;
+        VkSamplerMipmapMode MipmapMode;
+        VkSamplerAddressMode AddressModeU;
+        VkSamplerAddressMode AddressModeV;
+        VkSamplerAddressMode AddressModeW;
+        float MipLodBias;
+        VkBool32 AnisotropyEnable;
+        float MaxAnisotropy;
+        VkBool32 CompareEnable;
+        VkCompareOp CompareOp;
+        float MinLod;
+        float MaxLod;
+        VkBorderColor BorderColor;
+        VkBool32 UnnormalizedCoordinates;
+
+        VulkanSamplerKey(const VkSamplerCreateInfo& createInfo);
+
+        bool operator==(const VulkanSamplerKey& other) const = default;
+
+        VkSamplerCreateInfo ToCreateInfo() const;
+    };
+
+    uint64 ToHash(const VulkanSamplerKey& key);
+} // Coco
+
+namespace std
+{
+    template<>
+    struct hash<Coco::VulkanSamplerKey>
+    {
+        size_t operator()(const Coco::VulkanSamplerKey& key) const noexcept
+        {
+            return Coco::ToHash(key);
+        }
+    };
+}
+
+namespace Coco
+{
+    /// @brief Deduplicates VkSamplers across the device. Samplers are reference counted and destroyed when no longer used
+    class VulkanSamplerCache
+    {
+    public:
+        VulkanSamplerCache(VulkanGraphicsPlatform* platform);
+        ~VulkanSamplerCache();
+
+        VulkanSamplerCache(const VulkanSamplerCache&) = delete;
+        VulkanSamplerCache& operator=(const VulkanSamplerCache&) = delete;
+
+        /// @brief Gets a sampler for the given state, creating it if one doesn't exist
+        /// @param key The sampler state
+        /// @return The sampler
+        VkSampler Acquire(const VulkanSamplerKey& key);
+
+        /// @brief Releases a sampler acquired with Acquire()
+        /// @param key The sampler state
+        void Release(const VulkanSamplerKey& key);
+
+        uint64 GetSamplerCount() const { return _samplers.GetCount(); }
+
+    private:
+        struct CachedSampler
+        {
+            VkSampler Sampler;
+            uint32 UseCount;
+        };
+
+        VulkanGraphicsPlatform* _platform;
+        Map<VulkanSamplerKey, CachedSampler> _samplers;
+    };
+} // Coco
+
+#endif //COCOENGINE_VULKANSAMPLERCACHE_H
\ No newline at end of file
@@ -43,30 +43,91 @@ namespace Coco
         return _bufferInfo.AllocInfo.pMappedData;
     }
 
+    void VulkanBuffer::InvalidateMappedRange(uint64 offset, uint64 size)
+    {
+        AssertVkSuccess(vmaInvalidateAllocation(_platform->GetVmaAllocator(), _bufferInfo.Memory, offset, size));
+    }
+
     void VulkanBuffer::Resize(uint64 newSize)
     {
         // TODO
     }
 
     void VulkanBuffer::CopyFrom(StagingOperation& stagingOperation)
+    {
+        BufferCopyRegion region(0, 0, stagingOperation.Size);
+        CopyFrom(stagingOperation, Span<const BufferCopyRegion>(&region, 1));
+    }
+
+    void VulkanBuffer::CopyFrom(StagingOperation& stagingOperation, Span<const BufferCopyRegion> regions)
     {
         VulkanStagingOperation& vkStagingOperation = static_cast<VulkanStagingOperation&>(stagingOperation);
 
-        VkBufferCopy copyRegion = {
-            .srcOffset = vkStagingOperation.BufferOffset,
-            .dstOffset = 0,
-            .size = vkStagingOperation.Size
-        };
+        Array<VkBufferCopy> copyRegions(nullptr, regions.size());
+        for (const BufferCopyRegion& region : regions)
+        {
+            copyRegions.Append(VkBufferCopy{
+                .srcOffset = vkStagingOperation.BufferOffset + region.SourceOffset,
+                .dstOffset = region.DestinationOffset,
+                .size = region.Size
+            });
+        }
 
         Ref<VulkanBuffer> stagingBuffer = vkStagingOperation.StagingBuffer.Downcast<VulkanBuffer>();
         vkCmdCopyBuffer(
             vkStagingOperation.CommandBuffer,
             stagingBuffer->GetBuffer(),
             _bufferInfo.Buffer,
-            1, &copyRegion);
+            static_cast<uint32>(copyRegions.GetCount()), copyRegions.Data());
 
         VulkanStagingBuffer* vkStagingBuffer = static_cast<VulkanStagingBuffer*>(_platform->GetStagingBuffer());
-        vkStagingBuffer->AddBufferMemoryBarrier(_bufferInfo.Buffer, 0, stagingOperation.Size);
+        for (const BufferCopyRegion& region : regions)
+            vkStagingBuffer->AddBufferMemoryBarrier(_bufferInfo.Buffer, region.DestinationOffset, region.Size);
+    }
+
+    void VulkanBuffer::CopyWithin(Span<const BufferCopyRegion> regions)
+    {
+        if (regions.empty())
+            return;
+
+        VulkanStagingBuffer* vkStagingBuffer = static_cast<VulkanStagingBuffer*>(_platform->GetStagingBuffer());
+        VkCommandBuffer commandBuffer = vkStagingBuffer->AcquireTransferCommandBuffer();
+
+        // The source regions may have been written by earlier transfers
+        VkMemoryBarrier2 memoryBarrier = {
+            VK_STRUCTURE_TYPE_MEMORY_BARRIER_2,
+            nullptr,
+            VK_PIPELINE_STAGE_2_TRANSFER_BIT,
+            VK_ACCESS_2_TRANSFER_WRITE_BIT,
+            VK_PIPELINE_STAGE_2_TRANSFER_BIT,
+            VK_ACCESS_2_TRANSFER_READ_BIT | VK_ACCESS_2_TRANSFER_WRITE_BIT
+        };
+
+        VkDependencyInfo dependencyInfo = {
+            VK_STRUCTURE_TYPE_DEPENDENCY_INFO,
+            nullptr,
+            0,
+            1, &memoryBarrier,
+            0, nullptr,
+            0, nullptr
+        };
+
+        vkCmdPipelineBarrier2(commandBuffer, &dependencyInfo);
+
+        Array<VkBufferCopy> copyRegions(nullptr, regions.size());
+        for (const BufferCopyRegion& region : regions)
+        {
+            copyRegions.Append(VkBufferCopy{
+                .srcOffset = region.SourceOffset,
+                .dstOffset = region.DestinationOffset,
+                .size = region.Size
+            });
+        }
+
+        vkCmdCopyBuffer(commandBuffer, _bufferInfo.Buffer, _bufferInfo.Buffer, static_cast<uint32>(copyRegions.GetCount()), copyRegions.Data());
+
+        for (const BufferCopyRegion& region : regions)
+            vkStagingBuffer->AddBufferMemoryBarrier(_bufferInfo.Buffer, region.DestinationOffset, region.Size);
     }
 
     void VulkanBuffer::CreateBuffer(const BufferDescription& description, VulkanBufferInfo& outBufferInfo)
@@ -83,6 +144,10 @@ namespace Coco
         if ((description.UsageFlags & BufferUsageFlags::HostVisible) == BufferUsageFlags::HostVisible)
             allocCreateInfo.flags |= VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT | VMA_ALLOCATION_CREATE_MAPPED_BIT;
 
+        // Readback buffers are read by the CPU, so they need memory that is cached on the host
+        if ((description.UsageFlags & BufferUsageFlags::HostReadable) == BufferUsageFlags::HostReadable)
+            allocCreateInfo.flags |= VMA_ALLOCATION_CREATE_HOST_ACCESS_RANDOM_BIT | VMA_ALLOCATION_CREATE_MAPPED_BIT;
+
         AssertVkSuccess(
             vmaCreateBuffer(
                 _platform->GetVmaAllocator(),
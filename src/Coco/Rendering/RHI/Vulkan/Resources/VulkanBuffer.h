@@ -39,9 +39,16 @@ namespace Coco
         void* GetMappedPtr() override;
         void Resize(uint64 newSize) override;
         void CopyFrom(StagingOperation& stagingOperation) override;
+        void CopyFrom(StagingOperation& stagingOperation, Span<const BufferCopyRegion> regions) override;
+        void CopyWithin(Span<const BufferCopyRegion> regions) override;
 
         VkBuffer GetBuffer() const { return _bufferInfo.Buffer; }
 
+        /// @brief Makes device writes to a range of this buffer visible through the mapped pointer. Needed before reading a host readable buffer
+        /// @param offset The offset of the range
+        /// @param size The size of the range
+        void InvalidateMappedRange(uint64 offset, uint64 size);
+
     private:
         VulkanGraphicsPlatform* _platform;
         BufferDescription _description;
@@ -123,34 +123,56 @@ namespace Coco
         return _swapchainResources[_acquiredSwapchainImageIndex].RenderingCompleteSemaphore;
     }
 
-    void VulkanGraphicsSurface::Present()
+    void VulkanGraphicsSurface::Present(VulkanGraphicsPlatform* platform, Span<const Ref<VulkanGraphicsSurface>> surfaces)
     {
-        VulkanQueue* presentQueue = _platform->GetPresentQueue(_surface);
+        if (surfaces.empty())
+            return;
+
+        // The platform picks one present queue for every surface, so the first surface's queue is used for all of them
+        VulkanQueue* presentQueue = platform->GetPresentQueue(surfaces.front()->_surface);
         if (!presentQueue)
         {
             COCO_ENGINE_LOG_ERROR("Device does not support presentation");
             return;
         }
 
-        VkSemaphore vulkanSemaphore = _swapchainResources[_acquiredSwapchainImageIndex].RenderingCompleteSemaphore->GetSemaphore();
+        const uint64 surfaceCount = surfaces.size();
+        Array<VkSemaphore> waitSemaphores(nullptr, surfaceCount);
+        Array<VkSwapchainKHR> swapchains(nullptr, surfaceCount);
+        Array<uint32> imageIndices(nullptr, surfaceCount);
+        Array<VkResult> results(surfaceCount, VK_SUCCESS);
+
+        for (const Ref<VulkanGraphicsSurface>& surface : surfaces)
+        {
+            waitSemaphores.Append(surface->_swapchainResources[surface->_acquiredSwapchainImageIndex].RenderingCompleteSemaphore->GetSemaphore());
+            swapchains.Append(surface->_swapchain);
+            imageIndices.Append(surface->_acquiredSwapchainImageIndex);
+        }
 
         VkPresentInfoKHR presentInfo{ VK_STRUCTURE_TYPE_PRESENT_INFO_KHR };
-        presentInfo.pWaitSemaphores = &vulkanSemaphore;
-        presentInfo.waitSemaphoreCount = 1;
-        presentInfo.pSwapchains = &_swapchain;
-        presentInfo.swapchainCount = 1;
-        presentInfo.pImageIndices = &_acquiredSwapchainImageIndex;
+        presentInfo.pWaitSemaphores = waitSemaphores.Data();
+        presentInfo.waitSemaphoreCount = static_cast<uint32>(waitSemaphores.GetCount());
+        presentInfo.pSwapchains = swapchains.Data();
+        presentInfo.swapchainCount = static_cast<uint32>(swapchains.GetCount());
+        presentInfo.pImageIndices = imageIndices.Data();
+        presentInfo.pResults = results.Data();
 
-        VkResult result = vkQueuePresentKHR(presentQueue->GetQueue(), &presentInfo);
+        vkQueuePresentKHR(presentQueue->GetQueue(), &presentInfo);
 
-        if (result == VK_ERROR_OUT_OF_DATE_KHR || result == VK_SUBOPTIMAL_KHR)
+        // Each swapchain reports its own result, so only the surfaces that need it are rebuilt
+        for (uint64 i = 0; i < surfaceCount; i++)
         {
-            COCO_ENGINE_LOG_VERBOSE("Swapchain is not ideal: %u. Marking dirty...", result);
-            MarkDirty();
-        }
-        else if (result != VK_SUCCESS)
-        {
-            COCO_ENGINE_LOG_ERROR("Failed to queue the image for presentation: %u", result);
+            VkResult result = results[i];
+
+            if (result == VK_ERROR_OUT_OF_DATE_KHR || result == VK_SUBOPTIMAL_KHR)
+            {
+                COCO_ENGINE_LOG_VERBOSE("Swapchain is not ideal: %u. Marking dirty...", result);
+                surfaces[i]->MarkDirty();
+            }
+            else if (result != VK_SUCCESS)
+            {
+                COCO_ENGINE_LOG_ERROR("Failed to queue the image for presentation: %u", result);
+            }
         }
     }
 
@@ -40,7 +40,11 @@ namespace Coco
 
         bool AcquireImage(Ref<VulkanGraphicsSemaphore> imageAcquiredSemaphore, Ref<VulkanImage>& outImage);
         Ref<VulkanGraphicsSemaphore> GetRenderingCompleteSemaphore();
-        void Present();
+
+        /// @brief Presents the acquired images of multiple surfaces with a single present call
+        /// @param platform The platform
+        /// @param surfaces The surfaces to present
+        static void Present(VulkanGraphicsPlatform* platform, Span<const Ref<VulkanGraphicsSurface>> surfaces);
 
     private:
         VulkanGraphicsPlatform* _platform;
@@ -5,6 +5,8 @@
 #include "../VulkanGraphicsPlatform.h"
 #include "Coco/Core/Engine.h"
 #include "VulkanImage.h"
+#include "VulkanTransientMemory.h"
+#include "../VulkanBarrierBatch.h"
 #include "../VulkanUtils.h"
 #include "../VulkanStagingBuffer.h"
 #include "Coco/Rendering/RHI/Vulkan/VulkanQueue.h"
@@ -17,13 +19,15 @@ namespace Coco
         DepthView(nullptr),
         Memory(nullptr),
         AllocInfo(),
-        CurrentLayout(VK_IMAGE_LAYOUT_UNDEFINED)
+        CurrentLayout(VK_IMAGE_LAYOUT_UNDEFINED),
+        IsAliased(false)
     {}
 
     VulkanImage::VulkanImage(uint64 id, VulkanGraphicsPlatform* platform, const ImageDescription& description) :
         Image(id, description),
         _platform(platform),
-        _imageInfo()
+        _imageInfo(),
+        _transientMemory()
 		//_lastOperationQueue(platform->GetQueue(VulkanQueue::Type::Graphics))
     {
     	CreateImage(description, _imageInfo);
@@ -34,7 +38,8 @@ namespace Coco
         VkImage image) :
 		Image(id, description),
         _platform(platform),
-		_imageInfo()
+		_imageInfo(),
+		_transientMemory()
 		//_lastOperationQueue(platform->GetQueue(VulkanQueue::Type::Graphics))
     {
         _imageInfo.Image = image;
@@ -44,6 +49,19 @@ namespace Coco
     	COCO_ENGINE_LOG_VERBOSE("Created VulkanImage %u from existing image", id);
     }
 
+    VulkanImage::VulkanImage(uint64 id, VulkanGraphicsPlatform* platform, const ImageDescription& description,
+        Ref<VulkanTransientMemory> memory) :
+		Image(id, description),
+		_platform(platform),
+		_imageInfo(),
+		_transientMemory(memory)
+    {
+    	CreateAliasedImage(description, *memory, _imageInfo);
+    	CreateNativeView(description, _imageInfo);
+
+    	COCO_ENGINE_LOG_VERBOSE("Created VulkanImage %u aliasing VulkanTransientMemory %u", id, memory->GetID());
+    }
+
     VulkanImage::~VulkanImage()
     {
         DestroyImage(_imageInfo);
@@ -53,19 +71,44 @@ namespace Coco
 
     void VulkanImage::SetPixels(const void* pixelData, uint64 pixelDataSize)
     {
-		uint64 dataSize = Math::Min(GetPixelDataSize(), pixelDataSize);
+		// Pixel data that holds every mip level is copied as-is instead of generating the mip maps
+    	const uint64 mipChainSize = GetMipChainDataSize();
+    	const bool mipsUploaded = _description.MipCount > 1 && pixelDataSize >= mipChainSize;
+		uint64 dataSize = mipsUploaded ? mipChainSize : Math::Min(GetPixelDataSize(), pixelDataSize);
 
     	VulkanStagingBuffer* stagingBuffer = static_cast<VulkanStagingBuffer*>(_platform->GetStagingBuffer());
 		VulkanStagingOperation* stagingOperation = static_cast<VulkanStagingOperation*>(stagingBuffer->CreateStagingOperation(dataSize));
     	memcpy(stagingOperation->BufferPtr, pixelData, dataSize);
 
-    	TransitionLayout(stagingOperation->CommandBuffer, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+    	VulkanBuffer* buffer = static_cast<VulkanBuffer*>(stagingOperation->StagingBuffer.Get());
+    	const uint32 mipCount = mipsUploaded ? _description.MipCount : 1;
+    	uint64 mipOffset = stagingOperation->BufferOffset;
 
-    	VkImageSubresourceRange subresourceRange = {
-    		VulkanUtils::ToVkImageAspectFlags(_description.AttachmentType),
-    		0, 1,
-    		0, 1
-    	};
+    	for (uint32 mip = 0; mip < mipCount; mip++)
+    	{
+    		CopyFromStaging(stagingOperation->CommandBuffer, buffer->GetBuffer(), mipOffset, mip, 0, GetCopyRowCount(mip));
+    		mipOffset += GetMipDataSize(mip);
+    	}
+
+    	FinishUpload(stagingOperation->CommandBuffer, stagingBuffer->GetCurrentGraphicsCommandBuffer(),
+    		*stagingBuffer->GetQueue(), *_platform->GetQueue(VulkanQueue::Type::Graphics), mipsUploaded);
+    }
+
+    void VulkanImage::SetPixelRegion(uint32 x, uint32 y, uint32 width, uint32 height, const void* pixelData, uint64 pixelDataSize)
+    {
+    	COCO_ASSERT(!ImageDescription::IsCompressed(_description.PixelFormat), "Regions of compressed images can't be set");
+    	COCO_ASSERT(x + width <= _description.Width && y + height <= _description.Height, "Region was outside of image %u", GetID());
+
+    	const uint64 dataSize = Math::Min(ImageDescription::GetDataSize(_description.PixelFormat, width, height), pixelDataSize);
+
+    	VulkanStagingBuffer* stagingBuffer = static_cast<VulkanStagingBuffer*>(_platform->GetStagingBuffer());
+    	VulkanStagingOperation* stagingOperation = static_cast<VulkanStagingOperation*>(stagingBuffer->CreateStagingOperation(dataSize));
+    	memcpy(stagingOperation->BufferPtr, pixelData, dataSize);
+
+    	VulkanBuffer* buffer = static_cast<VulkanBuffer*>(stagingOperation->StagingBuffer.Get());
+
+    	// The rest of the image is kept, so it is transitioned without discarding its contents
+    	TransitionLayout(stagingOperation->CommandBuffer, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
 
     	VkBufferImageCopy region{};
     	region.bufferOffset = stagingOperation->BufferOffset;
@@ -77,93 +120,189 @@ namespace Coco
     	region.imageSubresource.baseArrayLayer = 0;
     	region.imageSubresource.layerCount = 1;
 
+    	region.imageOffset.x = static_cast<int32>(x);
+    	region.imageOffset.y = static_cast<int32>(y);
+    	region.imageExtent.width = width;
+    	region.imageExtent.height = height;
+    	region.imageExtent.depth = 1;
+
+    	vkCmdCopyBufferToImage(stagingOperation->CommandBuffer, buffer->GetBuffer(), _imageInfo.Image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
+
+    	FinishUpload(stagingOperation->CommandBuffer, stagingBuffer->GetCurrentGraphicsCommandBuffer(),
+    		*stagingBuffer->GetQueue(), *_platform->GetQueue(VulkanQueue::Type::Graphics));
+    }
+
+    void VulkanImage::CopyFromStaging(VkCommandBuffer transferCommandBuffer, VkBuffer stagingBuffer, uint64 stagingOffset, uint32 mipLevel, uint32 firstRow, uint32 rowCount)
+    {
+    	TransitionLayout(transferCommandBuffer, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+
+    	// Compressed images are copied in rows of 4x4 blocks, where the last row may extend past the edge of the image
+    	const uint32 rowHeight = ImageDescription::IsCompressed(_description.PixelFormat) ? 4 : 1;
+    	const uint32 mipHeight = ImageDescription::GetMipSize(_description.Height, mipLevel);
+    	const uint32 firstPixelRow = firstRow * rowHeight;
+
+    	VkBufferImageCopy region{};
+    	region.bufferOffset = stagingOffset;
+    	region.bufferRowLength = 0;
+    	region.bufferImageHeight = 0;
+
+    	region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+    	region.imageSubresource.mipLevel = mipLevel;
+    	region.imageSubresource.baseArrayLayer = 0;
+    	region.imageSubresource.layerCount = 1;
+
+    	region.imageOffset.y = static_cast<int32>(firstPixelRow);
+    	region.imageExtent.width = ImageDescription::GetMipSize(_description.Width, mipLevel);
+    	region.imageExtent.height = Math::Min(rowCount * rowHeight, mipHeight - firstPixelRow);
+    	region.imageExtent.depth = ImageDescription::GetMipSize(_description.Depth, mipLevel);
+
+    	vkCmdCopyBufferToImage(transferCommandBuffer, stagingBuffer, _imageInfo.Image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
+    }
+
+    uint32 VulkanImage::GetCopyRowCount(uint32 mipLevel) const
+    {
+    	const uint32 mipHeight = ImageDescription::GetMipSize(_description.Height, mipLevel);
+
+    	if (ImageDescription::IsCompressed(_description.PixelFormat))
+    		return (mipHeight + 3) / 4;
+
+    	return mipHeight;
+    }
+
+    void VulkanImage::CopyToBuffer(VkCommandBuffer commandBuffer, VkBuffer buffer, uint64 bufferOffset)
+    {
+    	TransitionLayout(commandBuffer, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL);
+
+    	VkBufferImageCopy region{};
+    	region.bufferOffset = bufferOffset;
+    	region.bufferRowLength = 0;
+    	region.bufferImageHeight = 0;
+
+    	region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+    	region.imageSubresource.mipLevel = 0;
+    	region.imageSubresource.baseArrayLayer = 0;
+    	region.imageSubresource.layerCount = 1;
+
     	region.imageExtent.width = _description.Width;
     	region.imageExtent.height = _description.Height;
     	region.imageExtent.depth = _description.Depth;
 
-    	VulkanBuffer* buffer = static_cast<VulkanBuffer*>(stagingOperation->StagingBuffer.Get());
-    	vkCmdCopyBufferToImage(stagingOperation->CommandBuffer, buffer->GetBuffer(), _imageInfo.Image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
+    	vkCmdCopyImageToBuffer(commandBuffer, _imageInfo.Image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, buffer, 1, &region);
+    }
 
-		if (_description.MipCount > 1)
+    void VulkanImage::FinishUpload(VkCommandBuffer transferCommandBuffer, VkCommandBuffer graphicsCommandBuffer,
+    	const VulkanQueue& transferQueue, const VulkanQueue& graphicsQueue, bool mipsUploaded)
+    {
+    	VkImageSubresourceRange subresourceRange = {
+    		VulkanUtils::ToVkImageAspectFlags(_description.AttachmentType),
+    		0, mipsUploaded ? static_cast<uint32>(_description.MipCount) : 1,
+    		0, 1
+    	};
+
+		if (_description.MipCount > 1 && !mipsUploaded)
 		{
-    		stagingBuffer->AddImageLayoutTransitionBarrier(_imageInfo.Image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, subresourceRange);
-			GenerateMipMaps(stagingBuffer->GetCurrentGraphicsCommandBuffer());
+    		VulkanStagingBuffer::RecordImageLayoutTransitionBarrier(transferCommandBuffer, graphicsCommandBuffer, transferQueue, graphicsQueue,
+    			_imageInfo.Image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, subresourceRange);
+			GenerateMipMaps(graphicsCommandBuffer);
 		}
     	else
     	{
-    		stagingBuffer->AddImageLayoutTransitionBarrier(_imageInfo.Image, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, subresourceRange);
+    		VulkanStagingBuffer::RecordImageLayoutTransitionBarrier(transferCommandBuffer, graphicsCommandBuffer, transferQueue, graphicsQueue,
+    			_imageInfo.Image, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, subresourceRange);
     		_imageInfo.CurrentLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
     	}
     }
 
     void VulkanImage::TransitionLayout(VkCommandBuffer commandBuffer, VkImageLayout newLayout)
     {
-    	if (_imageInfo.CurrentLayout == newLayout || newLayout == VK_IMAGE_LAYOUT_UNDEFINED)
-    		return;
+    	VulkanBarrierBatch batch;
+    	batch.AddImageTransition(*this, newLayout);
+    	batch.Record(commandBuffer);
+    }
 
-    	VkImageSubresourceRange subresourceRange = {
-    		VulkanUtils::ToVkImageAspectFlags(_description.AttachmentType),
-			0, _description.MipCount,
-			0, _description.Layers
-		};
+    void VulkanImage::DiscardContents(VkCommandBuffer commandBuffer, VkImageLayout newLayout)
+    {
+    	VulkanBarrierBatch batch;
+    	batch.AddImageTransition(*this, newLayout, true);
+    	batch.Record(commandBuffer);
+    }
+
+    bool VulkanImage::CreateLayoutBarrier(VkImageLayout newLayout, bool discardContents, VkImageMemoryBarrier2& outBarrier)
+    {
+    	if (newLayout == VK_IMAGE_LAYOUT_UNDEFINED || (!discardContents && _imageInfo.CurrentLayout == newLayout))
+    		return false;
 
     	VkPipelineStageFlags2 sourceStage;
-    	VkAccessFlagBits2 srcAccessMask;
+    	VkAccessFlags2 srcAccessMask;
     	VkPipelineStageFlags2 destinationStage;
-    	VkAccessFlagBits2 dstAccessMask;
+    	VkAccessFlags2 dstAccessMask;
 
-    	switch (_imageInfo.CurrentLayout)
-		{
-		case VK_IMAGE_LAYOUT_UNDEFINED:
-		case VK_IMAGE_LAYOUT_GENERAL:
-		{
-			srcAccessMask = 0;
-			sourceStage = VK_PIPELINE_STAGE_2_BOTTOM_OF_PIPE_BIT;
-			break;
-		}
-		case VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL:
-		{
-			srcAccessMask = VK_ACCESS_2_TRANSFER_WRITE_BIT;
-			sourceStage = VK_PIPELINE_STAGE_2_TRANSFER_BIT;
-			break;
-		}
-		case VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL:
-		{
-			srcAccessMask = VK_ACCESS_2_TRANSFER_READ_BIT;
-			sourceStage = VK_PIPELINE_STAGE_2_TRANSFER_BIT;
-			break;
-		}
-		case VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL:
-		case VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL:
-		{
-			srcAccessMask = VK_ACCESS_2_SHADER_READ_BIT;
-			sourceStage = VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT;
-			break;
-		}
-		case VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL:
-		{
-			srcAccessMask = VK_ACCESS_2_COLOR_ATTACHMENT_WRITE_BIT;
-			sourceStage = VK_PIPELINE_STAGE_2_COLOR_ATTACHMENT_OUTPUT_BIT;
-			break;
-		}
-		case VK_IMAGE_LAYOUT_DEPTH_ATTACHMENT_OPTIMAL:
-		case VK_IMAGE_LAYOUT_STENCIL_ATTACHMENT_OPTIMAL:
-		case VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL:
-		{
-			srcAccessMask = VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
-			sourceStage = VK_PIPELINE_STAGE_2_LATE_FRAGMENT_TESTS_BIT;
-			break;
-		}
-		case VK_IMAGE_LAYOUT_PRESENT_SRC_KHR:
-		{
-			srcAccessMask = 0;
-			sourceStage = VK_PIPELINE_STAGE_2_BOTTOM_OF_PIPE_BIT;
-			break;
-		}
-		default:
-			COCO_ENGINE_LOG_ERROR("Transitioning from %u is unsupported", _imageInfo.CurrentLayout);
-			return;
-		}
+    	const VkImageLayout oldLayout = discardContents ? VK_IMAGE_LAYOUT_UNDEFINED : _imageInfo.CurrentLayout;
+
+    	if (discardContents)
+    	{
+    		// Aliased memory may have been written or read by another image, so wait for any attachment or shader access to it
+    		srcAccessMask = VK_ACCESS_2_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+    		sourceStage = VK_PIPELINE_STAGE_2_COLOR_ATTACHMENT_OUTPUT_BIT |
+    			VK_PIPELINE_STAGE_2_LATE_FRAGMENT_TESTS_BIT |
+    			VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT;
+    	}
+    	else
+    	{
+    		// Only writes need to be made available, so read-only layouts just wait for their stage to finish
+    		switch (oldLayout)
+    		{
+    		case VK_IMAGE_LAYOUT_UNDEFINED:
+    		case VK_IMAGE_LAYOUT_GENERAL:
+    		{
+    			srcAccessMask = 0;
+    			sourceStage = VK_PIPELINE_STAGE_2_BOTTOM_OF_PIPE_BIT;
+    			break;
+    		}
+    		case VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL:
+    		{
+    			srcAccessMask = VK_ACCESS_2_TRANSFER_WRITE_BIT;
+    			sourceStage = VK_PIPELINE_STAGE_2_TRANSFER_BIT;
+    			break;
+    		}
+    		case VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL:
+    		{
+    			srcAccessMask = 0;
+    			sourceStage = VK_PIPELINE_STAGE_2_TRANSFER_BIT;
+    			break;
+    		}
+    		case VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL:
+    		case VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL:
+    		{
+    			srcAccessMask = 0;
+    			sourceStage = VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT;
+    			break;
+    		}
+    		case VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL:
+    		{
+    			srcAccessMask = VK_ACCESS_2_COLOR_ATTACHMENT_WRITE_BIT;
+    			sourceStage = VK_PIPELINE_STAGE_2_COLOR_ATTACHMENT_OUTPUT_BIT;
+    			break;
+    		}
+    		case VK_IMAGE_LAYOUT_DEPTH_ATTACHMENT_OPTIMAL:
+    		case VK_IMAGE_LAYOUT_STENCIL_ATTACHMENT_OPTIMAL:
+    		case VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL:
+    		{
+    			srcAccessMask = VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+    			sourceStage = VK_PIPELINE_STAGE_2_LATE_FRAGMENT_TESTS_BIT;
+    			break;
+    		}
+    		case VK_IMAGE_LAYOUT_PRESENT_SRC_KHR:
+    		{
+    			srcAccessMask = 0;
+    			sourceStage = VK_PIPELINE_STAGE_2_BOTTOM_OF_PIPE_BIT;
+    			break;
+    		}
+    		default:
+    			COCO_ENGINE_LOG_ERROR("Transitioning from %u is unsupported", oldLayout);
+    			return false;
+    		}
+    	}
 
 		switch (newLayout)
 		{
@@ -183,7 +322,7 @@ namespace Coco
 		case VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL:
 		{
 			dstAccessMask = VK_ACCESS_2_SHADER_READ_BIT;
-			destinationStage = VK_PIPELINE_STAGE_2_VERTEX_SHADER_BIT;
+			destinationStage = VK_PIPELINE_STAGE_2_VERTEX_SHADER_BIT | VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT;
 			break;
 		}
 		case VK_IMAGE_LAYOUT_PRESENT_SRC_KHR:
@@ -203,7 +342,7 @@ namespace Coco
 		case VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL:
 		{
 			dstAccessMask = VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_READ_BIT | VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
-			destinationStage = VK_PIPELINE_STAGE_2_LATE_FRAGMENT_TESTS_BIT;
+			destinationStage = VK_PIPELINE_STAGE_2_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_2_LATE_FRAGMENT_TESTS_BIT;
 			break;
 		}
 		case VK_IMAGE_LAYOUT_GENERAL:
@@ -214,34 +353,29 @@ namespace Coco
 		}
 		default:
 			COCO_ENGINE_LOG_ERROR("Transitioning to %u is not supported", newLayout);
-			return;
+			return false;
 		}
 
-    	VkImageMemoryBarrier2 memoryBarrier = {
+    	outBarrier = {
     		VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2,
 			nullptr,
 			sourceStage, srcAccessMask,
 			destinationStage, dstAccessMask,
-			_imageInfo.CurrentLayout, newLayout,
+			oldLayout, newLayout,
 			VK_QUEUE_FAMILY_IGNORED, VK_QUEUE_FAMILY_IGNORED,
 			_imageInfo.Image,
-			subresourceRange
+			{
+				VulkanUtils::ToVkImageAspectFlags(_description.AttachmentType),
+				0, _description.MipCount,
+				0, _description.Layers
+			}
 		};
 
-    	VkDependencyInfo dependencyInfo = {
-    		VK_STRUCTURE_TYPE_DEPENDENCY_INFO,
-			nullptr,
-			0,
-			0, nullptr,
-			0, nullptr,
-			1, &memoryBarrier,
-		};
-
-    	vkCmdPipelineBarrier2(commandBuffer, &dependencyInfo);
     	_imageInfo.CurrentLayout = newLayout;
+    	return true;
     }
 
-    void VulkanImage::CreateImage(const ImageDescription& description, VulkanImageInfo& outImageInfo)
+    VkImageCreateInfo VulkanImage::GetImageCreateInfo(const ImageDescription& description)
     {
     	ImageUsageFlags usageFlags = description.UsageFlags | ImageUsageFlags::TransferSource | ImageUsageFlags::TransferDestination;
     	bool hostVisible = (usageFlags & ImageUsageFlags::HostVisible) == ImageUsageFlags::HostVisible;
@@ -260,6 +394,14 @@ namespace Coco
     	create.samples = VulkanUtils::ToVkSampleFlags(description.SampleCount);
     	create.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
 
+    	return create;
+    }
+
+    void VulkanImage::CreateImage(const ImageDescription& description, VulkanImageInfo& outImageInfo)
+    {
+    	bool hostVisible = (description.UsageFlags & ImageUsageFlags::HostVisible) == ImageUsageFlags::HostVisible;
+    	VkImageCreateInfo create = GetImageCreateInfo(description);
+
     	VmaAllocationCreateInfo allocCreateInfo{};
     	allocCreateInfo.usage = VMA_MEMORY_USAGE_AUTO;
     	allocCreateInfo.flags = 0;
@@ -279,6 +421,22 @@ namespace Coco
 		);
     }
 
+    void VulkanImage::CreateAliasedImage(const ImageDescription& description, const VulkanTransientMemory& memory, VulkanImageInfo& outImageInfo)
+    {
+    	VkImageCreateInfo create = GetImageCreateInfo(description);
+
+    	AssertVkSuccess(
+			vmaCreateAliasingImage(
+				_platform->GetVmaAllocator(),
+				memory.GetAllocation(),
+				&create,
+				&outImageInfo.Image
+			)
+		);
+
+    	outImageInfo.IsAliased = true;
+    }
+
     void VulkanImage::CreateNativeView(const ImageDescription& description, VulkanImageInfo& outImageInfo)
     {
         VkImageViewCreateInfo createInfo{ VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO };
@@ -418,7 +576,14 @@ namespace Coco
             imageInfo.DepthView = nullptr;
         }
 
-        if (imageInfo.Image && imageInfo.Memory)
+        if (imageInfo.Image && imageInfo.IsAliased)
+        {
+            // The memory belongs to the transient memory block, so only the image is destroyed
+            vkDestroyImage(_platform->GetDevice(), imageInfo.Image, _platform->GetAllocationCallbacks());
+            imageInfo.Image = nullptr;
+            imageInfo.IsAliased = false;
+        }
+        else if (imageInfo.Image && imageInfo.Memory)
         {
             vmaDestroyImage(_platform->GetVmaAllocator(), imageInfo.Image, imageInfo.Memory);
             imageInfo.Image = nullptr;
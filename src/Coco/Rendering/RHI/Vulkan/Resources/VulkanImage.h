@@ -11,6 +11,8 @@
 namespace Coco
 {
     class VulkanGraphicsPlatform;
+    class VulkanQueue;
+    class VulkanTransientMemory;
 
     /// @brief Data for a Vulkan image
     struct VulkanImageInfo
@@ -32,6 +34,9 @@ namespace Coco
         /// @brief The current layout of the image
         VkImageLayout CurrentLayout;
 
+        /// @brief If true, the image is bound to transient memory that it doesn't own
+        bool IsAliased;
+
         VulkanImageInfo();
     };
 
@@ -40,22 +45,75 @@ namespace Coco
     public:
         VulkanImage(uint64 id, VulkanGraphicsPlatform* platform, const ImageDescription& description);
         VulkanImage(uint64 id, VulkanGraphicsPlatform* platform, const ImageDescription& description, VkImage image);
+        VulkanImage(uint64 id, VulkanGraphicsPlatform* platform, const ImageDescription& description, Ref<VulkanTransientMemory> memory);
         ~VulkanImage();
 
         void SetPixels(const void* pixelData, uint64 pixelDataSize) override;
+        void SetPixelRegion(uint32 x, uint32 y, uint32 width, uint32 height, const void* pixelData, uint64 pixelDataSize) override;
 
         //void TransitionLayout(VkCommandBuffer commandBuffer, VkImageLayout newLayout, VulkanQueue& targetQueue);
         void TransitionLayout(VkCommandBuffer commandBuffer, VkImageLayout newLayout);
 
+        /// @brief Transitions this image to a new layout without preserving its contents.
+        /// Used the first time an aliased image is written to in a frame, as its memory may still hold another image's contents
+        /// @param commandBuffer The command buffer to record to
+        /// @param newLayout The layout to transition to
+        void DiscardContents(VkCommandBuffer commandBuffer, VkImageLayout newLayout);
+
+        /// @brief Creates the barrier that transitions this image to a new layout, and tracks the image as being in that layout.
+        /// Used by VulkanBarrierBatch to record the transitions of several images at once
+        /// @param newLayout The layout to transition to
+        /// @param discardContents If true, the previous contents of the image are discarded
+        /// @param outBarrier Will be set to the barrier
+        /// @return True if a barrier is needed
+        bool CreateLayoutBarrier(VkImageLayout newLayout, bool discardContents, VkImageMemoryBarrier2& outBarrier);
+
+        /// @brief Records a copy of rows of a mip level from a staging buffer.
+        /// Rows of compressed images are rows of 4x4 blocks
+        /// @param transferCommandBuffer The transfer command buffer to record to
+        /// @param stagingBuffer The buffer holding the pixel data
+        /// @param stagingOffset The offset of the first row in the staging buffer
+        /// @param mipLevel The mip level to copy to
+        /// @param firstRow The first row to copy
+        /// @param rowCount The number of rows to copy
+        void CopyFromStaging(VkCommandBuffer transferCommandBuffer, VkBuffer stagingBuffer, uint64 stagingOffset, uint32 mipLevel, uint32 firstRow, uint32 rowCount);
+
+        /// @brief Gets the number of rows that a mip level is copied in
+        /// @param mipLevel The mip level
+        /// @return The number of rows of pixels, or rows of blocks for compressed images
+        uint32 GetCopyRowCount(uint32 mipLevel) const;
+
+        /// @brief Records a copy of the first mip level to a buffer, with tightly packed rows
+        /// @param commandBuffer The command buffer to record to
+        /// @param buffer The buffer to copy to
+        /// @param bufferOffset The offset in the buffer to copy the first row to
+        void CopyToBuffer(VkCommandBuffer commandBuffer, VkBuffer buffer, uint64 bufferOffset);
+
+        /// @brief Records the commands that make this image readable by shaders once all of its pixel data has been copied, generating mip maps if needed
+        /// @param transferCommandBuffer The transfer command buffer the copies were recorded in
+        /// @param graphicsCommandBuffer The graphics command buffer that is submitted after the transfer command buffer
+        /// @param transferQueue The transfer queue
+        /// @param graphicsQueue The graphics queue
+        /// @param mipsUploaded If true, every mip level was copied, so mip maps aren't generated
+        void FinishUpload(VkCommandBuffer transferCommandBuffer, VkCommandBuffer graphicsCommandBuffer, const VulkanQueue& transferQueue, const VulkanQueue& graphicsQueue,
+            bool mipsUploaded = false);
+
         VkImageView GetNativeView() const { return _imageInfo.NativeView; }
 
+        /// @brief Gets the create info for an image
+        /// @param description The image description
+        /// @return The create info
+        static VkImageCreateInfo GetImageCreateInfo(const ImageDescription& description);
+
     private:
         VulkanGraphicsPlatform* _platform;
         VulkanImageInfo _imageInfo;
+        Ref<VulkanTransientMemory> _transientMemory;
         //VulkanQueue* _lastOperationQueue;
 
     private:
         void CreateImage(const ImageDescription& description, VulkanImageInfo& outImageInfo);
+        void CreateAliasedImage(const ImageDescription& description, const VulkanTransientMemory& memory, VulkanImageInfo& outImageInfo);
         void CreateNativeView(const ImageDescription& description, VulkanImageInfo& outImageInfo);
         //void CreateDepthView(const ImageDescription& description, VulkanImageInfo& outImageInfo);
 
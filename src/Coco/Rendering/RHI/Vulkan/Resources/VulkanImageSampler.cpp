@@ -15,6 +15,7 @@ namespace Coco
         ImageSampler(id),
         _platform(platform),
         _description(samplerDescription),
+        _samplerKey(),
         _sampler(nullptr)
     {
         VkSamplerCreateInfo createInfo{ VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO };
@@ -38,18 +39,21 @@ namespace Coco
         createInfo.minLod = static_cast<float>(_description.MinLOD);
         createInfo.maxLod = static_cast<float>(_description.MaxLOD);
 
-        AssertVkSuccess(vkCreateSampler(_platform->GetDevice(), &createInfo, _platform->GetAllocationCallbacks(), &_sampler));
+        // Samplers with identical state share the same VkSampler
+        _samplerKey.emplace(createInfo);
+        _sampler = _platform->GetVulkanCache()->GetSamplerCache().Acquire(_samplerKey.value());
 
         COCO_ENGINE_LOG_VERBOSE("Created VulkanImageSampler %u", id);
     }
 
     VulkanImageSampler::~VulkanImageSampler()
     {
-        if (_sampler)
-        {
-            vkDestroySampler(_platform->GetDevice(), _sampler, _platform->GetAllocationCallbacks());
-            _sampler = nullptr;
-        }
+        // The sampler cache destroys any remaining samplers if it is destroyed first
+        VulkanResourceCache* cache = _platform->GetVulkanCache();
+        if (_sampler && cache)
+            cache->GetSamplerCache().Release(_samplerKey.value());
+
+        _sampler = nullptr;
 
         COCO_ENGINE_LOG_VERBOSE("Destroyed VulkanImageSampler %u", GetID());
     }
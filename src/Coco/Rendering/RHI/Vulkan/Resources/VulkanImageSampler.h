@@ -6,7 +6,9 @@
 #define COCOENGINE_VULKANIMAGESAMPLER_H
 #include "Coco/Rendering/Graphics/Resources/ImageSampler.h"
 #include "Coco/Rendering/Graphics/Resources/ImageSamplerTypes.h"
+#include "Coco/Core/Types/Optional.h"
 #include "Coco/Rendering/RHI/Vulkan/VulkanIncludes.h"
+#include "Coco/Rendering/RHI/Vulkan/CachedResources/VulkanSamplerCache.h"
 
 namespace Coco
 {
@@ -23,6 +25,7 @@ namespace Coco
     private:
         VulkanGraphicsPlatform* _platform;
         ImageSamplerDescription _description;
+        Optional<VulkanSamplerKey> _samplerKey;
         VkSampler _sampler;
     };
 } // Coco
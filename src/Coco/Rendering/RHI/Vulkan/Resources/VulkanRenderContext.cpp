@@ -8,46 +8,62 @@
 #include "Coco/Rendering/RenderScene.h"
 #include "../VulkanRenderFrame.h"
 #include "../VulkanGraphicsPlatform.h"
-#include "VulkanGraphicsFence.h"
 #include "VulkanShaderProgram.h"
 #include "Coco/Rendering/RHI/Vulkan/VulkanUtils.h"
+#include "Coco/Rendering/RHI/Vulkan/VulkanBarrierBatch.h"
 
+#include "Coco/Rendering/RenderService.h"
 #include "Coco/Rendering/Shader.h"
+#include "Coco/Rendering/Texture.h"
 #include "Coco/Rendering/RHI/Vulkan/CachedResources/VulkanPipeline.h"
+#include "Coco/Rendering/RHI/Vulkan/CachedResources/VulkanIndirectCullingPipeline.h"
+#include "Coco/Rendering/RHI/Vulkan/VulkanPersistentUniformStorage.h"
 #include "Coco/Rendering/RHI/Vulkan/VulkanShaderBufferInterface.h"
 
 #include "VulkanBuffer.h"
 #include "VulkanImage.h"
+#include "VulkanImageSampler.h"
 
 #include "Coco/Rendering/RHI/Vulkan/VulkanIncludes.h"
 
 namespace Coco
 {
     VulkanBoundShaderInfo::VulkanBoundShaderInfo(Ref<VulkanShaderProgram> shaderProgram,
-        const GraphicsPipelineState& pipelineState, VulkanPipeline& pipeline) :
+        const GraphicsPipelineState& pipelineState) :
         BoundShader(std::move(shaderProgram)),
         BoundPipelineState(pipelineState),
-        BoundPipeline(&pipeline)
+        BoundPipeline(nullptr),
+        BoundVertexFormat(),
+        FormatPipelines(),
+        IsBindlessTextureTableBound(false),
+        BoundVertexBuffer(nullptr),
+        BoundVertexBufferOffset(0),
+        BoundIndexBuffer(nullptr),
+        BoundIndexBufferOffset(0)
     {}
 
-    VulkanRenderOperation::VulkanRenderOperation(VulkanRenderFrame& frame, RenderGraph& graph, RenderScene& scene, VkCommandBuffer commandBuffer) :
+    VulkanRenderOperation::VulkanRenderOperation(VulkanRenderFrame& frame, RenderGraph& graph, RenderScene& scene, VkCommandBuffer commandBuffer,
+                                                 VulkanUniformStorage& uniformStorage, bool isStream) :
         Frame(&frame),
         Graph(&graph),
         Scene(&scene),
-        CommandBuffer(commandBuffer)
+        CommandBuffer(commandBuffer),
+        UniformStorage(&uniformStorage),
+        IsStream(isStream),
+        IsRecordingPassInParallel(false),
+        IsInPass(false),
+        StreamStats()
     {}
 
     VulkanRenderContext::VulkanRenderContext(uint64 id, VulkanGraphicsPlatform* platform) :
         RenderContext(id),
-        _platform(platform),
-        _renderCompletedFence(CreateDefaultManagedRef<VulkanGraphicsFence>(id, platform, false))
+        _platform(platform)
     {
         COCO_ENGINE_LOG_VERBOSE("Created VulkanRenderContext %u", id);
     }
 
     VulkanRenderContext::~VulkanRenderContext()
     {
-        _renderCompletedFence.Invalidate();
         COCO_ENGINE_LOG_VERBOSE("Destroyed VulkanRenderContext %u", GetID());
     }
 
@@ -60,14 +76,32 @@ namespace Coco
         return Sizei();
     }
 
-    void VulkanRenderContext::BeginPass(uint64 passIndex, Span<const RenderPassAttachmentInfo> passAttachments)
+    void VulkanRenderContext::BeginPass(uint64 passIndex, Span<const RenderPassAttachmentInfo> passAttachments, bool recordInParallel)
     {
         COCO_ASSERT(_currentRenderOperation, "Context was not rendering");
+        COCO_ASSERT(!_currentRenderOperation->IsStream, "Passes cannot be started from a parallel stream");
 
         COCO_ASSERT(passAttachments.size() <= 16, "Up to 16 attachments are supported per pass");
+
+        // Pipelines depend on the pass's attachment formats, so shaders are bound again for each pass
+        _currentRenderOperation->BoundShaderInfo.reset();
+
         StackArray<VkRenderingAttachmentInfo, 16> colorAttachmentInfos;
         Optional<VkRenderingAttachmentInfo> depthStencilAttachmentInfo;
 
+        // Gather every transition this pass needs so they are recorded in a single barrier
+        VulkanBarrierBatch barriers;
+
+        for (const Ref<Image>& readImage : _currentRenderOperation->Graph->GetCurrentPassReads())
+        {
+            Ref<VulkanImage> vkImage = readImage.Downcast<VulkanImage>();
+            const VkImageLayout readLayout = vkImage->GetDescription().AttachmentType == ImageAttachmentType::Color ?
+                VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL :
+                VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL;
+
+            barriers.AddImageTransition(*vkImage, readLayout);
+        }
+
         for (const auto& attachmentInfo : passAttachments)
         {
             Ref<VulkanImage> attachmentImage = attachmentInfo.AttachmentImage.Downcast<VulkanImage>();
@@ -84,7 +118,7 @@ namespace Coco
             }
             else
             {
-                info.loadOp = VK_ATTACHMENT_LOAD_OP_LOAD;
+                info.loadOp = attachmentInfo.DiscardPrevious ? VK_ATTACHMENT_LOAD_OP_DONT_CARE : VK_ATTACHMENT_LOAD_OP_LOAD;
             }
 
             info.storeOp = attachmentInfo.SaveResult ? VK_ATTACHMENT_STORE_OP_STORE : VK_ATTACHMENT_STORE_OP_DONT_CARE;
@@ -92,9 +126,11 @@ namespace Coco
             info.imageView = attachmentImage->GetNativeView();
             info.imageLayout = VulkanUtils::ToVkImageLayout(attachmentInfo.Type);
 
-            attachmentImage->TransitionLayout(_currentRenderOperation->CommandBuffer, info.imageLayout);
+            barriers.AddImageTransition(*attachmentImage, info.imageLayout, attachmentInfo.DiscardPrevious);
         }
 
+        barriers.Record(_currentRenderOperation->CommandBuffer);
+
         VkRenderingInfo renderInfo{VK_STRUCTURE_TYPE_RENDERING_INFO};
         renderInfo.pColorAttachments = colorAttachmentInfos.Data();
         renderInfo.colorAttachmentCount = static_cast<uint32>(colorAttachmentInfos.GetCount());
@@ -107,7 +143,14 @@ namespace Coco
         Sizei size = GetFramebufferSize();
         renderInfo.renderArea.extent = {static_cast<uint32>(size.Width), static_cast<uint32>(size.Height)};
 
+        // Passes recorded in parallel can only contain secondary command buffers
+        if (recordInParallel)
+            renderInfo.flags = VK_RENDERING_CONTENTS_SECONDARY_COMMAND_BUFFERS_BIT;
+
         vkCmdBeginRendering(_currentRenderOperation->CommandBuffer, &renderInfo);
+
+        _currentRenderOperation->IsRecordingPassInParallel = recordInParallel;
+        _currentRenderOperation->IsInPass = true;
     }
 
     void VulkanRenderContext::EndPass()
@@ -115,21 +158,16 @@ namespace Coco
         COCO_ASSERT(_currentRenderOperation, "Context was not rendering");
 
         vkCmdEndRendering(_currentRenderOperation->CommandBuffer);
+        _currentRenderOperation->IsRecordingPassInParallel = false;
+        _currentRenderOperation->IsInPass = false;
 
-        for (auto& attachment : _currentRenderOperation->Graph->GetCurrentPassAttachments())
-        {
-            const auto& desc = attachment.AttachmentImage->GetDescription();
-            if ((desc.UsageFlags | ImageUsageFlags::Sampled) == ImageUsageFlags::Sampled)
-            {
-                Ref<VulkanImage> vkImage = attachment.AttachmentImage.Downcast<VulkanImage>();
-                vkImage->TransitionLayout(_currentRenderOperation->CommandBuffer, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
-            }
-        }
+        // Attachments that are sampled later are transitioned along with the rest of the next pass' barriers in BeginPass()
     }
 
     void VulkanRenderContext::SetViewport(const Recti& viewportRect)
     {
         COCO_ASSERT(_currentRenderOperation, "Context was not rendering");
+        COCO_ASSERT(!_currentRenderOperation->IsRecordingPassInParallel, "Commands for this pass must be recorded through RecordParallel()");
 
         VkViewport viewport{};
         viewport.x = static_cast<float>(viewportRect.Offset.X());
@@ -144,6 +182,9 @@ namespace Coco
 
     void VulkanRenderContext::SetScissor(const Recti& scissorRect)
     {
+        COCO_ASSERT(_currentRenderOperation, "Context was not rendering");
+        COCO_ASSERT(!_currentRenderOperation->IsRecordingPassInParallel, "Commands for this pass must be recorded through RecordParallel()");
+
         VkRect2D scissor{};
         scissor.offset.x = static_cast<uint32_t>(scissorRect.Offset.X());
         scissor.offset.y = static_cast<uint32_t>(scissorRect.Offset.Y());
@@ -156,17 +197,17 @@ namespace Coco
     void VulkanRenderContext::SetShader(Shader& shader, const GraphicsPipelineState& pipelineState)
     {
         COCO_ASSERT(_currentRenderOperation, "Context was not rendering");
+        COCO_ASSERT(!_currentRenderOperation->IsRecordingPassInParallel, "Commands for this pass must be recorded through RecordParallel()");
 
         Ref<VulkanShaderProgram> shaderProgram = shader.GetProgram().Downcast<VulkanShaderProgram>();
+
         if (_currentRenderOperation->BoundShaderInfo &&
             _currentRenderOperation->BoundShaderInfo->BoundShader.Get() == shaderProgram.Get() &&
             _currentRenderOperation->BoundShaderInfo->BoundPipelineState == pipelineState)
             return;
 
-        VulkanPipeline* pipeline = _platform->GetVulkanCache()->GetOrCreatePipeline(*shaderProgram, *_currentRenderOperation->Graph, pipelineState);
-        vkCmdBindPipeline(_currentRenderOperation->CommandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline->GetPipeline());
-
-        _currentRenderOperation->BoundShaderInfo.emplace(shaderProgram, pipelineState, *pipeline);
+        // The pipeline depends on the vertex format of the drawn meshes, so it is bound when drawing
+        _currentRenderOperation->BoundShaderInfo.emplace(shaderProgram, pipelineState);
     }
 
     bool VulkanRenderContext::CreateAndBindGlobalBuffer(const char* name, ShaderCursor& outCursor)
@@ -174,7 +215,8 @@ namespace Coco
         COCO_ASSERT(_currentRenderOperation, "Context wasn't rendering");
         COCO_ASSERT(_currentRenderOperation->BoundShaderInfo, "No shader has been bound");
 
-        VulkanUniformStorage& uniformStorage = _currentRenderOperation->Frame->GetUniformStorage();
+        // Each stream has its own uniform storage, which only locks the platform to create new pages
+        VulkanUniformStorage& uniformStorage = *_currentRenderOperation->UniformStorage;
         if (auto interface = uniformStorage.BindOrAllocate(name, 0, _currentRenderOperation->BoundShaderInfo->BoundShader, _currentRenderOperation->CommandBuffer))
         {
             outCursor.BindToInterface(*interface);
@@ -189,7 +231,7 @@ namespace Coco
         COCO_ASSERT(_currentRenderOperation, "Context wasn't rendering");
         COCO_ASSERT(_currentRenderOperation->BoundShaderInfo, "No shader has been bound");
 
-        _currentRenderOperation->Frame->GetUniformStorage().Bind(name, 0, *_currentRenderOperation->BoundShaderInfo->BoundShader, _currentRenderOperation->CommandBuffer);
+        _currentRenderOperation->UniformStorage->Bind(name, 0, *_currentRenderOperation->BoundShaderInfo->BoundShader, _currentRenderOperation->CommandBuffer);
     }
 
     bool VulkanRenderContext::CreateAndBindInstanceBuffer(uint64 instanceID, const char* name, ShaderCursor& outCursor)
@@ -197,7 +239,7 @@ namespace Coco
         COCO_ASSERT(_currentRenderOperation, "Context wasn't rendering");
         COCO_ASSERT(_currentRenderOperation->BoundShaderInfo, "No shader has been bound");
 
-        VulkanUniformStorage& uniformStorage = _currentRenderOperation->Frame->GetUniformStorage();
+        VulkanUniformStorage& uniformStorage = *_currentRenderOperation->UniformStorage;
         if (auto interface = uniformStorage.BindOrAllocate(name, instanceID, _currentRenderOperation->BoundShaderInfo->BoundShader, _currentRenderOperation->CommandBuffer))
         {
             outCursor.BindToInterface(*interface);
@@ -212,7 +254,31 @@ namespace Coco
         COCO_ASSERT(_currentRenderOperation, "Context wasn't rendering");
         COCO_ASSERT(_currentRenderOperation->BoundShaderInfo, "No shader has been bound");
 
-        _currentRenderOperation->Frame->GetUniformStorage().Bind(name, instanceID, *_currentRenderOperation->BoundShaderInfo->BoundShader, _currentRenderOperation->CommandBuffer);
+        _currentRenderOperation->UniformStorage->Bind(name, instanceID, *_currentRenderOperation->BoundShaderInfo->BoundShader, _currentRenderOperation->CommandBuffer);
+    }
+
+    bool VulkanRenderContext::BindPersistentInstanceBuffer(uint64 instanceID, uint64 version, const char* name, ShaderCursor& outCursor)
+    {
+        COCO_ASSERT(_currentRenderOperation, "Context wasn't rendering");
+        COCO_ASSERT(_currentRenderOperation->BoundShaderInfo, "No shader has been bound");
+
+        bool needsWrite = false;
+        VulkanShaderBufferInterface* interface;
+
+        {
+            auto sharedStateLock = LockSharedState();
+            interface = _platform->GetPersistentUniformStorage()->BindOrUpdate(name, instanceID, version,
+                _currentRenderOperation->BoundShaderInfo->BoundShader, _currentRenderOperation->CommandBuffer, needsWrite);
+        }
+
+        // Blocks with textures can't persist, so they are recreated each frame instead
+        if (!interface)
+            return CreateAndBindInstanceBuffer(instanceID, name, outCursor);
+
+        if (needsWrite)
+            outCursor.BindToInterface(*interface);
+
+        return needsWrite;
     }
 
     void VulkanRenderContext::SetDrawData(const void* data, uint64 dataSize, Span<const SharedPtr<Texture>> textures)
@@ -220,8 +286,46 @@ namespace Coco
         COCO_ASSERT(_currentRenderOperation, "Context wasn't rendering");
         COCO_ASSERT(_currentRenderOperation->BoundShaderInfo, "No shader has been bound");
 
-        auto shader = _currentRenderOperation->BoundShaderInfo->BoundShader;
-        auto pipelineLayout = shader->GetPipelineLayout();
+        VulkanBoundShaderInfo& boundShaderInfo = *_currentRenderOperation->BoundShaderInfo;
+        auto pipelineLayout = boundShaderInfo.BoundShader->GetPipelineLayout();
+        VulkanUniformStorage& uniformStorage = *_currentRenderOperation->UniformStorage;
+
+        // The bindless table and draw texture sets are shared by every stream, but the uniform storage
+        // remembers what it got from them this frame so that it only locks the platform for new textures
+        VulkanBindlessTextureTable* bindlessTable = pipelineLayout->BindlessTextureSetIndex.has_value() ?
+            _platform->GetVulkanCache()->GetBindlessTextureTable() : nullptr;
+
+        // Bindless shaders get the table indices of their textures as uint32s directly after the draw data
+        uint8 bindlessPushConstantData[_maxBindlessPushConstantSize];
+        if (bindlessTable)
+        {
+            if (!boundShaderInfo.IsBindlessTextureTableBound)
+            {
+                VkDescriptorSet tableSet = bindlessTable->GetDescriptorSet();
+                vkCmdBindDescriptorSets(_currentRenderOperation->CommandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipelineLayout->PipelineLayout,
+                    *pipelineLayout->BindlessTextureSetIndex, 1, &tableSet,
+                    0, nullptr);
+                boundShaderInfo.IsBindlessTextureTableBound = true;
+            }
+
+            const uint64 bindlessDataSize = dataSize + textures.size() * sizeof(uint32);
+            COCO_ASSERT(bindlessDataSize <= _maxBindlessPushConstantSize, "Draw data and texture indices must fit in %u bytes", _maxBindlessPushConstantSize);
+
+            if (dataSize > 0)
+                memcpy(bindlessPushConstantData, data, dataSize);
+
+            for (uint64 i = 0; i < textures.size(); i++)
+            {
+                const uint32 textureIndex = uniformStorage.GetBindlessTextureIndex(textures[i].get(), *bindlessTable);
+                memcpy(bindlessPushConstantData + dataSize + i * sizeof(uint32), &textureIndex, sizeof(uint32));
+            }
+
+            data = bindlessPushConstantData;
+            dataSize = bindlessDataSize;
+        }
+
+        if (!textures.empty() && !bindlessTable)
+            uniformStorage.BindDrawTextures(textures, boundShaderInfo.BoundShader, _currentRenderOperation->CommandBuffer);
 
         // Write data to the push constant buffer
         if (dataSize > 0)
@@ -237,111 +341,489 @@ namespace Coco
                 vkCmdPushConstants(_currentRenderOperation->CommandBuffer, pipelineLayout->PipelineLayout, range.stageFlags, range.offset, range.size, dataPtr);
             }
         }
-
-        // Write textures to a descriptor set and bind it
-        if (!textures.empty())
-            _currentRenderOperation->Frame->GetUniformStorage().BindDrawTextures(textures, shader, _currentRenderOperation->CommandBuffer);
     }
 
     void VulkanRenderContext::DrawObject(const RenderObject& obj)
     {
         COCO_ASSERT(_currentRenderOperation, "Context wasn't rendering");
+        COCO_ASSERT(!_currentRenderOperation->IsRecordingPassInParallel, "Commands for this pass must be recorded through RecordParallel()");
         COCO_ASSERT(_currentRenderOperation->BoundShaderInfo, "No shader has been bound");
 
         const MeshEntry* meshEntry = _platform->GetMeshStorage()->GetMesh(obj.MeshID);
+        BindMesh(*meshEntry);
 
-        StackArray<VkBuffer, 5> buffers;
-        StackArray<VkDeviceSize, 5> bufferOffsets;
-        VkBuffer buffer = meshEntry->MeshBuffer.Downcast<VulkanBuffer>()->GetBuffer();
+        // Draw the mesh
+        vkCmdDrawIndexed(_currentRenderOperation->CommandBuffer,
+            obj.DrawSubmesh.IndexCount,
+            1,
+            static_cast<uint32>(obj.DrawSubmesh.IndexOffset + meshEntry->FirstIndex),
+            static_cast<int32>(obj.DrawSubmesh.VertexOffset + meshEntry->FirstVertex),
+            0);
+
+        AddDrawCall(obj.DrawSubmesh.IndexCount / 3, obj.DrawSubmesh.IndexCount);
+    }
+
+    bool VulkanRenderContext::CanDrawIndirect(const RenderObject& obj) const
+    {
+        if (!_platform->GetDeviceDescription().SupportsIndirectDrawCount)
+            return false;
 
-        for (const auto& channel : _currentRenderOperation->BoundShaderInfo->BoundShader->GetVertexChannels())
+        // Only meshes in a static mesh arena share their buffers with other meshes, so they can be drawn in groups
+        const MeshEntry* meshEntry = _platform->GetMeshStorage()->GetMesh(obj.MeshID);
+        return meshEntry && meshEntry->ArenaIndex.has_value();
+    }
+
+    void VulkanRenderContext::CullIndirect(uint64 batchID, const ViewFrustum& frustum, Span<const IndirectDrawObject> objects, Span<const uint8> instanceData, uint64 instanceDataStride)
+    {
+        COCO_ASSERT(_currentRenderOperation, "Context wasn't rendering");
+        COCO_ASSERT(!_currentRenderOperation->IsInPass, "Objects must be culled outside of a pass");
+        COCO_ASSERT(!_currentRenderOperation->IsStream, "Objects cannot be culled from a parallel stream");
+        COCO_ASSERT(instanceData.size() == objects.size() * instanceDataStride, "Instance data size must match the object count and stride");
+
+        VulkanIndirectCullingPipeline* cullingPipeline = _platform->GetVulkanCache()->GetIndirectCullingPipeline();
+        if (!cullingPipeline)
         {
-            uint64 offset = meshEntry->ChannelOffsets[static_cast<uint8>(channel)] + meshEntry->BufferOffset;
-            bufferOffsets.Append(offset);
-            buffers.Append(buffer);
+            COCO_ENGINE_LOG_ERROR("The device does not support indirect drawing");
+            return;
         }
 
-        vkCmdBindVertexBuffers(_currentRenderOperation->CommandBuffer, 0, static_cast<uint32>(buffers.GetCount()), buffers.Data(), bufferOffsets.Data());
+        VulkanIndirectDrawStorage& storage = _currentRenderOperation->Frame->GetIndirectDrawStorage();
+        VulkanIndirectBatch& batch = storage.CreateBatch(batchID);
+        batch.InstanceDataSize = instanceData.size();
 
-        uint64 indexDataOffset = meshEntry->BufferOffset + meshEntry->IndexDataOffset;
-        vkCmdBindIndexBuffer(_currentRenderOperation->CommandBuffer, buffer, indexDataOffset, VK_INDEX_TYPE_UINT32);
+        if (objects.empty())
+            return;
 
-        // Draw the mesh
-        vkCmdDrawIndexed(_currentRenderOperation->CommandBuffer,
-            obj.DrawSubmesh.IndexCount,
-            1,
-            obj.DrawSubmesh.IndexOffset,
-            obj.DrawSubmesh.VertexOffset,
-            0);
+        MeshStorage* meshStorage = _platform->GetMeshStorage();
+
+        // Objects are grouped by arena, since each group is drawn with a single set of vertex and index buffers
+        Array<uint64> groupArenas;
+        Array<uint32> objectGroups;
+        objectGroups.Reserve(objects.size());
 
-        _currentRenderOperation->Frame->AddDrawCall(obj.DrawSubmesh.IndexCount / 3, obj.DrawSubmesh.IndexCount);
+        for (const IndirectDrawObject& obj : objects)
+        {
+            const MeshEntry* meshEntry = meshStorage->GetMesh(obj.Object->MeshID);
+            COCO_ASSERT(meshEntry && meshEntry->ArenaIndex.has_value(), "Object cannot be drawn indirectly");
+
+            int64 groupIndex = groupArenas.Find(meshEntry->ArenaIndex.value());
+            if (groupIndex == -1)
+            {
+                groupIndex = static_cast<int64>(groupArenas.GetCount());
+                groupArenas.Append(meshEntry->ArenaIndex.value());
+                batch.Groups.EmplaceBack(obj.Object->MeshID);
+            }
+
+            batch.Groups[groupIndex].MaxDrawCount++;
+            objectGroups.Append(static_cast<uint32>(groupIndex));
+        }
+
+        uint32 commandCount = 0;
+        for (VulkanIndirectDrawGroup& group : batch.Groups)
+        {
+            group.CommandOffset = commandCount;
+            commandCount += group.MaxDrawCount;
+        }
+
+        // Upload the cull objects and instance data
+        const uint64 objectDataSize = objects.size() * sizeof(VulkanIndirectCullObject);
+        Ref<VulkanBuffer> objectBuffer;
+        uint64 objectBufferOffset;
+        storage.AllocateUploadData(objectDataSize, objectBuffer, objectBufferOffset);
+
+        auto cullObjects = reinterpret_cast<VulkanIndirectCullObject*>(static_cast<uint8*>(objectBuffer->GetMappedPtr()) + objectBufferOffset);
+        for (uint64 i = 0; i < objects.size(); i++)
+        {
+            const IndirectDrawObject& obj = objects[i];
+            const MeshEntry* meshEntry = meshStorage->GetMesh(obj.Object->MeshID);
+            VulkanIndirectCullObject& cullObject = cullObjects[i];
+
+            cullObject.Center[0] = static_cast<float>(obj.BoundsCenter.X());
+            cullObject.Center[1] = static_cast<float>(obj.BoundsCenter.Y());
+            cullObject.Center[2] = static_cast<float>(obj.BoundsCenter.Z());
+            cullObject.Extents[0] = static_cast<float>(obj.BoundsExtents.X());
+            cullObject.Extents[1] = static_cast<float>(obj.BoundsExtents.Y());
+            cullObject.Extents[2] = static_cast<float>(obj.BoundsExtents.Z());
+            cullObject.IndexCount = obj.Object->DrawSubmesh.IndexCount;
+            cullObject.FirstIndex = static_cast<uint32>(obj.Object->DrawSubmesh.IndexOffset + meshEntry->FirstIndex);
+            cullObject.VertexOffset = static_cast<int32>(obj.Object->DrawSubmesh.VertexOffset + meshEntry->FirstVertex);
+            cullObject.InstanceIndex = static_cast<uint32>(i);
+            cullObject.DrawGroup = objectGroups[i];
+            cullObject.CommandOffset = batch.Groups[objectGroups[i]].CommandOffset;
+        }
+
+        if (!instanceData.empty())
+        {
+            storage.AllocateUploadData(instanceData.size(), batch.InstanceBuffer, batch.InstanceBufferOffset);
+            memcpy(static_cast<uint8*>(batch.InstanceBuffer->GetMappedPtr()) + batch.InstanceBufferOffset, instanceData.data(), instanceData.size());
+        }
+
+        // The draw counts directly follow the commands
+        const uint64 commandDataSize = static_cast<uint64>(commandCount) * VulkanIndirectCullingPipeline::CommandStride;
+        const uint64 countDataSize = batch.Groups.GetCount() * sizeof(uint32);
+        storage.AllocateCommandData(commandDataSize + countDataSize, batch.CommandBuffer, batch.CommandBufferOffset);
+        batch.CountBufferOffset = batch.CommandBufferOffset + commandDataSize;
+
+        VkDescriptorSet cullingSet = storage.AllocateCullingSet(cullingPipeline->GetSetLayout());
+
+        VkDescriptorBufferInfo bufferInfos[3];
+        bufferInfos[0] = { objectBuffer->GetBuffer(), objectBufferOffset, objectDataSize };
+        bufferInfos[1] = { batch.CommandBuffer->GetBuffer(), batch.CommandBufferOffset, commandDataSize };
+        bufferInfos[2] = { batch.CommandBuffer->GetBuffer(), batch.CountBufferOffset, countDataSize };
+
+        VkWriteDescriptorSet writes[3];
+        for (uint32 i = 0; i < 3; i++)
+        {
+            writes[i] = {VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET};
+            writes[i].dstSet = cullingSet;
+            writes[i].dstBinding = i;
+            writes[i].dstArrayElement = 0;
+            writes[i].descriptorCount = 1;
+            writes[i].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+            writes[i].pBufferInfo = &bufferInfos[i];
+        }
+
+        vkUpdateDescriptorSets(_platform->GetDevice(), 3, writes, 0, nullptr);
+
+        VkCommandBuffer commandBuffer = _currentRenderOperation->CommandBuffer;
+
+        // Reset the draw counts, then make the reset visible to the culling shader
+        vkCmdFillBuffer(commandBuffer, batch.CommandBuffer->GetBuffer(), batch.CountBufferOffset, countDataSize, 0);
+
+        VkMemoryBarrier2 fillBarrier{VK_STRUCTURE_TYPE_MEMORY_BARRIER_2};
+        fillBarrier.srcStageMask = VK_PIPELINE_STAGE_2_TRANSFER_BIT;
+        fillBarrier.srcAccessMask = VK_ACCESS_2_TRANSFER_WRITE_BIT;
+        fillBarrier.dstStageMask = VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT;
+        fillBarrier.dstAccessMask = VK_ACCESS_2_SHADER_STORAGE_READ_BIT | VK_ACCESS_2_SHADER_STORAGE_WRITE_BIT;
+
+        VkDependencyInfo fillDependency{VK_STRUCTURE_TYPE_DEPENDENCY_INFO};
+        fillDependency.memoryBarrierCount = 1;
+        fillDependency.pMemoryBarriers = &fillBarrier;
+        vkCmdPipelineBarrier2(commandBuffer, &fillDependency);
+
+        VulkanIndirectCullConstants constants{};
+        for (uint8 i = 0; i < ViewFrustum::PlaneCount; i++)
+        {
+            const Vector4& plane = frustum.Planes[i];
+            constants.Planes[i][0] = static_cast<float>(plane.X());
+            constants.Planes[i][1] = static_cast<float>(plane.Y());
+            constants.Planes[i][2] = static_cast<float>(plane.Z());
+            constants.Planes[i][3] = static_cast<float>(plane.W());
+        }
+
+        constants.ObjectCount = static_cast<uint32>(objects.size());
+
+        vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, cullingPipeline->GetPipeline());
+        vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, cullingPipeline->GetPipelineLayout(),
+            0, 1, &cullingSet,
+            0, nullptr);
+        vkCmdPushConstants(commandBuffer, cullingPipeline->GetPipelineLayout(), VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(constants), &constants);
+
+        const uint32 workgroupCount = (constants.ObjectCount + VulkanIndirectCullingPipeline::WorkgroupSize - 1) / VulkanIndirectCullingPipeline::WorkgroupSize;
+        vkCmdDispatch(commandBuffer, workgroupCount, 1, 1);
+
+        // Make the draw commands and counts visible to the indirect draws
+        VkMemoryBarrier2 cullBarrier{VK_STRUCTURE_TYPE_MEMORY_BARRIER_2};
+        cullBarrier.srcStageMask = VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT;
+        cullBarrier.srcAccessMask = VK_ACCESS_2_SHADER_STORAGE_WRITE_BIT;
+        cullBarrier.dstStageMask = VK_PIPELINE_STAGE_2_DRAW_INDIRECT_BIT;
+        cullBarrier.dstAccessMask = VK_ACCESS_2_INDIRECT_COMMAND_READ_BIT;
+
+        VkDependencyInfo cullDependency{VK_STRUCTURE_TYPE_DEPENDENCY_INFO};
+        cullDependency.memoryBarrierCount = 1;
+        cullDependency.pMemoryBarriers = &cullBarrier;
+        vkCmdPipelineBarrier2(commandBuffer, &cullDependency);
     }
 
-    void VulkanRenderContext::WaitForWorkToComplete()
+    void VulkanRenderContext::DrawIndirect(uint64 batchID)
     {
-        _renderCompletedFence->WaitForSignal(true);
+        COCO_ASSERT(_currentRenderOperation, "Context wasn't rendering");
+        COCO_ASSERT(!_currentRenderOperation->IsRecordingPassInParallel, "Commands for this pass must be recorded through RecordParallel()");
+        COCO_ASSERT(_currentRenderOperation->BoundShaderInfo, "No shader has been bound");
+
+        // Batches are only created outside of parallel streams, so they can be read without locking
+        VulkanIndirectDrawStorage& storage = _currentRenderOperation->Frame->GetIndirectDrawStorage();
+        const VulkanIndirectBatch* batch = storage.GetBatch(batchID);
+        if (!batch)
+        {
+            COCO_ENGINE_LOG_ERROR("Indirect batch %u was not culled this frame", batchID);
+            return;
+        }
+
+        if (batch->Groups.IsEmpty())
+            return;
+
+        VulkanBoundShaderInfo& boundShaderInfo = *_currentRenderOperation->BoundShaderInfo;
+        const Ref<VulkanShaderProgram>& shader = boundShaderInfo.BoundShader;
+        const VulkanPipelineLayout* pipelineLayout = shader->GetPipelineLayout();
+        VkCommandBuffer commandBuffer = _currentRenderOperation->CommandBuffer;
+
+        if (batch->InstanceBuffer.IsValid())
+        {
+            const int64 blockIndex = shader->GetParamBlockIndex(_instanceBlockName);
+            if (blockIndex == -1)
+            {
+                COCO_ENGINE_LOG_ERROR("Shader has no \"%s\" block for indirect instance data", _instanceBlockName);
+                return;
+            }
+
+            const uint64 setIndex = pipelineLayout->ParamBlockSetIndices[blockIndex];
+            const VkDescriptorSetLayoutBinding& binding = shader->GetDescriptorSetLayouts()[setIndex].LayoutBindings[0];
+            VkDescriptorSet instanceSet;
+
+            {
+                // Streams share the frame's instance set pools
+                auto sharedStateLock = LockSharedState();
+                instanceSet = storage.AllocateInstanceSet(shader, setIndex);
+            }
+
+            VkDescriptorBufferInfo bufferInfo;
+            bufferInfo.buffer = batch->InstanceBuffer->GetBuffer();
+            bufferInfo.offset = batch->InstanceBufferOffset;
+            bufferInfo.range = batch->InstanceDataSize;
+
+            VkWriteDescriptorSet write = {VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET};
+            write.dstSet = instanceSet;
+            write.dstBinding = binding.binding;
+            write.dstArrayElement = 0;
+            write.descriptorCount = 1;
+            write.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+            write.pBufferInfo = &bufferInfo;
+
+            vkUpdateDescriptorSets(_platform->GetDevice(), 1, &write, 0, nullptr);
+
+            vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipelineLayout->PipelineLayout,
+                static_cast<uint32>(setIndex), 1, &instanceSet,
+                0, nullptr);
+        }
+
+        MeshStorage* meshStorage = _platform->GetMeshStorage();
+        VkBuffer indirectBuffer = batch->CommandBuffer->GetBuffer();
+
+        for (uint64 i = 0; i < batch->Groups.GetCount(); i++)
+        {
+            const VulkanIndirectDrawGroup& group = batch->Groups[i];
+            BindMesh(*meshStorage->GetMesh(group.MeshID));
+
+            vkCmdDrawIndexedIndirectCountKHR(commandBuffer,
+                indirectBuffer, batch->CommandBufferOffset + static_cast<uint64>(group.CommandOffset) * VulkanIndirectCullingPipeline::CommandStride,
+                indirectBuffer, batch->CountBufferOffset + i * sizeof(uint32),
+                group.MaxDrawCount, VulkanIndirectCullingPipeline::CommandStride);
+
+            // The number of visible objects is only known by the GPU
+            AddDrawCall(0, 0);
+        }
+    }
+
+    void VulkanRenderContext::RecordParallel(uint32 streamCount, const ParallelRecordFunction& recordFunction)
+    {
+        COCO_ASSERT(_currentRenderOperation, "Context was not rendering");
+        COCO_ASSERT(_currentRenderOperation->IsRecordingPassInParallel, "The current pass was not set up for parallel recording");
+        COCO_ASSERT(streamCount > 0 && streamCount <= MaxParallelStreams, "Stream count must be between 1 and %u", MaxParallelStreams);
+
+        const auto attachmentFormats = VulkanPipelineAttachmentFormats::FromPassAttachments(_currentRenderOperation->Graph->GetCurrentPassAttachments());
+
+        VkCommandBufferInheritanceRenderingInfo renderingInfo{VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_RENDERING_INFO};
+        renderingInfo.colorAttachmentCount = static_cast<uint32>(attachmentFormats.ColorFormats.GetCount());
+        renderingInfo.pColorAttachmentFormats = attachmentFormats.ColorFormats.Data();
+        renderingInfo.depthAttachmentFormat = attachmentFormats.DepthStencilFormat;
+        renderingInfo.stencilAttachmentFormat = attachmentFormats.DepthStencilFormat;
+        renderingInfo.rasterizationSamples = VK_SAMPLE_COUNT_1_BIT;
+
+        VkCommandBufferInheritanceInfo inheritanceInfo{VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO};
+        inheritanceInfo.pNext = &renderingInfo;
+
+        VulkanRenderFrame& frame = *_currentRenderOperation->Frame;
+        StackArray<Ref<VulkanRenderContext>, MaxParallelStreams> streamContexts;
+        StackArray<VkCommandBuffer, MaxParallelStreams> streamCommandBuffers;
+        StackArray<VulkanUniformStorage*, MaxParallelStreams> streamUniformStorages;
+        StackArray<RenderFrameStats, MaxParallelStreams> streamStats;
+
+        // Everything a stream needs is created up front, so workers only touch the platform through the shared state lock
+        for (uint32 i = 0; i < streamCount; i++)
+        {
+            VkCommandBuffer commandBuffer = frame.AllocateStreamCommandBuffer(i);
+            Ref<VulkanRenderContext> streamContext = frame.GetStreamRenderContext(i);
+
+            streamContexts.Append(streamContext);
+            streamCommandBuffers.Append(commandBuffer);
+            streamUniformStorages.Append(&frame.GetStreamUniformStorage(i));
+            streamStats.EmplaceBack();
+        }
+
+        // Each stream records into its own context, command pool, and uniform storage
+        _platform->GetRenderService()->GetWorkerPool()->ParallelFor(streamCount, [&](uint64 streamIndex)
+        {
+            VulkanRenderContext& streamContext = *streamContexts[streamIndex];
+            streamContext.BeginStream(frame, *_currentRenderOperation->Graph, *_currentRenderOperation->Scene, streamCommandBuffers[streamIndex],
+                *streamUniformStorages[streamIndex], inheritanceInfo);
+
+            recordFunction(streamContext, static_cast<uint32>(streamIndex));
+            streamStats[streamIndex] = streamContext.EndStream();
+        });
+
+        for (const RenderFrameStats& stats : streamStats)
+            frame.AddStreamDrawCalls(stats);
+
+        // Execute in stream order so the result is deterministic regardless of which stream finished first
+        vkCmdExecuteCommands(_currentRenderOperation->CommandBuffer, static_cast<uint32>(streamCommandBuffers.GetCount()), streamCommandBuffers.Data());
     }
 
     void VulkanRenderContext::Begin(VulkanRenderFrame& frame, RenderGraph& graph, RenderScene& scene,
                                     VkCommandBuffer commandBuffer)
     {
-        _currentRenderOperation.emplace(frame, graph, scene, commandBuffer);
+        _currentRenderOperation.emplace(frame, graph, scene, commandBuffer, frame.GetUniformStorage(), false);
 
         VkCommandBufferBeginInfo beginInfo{VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO};
         beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
         vkBeginCommandBuffer(commandBuffer, &beginInfo);
 
-        Recti viewportRect(Vector2i::Zero, graph.GetAttachmentSize());
+        SetDefaultDynamicState();
+    }
+
+    void VulkanRenderContext::BeginStream(VulkanRenderFrame& frame, RenderGraph& graph, RenderScene& scene, VkCommandBuffer commandBuffer,
+                                          VulkanUniformStorage& uniformStorage, const VkCommandBufferInheritanceInfo& inheritanceInfo)
+    {
+        _currentRenderOperation.emplace(frame, graph, scene, commandBuffer, uniformStorage, true);
+
+        VkCommandBufferBeginInfo beginInfo{VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO};
+        beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT | VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT;
+        beginInfo.pInheritanceInfo = &inheritanceInfo;
+        vkBeginCommandBuffer(commandBuffer, &beginInfo);
+
+        // Dynamic state isn't inherited from the primary command buffer
+        SetDefaultDynamicState();
+    }
+
+    RenderFrameStats VulkanRenderContext::EndStream()
+    {
+        COCO_ASSERT(_currentRenderOperation && _currentRenderOperation->IsStream, "Context was not recording a stream");
+
+        vkEndCommandBuffer(_currentRenderOperation->CommandBuffer);
+        RenderFrameStats stats = _currentRenderOperation->StreamStats;
+        _currentRenderOperation.reset();
+
+        return stats;
+    }
+
+    VkCommandBuffer VulkanRenderContext::End()
+    {
+        COCO_ASSERT(_currentRenderOperation && !_currentRenderOperation->IsStream, "Context was not rendering");
+
+        VkCommandBuffer commandBuffer = _currentRenderOperation->CommandBuffer;
+        vkEndCommandBuffer(commandBuffer);
+        _currentRenderOperation.reset();
+
+        return commandBuffer;
+    }
+
+    void VulkanRenderContext::SetDefaultDynamicState()
+    {
+        Recti viewportRect(Vector2i::Zero, _currentRenderOperation->Graph->GetAttachmentSize());
         SetViewport(viewportRect);
         SetScissor(viewportRect);
 
         vkCmdSetLineWidth(_currentRenderOperation->CommandBuffer, 1.0f);
     }
 
-    void VulkanRenderContext::Submit(Span<const std::pair<Ref<VulkanGraphicsSemaphore>, VkPipelineStageFlags2>> waitSemaphores, Ref<VulkanGraphicsSemaphore> renderingCompleteSemaphore)
+    std::unique_lock<std::mutex> VulkanRenderContext::LockSharedState()
     {
-        COCO_ASSERT(_currentRenderOperation, "Context was not rendering");
-        vkEndCommandBuffer(_currentRenderOperation->CommandBuffer);
+        if (!_currentRenderOperation->IsStream)
+            return std::unique_lock<std::mutex>();
 
-        uint64 currentFrameNumber = _platform->GetCurrentFrameNumber();
+        return std::unique_lock<std::mutex>(_platform->GetSharedStateLock());
+    }
 
-        COCO_ASSERT(waitSemaphores.size() <= 2, "Up to 2 waits are supported currently");
-        StackArray<VkSemaphoreSubmitInfo, 2> waitInfos;
-        for (const auto& pair : waitSemaphores)
+    void VulkanRenderContext::AddDrawCall(uint32 triangleCount, uint32 vertexCount)
+    {
+        if (!_currentRenderOperation->IsStream)
         {
-            VkSemaphoreSubmitInfo& info = waitInfos.EmplaceBack(VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO, nullptr);
-            info.semaphore = pair.first->GetSemaphore();
-            info.value = currentFrameNumber;
-            info.stageMask = pair.second;
-            info.deviceIndex = 0;
+            _currentRenderOperation->Frame->AddDrawCall(triangleCount, vertexCount);
+            return;
         }
 
-        VkSemaphoreSubmitInfo signalInfo = {
-            VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO,
-            nullptr,
-            renderingCompleteSemaphore->GetSemaphore(),
-            0,
-            VK_PIPELINE_STAGE_2_COLOR_ATTACHMENT_OUTPUT_BIT,
-            0
-        };
-
-        VkCommandBufferSubmitInfo bufferInfo = {
-            VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO,
-            nullptr,
-            _currentRenderOperation->CommandBuffer,
-            0
-        };
-
-        VkSubmitInfo2 submitInfo = {
-            VK_STRUCTURE_TYPE_SUBMIT_INFO_2,
-            nullptr,
-            0,
-            static_cast<uint32>(waitInfos.GetCount()), waitInfos.Data(),
-            1, &bufferInfo,
-            1, &signalInfo
-        };
-
-        VulkanQueue* graphicsQueue = _platform->GetQueue(VulkanQueue::Type::Graphics);
-        vkQueueSubmit2(graphicsQueue->GetQueue(), 1, &submitInfo, _renderCompletedFence->GetFence());
+        RenderFrameStats& stats = _currentRenderOperation->StreamStats;
+        stats.DrawCalls++;
+        stats.TrianglesDrawn += triangleCount;
+        stats.VerticesDrawn += vertexCount;
+    }
+
+    void VulkanRenderContext::BindMesh(const MeshEntry& meshEntry)
+    {
+        VulkanBoundShaderInfo& boundShaderInfo = _currentRenderOperation->BoundShaderInfo.value();
+
+        if (!boundShaderInfo.BoundPipeline || !(boundShaderInfo.BoundVertexFormat == meshEntry.Format))
+        {
+            VulkanPipeline* pipeline = nullptr;
+
+            for (const auto& [format, formatPipeline] : boundShaderInfo.FormatPipelines)
+            {
+                if (format == meshEntry.Format)
+                {
+                    pipeline = formatPipeline;
+                    break;
+                }
+            }
+
+            if (!pipeline)
+            {
+                const auto attachmentFormats = VulkanPipelineAttachmentFormats::FromPassAttachments(_currentRenderOperation->Graph->GetCurrentPassAttachments());
+
+                {
+                    // The pipeline cache is shared by every stream
+                    auto sharedStateLock = LockSharedState();
+                    pipeline = _platform->GetVulkanCache()->GetOrCreatePipeline(*boundShaderInfo.BoundShader, attachmentFormats, boundShaderInfo.BoundPipelineState, meshEntry.Format);
+                }
+
+                boundShaderInfo.FormatPipelines.EmplaceBack(meshEntry.Format, pipeline);
+            }
+
+            vkCmdBindPipeline(_currentRenderOperation->CommandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline->GetPipeline());
+
+            // The vertex bindings depend on the vertex format, so they need to be bound again
+            boundShaderInfo.BoundPipeline = pipeline;
+            boundShaderInfo.BoundVertexFormat = meshEntry.Format;
+            boundShaderInfo.BoundVertexBuffer = nullptr;
+        }
+
+        // Static meshes in the same arena share buffers and channel offsets, so consecutive draws only need to rebind when the arena changes
+        VkBuffer vertexBuffer = meshEntry.MeshBuffer.Downcast<VulkanBuffer>()->GetBuffer();
+
+        if (vertexBuffer != boundShaderInfo.BoundVertexBuffer || meshEntry.BufferOffset != boundShaderInfo.BoundVertexBufferOffset)
+        {
+            StackArray<VkBuffer, 5> buffers;
+            StackArray<VkDeviceSize, 5> bufferOffsets;
+
+            if (meshEntry.Format.LayoutMode == VertexLayoutMode::Interleaved)
+            {
+                bufferOffsets.Append(meshEntry.BufferOffset);
+                buffers.Append(vertexBuffer);
+            }
+            else
+            {
+                for (const auto& channel : boundShaderInfo.BoundShader->GetVertexChannels())
+                {
+                    uint64 offset = meshEntry.ChannelOffsets[static_cast<uint8>(channel)] + meshEntry.BufferOffset;
+                    bufferOffsets.Append(offset);
+                    buffers.Append(vertexBuffer);
+                }
+            }
+
+            vkCmdBindVertexBuffers(_currentRenderOperation->CommandBuffer, 0, static_cast<uint32>(buffers.GetCount()), buffers.Data(), bufferOffsets.Data());
+
+            boundShaderInfo.BoundVertexBuffer = vertexBuffer;
+            boundShaderInfo.BoundVertexBufferOffset = meshEntry.BufferOffset;
+        }
+
+        VkBuffer indexBuffer = meshEntry.IndexBuffer.Downcast<VulkanBuffer>()->GetBuffer();
+        uint64 indexDataOffset = meshEntry.BufferOffset + meshEntry.IndexDataOffset;
+
+        if (indexBuffer != boundShaderInfo.BoundIndexBuffer || indexDataOffset != boundShaderInfo.BoundIndexBufferOffset)
+        {
+            vkCmdBindIndexBuffer(_currentRenderOperation->CommandBuffer, indexBuffer, indexDataOffset, VulkanUtils::ToVkIndexType(meshEntry.IndexType));
+
+            boundShaderInfo.BoundIndexBuffer = indexBuffer;
+            boundShaderInfo.BoundIndexBufferOffset = indexDataOffset;
+        }
     }
 } // Coco
\ No newline at end of file
@@ -4,8 +4,10 @@
 
 #ifndef COCOENGINE_VULKANRENDERCONTEXT_H
 #define COCOENGINE_VULKANRENDERCONTEXT_H
+#include <mutex>
 
 #include "Coco/Core/Types/Optional.h"
+#include "Coco/Rendering/Graphics/RenderFrameStats.h"
 #include "Coco/Rendering/Graphics/Resources/RenderContext.h"
 #include "../VulkanForwardDeclarations.h"
 
@@ -16,20 +18,36 @@ namespace Coco
     class VulkanImage;
     class VulkanPipeline;
     class VulkanShaderProgram;
-    class VulkanGraphicsSemaphore;
-    class VulkanGraphicsFence;
     class VulkanGraphicsPlatform;
     class VulkanRenderFrame;
     class RenderGraph;
     class RenderScene;
+    struct MeshEntry;
 
     struct VulkanBoundShaderInfo
     {
         Ref<VulkanShaderProgram> BoundShader;
         GraphicsPipelineState BoundPipelineState;
+
+        /// @brief The pipeline for the vertex format of the last drawn mesh, or null if nothing has been drawn with this shader yet
         VulkanPipeline* BoundPipeline;
+        VertexFormat BoundVertexFormat;
+
+        /// @brief The pipelines this shader has been drawn with, by vertex format, so switching back to a format doesn't need the shared pipeline cache
+        Array<std::pair<VertexFormat, VulkanPipeline*>> FormatPipelines;
+
+        /// @brief If true, the bindless texture table has been bound for this shader
+        bool IsBindlessTextureTableBound;
+
+        /// @brief The vertex buffer and base offset currently bound for this shader's vertex channels
+        VkBuffer BoundVertexBuffer;
+        uint64 BoundVertexBufferOffset;
+
+        /// @brief The index buffer and offset currently bound
+        VkBuffer BoundIndexBuffer;
+        uint64 BoundIndexBufferOffset;
 
-        VulkanBoundShaderInfo(Ref<VulkanShaderProgram> shaderProgram, const GraphicsPipelineState& pipelineState, VulkanPipeline& pipeline);
+        VulkanBoundShaderInfo(Ref<VulkanShaderProgram> shaderProgram, const GraphicsPipelineState& pipelineState);
     };
 
     struct VulkanRenderOperation
@@ -38,9 +56,21 @@ namespace Coco
         RenderGraph* Graph;
         RenderScene* Scene;
         VkCommandBuffer CommandBuffer;
+
+        /// @brief The storage that uniform blocks are allocated from. Each parallel stream has its own
+        VulkanUniformStorage* UniformStorage;
         Optional<VulkanBoundShaderInfo> BoundShaderInfo;
+        bool IsStream;
+        bool IsRecordingPassInParallel;
+
+        /// @brief If true, a pass has been started with BeginPass() and not yet ended
+        bool IsInPass;
 
-        VulkanRenderOperation(VulkanRenderFrame& frame, RenderGraph& graph, RenderScene& scene, VkCommandBuffer commandBuffer);
+        /// @brief The draw calls recorded by a parallel stream, which are added to the frame once every stream has finished
+        RenderFrameStats StreamStats;
+
+        VulkanRenderOperation(VulkanRenderFrame& frame, RenderGraph& graph, RenderScene& scene, VkCommandBuffer commandBuffer,
+            VulkanUniformStorage& uniformStorage, bool isStream);
     };
 
     class VulkanRenderContext : public RenderContext
@@ -50,7 +80,7 @@ namespace Coco
         ~VulkanRenderContext();
 
         Sizei GetFramebufferSize() const override;
-        void BeginPass(uint64 passIndex, Span<const RenderPassAttachmentInfo> passAttachments) override;
+        void BeginPass(uint64 passIndex, Span<const RenderPassAttachmentInfo> passAttachments, bool recordInParallel) override;
         void EndPass() override;
         void SetViewport(const Recti& viewportRect) override;
         void SetScissor(const Recti& scissorRect) override;
@@ -60,17 +90,59 @@ namespace Coco
         void BindGlobalBuffer(const char* name) override;
         bool CreateAndBindInstanceBuffer(uint64 instanceID, const char* name, ShaderCursor& outCursor) override;
         void BindInstanceBuffer(uint64 instanceID, const char* name) override;
+        bool BindPersistentInstanceBuffer(uint64 instanceID, uint64 version, const char* name, ShaderCursor& outCursor) override;
         void SetDrawData(const void* data, uint64 dataSize, Span<const SharedPtr<Texture>> textures) override;
         void DrawObject(const RenderObject& obj) override;
+        bool CanDrawIndirect(const RenderObject& obj) const override;
+        void CullIndirect(uint64 batchID, const ViewFrustum& frustum, Span<const IndirectDrawObject> objects, Span<const uint8> instanceData, uint64 instanceDataStride) override;
+        void DrawIndirect(uint64 batchID) override;
+        void RecordParallel(uint32 streamCount, const ParallelRecordFunction& recordFunction) override;
 
-        void WaitForWorkToComplete();
         void Begin(VulkanRenderFrame& frame, RenderGraph& graph, RenderScene& scene, VkCommandBuffer commandBuffer);
-        void Submit(Span<const std::pair<Ref<VulkanGraphicsSemaphore>, VkPipelineStageFlags2>> waitSemaphores, Ref<VulkanGraphicsSemaphore> renderingCompleteSemaphore);
+
+        /// @brief Begins recording a stream of a parallel pass into a secondary command buffer
+        /// @param frame The frame being rendered
+        /// @param graph The graph being rendered
+        /// @param scene The scene being rendered
+        /// @param commandBuffer The secondary command buffer
+        /// @param uniformStorage The uniform storage dedicated to the stream
+        /// @param inheritanceInfo The inheritance info of the pass that the stream will execute in
+        void BeginStream(VulkanRenderFrame& frame, RenderGraph& graph, RenderScene& scene, VkCommandBuffer commandBuffer,
+            VulkanUniformStorage& uniformStorage, const VkCommandBufferInheritanceInfo& inheritanceInfo);
+
+        /// @brief Ends recording a stream started with BeginStream()
+        /// @return The draw calls that the stream recorded
+        RenderFrameStats EndStream();
+
+        /// @brief Ends recording started with Begin(). The frame submits the returned command buffer with the rest of the frame's work
+        /// @return The recorded command buffer
+        VkCommandBuffer End();
 
     private:
+        /// @brief The largest push constant block that bindless texture indices can be appended to
+        static constexpr uint64 _maxBindlessPushConstantSize = 256;
+
+        /// @brief The name of the parameter block that indirectly drawn objects read their instance data from
+        static constexpr const char* _instanceBlockName = "indirectInstances";
+
         VulkanGraphicsPlatform* _platform;
-        ManagedRef<VulkanGraphicsFence> _renderCompletedFence;
         Optional<VulkanRenderOperation> _currentRenderOperation;
+
+    private:
+        void SetDefaultDynamicState();
+
+        /// @brief Locks the platform's shared state if this context is recording a parallel stream, since other streams may be using it on other threads
+        /// @return The lock, which doesn't own anything if this context isn't recording a stream
+        std::unique_lock<std::mutex> LockSharedState();
+
+        /// @brief Counts a draw call in the frame's statistics, or in the stream's statistics if this context is recording a parallel stream
+        /// @param triangleCount The number of triangles drawn
+        /// @param vertexCount The number of vertices drawn
+        void AddDrawCall(uint32 triangleCount, uint32 vertexCount);
+
+        /// @brief Binds the pipeline, vertex buffers, and index buffer for drawing a mesh with the bound shader, if they aren't already bound
+        /// @param meshEntry The mesh
+        void BindMesh(const MeshEntry& meshEntry);
     };
 } // Coco
 
@@ -19,20 +19,17 @@ namespace Coco
     VulkanShaderProgram::VulkanShaderProgram(uint64 id, VulkanGraphicsPlatform* platform, const FilePath& shaderPath) :
         ShaderProgram(id),
         _platform(platform),
-        _linkedProgram(),
-        _globalUniformsLayoutInfo(nullptr),
+        _shaderPath(shaderPath),
+        _layout(),
         _pipelineLayout(),
         _shaderModule(nullptr),
         _vertexChannels()
     {
-        _linkedProgram = _platform->GetShaderProgramCompiler()->CompileShader(shaderPath);
+        SlangCompiledProgram compiledProgram = _platform->GetShaderProgramCompiler()->CompileShader(shaderPath);
+        _layout = compiledProgram.Layout;
 
-        Slang::ComPtr<slang::IBlob> programCode;
-        auto result = _linkedProgram->getTargetCode(0, programCode.writeRef());
-        COCO_ASSERT(SLANG_SUCCEEDED(result), "Failed to get program code");
-
-        auto layout = _linkedProgram->getLayout();
-        _globalUniformsLayoutInfo = layout->getGlobalParamsVarLayout()->getTypeLayout();
+        Slang::ComPtr<slang::IBlob> programCode = compiledProgram.TargetCode;
+        COCO_ASSERT(programCode, "Failed to get program code");
 
         VkShaderModuleCreateInfo createInfo{VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO};
         createInfo.flags = 0;
@@ -58,7 +55,8 @@ namespace Coco
 
         for (auto& setLayout : _pipelineLayout.DescriptorSetLayouts)
         {
-            if (setLayout.DescriptorSetLayout)
+            // The bindless texture table's layout is owned by the platform
+            if (setLayout.DescriptorSetLayout && !setLayout.IsBindlessTextureTable)
             {
                 vkDestroyDescriptorSetLayout(_platform->GetDevice(), setLayout.DescriptorSetLayout, _platform->GetAllocationCallbacks());
                 setLayout.DescriptorSetLayout = nullptr;
@@ -77,43 +75,71 @@ namespace Coco
         COCO_ENGINE_LOG_VERBOSE("Destroyed VulkanShaderProgram %u", GetID());
     }
 
-    slang::ProgramLayout* VulkanShaderProgram::GetProgramLayout()
+    int64 VulkanShaderProgram::GetParamBlockIndex(const char* name)
     {
-        return _linkedProgram->getLayout();
+        const int64 index = _layout->GetGlobalParamsTypeLayout()->FindFieldIndexByName(name);
+
+        // Only parameter blocks have a set of their own
+        if (index == -1 || _pipelineLayout.ParamBlockSetIndices[index] == VulkanPipelineLayout::InvalidSetIndex)
+            return -1;
+
+        return index;
     }
 
-    int64 VulkanShaderProgram::GetParamBlockIndex(const char* name)
+    const ShaderTypeLayout* VulkanShaderProgram::GetParamBlockLayout(uint64 index)
     {
-        return _globalUniformsLayoutInfo->findFieldIndexByName(name);
+        return _layout->GetParamBlockLayout(index);
     }
 
-    slang::TypeLayoutReflection* VulkanShaderProgram::GetParamBlockLayout(uint64 index)
+    void VulkanShaderProgram::GetVertexInputDescriptions(const VertexFormat& format,
+        ArrayContainer<VkVertexInputBindingDescription>& outBindings,
+        ArrayContainer<VkVertexInputAttributeDescription>& outAttributes) const
     {
-        auto field = _globalUniformsLayoutInfo->getFieldByIndex(index);
-        COCO_ASSERT(field, "Invalid field index");
+        const bool isInterleaved = format.LayoutMode == VertexLayoutMode::Interleaved;
 
-        return field->getTypeLayout()->getElementTypeLayout();
-    }
+        // Interleaved vertices are read from a single binding
+        if (isInterleaved)
+        {
+            VkVertexInputBindingDescription& vertexInput = outBindings.EmplaceBack();
+            vertexInput.binding = 0;
+            vertexInput.stride = format.GetVertexSize();
+            vertexInput.inputRate = VK_VERTEX_INPUT_RATE_VERTEX;
+        }
 
-    VkPipelineVertexInputStateCreateInfo VulkanShaderProgram::GetVertexInputStateCreateInfo() const
-    {
-        VkPipelineVertexInputStateCreateInfo createInfo{ VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO };
-        createInfo.pVertexBindingDescriptions = _vertexInputBindingDescriptions.Data();
-        createInfo.vertexBindingDescriptionCount = static_cast<uint32_t>(_vertexInputBindingDescriptions.GetCount());
-        createInfo.pVertexAttributeDescriptions = _vertexInputAttributeDescriptions.Data();
-        createInfo.vertexAttributeDescriptionCount = static_cast<uint32_t>(_vertexInputAttributeDescriptions.GetCount());
+        uint32 vertexLocationIndex = 0;
+
+        // Add the vertex attributes
+        for (const auto& channel : _vertexChannels)
+        {
+            const bool hasChannel = format.HasChannel(channel);
+            const uint8 channelIndex = static_cast<uint8>(channel);
+
+            // Channels the mesh has no data for read a small format from the start of the vertex so they never read out of bounds
+            const VkFormat attributeFormat = hasChannel ? VulkanUtils::ToVkFormat(channel, format.ChannelFormats[channelIndex]) : VK_FORMAT_R8G8B8A8_UNORM;
+
+            if (!isInterleaved)
+            {
+                VkVertexInputBindingDescription& vertexInput = outBindings.EmplaceBack();
+                vertexInput.binding = vertexLocationIndex; // The index of the binding
+                vertexInput.stride = hasChannel ? format.GetChannelSize(channel) : 4; // Size of a single vertice's data
+                vertexInput.inputRate = VK_VERTEX_INPUT_RATE_VERTEX; // One data entry for each vertex
+            }
+
+            VkVertexInputAttributeDescription& desc = outAttributes.EmplaceBack();
+            desc.binding = isInterleaved ? 0 : vertexLocationIndex; // The input binding index
+            desc.location = vertexLocationIndex;
+            desc.format = attributeFormat;
+            desc.offset = isInterleaved && hasChannel ? format.GetInterleavedChannelOffset(channel) : 0;
 
-        return createInfo;
+            ++vertexLocationIndex;
+        }
     }
 
     void VulkanShaderProgram::GetStageInfos(ArrayContainer<VkPipelineShaderStageCreateInfo>& outStageInfos) const
     {
-        auto programLayout = _linkedProgram->getLayout();
-
-        for (uint8 i = 0; i < programLayout->getEntryPointCount(); ++i)
+        for (const ShaderEntryPointLayout& entryPoint : _layout->GetEntryPoints())
         {
-            auto entryPoint = programLayout->getEntryPointByIndex(i);
-            switch (entryPoint->getStage())
+            switch (entryPoint.Stage)
             {
                 case SLANG_STAGE_VERTEX:
                 {
@@ -141,31 +167,13 @@ namespace Coco
 
     void VulkanShaderProgram::ReflectVertexInputInformation()
     {
-        SlangCompiler::ReflectVertexAttributes(_linkedProgram->getLayout(), _vertexChannels);
-
-        uint32 vertexLocationIndex = 0;
-
-        // Add the vertex attributes
-        for (const auto& channel : _vertexChannels)
-        {
-            VkVertexInputBindingDescription& vertexInput = _vertexInputBindingDescriptions.EmplaceBack();
-            vertexInput.binding = vertexLocationIndex; // The index of the binding
-            vertexInput.stride = GetVertexChannelElementCount(channel) * sizeof(float); // Size of a single vertice's data
-            vertexInput.inputRate = VK_VERTEX_INPUT_RATE_VERTEX; // One data entry for each vertex
-
-            VkVertexInputAttributeDescription& desc = _vertexInputAttributeDescriptions.EmplaceBack();
-            desc.binding = vertexLocationIndex; // The input binding index
-            desc.location = vertexLocationIndex;
-            desc.format = VulkanUtils::ToVkFormat(channel);
-            desc.offset = 0;
-
-            ++vertexLocationIndex;
-        }
+        for (const VertexChannel channel : _layout->GetVertexChannels())
+            _vertexChannels.Append(channel);
     }
 
     void VulkanShaderProgram::CreatePipelineLayout()
     {
         VulkanPipelineLayoutBuilder pipelineLayoutBuilder(_platform);
-        _pipelineLayout = pipelineLayoutBuilder.BuildForProgram(_linkedProgram->getLayout());
+        _pipelineLayout = pipelineLayoutBuilder.BuildForProgram(*_layout);
     }
 } // Coco
\ No newline at end of file
@@ -13,7 +13,6 @@
 
 #include "Coco/Core/Types/Array.h"
 #include "Coco/Rendering/RHI/Vulkan/VulkanDescriptorSetLayout.h"
-#include <slang-com-ptr.h>
 
 #include "Coco/Rendering/RHI/Vulkan/VulkanPipelineLayout.h"
 
@@ -27,22 +26,29 @@ namespace Coco
         VulkanShaderProgram(uint64 id, VulkanGraphicsPlatform* platform, const FilePath& shaderPath);
         ~VulkanShaderProgram();
 
-        slang::ProgramLayout* GetProgramLayout() override;
+        const ShaderProgramLayout& GetProgramLayout() const override { return *_layout; }
         int64 GetParamBlockIndex(const char* name) override;
-        slang::TypeLayoutReflection* GetParamBlockLayout(uint64 index) override;
+        const ShaderTypeLayout* GetParamBlockLayout(uint64 index) override;
 
         Span<const VertexChannel> GetVertexChannels() const { return _vertexChannels; }
         Span<const VulkanDescriptorSetLayout> GetDescriptorSetLayouts() const { return _pipelineLayout.DescriptorSetLayouts; }
         const VulkanPipelineLayout* GetPipelineLayout() const { return &_pipelineLayout; }
-        VkPipelineVertexInputStateCreateInfo GetVertexInputStateCreateInfo() const;
+
+        /// @brief Gets the vertex input bindings and attributes for drawing meshes with a vertex format using this shader
+        /// @param format The vertex format of the meshes
+        /// @param outBindings Will be filled with the vertex input bindings
+        /// @param outAttributes Will be filled with the vertex input attributes
+        void GetVertexInputDescriptions(const VertexFormat& format,
+            ArrayContainer<VkVertexInputBindingDescription>& outBindings,
+            ArrayContainer<VkVertexInputAttributeDescription>& outAttributes) const;
+
         void GetStageInfos(ArrayContainer<VkPipelineShaderStageCreateInfo>& outStageInfos) const;
+        const FilePath& GetShaderPath() const { return _shaderPath; }
 
     private:
         VulkanGraphicsPlatform* _platform;
-        Slang::ComPtr<slang::IComponentType> _linkedProgram;
-        slang::TypeLayoutReflection* _globalUniformsLayoutInfo;
-        Array<VkVertexInputBindingDescription> _vertexInputBindingDescriptions;
-        Array<VkVertexInputAttributeDescription> _vertexInputAttributeDescriptions;
+        FilePath _shaderPath;
+        SharedPtr<ShaderProgramLayout> _layout;
         VulkanPipelineLayout _pipelineLayout;
         VkShaderModule _shaderModule;
         StackArray<VertexChannel, 5> _vertexChannels;
@@ -0,0 +1,44 @@
+//
+// Created by cullen on 10/18/26.
+//
+
+#include "Coco/Core/Engine.h"
+#include "Coco/Rendering/RHI/Vulkan/VulkanGraphicsPlatform.h"
+#include "../VulkanUtils.h"
+#include "VulkanTransientMemory.h"
+
+namespace Coco
+{
+    VulkanTransientMemory::VulkanTransientMemory(uint64 id, VulkanGraphicsPlatform* platform, const GraphicsMemoryRequirements& requirements) :
+        TransientMemory(id, requirements),
+        _platform(platform),
+        _allocation(nullptr)
+    {
+        VkMemoryRequirements memoryRequirements{};
+        memoryRequirements.size = requirements.Size;
+        memoryRequirements.alignment = requirements.Alignment;
+        memoryRequirements.memoryTypeBits = requirements.CompatibilityMask;
+
+        VmaAllocationCreateInfo allocCreateInfo{};
+        allocCreateInfo.requiredFlags = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+
+        VmaAllocationInfo allocInfo{};
+        AssertVkSuccess(vmaAllocateMemory(_platform->GetVmaAllocator(), &memoryRequirements, &allocCreateInfo, &_allocation, &allocInfo));
+
+        // Narrow the mask to the memory type that was picked so only images that can live in it are bound here
+        _requirements.CompatibilityMask = 1u << allocInfo.memoryType;
+
+        COCO_ENGINE_LOG_VERBOSE("Created VulkanTransientMemory %u (%llu bytes)", id, requirements.Size);
+    }
+
+    VulkanTransientMemory::~VulkanTransientMemory()
+    {
+        if (_allocation)
+        {
+            vmaFreeMemory(_platform->GetVmaAllocator(), _allocation);
+            _allocation = nullptr;
+        }
+
+        COCO_ENGINE_LOG_VERBOSE("Destroyed VulkanTransientMemory %u", GetID());
+    }
+} // Coco
\ No newline at end of file
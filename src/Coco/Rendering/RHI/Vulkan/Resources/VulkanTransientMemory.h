@@ -0,0 +1,31 @@
+//
+// Created by cullen on 10/18/26.
+//
+
+#ifndef COCOENGINE_VULKANTRANSIENTMEMORY_H
+#define COCOENGINE_VULKANTRANSIENTMEMORY_H
+#include "Coco/Rendering/Graphics/Resources/TransientMemory.h"
+
+#include "Coco/Rendering/RHI/Vulkan/VulkanIncludes.h"
+#include <vk_mem_alloc.h>
+
+namespace Coco
+{
+    class VulkanGraphicsPlatform;
+
+    /// @brief A device-local VMA allocation that transient images are bound to with vmaCreateAliasingImage
+    class VulkanTransientMemory : public TransientMemory
+    {
+    public:
+        VulkanTransientMemory(uint64 id, VulkanGraphicsPlatform* platform, const GraphicsMemoryRequirements& requirements);
+        ~VulkanTransientMemory();
+
+        VmaAllocation GetAllocation() const { return _allocation; }
+
+    private:
+        VulkanGraphicsPlatform* _platform;
+        VmaAllocation _allocation;
+    };
+} // Coco
+
+#endif //COCOENGINE_VULKANTRANSIENTMEMORY_H
\ No newline at end of file
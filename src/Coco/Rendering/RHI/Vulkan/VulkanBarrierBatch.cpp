@@ -0,0 +1,58 @@
+//
+// Created by cullen on 10/18/26.
+//
+
+#include "VulkanBarrierBatch.h"
+
+#include "Resources/VulkanImage.h"
+
+namespace Coco
+{
+    VulkanBarrierBatch::VulkanBarrierBatch() :
+        _imageBarriers()
+    {}
+
+    void VulkanBarrierBatch::AddImageTransition(VulkanImage& image, VkImageLayout newLayout, bool discardContents)
+    {
+        VkImageMemoryBarrier2 barrier;
+        if (!image.CreateLayoutBarrier(newLayout, discardContents, barrier))
+            return;
+
+        int64 existingIndex = _imageBarriers.Find([&barrier](const VkImageMemoryBarrier2& other) { return other.image == barrier.image; });
+
+        if (existingIndex == -1)
+        {
+            COCO_ASSERT(_imageBarriers.GetCount() < MaxImageBarriers, "Too many image barriers in one batch");
+            _imageBarriers.Append(barrier);
+            return;
+        }
+
+        // Skip the intermediate layout by going straight from the first transition's layout to the new one
+        VkImageMemoryBarrier2& existing = _imageBarriers[existingIndex];
+
+        if (discardContents)
+        {
+            existing.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+            existing.srcStageMask |= barrier.srcStageMask;
+            existing.srcAccessMask |= barrier.srcAccessMask;
+        }
+
+        existing.newLayout = barrier.newLayout;
+        existing.dstStageMask = barrier.dstStageMask;
+        existing.dstAccessMask = barrier.dstAccessMask;
+    }
+
+    void VulkanBarrierBatch::Record(VkCommandBuffer commandBuffer)
+    {
+        if (_imageBarriers.IsEmpty())
+            return;
+
+        VkDependencyInfo dependencyInfo{VK_STRUCTURE_TYPE_DEPENDENCY_INFO};
+        dependencyInfo.imageMemoryBarrierCount = static_cast<uint32>(_imageBarriers.GetCount());
+        dependencyInfo.pImageMemoryBarriers = _imageBarriers.Data();
+
+        vkCmdPipelineBarrier2(commandBuffer, &dependencyInfo);
+
+        _imageBarriers.Clear();
+    }
+} // Coco
\ No newline at end of file
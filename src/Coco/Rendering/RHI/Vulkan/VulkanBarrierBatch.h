@@ -0,0 +1,43 @@
+//
+// Created by cullen on 10/18/26.
+//
+
+#ifndef COCOENGINE_VULKANBARRIERBATCH_H
+#define COCOENGINE_VULKANBARRIERBATCH_H
+#include "Coco/Core/Types/StackArray.h"
+#include "VulkanIncludes.h"
+
+namespace Coco
+{
+    class VulkanImage;
+
+    /// @brief Collects image layout transitions so they can be recorded with a single vkCmdPipelineBarrier2
+    class VulkanBarrierBatch
+    {
+    public:
+        /// @brief The maximum number of image barriers in a batch
+        static constexpr uint64 MaxImageBarriers = 32;
+
+        VulkanBarrierBatch();
+
+        /// @brief Adds a transition of an image to a new layout. Transitions to the layout the image is already in are skipped,
+        /// and multiple transitions of the same image are merged into one
+        /// @param image The image
+        /// @param newLayout The layout to transition to
+        /// @param discardContents If true, the previous contents of the image are discarded
+        void AddImageTransition(VulkanImage& image, VkImageLayout newLayout, bool discardContents = false);
+
+        /// @brief Gets if this batch has any barriers
+        /// @return True if there are no barriers to record
+        bool IsEmpty() const { return _imageBarriers.IsEmpty(); }
+
+        /// @brief Records all barriers in this batch and clears it
+        /// @param commandBuffer The command buffer to record to
+        void Record(VkCommandBuffer commandBuffer);
+
+    private:
+        StackArray<VkImageMemoryBarrier2, MaxImageBarriers> _imageBarriers;
+    };
+} // Coco
+
+#endif //COCOENGINE_VULKANBARRIERBATCH_H
\ No newline at end of file
@@ -14,7 +14,9 @@ namespace Coco
         _platform(platform),
         _commandPool(nullptr),
         _commandBuffers(nullptr, 3),
-        _currentCommandBufferIndex(0)
+        _currentCommandBufferIndex(0),
+        _secondaryCommandBuffers(),
+        _currentSecondaryCommandBufferIndex(0)
     {
         VkCommandPoolCreateInfo commandPoolCreateInfo { VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO };
         commandPoolCreateInfo.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
@@ -26,6 +28,7 @@ namespace Coco
     VulkanCommandPool::~VulkanCommandPool()
     {
         _commandBuffers.Clear(true);
+        _secondaryCommandBuffers.Clear(true);
 
         if (_commandPool)
         {
@@ -35,19 +38,22 @@ namespace Coco
         }
     }
 
-    VkCommandBuffer VulkanCommandPool::AllocateCommandBuffer()
+    VkCommandBuffer VulkanCommandPool::AllocateCommandBuffer(bool secondary)
     {
-        if (_currentCommandBufferIndex < _commandBuffers.GetCount())
-            return _commandBuffers[_currentCommandBufferIndex++];
+        Array<VkCommandBuffer>& commandBuffers = secondary ? _secondaryCommandBuffers : _commandBuffers;
+        uint64& currentIndex = secondary ? _currentSecondaryCommandBufferIndex : _currentCommandBufferIndex;
+
+        if (currentIndex < commandBuffers.GetCount())
+            return commandBuffers[currentIndex++];
 
         VkCommandBufferAllocateInfo allocateInfo { VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO };
         allocateInfo.commandPool = _commandPool;
         allocateInfo.commandBufferCount = 1;
-        allocateInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        allocateInfo.level = secondary ? VK_COMMAND_BUFFER_LEVEL_SECONDARY : VK_COMMAND_BUFFER_LEVEL_PRIMARY;
 
-        VkCommandBuffer& commandBuffer = _commandBuffers.EmplaceBack(nullptr);
+        VkCommandBuffer& commandBuffer = commandBuffers.EmplaceBack(nullptr);
         AssertVkSuccess(vkAllocateCommandBuffers(_platform->GetDevice(), &allocateInfo, &commandBuffer));
-        _currentCommandBufferIndex++;
+        currentIndex++;
 
         return commandBuffer;
     }
@@ -56,5 +62,6 @@ namespace Coco
     {
         vkResetCommandPool(_platform->GetDevice(), _commandPool, VK_COMMAND_POOL_RESET_RELEASE_RESOURCES_BIT);
         _currentCommandBufferIndex = 0;
+        _currentSecondaryCommandBufferIndex = 0;
     }
 } // Coco
\ No newline at end of file
@@ -19,7 +19,7 @@ namespace Coco
         VulkanCommandPool(VulkanGraphicsPlatform* platform, VulkanQueue::Type queueType);
         ~VulkanCommandPool();
 
-        VkCommandBuffer AllocateCommandBuffer();
+        VkCommandBuffer AllocateCommandBuffer(bool secondary = false);
         void Reset();
 
     private:
@@ -27,6 +27,8 @@ namespace Coco
         VkCommandPool _commandPool;
         Array<VkCommandBuffer> _commandBuffers;
         uint64 _currentCommandBufferIndex;
+        Array<VkCommandBuffer> _secondaryCommandBuffers;
+        uint64 _currentSecondaryCommandBufferIndex;
     };
 } // Coco
 
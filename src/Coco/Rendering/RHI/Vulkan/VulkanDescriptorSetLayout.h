@@ -19,6 +19,9 @@ namespace Coco
         ShaderStageFlags ShaderStages;
         uint32 DescriptorSetIndex;
         VkDescriptorSetLayout DescriptorSetLayout;
+
+        /// @brief If true, this set is the device's bindless texture table, whose layout and descriptor set are owned by the platform
+        bool IsBindlessTextureTable;
     /*public:
         VulkanDescriptorSetLayout(VulkanGraphicsPlatform* platform);
         ~VulkanDescriptorSetLayout();
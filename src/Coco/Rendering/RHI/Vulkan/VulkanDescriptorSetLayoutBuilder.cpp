@@ -11,17 +11,18 @@
 namespace Coco
 {
     VulkanDescriptorSetLayoutBuilder::VulkanDescriptorSetLayoutBuilder(
-        VulkanPipelineLayoutBuilder& pipelineLayoutBuilder) :
+        VulkanPipelineLayoutBuilder& pipelineLayoutBuilder, uint32 space) :
         _pipelineLayoutBuilder(&pipelineLayoutBuilder),
+        _space(space),
         _layout()
     {
         _layout.ShaderStages = VulkanUtils::ToShaderStageFlags(pipelineLayoutBuilder._currentShaderStage);
     }
 
     void VulkanDescriptorSetLayoutBuilder::AddDescriptorRanges(
-        slang::TypeLayoutReflection* elementTypeLayout)
+        const ShaderTypeLayout* elementTypeLayout)
     {
-        if (elementTypeLayout->getSize() > 0)
+        if (elementTypeLayout->Size > 0)
             AddAutomaticallyInducedUniformBuffer();
 
         AddRanges(elementTypeLayout);
@@ -50,35 +51,60 @@ namespace Coco
         binding.stageFlags = _pipelineLayoutBuilder->_currentShaderStage;
         binding.binding = bindingIndex;
         binding.descriptorCount = 1;
-        binding.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+        // Dynamic so that instances of the block can share a descriptor set and only change their offset
+        binding.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
     }
 
-    void VulkanDescriptorSetLayoutBuilder::AddRanges(slang::TypeLayoutReflection* typeLayout)
+    void VulkanDescriptorSetLayoutBuilder::AddRanges(const ShaderTypeLayout* typeLayout)
     {
-        int rangeCount = typeLayout->getDescriptorSetDescriptorRangeCount(0);
-        for (int i = 0; i < rangeCount; i++)
+        if (!typeLayout->DescriptorSets.IsEmpty())
         {
-            AddDescriptorRange(typeLayout, i);
+            const ShaderDescriptorSetLayout& set = typeLayout->DescriptorSets[0];
+            for (uint32 i = 0; i < set.DescriptorRanges.GetCount(); i++)
+            {
+                AddDescriptorRange(set.DescriptorRanges[i], i);
+            }
         }
 
-        _pipelineLayoutBuilder->AddSubObjectRanges(typeLayout);
+        // Slang places unbounded arrays in their own space, which becomes the bindless texture table's set
+        for (const ShaderDescriptorSetLayout& set : typeLayout->DescriptorSets)
+        {
+            AddUnboundedRanges(set);
+        }
+
+        _pipelineLayoutBuilder->AddSubObjectRanges(typeLayout, _space);
     }
 
-    void VulkanDescriptorSetLayoutBuilder::AddDescriptorRange(slang::TypeLayoutReflection* typeLayout, int rangeIndex)
+    void VulkanDescriptorSetLayoutBuilder::AddDescriptorRange(const ShaderDescriptorRangeLayout& range, uint32 rangeIndex)
     {
-        auto bindingType = typeLayout->getDescriptorSetDescriptorRangeType(0, rangeIndex);
+        const slang::BindingType bindingType = range.BindingType;
 
         if (bindingType == slang::BindingType::PushConstant)
             return;
 
-        auto descriptorCount = typeLayout->getDescriptorSetDescriptorRangeDescriptorCount(0, rangeIndex);
+        const uint64 descriptorCount = range.DescriptorCount;
+        // Unbounded arrays are added by AddUnboundedRanges()
+        if (static_cast<size_t>(descriptorCount) == SLANG_UNBOUNDED_SIZE)
+            return;
+
         //uint32 bindingIndex = _layout.LayoutBindings.GetCount();
-        uint32 bindingIndex = static_cast<uint32>(rangeIndex) + _layout.LayoutBindings.GetCount();
+        uint32 bindingIndex = rangeIndex + _layout.LayoutBindings.GetCount();
 
         VkDescriptorSetLayoutBinding& binding = _layout.LayoutBindings.EmplaceBack();
         binding.stageFlags = _pipelineLayoutBuilder->_currentShaderStage;
         binding.binding = bindingIndex;
-        binding.descriptorCount = descriptorCount;
+        binding.descriptorCount = static_cast<uint32>(descriptorCount);
         binding.descriptorType = VulkanUtils::ToVkDescriptorType(bindingType);
     }
+
+    void VulkanDescriptorSetLayoutBuilder::AddUnboundedRanges(const ShaderDescriptorSetLayout& set)
+    {
+        for (const ShaderDescriptorRangeLayout& range : set.DescriptorRanges)
+        {
+            if (static_cast<size_t>(range.DescriptorCount) != SLANG_UNBOUNDED_SIZE)
+                continue;
+
+            _pipelineLayoutBuilder->AddBindlessTextureTable(range.BindingType, _space + set.SpaceOffset);
+        }
+    }
 } // Coco
\ No newline at end of file
@@ -8,7 +8,7 @@
 
 #include "VulkanDescriptorSetLayout.h"
 #include "VulkanIncludes.h"
-#include <slang.h>
+#include "Coco/Rendering/Graphics/ShaderLayout.h"
 
 namespace Coco
 {
@@ -18,20 +18,24 @@ namespace Coco
     class VulkanDescriptorSetLayoutBuilder
     {
     public:
-        VulkanDescriptorSetLayoutBuilder(VulkanPipelineLayoutBuilder& pipelineLayoutBuilder);
+        /// @param pipelineLayoutBuilder The builder of the pipeline layout that the set belongs to
+        /// @param space The register space of the type whose descriptors are added
+        VulkanDescriptorSetLayoutBuilder(VulkanPipelineLayoutBuilder& pipelineLayoutBuilder, uint32 space);
 
-        void AddDescriptorRanges(slang::TypeLayoutReflection* elementTypeLayout);
+        void AddDescriptorRanges(const ShaderTypeLayout* elementTypeLayout);
 
         VulkanDescriptorSetLayout FinishBuilding(VulkanGraphicsPlatform& platform);
 
     private:
         VulkanPipelineLayoutBuilder* _pipelineLayoutBuilder;
+        uint32 _space;
         VulkanDescriptorSetLayout _layout;
 
     private:
         void AddAutomaticallyInducedUniformBuffer();
-        void AddRanges(slang::TypeLayoutReflection* typeLayout);
-        void AddDescriptorRange(slang::TypeLayoutReflection* typeLayout, int rangeIndex);
+        void AddRanges(const ShaderTypeLayout* typeLayout);
+        void AddDescriptorRange(const ShaderDescriptorRangeLayout& range, uint32 rangeIndex);
+        void AddUnboundedRanges(const ShaderDescriptorSetLayout& set);
     };
 } // Coco
 
@@ -12,7 +12,7 @@
 namespace Coco
 {
     VulkanDescriptorSetPool::VulkanDescriptorSetPool(VulkanGraphicsPlatform* platform,
-        Ref<VulkanShaderProgram> shaderProgram) :
+        Ref<VulkanShaderProgram> shaderProgram, bool allowFreeingSets) :
         _platform(platform),
         _shaderProgram(shaderProgram),
         _pools(nullptr, 1),
@@ -25,6 +25,10 @@ namespace Coco
 
         for (const auto& setLayout : setLayouts)
         {
+            // The bindless texture table is allocated by the platform
+            if (setLayout.IsBindlessTextureTable)
+                continue;
+
             for (const auto& layoutBinding : setLayout.LayoutBindings)
             {
                 if (typeCounts.Contains(layoutBinding.descriptorType))
@@ -48,6 +52,9 @@ namespace Coco
         _poolCreateInfo.pPoolSizes = _poolSizes.Data();
         _poolCreateInfo.poolSizeCount = static_cast<uint32>(_poolSizes.GetCount());
         _poolCreateInfo.maxSets = _maxSets;
+
+        if (allowFreeingSets)
+            _poolCreateInfo.flags = VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT;
     }
 
     VulkanDescriptorSetPool::~VulkanDescriptorSetPool()
@@ -59,7 +66,7 @@ namespace Coco
         _platform->InvalidateResource(_shaderProgram->GetID());
     }
 
-    VkDescriptorSet VulkanDescriptorSetPool::AllocateDescriptorSet(uint64 layoutIndex)
+    VkDescriptorSet VulkanDescriptorSetPool::AllocateDescriptorSet(uint64 layoutIndex, VkDescriptorPool* outPool)
     {
         auto setLayouts = _shaderProgram->GetDescriptorSetLayouts();
         COCO_ASSERT(layoutIndex < setLayouts.size(), "Invalid layout index");
@@ -81,6 +88,10 @@ namespace Coco
             if (result == VK_SUCCESS)
             {
                 pool.LastAllocatedFrameNumber = _lastAllocatedFrameNumber;
+
+                if (outPool)
+                    *outPool = pool.Pool;
+
                 break;
             }
 
@@ -99,11 +110,20 @@ namespace Coco
             AssertVkSuccess(vkAllocateDescriptorSets(_platform->GetDevice(), &allocInfo, &descriptorSet));
 
             pool.LastAllocatedFrameNumber = _lastAllocatedFrameNumber;
+
+            if (outPool)
+                *outPool = pool.Pool;
         }
 
         return descriptorSet;
     }
 
+    void VulkanDescriptorSetPool::FreeDescriptorSet(VkDescriptorPool pool, VkDescriptorSet descriptorSet)
+    {
+        COCO_ASSERT(_poolCreateInfo.flags & VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT, "Pool was not created to allow freeing descriptor sets");
+        AssertVkSuccess(vkFreeDescriptorSets(_platform->GetDevice(), pool, 1, &descriptorSet));
+    }
+
     void VulkanDescriptorSetPool::Reset()
     {
         for (auto& pool : _pools)
@@ -23,10 +23,14 @@ namespace Coco
     class VulkanDescriptorSetPool
     {
     public:
-        VulkanDescriptorSetPool(VulkanGraphicsPlatform* platform, Ref<VulkanShaderProgram> shaderProgram);
+        VulkanDescriptorSetPool(VulkanGraphicsPlatform* platform, Ref<VulkanShaderProgram> shaderProgram, bool allowFreeingSets = false);
         ~VulkanDescriptorSetPool();
 
-        VkDescriptorSet AllocateDescriptorSet(uint64 layoutIndex);
+        VulkanDescriptorSetPool(const VulkanDescriptorSetPool&) = delete;
+        VulkanDescriptorSetPool& operator=(const VulkanDescriptorSetPool&) = delete;
+
+        VkDescriptorSet AllocateDescriptorSet(uint64 layoutIndex, VkDescriptorPool* outPool = nullptr);
+        void FreeDescriptorSet(VkDescriptorPool pool, VkDescriptorSet descriptorSet);
         void Reset();
         uint64 GetLastAllocatedFrameNumber() const { return _lastAllocatedFrameNumber; }
 
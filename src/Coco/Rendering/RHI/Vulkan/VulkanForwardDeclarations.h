@@ -37,6 +37,7 @@ typedef struct VkBuffer_T* VkBuffer;
 typedef struct VkDescriptorPool_T* VkDescriptorPool;
 typedef struct VkDescriptorSet_T* VkDescriptorSet;
 struct VkDescriptorSetLayoutBinding;
+struct VkCommandBufferInheritanceInfo;
 
 // Vulkan Memory Allocator types
 typedef struct VmaAllocator_T* VmaAllocator;
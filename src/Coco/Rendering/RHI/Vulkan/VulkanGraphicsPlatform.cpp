@@ -18,8 +18,11 @@
 #include "Resources/VulkanImageSampler.h"
 #include "Resources/VulkanRenderContext.h"
 #include "Resources/VulkanShaderProgram.h"
+#include "Resources/VulkanTransientMemory.h"
+#include "VulkanPersistentUniformStorage.h"
 #include "VulkanRenderFrame.h"
 #include "VulkanStagingBuffer.h"
+#include "VulkanUploadScheduler.h"
 #include "VulkanUtils.h"
 
 #include "Coco/Rendering/RHI/Vulkan/VulkanIncludes.h"
@@ -80,6 +83,8 @@ namespace Coco
         _resourceManager(),
         _shaderProgramCompiler(),
         _graphicsResourceCache(),
+        _uploadScheduler(),
+        _persistentUniformStorage(),
         _renderFrames(nullptr, 2),
         _currentRenderFrameIndex(0),
         _currentFrameNumber(0)
@@ -99,8 +104,10 @@ namespace Coco
         _shaderProgramCompiler = CreateDefaultUnique<SlangCompiler>(SLANG_SPIRV, "spirv_1_5");
         _resourceManager = CreateDefaultUnique<GraphicsResourceManager>();
         _meshStorage = CreateDefaultUnique<MeshStorage>(this, 2);
-        _vulkanResourceCache = CreateDefaultUnique<VulkanResourceCache>(this);
+        _vulkanResourceCache = CreateDefaultUnique<VulkanResourceCache>(this, createParams.DeviceCreateParams.EnablePipelinePrewarming, _deviceDescription.SupportsBindlessTextures);
         _graphicsResourceCache = CreateDefaultUnique<GraphicsResourceCache>(this);
+        _uploadScheduler = CreateDefaultUnique<VulkanUploadScheduler>(this, createParams.DeviceCreateParams.UploadFrameBudget);
+        _persistentUniformStorage = CreateDefaultUnique<VulkanPersistentUniformStorage>(this, _persistentUniformPageSize);
 
         for (uint8 i = 0; i < 2; ++i)
             _renderFrames.EmplaceBack(CreateDefaultManagedRef<VulkanRenderFrame>(this));
@@ -112,7 +119,13 @@ namespace Coco
 
     VulkanGraphicsPlatform::~VulkanGraphicsPlatform()
     {
-        _renderFrames.Clear(true);
+        _uploadScheduler.reset();
+
+        // Frames invalidate resources while they're destroyed, so they're taken out of the platform first
+        Array<ManagedRef<VulkanRenderFrame>> renderFrames = std::move(_renderFrames);
+        renderFrames.Clear(true);
+
+        _persistentUniformStorage.reset();
         _graphicsResourceCache.reset();
         _vulkanResourceCache.reset();
         _meshStorage.reset();
@@ -166,6 +179,11 @@ namespace Coco
 
         _renderFrames[_currentRenderFrameIndex]->NewFrame();
         _meshStorage->SetCurrentDynamicMeshBuffer(_currentRenderFrameIndex);
+        _meshStorage->UpdateStaticMeshArenas();
+        _persistentUniformStorage->FreeRetiredRanges();
+        _vulkanResourceCache->PurgeUnused();
+        _graphicsResourceCache->PurgeUnused();
+        _uploadScheduler->Process();
     }
 
     Ref<RenderContext> VulkanGraphicsPlatform::CreateRenderContext()
@@ -178,6 +196,30 @@ namespace Coco
         return _resourceManager->Create<VulkanImage>(this, imageDescription);
     }
 
+    Ref<Image> VulkanGraphicsPlatform::CreateAliasedImage(const ImageDescription& imageDescription, Ref<TransientMemory> memory)
+    {
+        return _resourceManager->Create<VulkanImage>(this, imageDescription, memory.Downcast<VulkanTransientMemory>());
+    }
+
+    Ref<TransientMemory> VulkanGraphicsPlatform::CreateTransientMemory(const GraphicsMemoryRequirements& requirements)
+    {
+        return _resourceManager->Create<VulkanTransientMemory>(this, requirements);
+    }
+
+    GraphicsMemoryRequirements VulkanGraphicsPlatform::GetImageMemoryRequirements(const ImageDescription& imageDescription)
+    {
+        const VkImageCreateInfo imageCreateInfo = VulkanImage::GetImageCreateInfo(imageDescription);
+
+        VkDeviceImageMemoryRequirements requirementsInfo{VK_STRUCTURE_TYPE_DEVICE_IMAGE_MEMORY_REQUIREMENTS};
+        requirementsInfo.pCreateInfo = &imageCreateInfo;
+
+        VkMemoryRequirements2 requirements{VK_STRUCTURE_TYPE_MEMORY_REQUIREMENTS_2};
+        vkGetDeviceImageMemoryRequirements(_device, &requirementsInfo, &requirements);
+
+        const VkMemoryRequirements& memoryRequirements = requirements.memoryRequirements;
+        return GraphicsMemoryRequirements(memoryRequirements.size, memoryRequirements.alignment, memoryRequirements.memoryTypeBits);
+    }
+
     Ref<ImageSampler> VulkanGraphicsPlatform::CreateImageSampler(const ImageSamplerDescription& samplerDescription)
     {
         return _resourceManager->Create<VulkanImageSampler>(this, samplerDescription);
@@ -185,7 +227,10 @@ namespace Coco
 
     Ref<ShaderProgram> VulkanGraphicsPlatform::CreateShaderProgram(const FilePath& shaderPath)
     {
-        return _resourceManager->Create<VulkanShaderProgram>(this, shaderPath);
+        Ref<VulkanShaderProgram> shaderProgram = _resourceManager->Create<VulkanShaderProgram>(this, shaderPath);
+        _vulkanResourceCache->PrewarmPipelines(*shaderProgram);
+
+        return shaderProgram;
     }
 
     Ref<Buffer> VulkanGraphicsPlatform::CreateBuffer(const BufferDescription& bufferDescription)
@@ -198,9 +243,32 @@ namespace Coco
         return &_renderFrames[_currentRenderFrameIndex]->GetStagingBuffer();
     }
 
+    UploadScheduler* VulkanGraphicsPlatform::GetUploadScheduler()
+    {
+        return _uploadScheduler.get();
+    }
+
     void VulkanGraphicsPlatform::InvalidateResource(uint64 resourceID)
     {
         _resourceManager->Invalidate(resourceID);
+
+        // The cache is null while it is being destroyed
+        if (_vulkanResourceCache)
+            _vulkanResourceCache->OnResourceInvalidated(resourceID);
+
+        // The storage is null while it is being destroyed
+        if (_persistentUniformStorage)
+            _persistentUniformStorage->OnResourceInvalidated(resourceID);
+
+        for (auto& renderFrame : _renderFrames)
+            renderFrame->OnResourceInvalidated(resourceID);
+    }
+
+    void VulkanGraphicsPlatform::ReleasePersistentUniforms(uint64 instanceID)
+    {
+        // The storage is null while the platform is being destroyed
+        if (_persistentUniformStorage)
+            _persistentUniformStorage->Release(instanceID);
     }
 
     Ref<GraphicsSurface> VulkanGraphicsPlatform::CreateSurface(VkSurfaceKHR surface, const Sizei& framebufferSize)
@@ -435,9 +503,13 @@ namespace Coco
         appInfo.applicationVersion = VulkanUtils::ToVkVersion(createParams.App->GetVersion());
         appInfo.apiVersion = _platformAPIVersion;
 
-        // TODO: headless rendering?
         VulkanRenderingExtensions extensions;
-        extensions.InstanceExtensions.Append(VK_KHR_SURFACE_EXTENSION_NAME);
+
+        // Headless platforms only render to offscreen targets, so they can run without a display or any surface extensions
+        const bool supportPresentation = createParams.DeviceCreateParams.SupportPresentation;
+
+        if (supportPresentation)
+            extensions.InstanceExtensions.Append(VK_KHR_SURFACE_EXTENSION_NAME);
 
         VkDebugUtilsMessengerCreateInfoEXT debugCreateInfo{};
 
@@ -450,7 +522,8 @@ namespace Coco
             debugCreateInfo = GetDebugMessengerCreateInfo();
         }
 
-        _renderService->GetRenderingPlatform()->GetRenderingExtensions(*this, extensions);
+        if (supportPresentation)
+            _renderService->GetRenderingPlatform()->GetRenderingExtensions(*this, extensions);
 
         CheckExtensionsSupport(extensions.InstanceExtensions);
         CheckLayersSupport(instanceLayers);
@@ -561,6 +634,36 @@ namespace Coco
 
         _deviceDescription.SupportsWireframe = deviceFeatures.fillModeNonSolid;
 
+        // Every supported feature is enabled, so BC formats can be sampled whenever the device supports them
+        _deviceDescription.SupportsBCCompression = deviceFeatures.textureCompressionBC;
+
+        // Bindless textures need descriptor indexing, which is only enabled if it was requested
+        VkPhysicalDeviceDescriptorIndexingFeatures supportedIndexingFeatures{VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES};
+        VkPhysicalDeviceFeatures2 supportedFeatures{VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2};
+        supportedFeatures.pNext = &supportedIndexingFeatures;
+        vkGetPhysicalDeviceFeatures2(_physicalDevice, &supportedFeatures);
+
+        _deviceDescription.SupportsBindlessTextures = createParams.EnableBindlessTextures && VulkanBindlessTextureTable::IsSupported(supportedIndexingFeatures);
+
+        if (createParams.EnableBindlessTextures && !_deviceDescription.SupportsBindlessTextures)
+            COCO_ENGINE_LOG_WARN("Bindless textures were requested but the device doesn't support descriptor indexing. Falling back to per-draw texture descriptor sets");
+
+        // GPU culling draws with a count written by a compute shader, and objects find their instance data through their first instance
+        uint32 extensionCount;
+        vkEnumerateDeviceExtensionProperties(_physicalDevice, nullptr, &extensionCount, nullptr);
+        Array<VkExtensionProperties> supportedExtensions(extensionCount, VkExtensionProperties());
+        vkEnumerateDeviceExtensionProperties(_physicalDevice, nullptr, &extensionCount, supportedExtensions.Data());
+
+        const bool supportsDrawIndirectCount = supportedExtensions.Contains([](const VkExtensionProperties& properties)
+        {
+            return strcmp(&properties.extensionName[0], VK_KHR_DRAW_INDIRECT_COUNT_EXTENSION_NAME) == 0;
+        });
+
+        _deviceDescription.SupportsIndirectDrawCount = supportsDrawIndirectCount && deviceFeatures.multiDrawIndirect && deviceFeatures.drawIndirectFirstInstance;
+
+        if (_deviceDescription.SupportsIndirectDrawCount)
+            deviceExtensions.Append(VK_KHR_DRAW_INDIRECT_COUNT_EXTENSION_NAME);
+
         // Create the logical device
         VkDeviceCreateInfo createInfo{ VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO };
         createInfo.pQueueCreateInfos = deviceQueueCreateInfos.Data();
@@ -582,7 +685,18 @@ namespace Coco
         synchronization2Features.synchronization2 = true;
         synchronization2Features.pNext = &timelineSemaphoreFeatures;
 
-        createInfo.pNext = &synchronization2Features;
+        VkPhysicalDeviceDescriptorIndexingFeatures descriptorIndexingFeatures{VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES};
+        descriptorIndexingFeatures.pNext = &synchronization2Features;
+
+        if (_deviceDescription.SupportsBindlessTextures)
+        {
+            VulkanBindlessTextureTable::EnableRequiredFeatures(descriptorIndexingFeatures);
+            createInfo.pNext = &descriptorIndexingFeatures;
+        }
+        else
+        {
+            createInfo.pNext = &synchronization2Features;
+        }
 
         AssertVkSuccess(vkCreateDevice(_physicalDevice, &createInfo, _allocationCallbacks.get(), &_device));
 
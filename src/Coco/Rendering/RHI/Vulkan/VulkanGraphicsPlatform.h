@@ -4,6 +4,7 @@
 
 #ifndef COCOENGINE_VULKANGRAPHICSPLATFORM_H
 #define COCOENGINE_VULKANGRAPHICSPLATFORM_H
+#include <mutex>
 
 #include "Coco/Core/Memory/Ptrs.h"
 #include "Coco/Rendering/Graphics/GraphicsPlatform.h"
@@ -17,8 +18,10 @@
 namespace Coco
 {
     class Application;
+    class VulkanPersistentUniformStorage;
     class VulkanRenderFrame;
     class VulkanStagingBuffer;
+    class VulkanUploadScheduler;
 
     struct VulkanGraphicsPlatformCreateParams
     {
@@ -51,14 +54,19 @@ namespace Coco
         void NextFrame() override;
         Ref<RenderContext> CreateRenderContext() override;
         Ref<Image> CreateImage(const ImageDescription& imageDescription) override;
+        Ref<Image> CreateAliasedImage(const ImageDescription& imageDescription, Ref<TransientMemory> memory) override;
+        Ref<TransientMemory> CreateTransientMemory(const GraphicsMemoryRequirements& requirements) override;
+        GraphicsMemoryRequirements GetImageMemoryRequirements(const ImageDescription& imageDescription) override;
         Ref<ImageSampler> CreateImageSampler(const ImageSamplerDescription& samplerDescription) override;
         Ref<ShaderProgram> CreateShaderProgram(const FilePath& shaderPath) override;
         Ref<Buffer> CreateBuffer(const BufferDescription& bufferDescription) override;
         MeshStorage* GetMeshStorage() override { return _meshStorage.get(); }
         StagingBuffer* GetStagingBuffer() override;
+        UploadScheduler* GetUploadScheduler() override;
         SlangCompiler* GetShaderProgramCompiler() override { return _shaderProgramCompiler.get(); }
         GraphicsResourceCache* GetResourceCache() override { return _graphicsResourceCache.get(); }
         void InvalidateResource(uint64 resourceID) override;
+        void ReleasePersistentUniforms(uint64 instanceID) override;
 
         VkInstance GetInstance() const { return _instance; }
         VkPhysicalDevice GetPhysicalDevice() const { return _physicalDevice; }
@@ -69,9 +77,17 @@ namespace Coco
         VulkanQueue* GetPresentQueue(VkSurfaceKHR surface);
         VmaAllocator GetVmaAllocator() const { return _deviceAllocator; }
         VulkanResourceCache* GetVulkanCache() { return _vulkanResourceCache.get(); }
+        VulkanPersistentUniformStorage* GetPersistentUniformStorage() { return _persistentUniformStorage.get(); }
+
+        /// @brief Gets the lock that parallel recording streams hold while changing the platform's caches, storages, and resources.
+        /// Streams only take it for shared changes, such as creating pages and pipelines, adding bindless textures and finishing texture loads
+        /// @return The lock
+        std::mutex& GetSharedStateLock() { return _sharedStateLock; }
         void WaitForIdle();
 
     private:
+        static constexpr uint64 _persistentUniformPageSize = 256 * 1024;
+
         VkInstance _instance;
         uint32 _platformAPIVersion;
         VkDebugUtilsMessengerEXT _debugMessenger;
@@ -89,9 +105,12 @@ namespace Coco
         UniquePtr<SlangCompiler> _shaderProgramCompiler;
         UniquePtr<VulkanResourceCache> _vulkanResourceCache;
         UniquePtr<GraphicsResourceCache> _graphicsResourceCache;
+        UniquePtr<VulkanUploadScheduler> _uploadScheduler;
+        UniquePtr<VulkanPersistentUniformStorage> _persistentUniformStorage;
         Array<ManagedRef<VulkanRenderFrame>> _renderFrames;
         uint8 _currentRenderFrameIndex;
         uint64 _currentFrameNumber;
+        std::mutex _sharedStateLock;
 
     private:
         static VkDebugUtilsMessengerCreateInfoEXT GetDebugMessengerCreateInfo();
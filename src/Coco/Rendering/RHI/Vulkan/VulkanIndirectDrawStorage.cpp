@@ -0,0 +1,133 @@
+//
+// Created by cullen on 10/18/26.
+//
+
+#include "VulkanIndirectDrawStorage.h"
+
+#include "VulkanGraphicsPlatform.h"
+#include "VulkanUtils.h"
+#include "Resources/VulkanShaderProgram.h"
+
+namespace Coco
+{
+    VulkanIndirectDrawGroup::VulkanIndirectDrawGroup(uint64 meshID) :
+        MeshID(meshID),
+        CommandOffset(0),
+        MaxDrawCount(0)
+    {}
+
+    VulkanIndirectBatch::VulkanIndirectBatch() :
+        Groups(),
+        CommandBuffer(),
+        CommandBufferOffset(0),
+        CountBufferOffset(0),
+        InstanceBuffer(),
+        InstanceBufferOffset(0),
+        InstanceDataSize(0)
+    {}
+
+    VulkanIndirectDrawStorage::VulkanIndirectDrawStorage(VulkanGraphicsPlatform* platform) :
+        _platform(platform),
+        _uploadBuffers(platform, BufferDescription(_bufferPageSize, BufferUsageFlags::HostVisible | BufferUsageFlags::Storage), _storageBufferAlignment),
+        _commandBuffers(platform, BufferDescription(_bufferPageSize, BufferUsageFlags::Storage | BufferUsageFlags::Indirect | BufferUsageFlags::TransferDestination), _storageBufferAlignment),
+        _cullingSetPools(),
+        _currentCullingSetPoolIndex(0),
+        _instanceSetPools(),
+        _batches()
+    {}
+
+    VulkanIndirectDrawStorage::~VulkanIndirectDrawStorage()
+    {
+        _batches.Clear();
+        _instanceSetPools.Clear();
+
+        for (VkDescriptorPool pool : _cullingSetPools)
+            vkDestroyDescriptorPool(_platform->GetDevice(), pool, _platform->GetAllocationCallbacks());
+
+        _cullingSetPools.Clear(true);
+    }
+
+    VulkanIndirectBatch& VulkanIndirectDrawStorage::CreateBatch(uint64 batchID)
+    {
+        _batches.Remove(batchID);
+        return _batches.Emplace(batchID);
+    }
+
+    const VulkanIndirectBatch* VulkanIndirectDrawStorage::GetBatch(uint64 batchID) const
+    {
+        return _batches.TryGetValue(batchID);
+    }
+
+    void VulkanIndirectDrawStorage::AllocateUploadData(uint64 size, Ref<VulkanBuffer>& outBuffer, uint64& outBufferOffset)
+    {
+        _uploadBuffers.Allocate(size, outBuffer, outBufferOffset);
+    }
+
+    void VulkanIndirectDrawStorage::AllocateCommandData(uint64 size, Ref<VulkanBuffer>& outBuffer, uint64& outBufferOffset)
+    {
+        _commandBuffers.Allocate(size, outBuffer, outBufferOffset);
+    }
+
+    VkDescriptorSet VulkanIndirectDrawStorage::AllocateCullingSet(VkDescriptorSetLayout setLayout)
+    {
+        VkDescriptorSetAllocateInfo allocInfo{VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO};
+        allocInfo.descriptorSetCount = 1;
+        allocInfo.pSetLayouts = &setLayout;
+
+        VkDescriptorSet descriptorSet = nullptr;
+
+        // Pools are filled in order and reset together, so only the current pool can have space
+        for (; _currentCullingSetPoolIndex < _cullingSetPools.GetCount(); _currentCullingSetPoolIndex++)
+        {
+            allocInfo.descriptorPool = _cullingSetPools[_currentCullingSetPoolIndex];
+            VkResult result = vkAllocateDescriptorSets(_platform->GetDevice(), &allocInfo, &descriptorSet);
+
+            if (result == VK_SUCCESS)
+                return descriptorSet;
+
+            if (result != VK_ERROR_OUT_OF_POOL_MEMORY && result != VK_ERROR_FRAGMENTED_POOL)
+                AssertVkSuccess(result);
+        }
+
+        VkDescriptorPoolSize poolSize{};
+        poolSize.type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        poolSize.descriptorCount = _cullingSetsPerPool * _cullingSetBufferCount;
+
+        VkDescriptorPoolCreateInfo poolCreateInfo{VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO};
+        poolCreateInfo.maxSets = _cullingSetsPerPool;
+        poolCreateInfo.poolSizeCount = 1;
+        poolCreateInfo.pPoolSizes = &poolSize;
+
+        VkDescriptorPool& pool = _cullingSetPools.EmplaceBack();
+        AssertVkSuccess(vkCreateDescriptorPool(_platform->GetDevice(), &poolCreateInfo, _platform->GetAllocationCallbacks(), &pool));
+
+        allocInfo.descriptorPool = pool;
+        AssertVkSuccess(vkAllocateDescriptorSets(_platform->GetDevice(), &allocInfo, &descriptorSet));
+
+        return descriptorSet;
+    }
+
+    VkDescriptorSet VulkanIndirectDrawStorage::AllocateInstanceSet(Ref<VulkanShaderProgram> shaderProgram, uint64 descriptorSetIndex)
+    {
+        auto pool = _instanceSetPools.TryGetValue(shaderProgram->GetID());
+        if (!pool)
+            pool = &_instanceSetPools.Emplace(shaderProgram->GetID(), _platform, shaderProgram);
+
+        return pool->AllocateDescriptorSet(descriptorSetIndex);
+    }
+
+    void VulkanIndirectDrawStorage::Clear()
+    {
+        _batches.Clear();
+        _uploadBuffers.Clear();
+        _commandBuffers.Clear();
+
+        for (VkDescriptorPool pool : _cullingSetPools)
+            AssertVkSuccess(vkResetDescriptorPool(_platform->GetDevice(), pool, 0));
+
+        _currentCullingSetPoolIndex = 0;
+
+        for (auto& pool : _instanceSetPools)
+            pool.second.Reset();
+    }
+} // Coco
\ No newline at end of file
@@ -0,0 +1,128 @@
+//
+// Created by cullen on 10/18/26.
+//
+
+#ifndef COCOENGINE_VULKANINDIRECTDRAWSTORAGE_H
+#define COCOENGINE_VULKANINDIRECTDRAWSTORAGE_H
+#include "Coco/Core/Types/Array.h"
+#include "Coco/Core/Types/Map.h"
+#include "Coco/Rendering/Graphics/PagedLinearBuffer.h"
+#include "VulkanDescriptorSetPool.h"
+#include "Resources/VulkanBuffer.h"
+
+namespace Coco
+{
+    class VulkanGraphicsPlatform;
+    class VulkanShaderProgram;
+
+    /// @brief A range of indirect draw commands for objects whose meshes share vertex and index buffers
+    struct VulkanIndirectDrawGroup
+    {
+        /// @brief One of the group's meshes, used to bind the buffers that the group draws from
+        uint64 MeshID;
+
+        /// @brief The index of the group's first command
+        uint32 CommandOffset;
+
+        /// @brief The number of objects in the group, which is the most commands the group can have after culling
+        uint32 MaxDrawCount;
+
+        VulkanIndirectDrawGroup(uint64 meshID);
+    };
+
+    /// @brief The draw commands and instance data of a batch of objects culled on the GPU
+    struct VulkanIndirectBatch
+    {
+        /// @brief The draw groups of the batch
+        Array<VulkanIndirectDrawGroup> Groups;
+
+        /// @brief The buffer holding the draw commands followed by the draw count of each group
+        Ref<VulkanBuffer> CommandBuffer;
+
+        /// @brief The offset of the first draw command
+        uint64 CommandBufferOffset;
+
+        /// @brief The offset of the first group's draw count
+        uint64 CountBufferOffset;
+
+        /// @brief The buffer holding the instance data of each object
+        Ref<VulkanBuffer> InstanceBuffer;
+
+        /// @brief The offset of the first object's instance data
+        uint64 InstanceBufferOffset;
+
+        /// @brief The total size of the instance data of the batch's objects
+        uint64 InstanceDataSize;
+
+        VulkanIndirectBatch();
+    };
+
+    /// @brief Per-frame memory and descriptor sets for culling objects on the GPU and drawing them indirectly
+    class VulkanIndirectDrawStorage
+    {
+    public:
+        VulkanIndirectDrawStorage(VulkanGraphicsPlatform* platform);
+        ~VulkanIndirectDrawStorage();
+
+        VulkanIndirectDrawStorage(const VulkanIndirectDrawStorage&) = delete;
+        VulkanIndirectDrawStorage& operator=(const VulkanIndirectDrawStorage&) = delete;
+
+        /// @brief Creates an empty batch, replacing a batch with the same ID that was culled earlier this frame
+        /// @param batchID The ID of the batch
+        /// @return The batch
+        VulkanIndirectBatch& CreateBatch(uint64 batchID);
+
+        /// @brief Gets a batch that was culled this frame
+        /// @param batchID The ID of the batch
+        /// @return The batch, or nullptr if a batch with the given ID wasn't culled this frame
+        const VulkanIndirectBatch* GetBatch(uint64 batchID) const;
+
+        /// @brief Allocates memory that is written by the CPU and read by shaders as a storage buffer
+        /// @param size The size of the allocation
+        /// @param outBuffer Will be set to the buffer the memory was allocated from
+        /// @param outBufferOffset Will be set to the offset of the memory in the buffer
+        void AllocateUploadData(uint64 size, Ref<VulkanBuffer>& outBuffer, uint64& outBufferOffset);
+
+        /// @brief Allocates device memory for draw commands and draw counts that are written by shaders
+        /// @param size The size of the allocation
+        /// @param outBuffer Will be set to the buffer the memory was allocated from
+        /// @param outBufferOffset Will be set to the offset of the memory in the buffer
+        void AllocateCommandData(uint64 size, Ref<VulkanBuffer>& outBuffer, uint64& outBufferOffset);
+
+        /// @brief Allocates a descriptor set for the culling shader
+        /// @param setLayout The layout of the culling shader's descriptor set
+        /// @return The descriptor set
+        VkDescriptorSet AllocateCullingSet(VkDescriptorSetLayout setLayout);
+
+        /// @brief Allocates a descriptor set for a draw shader's instance data block
+        /// @param shaderProgram The draw shader
+        /// @param descriptorSetIndex The index of the instance data block's descriptor set
+        /// @return The descriptor set
+        VkDescriptorSet AllocateInstanceSet(Ref<VulkanShaderProgram> shaderProgram, uint64 descriptorSetIndex);
+
+        /// @brief Releases this frame's batches and memory so they can be reused next frame
+        void Clear();
+
+    private:
+        static constexpr uint64 _bufferPageSize = 1024 * 1024;
+
+        /// @brief The largest minimum storage buffer offset alignment that Vulkan allows
+        static constexpr uint64 _storageBufferAlignment = 256;
+
+        /// @brief The number of culling sets each descriptor pool holds
+        static constexpr uint32 _cullingSetsPerPool = 64;
+
+        /// @brief The number of storage buffers in a culling set
+        static constexpr uint32 _cullingSetBufferCount = 3;
+
+        VulkanGraphicsPlatform* _platform;
+        PagedLinearBuffer<VulkanBuffer> _uploadBuffers;
+        PagedLinearBuffer<VulkanBuffer> _commandBuffers;
+        Array<VkDescriptorPool> _cullingSetPools;
+        uint64 _currentCullingSetPoolIndex;
+        Map<uint64, VulkanDescriptorSetPool> _instanceSetPools;
+        Map<uint64, VulkanIndirectBatch> _batches;
+    };
+} // Coco
+
+#endif //COCOENGINE_VULKANINDIRECTDRAWSTORAGE_H
\ No newline at end of file
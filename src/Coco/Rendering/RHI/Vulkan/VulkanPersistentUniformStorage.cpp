@@ -0,0 +1,265 @@
+//
+// Created by cullen on 10/18/26.
+//
+
+#include "VulkanPersistentUniformStorage.h"
+#include "VulkanGraphicsPlatform.h"
+#include "VulkanUniformStorage.h"
+
+#include "Coco/Core/Engine.h"
+
+#include "Resources/VulkanShaderProgram.h"
+
+namespace Coco
+{
+    VulkanPersistentUniformStorage::Page::Page(Ref<VulkanBuffer> uniformBuffer) :
+        UniformBuffer(uniformBuffer),
+        Allocator(uniformBuffer->GetSize())
+    {}
+
+    VulkanPersistentUniformStorage::PersistentBlock::PersistentBlock(uint64 shaderProgramID, uint64 instanceID, uint64 version, uint64 pageIndex, uint64 offset, uint64 size,
+                                                                     const VulkanShaderBufferInterface& interface) :
+        ShaderProgramID(shaderProgramID),
+        InstanceID(instanceID),
+        Version(version),
+        PageIndex(pageIndex),
+        Offset(offset),
+        Size(size),
+        Interface(interface)
+    {}
+
+    VulkanPersistentUniformStorage::RetiredRange::RetiredRange(uint64 pageIndex, uint64 offset, uint64 size, uint64 retiredFrameNumber) :
+        PageIndex(pageIndex),
+        Offset(offset),
+        Size(size),
+        RetiredFrameNumber(retiredFrameNumber)
+    {}
+
+    VulkanPersistentUniformStorage::VulkanPersistentUniformStorage(VulkanGraphicsPlatform* platform, uint64 pageSize) :
+        _platform(platform),
+        _pageSize(pageSize),
+        _alignment(platform->GetDeviceDescription().MinimumBufferAlignment),
+        _pages(),
+        _blocks(),
+        _retiredRanges(),
+        _nonPersistableBlocks(),
+        _descriptorSetPools(),
+        _uniformSets()
+    {}
+
+    VulkanPersistentUniformStorage::~VulkanPersistentUniformStorage()
+    {
+        _blocks.Clear();
+        _retiredRanges.Clear();
+        _nonPersistableBlocks.Clear();
+        _uniformSets.Clear();
+        _descriptorSetPools.Clear();
+
+        for (auto& page : _pages)
+            _platform->InvalidateResource(page.UniformBuffer->GetID());
+
+        _pages.Clear(true);
+    }
+
+    VulkanShaderBufferInterface* VulkanPersistentUniformStorage::BindOrUpdate(const char* blockName, uint64 instanceID, uint64 version,
+        Ref<VulkanShaderProgram> shaderProgram, VkCommandBuffer commandBuffer, bool& outNeedsWrite)
+    {
+        outNeedsWrite = false;
+
+        const uint64 blockNameHash = ToHash(blockName);
+        const uint64 layoutKey = Math::CombineHashes(shaderProgram->GetID(), blockNameHash);
+        if (_nonPersistableBlocks.Contains(layoutKey))
+            return nullptr;
+
+        const uint64 blockID = Math::CombineHashes(shaderProgram->GetID(), instanceID, blockNameHash);
+
+        if (PersistentBlock* existing = _blocks.TryGetValue(blockID))
+        {
+            if (existing->Version == version && existing->Interface.AreTextureIndicesValid())
+            {
+                existing->Interface.MarkTextureIndicesUsed();
+                existing->Interface.Bind(commandBuffer);
+                return &existing->Interface;
+            }
+
+            // Frames in flight may still be reading the old data, so the new data is written to a new range
+            RetireRange(*existing);
+            _blocks.Remove(blockID);
+        }
+
+        const int64 blockIndex = shaderProgram->GetParamBlockIndex(blockName);
+        if (blockIndex == -1)
+        {
+            _nonPersistableBlocks.Emplace(layoutKey, shaderProgram->GetID());
+            return nullptr;
+        }
+
+        const VulkanPipelineLayout* pipelineLayout = shaderProgram->GetPipelineLayout();
+        const uint64 descriptorSetIndex = pipelineLayout->ParamBlockSetIndices[blockIndex];
+        const VulkanDescriptorSetLayout& descriptorSetLayout = shaderProgram->GetDescriptorSetLayouts()[descriptorSetIndex];
+
+        const ShaderTypeLayout* blockLayout = shaderProgram->GetParamBlockLayout(blockIndex);
+        const uint64 dataSize = blockLayout->Size;
+
+        if (dataSize == 0 || descriptorSetLayout.LayoutBindings.GetCount() != 1)
+        {
+            _nonPersistableBlocks.Emplace(layoutKey, shaderProgram->GetID());
+            return nullptr;
+        }
+
+        // Keeping every range a multiple of the alignment keeps every offset aligned too
+        const uint64 rangeSize = Math::AlignedAddress(dataSize, _alignment);
+        uint64 pageIndex = 0;
+        uint64 offset = 0;
+        AllocateRange(rangeSize, pageIndex, offset);
+
+        VulkanDescriptorSetInfo setInfo;
+        setInfo.DescriptorSetIndex = descriptorSetIndex;
+        setInfo.UniformBuffer = _pages[pageIndex].UniformBuffer;
+        setInfo.BufferOffset = offset;
+        setInfo.UsesDynamicOffset = true;
+        setInfo.DescriptorSet = GetOrCreateUniformSet(shaderProgram, descriptorSetIndex, *setInfo.UniformBuffer, dataSize);
+
+        PersistentBlock& block = _blocks.Emplace(blockID, shaderProgram->GetID(), instanceID, version, pageIndex, offset, rangeSize,
+            VulkanShaderBufferInterface(_platform, blockLayout, setInfo, pipelineLayout, commandBuffer));
+
+        block.Interface.Bind(commandBuffer);
+        outNeedsWrite = true;
+
+        return &block.Interface;
+    }
+
+    void VulkanPersistentUniformStorage::Release(uint64 instanceID)
+    {
+        Array<uint64> blockIDs;
+
+        for (const auto& block : _blocks)
+        {
+            if (block.second.InstanceID != instanceID)
+                continue;
+
+            RetireRange(block.second);
+            blockIDs.Append(block.first);
+        }
+
+        for (const uint64 blockID : blockIDs)
+            _blocks.Remove(blockID);
+    }
+
+    void VulkanPersistentUniformStorage::FreeRetiredRanges()
+    {
+        const uint64 currentFrameNumber = _platform->GetCurrentFrameNumber();
+
+        for (uint64 i = 0; i < _retiredRanges.GetCount();)
+        {
+            const RetiredRange& range = _retiredRanges[i];
+
+            if (currentFrameNumber < range.RetiredFrameNumber + _framesBeforeRangeReuse)
+            {
+                i++;
+                continue;
+            }
+
+            _pages[range.PageIndex].Allocator.Free(range.Offset, range.Size);
+            _retiredRanges.RemoveAt(i);
+        }
+    }
+
+    void VulkanPersistentUniformStorage::OnResourceInvalidated(uint64 resourceID)
+    {
+        Array<uint64> staleKeys;
+
+        // A recompiled program may have a different layout, so its blocks need to be checked again
+        for (const auto& [key, shaderProgramID] : _nonPersistableBlocks)
+        {
+            if (shaderProgramID == resourceID)
+                staleKeys.Append(key);
+        }
+
+        for (const uint64 key : staleKeys)
+            _nonPersistableBlocks.Remove(key);
+
+        UniquePtr<VulkanDescriptorSetPool>* pool = _descriptorSetPools.TryGetValue(resourceID);
+        if (!pool)
+            return;
+
+        staleKeys.Clear();
+
+        for (const auto& [key, block] : _blocks)
+        {
+            if (block.ShaderProgramID != resourceID)
+                continue;
+
+            RetireRange(block);
+            staleKeys.Append(key);
+        }
+
+        for (const uint64 key : staleKeys)
+            _blocks.Remove(key);
+
+        staleKeys.Clear();
+
+        for (const auto& [key, set] : _uniformSets)
+        {
+            if (set.ShaderProgramID == resourceID)
+                staleKeys.Append(key);
+        }
+
+        for (const uint64 key : staleKeys)
+            _uniformSets.Remove(key);
+
+        // Take the pool out of the map first, since destroying it invalidates the shader program again
+        UniquePtr<VulkanDescriptorSetPool> removedPool = std::move(*pool);
+        _descriptorSetPools.Remove(resourceID);
+
+        // Frames in flight may still be using the pool's sets
+        _platform->WaitForIdle();
+        removedPool.reset();
+    }
+
+    void VulkanPersistentUniformStorage::AllocateRange(uint64 size, uint64& outPageIndex, uint64& outOffset)
+    {
+        for (uint64 i = 0; i < _pages.GetCount(); i++)
+        {
+            Optional<uint64> offset = _pages[i].Allocator.Allocate(size);
+            if (!offset.has_value())
+                continue;
+
+            outPageIndex = i;
+            outOffset = offset.value();
+            return;
+        }
+
+        // Blocks larger than a page get a page of their own size
+        BufferDescription description(Math::Max(_pageSize, size), BufferUsageFlags::HostVisible | BufferUsageFlags::Uniform);
+        Page& page = _pages.EmplaceBack(_platform->CreateBuffer(description).Downcast<VulkanBuffer>());
+
+        outPageIndex = _pages.GetCount() - 1;
+        outOffset = page.Allocator.Allocate(size).value();
+    }
+
+    void VulkanPersistentUniformStorage::RetireRange(const PersistentBlock& block)
+    {
+        _retiredRanges.EmplaceBack(block.PageIndex, block.Offset, block.Size, _platform->GetCurrentFrameNumber());
+    }
+
+    VkDescriptorSet VulkanPersistentUniformStorage::GetOrCreateUniformSet(Ref<VulkanShaderProgram> shaderProgram, uint64 descriptorSetIndex,
+        const VulkanBuffer& uniformBuffer, uint64 blockSize)
+    {
+        const uint64 key = Math::CombineHashes(shaderProgram->GetID(), descriptorSetIndex, uniformBuffer.GetID());
+
+        if (const UniformSet* existing = _uniformSets.TryGetValue(key))
+            return existing->DescriptorSet;
+
+        UniquePtr<VulkanDescriptorSetPool>* pool = _descriptorSetPools.TryGetValue(shaderProgram->GetID());
+        if (!pool)
+            pool = &_descriptorSetPools.Emplace(shaderProgram->GetID(), CreateDefaultUnique<VulkanDescriptorSetPool>(_platform, shaderProgram));
+
+        // Blocks only differ by their dynamic offset, so the set never needs to be rewritten
+        VkDescriptorSet descriptorSet = (*pool)->AllocateDescriptorSet(descriptorSetIndex);
+        VulkanUniformStorage::WriteUniformBufferDescriptor(_platform->GetDevice(), descriptorSet, uniformBuffer, blockSize);
+
+        _uniformSets.Emplace(key, UniformSet{shaderProgram->GetID(), descriptorSet});
+        return descriptorSet;
+    }
+} // Coco
\ No newline at end of file
@@ -0,0 +1,130 @@
+//
+// Created by cullen on 10/18/26.
+//
+
+#ifndef COCOENGINE_VULKANPERSISTENTUNIFORMSTORAGE_H
+#define COCOENGINE_VULKANPERSISTENTUNIFORMSTORAGE_H
+
+#include "Coco/Core/Types/Array.h"
+#include "Coco/Core/Types/Map.h"
+#include "Coco/Rendering/Graphics/RangeAllocator.h"
+#include "VulkanShaderBufferInterface.h"
+#include "VulkanDescriptorSetPool.h"
+#include "Resources/VulkanBuffer.h"
+
+namespace Coco
+{
+    class VulkanShaderProgram;
+    class VulkanGraphicsPlatform;
+
+    /// @brief Stores uniform blocks that persist across frames, such as material parameters.
+    /// A block is only written when it is created or its instance's version changes. Since frames in flight may still be reading the old data,
+    /// a changed block is moved to a new range and the old range is freed once the GPU can no longer be using it
+    class VulkanPersistentUniformStorage
+    {
+    public:
+        VulkanPersistentUniformStorage(VulkanGraphicsPlatform* platform, uint64 pageSize);
+        ~VulkanPersistentUniformStorage();
+
+        /// @brief Binds an instance's persistent uniform block, moving it to a new range if the instance's version changed.
+        /// Only blocks without textures can persist, since a block's textures are written into its descriptor set, which frames in flight may be using.
+        /// Blocks can reference textures by their bindless texture table indices instead, which are rewritten if the table releases a slot
+        /// @param blockName The name of the block
+        /// @param instanceID The ID of the instance
+        /// @param version The version of the instance's data
+        /// @param shaderProgram The shader program the block is for
+        /// @param commandBuffer The command buffer to bind the block with
+        /// @param outNeedsWrite Will be set to true if the block was created or moved and its data needs to be written
+        /// @return The block's interface, or nullptr if the block can't persist
+        VulkanShaderBufferInterface* BindOrUpdate(const char* blockName, uint64 instanceID, uint64 version,
+            Ref<VulkanShaderProgram> shaderProgram, VkCommandBuffer commandBuffer, bool& outNeedsWrite);
+
+        /// @brief Releases every persistent block of an instance
+        /// @param instanceID The ID of the instance
+        void Release(uint64 instanceID);
+
+        /// @brief Frees the ranges of blocks that were moved or released long enough ago that the GPU can no longer be using them
+        void FreeRetiredRanges();
+
+        /// @brief Removes the blocks, descriptor sets, and descriptor set pool of a shader program that was invalidated
+        /// @param resourceID The ID of the invalidated resource
+        void OnResourceInvalidated(uint64 resourceID);
+
+    private:
+        /// @brief A uniform buffer that blocks are suballocated from
+        struct Page
+        {
+            Ref<VulkanBuffer> UniformBuffer;
+            RangeAllocator Allocator;
+
+            Page(Ref<VulkanBuffer> uniformBuffer);
+        };
+
+        /// @brief A uniform block and the range of a page it was written to
+        struct PersistentBlock
+        {
+            uint64 ShaderProgramID;
+            uint64 InstanceID;
+            uint64 Version;
+            uint64 PageIndex;
+            uint64 Offset;
+            uint64 Size;
+            VulkanShaderBufferInterface Interface;
+
+            PersistentBlock(uint64 shaderProgramID, uint64 instanceID, uint64 version, uint64 pageIndex, uint64 offset, uint64 size, const VulkanShaderBufferInterface& interface);
+        };
+
+        /// @brief A range of a page that is freed once the GPU can no longer be using it
+        struct RetiredRange
+        {
+            uint64 PageIndex;
+            uint64 Offset;
+            uint64 Size;
+            uint64 RetiredFrameNumber;
+
+            RetiredRange(uint64 pageIndex, uint64 offset, uint64 size, uint64 retiredFrameNumber);
+        };
+
+        static constexpr uint64 _framesBeforeRangeReuse = 3;
+
+        VulkanGraphicsPlatform* _platform;
+        uint64 _pageSize;
+        uint64 _alignment;
+        Array<Page> _pages;
+        Map<uint64, PersistentBlock> _blocks;
+        Array<RetiredRange> _retiredRanges;
+
+        /// @brief The shader program IDs of blocks that can't persist, keyed by the program and block name, so they aren't looked up on every bind
+        Map<uint64, uint64> _nonPersistableBlocks;
+
+        /// @brief A descriptor set shared by all blocks of a shader's set in a page
+        struct UniformSet
+        {
+            uint64 ShaderProgramID;
+            VkDescriptorSet DescriptorSet;
+        };
+
+        Map<uint64, UniquePtr<VulkanDescriptorSetPool>> _descriptorSetPools;
+        Map<uint64, UniformSet> _uniformSets;
+
+        /// @brief Allocates a range from the first page with room for it, creating a page if none do
+        /// @param size The size of the range. Must be a multiple of the buffer alignment
+        /// @param outPageIndex Will be set to the index of the page
+        /// @param outOffset Will be set to the offset of the range in the page
+        void AllocateRange(uint64 size, uint64& outPageIndex, uint64& outOffset);
+
+        /// @brief Retires the range of a block so it is freed once the GPU can no longer be using it
+        /// @param block The block
+        void RetireRange(const PersistentBlock& block);
+
+        /// @brief Gets the descriptor set shared by all blocks of a shader's set in a page, creating it if needed
+        /// @param shaderProgram The shader program
+        /// @param descriptorSetIndex The index of the block's descriptor set
+        /// @param uniformBuffer The page's buffer
+        /// @param blockSize The size of the block
+        /// @return The descriptor set
+        VkDescriptorSet GetOrCreateUniformSet(Ref<VulkanShaderProgram> shaderProgram, uint64 descriptorSetIndex, const VulkanBuffer& uniformBuffer, uint64 blockSize);
+    };
+} // Coco
+
+#endif //COCOENGINE_VULKANPERSISTENTUNIFORMSTORAGE_H
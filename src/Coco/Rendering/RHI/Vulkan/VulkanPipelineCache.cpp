@@ -0,0 +1,271 @@
+//
+// Created by cullen on 10/18/26.
+//
+
+#include "VulkanPipelineCache.h"
+
+#include "VulkanGraphicsPlatform.h"
+#include "VulkanUtils.h"
+#include "VulkanIncludes.h"
+
+#include "Coco/Core/Engine.h"
+#include "Coco/Core/IO/BinaryData.h"
+
+namespace Coco
+{
+    VulkanPipelineCache::VulkanPipelineCache(VulkanGraphicsPlatform* platform, bool enableManifest) :
+        _platform(platform),
+        _cache(nullptr),
+        _cacheFileName(),
+        _manifestEnabled(enableManifest),
+        _manifestDirty(false),
+        _manifestEntries()
+    {
+        VkPhysicalDeviceProperties deviceProperties{};
+        vkGetPhysicalDeviceProperties(_platform->GetPhysicalDevice(), &deviceProperties);
+
+        // Driver updates invalidate the cache data, so keep a separate file per device and driver
+        _cacheFileName = FormatString("PipelineCache_%x_%x_%x.bin", deviceProperties.vendorID, deviceProperties.deviceID, deviceProperties.driverVersion);
+
+        Array<uint8> initialData;
+        if (TryReadCacheFile(_cacheFileName.CStr(), initialData) && !IsCacheDataValid(initialData, deviceProperties))
+        {
+            COCO_ENGINE_LOG_WARN("Discarding pipeline cache \"%s\" as it was created by a different device or driver", _cacheFileName.CStr());
+            initialData.Clear();
+        }
+
+        VkPipelineCacheCreateInfo createInfo{VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO};
+        createInfo.initialDataSize = initialData.GetCount();
+        createInfo.pInitialData = initialData.IsEmpty() ? nullptr : initialData.Data();
+
+        AssertVkSuccess(vkCreatePipelineCache(_platform->GetDevice(), &createInfo, _platform->GetAllocationCallbacks(), &_cache));
+
+        if (_manifestEnabled)
+            LoadManifest();
+
+        COCO_ENGINE_LOG_VERBOSE("Created VulkanPipelineCache with %u bytes of initial data and %u manifest entries", initialData.GetCount(), _manifestEntries.GetCount());
+    }
+
+    VulkanPipelineCache::~VulkanPipelineCache()
+    {
+        Save();
+
+        if (_cache)
+        {
+            vkDestroyPipelineCache(_platform->GetDevice(), _cache, _platform->GetAllocationCallbacks());
+            _cache = nullptr;
+        }
+
+        _manifestEntries.Clear();
+    }
+
+    void VulkanPipelineCache::Save()
+    {
+        if (_cache)
+        {
+            size_t dataSize = 0;
+            AssertVkSuccess(vkGetPipelineCacheData(_platform->GetDevice(), _cache, &dataSize, nullptr));
+
+            Array<uint8> data(nullptr, dataSize);
+            data.Resize(dataSize);
+            AssertVkSuccess(vkGetPipelineCacheData(_platform->GetDevice(), _cache, &dataSize, data.Data()));
+            data.Resize(dataSize);
+
+            WriteCacheFile(_cacheFileName.CStr(), data);
+        }
+
+        if (_manifestEnabled && _manifestDirty)
+            SaveManifest();
+    }
+
+    void VulkanPipelineCache::RecordPipeline(const FilePath& shaderPath, const VulkanPipelineAttachmentFormats& attachmentFormats,
+        const GraphicsPipelineState& pipelineState, const VertexFormat& vertexFormat)
+    {
+        if (!_manifestEnabled)
+            return;
+
+        const uint64 key = MakeManifestKey(shaderPath.CStr(), attachmentFormats, pipelineState, vertexFormat);
+        if (_manifestEntries.Contains(key))
+            return;
+
+        _manifestEntries.Emplace(key, VulkanPipelineManifestEntry{shaderPath.CStr(), attachmentFormats, pipelineState, vertexFormat});
+        _manifestDirty = true;
+    }
+
+    void VulkanPipelineCache::GetManifestEntries(const FilePath& shaderPath, ArrayContainer<const VulkanPipelineManifestEntry*>& outEntries) const
+    {
+        for (const auto& [key, entry] : _manifestEntries)
+        {
+            if (entry.ShaderPath == shaderPath.CStr())
+                outEntries.Append(&entry);
+        }
+    }
+
+    uint64 VulkanPipelineCache::MakeManifestKey(const char* shaderPath, const VulkanPipelineAttachmentFormats& attachmentFormats,
+        const GraphicsPipelineState& pipelineState, const VertexFormat& vertexFormat)
+    {
+        return Math::CombineHashes(ToHash(shaderPath), attachmentFormats.GetHash(), ToHash(pipelineState), vertexFormat.GetHash());
+    }
+
+    bool VulkanPipelineCache::IsCacheDataValid(Span<const uint8> data, const VkPhysicalDeviceProperties& deviceProperties)
+    {
+        VkPipelineCacheHeaderVersionOne header{};
+        if (data.size() < sizeof(header))
+            return false;
+
+        memcpy(&header, data.data(), sizeof(header));
+
+        return header.headerSize >= sizeof(header) &&
+            header.headerSize <= data.size() &&
+            header.headerVersion == VK_PIPELINE_CACHE_HEADER_VERSION_ONE &&
+            header.vendorID == deviceProperties.vendorID &&
+            header.deviceID == deviceProperties.deviceID &&
+            memcmp(header.pipelineCacheUUID, deviceProperties.pipelineCacheUUID, VK_UUID_SIZE) == 0;
+    }
+
+    bool VulkanPipelineCache::TryReadCacheFile(const char* fileName, Array<uint8>& outData) const
+    {
+        FileSystem* fs = Engine::Get()->GetFileSystem();
+
+        if (!fs->Exists(fileName, true))
+            return false;
+
+        try
+        {
+            File file = fs->Open(fileName, FileOpenFlags::Read, true);
+            file.ReadToEnd(outData);
+            file.Close();
+        }
+        catch (const Exception& ex)
+        {
+            COCO_ENGINE_LOG_WARN("Failed to read \"%s\": %s", fileName, ex.what());
+            outData.Clear();
+            return false;
+        }
+
+        return !outData.IsEmpty();
+    }
+
+    void VulkanPipelineCache::WriteCacheFile(const char* fileName, Span<const uint8> data) const
+    {
+        try
+        {
+            File file = Engine::Get()->GetFileSystem()->Open(fileName, FileOpenFlags::Write, true);
+            file.Write(data);
+            file.Close();
+        }
+        catch (const Exception& ex)
+        {
+            COCO_ENGINE_LOG_WARN("Failed to write \"%s\": %s", fileName, ex.what());
+        }
+    }
+
+    void VulkanPipelineCache::LoadManifest()
+    {
+        Array<uint8> data;
+        if (!TryReadCacheFile(_manifestFileName, data))
+            return;
+
+        BinaryReader reader(data);
+        const uint32 magic = reader.Read<uint32>();
+        const uint32 version = reader.Read<uint32>();
+
+        if (reader.HasFailed() || magic != _manifestMagic || version != _manifestVersion)
+        {
+            COCO_ENGINE_LOG_WARN("Ignoring pipeline manifest with an unknown format");
+            return;
+        }
+
+        const uint32 entryCount = reader.Read<uint32>();
+
+        for (uint32 i = 0; i < entryCount && !reader.HasFailed(); i++)
+        {
+            VulkanPipelineManifestEntry entry;
+            entry.ShaderPath = reader.ReadString();
+
+            const uint8 colorFormatCount = reader.Read<uint8>();
+            if (colorFormatCount > entry.AttachmentFormats.ColorFormats.GetCapacity())
+                break;
+
+            for (uint8 f = 0; f < colorFormatCount; f++)
+                entry.AttachmentFormats.ColorFormats.Append(static_cast<VkFormat>(reader.Read<int32>()));
+
+            entry.AttachmentFormats.DepthStencilFormat = static_cast<VkFormat>(reader.Read<int32>());
+
+            GraphicsPipelineState& state = entry.PipelineState;
+            state.TopologyMode = reader.Read<MeshTopologyMode>();
+            state.CullingMode = reader.Read<CullMode>();
+            state.WindingMode = reader.Read<TriangleWindingMode>();
+            state.FillMode = reader.Read<PolygonFillMode>();
+            state.EnableDepthClamping = reader.Read<uint8>() != 0;
+            state.DepthTestMode = reader.Read<DepthTestingMode>();
+            state.EnableDepthWrite = reader.Read<uint8>() != 0;
+            state.BlendState.ColorSourceFactor = reader.Read<BlendFactorMode>();
+            state.BlendState.ColorDestinationFactor = reader.Read<BlendFactorMode>();
+            state.BlendState.ColorBlendOperation = reader.Read<BlendOperation>();
+            state.BlendState.AlphaSourceFactor = reader.Read<BlendFactorMode>();
+            state.BlendState.AlphaDestinationFactor = reader.Read<BlendFactorMode>();
+            state.BlendState.AlphaBlendOperation = reader.Read<BlendOperation>();
+
+            VertexFormat& vertexFormat = entry.MeshVertexFormat;
+            vertexFormat.Channels = reader.Read<VertexChannelFlags>();
+            vertexFormat.LayoutMode = reader.Read<VertexLayoutMode>();
+
+            for (uint8 c = 0; c < MaxVertexChannelCount; c++)
+                vertexFormat.ChannelFormats[c] = reader.Read<VertexAttributeFormat>();
+
+            if (reader.HasFailed())
+                break;
+
+            const uint64 key = MakeManifestKey(entry.ShaderPath.CStr(), entry.AttachmentFormats, entry.PipelineState, entry.MeshVertexFormat);
+            _manifestEntries.Emplace(key, entry);
+        }
+
+        if (reader.HasFailed())
+            COCO_ENGINE_LOG_WARN("Pipeline manifest is truncated. Only %u entries were loaded", _manifestEntries.GetCount());
+    }
+
+    void VulkanPipelineCache::SaveManifest()
+    {
+        BinaryWriter writer;
+        writer.Write(_manifestMagic);
+        writer.Write(_manifestVersion);
+        writer.Write(static_cast<uint32>(_manifestEntries.GetCount()));
+
+        for (const auto& [key, entry] : _manifestEntries)
+        {
+            writer.WriteString(entry.ShaderPath);
+
+            writer.Write(static_cast<uint8>(entry.AttachmentFormats.ColorFormats.GetCount()));
+            for (const VkFormat format : entry.AttachmentFormats.ColorFormats)
+                writer.Write(static_cast<int32>(format));
+
+            writer.Write(static_cast<int32>(entry.AttachmentFormats.DepthStencilFormat));
+
+            const GraphicsPipelineState& state = entry.PipelineState;
+            writer.Write(state.TopologyMode);
+            writer.Write(state.CullingMode);
+            writer.Write(state.WindingMode);
+            writer.Write(state.FillMode);
+            writer.Write(static_cast<uint8>(state.EnableDepthClamping));
+            writer.Write(state.DepthTestMode);
+            writer.Write(static_cast<uint8>(state.EnableDepthWrite));
+            writer.Write(state.BlendState.ColorSourceFactor);
+            writer.Write(state.BlendState.ColorDestinationFactor);
+            writer.Write(state.BlendState.ColorBlendOperation);
+            writer.Write(state.BlendState.AlphaSourceFactor);
+            writer.Write(state.BlendState.AlphaDestinationFactor);
+            writer.Write(state.BlendState.AlphaBlendOperation);
+
+            const VertexFormat& vertexFormat = entry.MeshVertexFormat;
+            writer.Write(vertexFormat.Channels);
+            writer.Write(vertexFormat.LayoutMode);
+
+            for (const VertexAttributeFormat format : vertexFormat.ChannelFormats)
+                writer.Write(format);
+        }
+
+        WriteCacheFile(_manifestFileName, writer.GetData());
+        _manifestDirty = false;
+    }
+} // Coco
\ No newline at end of file
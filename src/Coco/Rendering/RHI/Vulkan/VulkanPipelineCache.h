@@ -0,0 +1,84 @@
+//
+// Created by cullen on 10/18/26.
+//
+
+#ifndef COCOENGINE_VULKANPIPELINECACHE_H
+#define COCOENGINE_VULKANPIPELINECACHE_H
+#include "Coco/Core/Types/Array.h"
+#include "Coco/Core/Types/Map.h"
+#include "Coco/Core/Types/String.h"
+#include "Coco/Core/IO/FilePath.h"
+#include "Coco/Rendering/ShaderTypes.h"
+#include "CachedResources/VulkanPipeline.h"
+
+namespace Coco
+{
+    /// @brief A pipeline that was created in a previous run and can be recreated ahead of time
+    struct VulkanPipelineManifestEntry
+    {
+        String ShaderPath;
+        VulkanPipelineAttachmentFormats AttachmentFormats;
+        GraphicsPipelineState PipelineState;
+        VertexFormat MeshVertexFormat;
+    };
+
+    /// @brief Owns the device's VkPipelineCache and persists it to the cache directory between runs.
+    /// Optionally records the pipelines that were created so they can be compiled again at load time
+    class VulkanPipelineCache
+    {
+    public:
+        VulkanPipelineCache(VulkanGraphicsPlatform* platform, bool enableManifest);
+        ~VulkanPipelineCache();
+
+        VulkanPipelineCache(const VulkanPipelineCache&) = delete;
+        VulkanPipelineCache& operator=(const VulkanPipelineCache&) = delete;
+
+        VkPipelineCache GetCache() const { return _cache; }
+
+        /// @brief Writes the pipeline cache and manifest to the cache directory
+        void Save();
+
+        /// @brief Records a pipeline in the manifest so it can be created at load time in future runs
+        /// @param shaderPath The path of the shader the pipeline was created with
+        /// @param attachmentFormats The attachment formats of the pipeline
+        /// @param pipelineState The state of the pipeline
+        /// @param vertexFormat The vertex format of the pipeline
+        void RecordPipeline(const FilePath& shaderPath, const VulkanPipelineAttachmentFormats& attachmentFormats, const GraphicsPipelineState& pipelineState, const VertexFormat& vertexFormat);
+
+        /// @brief Gets the manifest entries for a shader
+        /// @param shaderPath The path of the shader
+        /// @param outEntries Will be filled with the manifest entries created with the shader
+        void GetManifestEntries(const FilePath& shaderPath, ArrayContainer<const VulkanPipelineManifestEntry*>& outEntries) const;
+
+    private:
+        static constexpr uint32 _manifestMagic = 0x4D50434F; // "OCPM"
+        // 2: strings are written with BinaryWriter::WriteString, which uses 32-bit lengths instead of 16-bit ones
+        // 3: entries record the vertex format of their pipeline
+        static constexpr uint32 _manifestVersion = 3;
+        static constexpr const char* _manifestFileName = "PipelineManifest.bin";
+
+        VulkanGraphicsPlatform* _platform;
+        VkPipelineCache _cache;
+        String _cacheFileName;
+        bool _manifestEnabled;
+        bool _manifestDirty;
+        Map<uint64, VulkanPipelineManifestEntry> _manifestEntries;
+
+    private:
+        static uint64 MakeManifestKey(const char* shaderPath, const VulkanPipelineAttachmentFormats& attachmentFormats, const GraphicsPipelineState& pipelineState, const VertexFormat& vertexFormat);
+
+        /// @brief Checks that pipeline cache data was created by the current device and driver
+        /// @param data The pipeline cache data
+        /// @param deviceProperties The properties of the current device
+        /// @return True if the data can be used to initialize the pipeline cache
+        static bool IsCacheDataValid(Span<const uint8> data, const VkPhysicalDeviceProperties& deviceProperties);
+
+        bool TryReadCacheFile(const char* fileName, Array<uint8>& outData) const;
+        void WriteCacheFile(const char* fileName, Span<const uint8> data) const;
+
+        void LoadManifest();
+        void SaveManifest();
+    };
+} // Coco
+
+#endif //COCOENGINE_VULKANPIPELINECACHE_H
\ No newline at end of file
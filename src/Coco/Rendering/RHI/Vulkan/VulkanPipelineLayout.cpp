@@ -9,6 +9,8 @@ namespace Coco
 {
     VulkanPipelineLayout::VulkanPipelineLayout() :
         GlobalDescriptorSetIndexOffset(0),
-        PipelineLayout(nullptr)
+        PipelineLayout(nullptr),
+        BindlessTextureSetIndex(),
+        ParamBlockSetIndices()
     {}
 } // Coco
\ No newline at end of file
@@ -5,16 +5,28 @@
 #ifndef COCOENGINE_VULKANPIPELINELAYOUT_H
 #define COCOENGINE_VULKANPIPELINELAYOUT_H
 #include "VulkanDescriptorSetLayout.h"
+#include "Coco/Core/Types/Optional.h"
 
 namespace Coco
 {
     struct VulkanPipelineLayout
     {
+        /// @brief The set index of global parameters that aren't parameter blocks
+        static constexpr uint32 InvalidSetIndex = std::numeric_limits<uint32>::max();
+
         Array<VulkanDescriptorSetLayout> DescriptorSetLayouts;
         Array<VkPushConstantRange> PushConstantRanges;
         uint32 GlobalDescriptorSetIndexOffset;
         VkPipelineLayout PipelineLayout;
 
+        /// @brief The index of the set bound to the bindless texture table, if the program declares an unbounded texture array.
+        /// Like every global set, its index comes from the register space that Slang gave the array
+        Optional<uint32> BindlessTextureSetIndex;
+
+        /// @brief The set index of each global parameter, indexed by the parameter's field index.
+        /// Parameters that aren't parameter blocks have InvalidSetIndex
+        Array<uint32> ParamBlockSetIndices;
+
         VulkanPipelineLayout();
     };
 } // Coco
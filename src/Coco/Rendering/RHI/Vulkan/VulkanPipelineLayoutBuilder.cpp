@@ -4,6 +4,7 @@
 
 #include "VulkanPipelineLayoutBuilder.h"
 
+#include <algorithm>
 #include <csetjmp>
 
 #include "VulkanDescriptorSetLayoutBuilder.h"
@@ -18,12 +19,11 @@ namespace Coco
         _pipelineLayout()
     {}
 
-    VulkanPipelineLayout VulkanPipelineLayoutBuilder::BuildForProgram(slang::ProgramLayout* programLayout)
+    VulkanPipelineLayout VulkanPipelineLayoutBuilder::BuildForProgram(const ShaderProgramLayout& programLayout)
     {
-        for (uint8 entryPointIndex = 0; entryPointIndex < programLayout->getEntryPointCount(); entryPointIndex++)
+        for (const ShaderEntryPointLayout& entryPoint : programLayout.GetEntryPoints())
         {
-            auto entryPoint = programLayout->getEntryPointByIndex(entryPointIndex);
-            switch (entryPoint->getStage())
+            switch (entryPoint.Stage)
             {
                 case SLANG_STAGE_VERTEX:
                     _currentShaderStage = VK_SHADER_STAGE_VERTEX_BIT;
@@ -42,17 +42,25 @@ namespace Coco
                     continue;
             }
 
-            AddDescriptorSetForParameterBlock(entryPoint->getTypeLayout());
+            AddDescriptorSetForParameterBlock(entryPoint.TypeLayout, 0);
         }
 
         _currentShaderStage = VK_SHADER_STAGE_ALL;
-        auto globalTypeLayout = programLayout->getGlobalParamsVarLayout()->getTypeLayout();
-        AddDescriptorSetForParameterBlock(globalTypeLayout);
+        AddDescriptorSetForParameterBlock(programLayout.GetGlobalParamsTypeLayout(), 0);
+
+        FillDescriptorSetGaps();
+        MapParamBlockSetIndices(programLayout.GetGlobalParamsTypeLayout());
 
         Array<VkDescriptorSetLayout> descriptorSetLayouts(nullptr, _pipelineLayout.DescriptorSetLayouts.GetCount());
 
         for (auto& layout : _pipelineLayout.DescriptorSetLayouts)
         {
+            if (layout.IsBindlessTextureTable)
+            {
+                descriptorSetLayouts.EmplaceBack(layout.DescriptorSetLayout);
+                continue;
+            }
+
             VkDescriptorSetLayoutCreateInfo createInfo{VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO};
             createInfo.flags = 0;
             createInfo.pBindings = layout.LayoutBindings.Data();
@@ -75,9 +83,9 @@ namespace Coco
     }
 
     void VulkanPipelineLayoutBuilder::AddDescriptorSetForParameterBlock(
-        slang::TypeLayoutReflection* parameterBlockTypeLayout)
+        const ShaderTypeLayout* parameterBlockTypeLayout, uint32 space)
     {
-        VulkanDescriptorSetLayoutBuilder layoutBuilder(*this);
+        VulkanDescriptorSetLayoutBuilder layoutBuilder(*this, space);
         layoutBuilder.AddDescriptorRanges(parameterBlockTypeLayout);
         VulkanDescriptorSetLayout layout = layoutBuilder.FinishBuilding(*_platform);
         if (!layout.LayoutBindings.IsEmpty())
@@ -87,6 +95,9 @@ namespace Coco
             {
                 for (auto& existingLayout : _pipelineLayout.DescriptorSetLayouts)
                 {
+                    if (existingLayout.IsBindlessTextureTable)
+                        continue;
+
                     if (existingLayout.LayoutBindings.GetCount() != layout.LayoutBindings.GetCount())
                     {
                         break;
@@ -121,39 +132,31 @@ namespace Coco
                 _pipelineLayout.GlobalDescriptorSetIndexOffset++;
             }
 
-            layout.DescriptorSetIndex = static_cast<uint32>(_pipelineLayout.DescriptorSetLayouts.GetCount());
+            layout.DescriptorSetIndex = GetDescriptorSetIndex(space);
             _pipelineLayout.DescriptorSetLayouts.EmplaceBack(layout);
         }
     }
 
-    void VulkanPipelineLayoutBuilder::AddSubObjectRanges(slang::TypeLayoutReflection* typeLayout)
+    void VulkanPipelineLayoutBuilder::AddSubObjectRanges(const ShaderTypeLayout* typeLayout, uint32 space)
     {
-        long subObjectRangeCount = typeLayout->getSubObjectRangeCount();
-
-        for (long i = 0; i < subObjectRangeCount; i++)
+        for (const ShaderSubObjectRangeLayout& subObjectRange : typeLayout->SubObjectRanges)
         {
-            AddSubObjectRange(typeLayout, i);
+            AddSubObjectRange(subObjectRange, space);
         }
     }
 
-    void VulkanPipelineLayoutBuilder::AddSubObjectRange(slang::TypeLayoutReflection* typeLayout,
-        long subObjectRangeIndex)
+    void VulkanPipelineLayoutBuilder::AddSubObjectRange(const ShaderSubObjectRangeLayout& subObjectRange, uint32 space)
     {
-        auto bindingRangeIndex = typeLayout->getSubObjectRangeBindingRangeIndex(subObjectRangeIndex);
-        auto bindingType = typeLayout->getBindingRangeType(bindingRangeIndex);
-
-        switch (bindingType)
+        switch (subObjectRange.BindingType)
         {
             case slang::BindingType::ParameterBlock:
             {
-                auto parameterBlockTypeLayout = typeLayout->getBindingRangeLeafTypeLayout(bindingRangeIndex);
-                AddDescriptorSetForParameterBlock(parameterBlockTypeLayout->getElementTypeLayout());
+                AddDescriptorSetForParameterBlock(subObjectRange.LeafTypeLayout->ElementTypeLayout, space + subObjectRange.SpaceOffset);
                 break;
             }
             case slang::BindingType::PushConstant:
             {
-                auto pushConstantTypeLayout = typeLayout->getBindingRangeLeafTypeLayout(bindingRangeIndex);
-                AddPushConstantRange(pushConstantTypeLayout);
+                AddPushConstantRange(subObjectRange.LeafTypeLayout);
                 break;
             }
             default:
@@ -161,10 +164,10 @@ namespace Coco
         }
     }
 
-    void VulkanPipelineLayoutBuilder::AddPushConstantRange(slang::TypeLayoutReflection* typeLayout)
+    void VulkanPipelineLayoutBuilder::AddPushConstantRange(const ShaderTypeLayout* typeLayout)
     {
-        auto elementTypeLayout = typeLayout->getElementTypeLayout();
-        auto elementSize = elementTypeLayout->getSize();
+        const ShaderTypeLayout* elementTypeLayout = typeLayout->ElementTypeLayout;
+        auto elementSize = elementTypeLayout->Size;
 
         if (elementSize == 0)
             return;
@@ -188,4 +191,95 @@ namespace Coco
         range.offset = offset;
         range.size = elementSize;
     }
+
+    uint32 VulkanPipelineLayoutBuilder::GetDescriptorSetIndex(uint32 space) const
+    {
+        if (_currentShaderStage != VK_SHADER_STAGE_ALL)
+            return static_cast<uint32>(_pipelineLayout.DescriptorSetLayouts.GetCount());
+
+        return _pipelineLayout.GlobalDescriptorSetIndexOffset + space;
+    }
+
+    void VulkanPipelineLayoutBuilder::AddBindlessTextureTable(slang::BindingType bindingType, uint32 space)
+    {
+        if (_pipelineLayout.BindlessTextureSetIndex.has_value())
+            return;
+
+        if (bindingType != slang::BindingType::CombinedTextureSampler)
+            throw Exception("Unbounded arrays are only supported for combined texture samplers");
+
+        VulkanBindlessTextureTable* table = _platform->GetVulkanCache()->GetBindlessTextureTable();
+        if (!table)
+            throw Exception("Shader declares an unbounded texture array, but bindless textures aren't supported");
+
+        VulkanDescriptorSetLayout layout{};
+        layout.ShaderStages = ShaderStageFlags::All;
+        layout.DescriptorSetIndex = GetDescriptorSetIndex(space);
+        layout.DescriptorSetLayout = table->GetSetLayout();
+        layout.IsBindlessTextureTable = true;
+
+        VkDescriptorSetLayoutBinding& binding = layout.LayoutBindings.EmplaceBack();
+        binding.binding = 0;
+        binding.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+        binding.descriptorCount = table->GetCapacity();
+        binding.stageFlags = VK_SHADER_STAGE_ALL;
+
+        _pipelineLayout.BindlessTextureSetIndex = layout.DescriptorSetIndex;
+        _pipelineLayout.DescriptorSetLayouts.EmplaceBack(layout);
+    }
+
+    void VulkanPipelineLayoutBuilder::FillDescriptorSetGaps()
+    {
+        Array<VulkanDescriptorSetLayout>& layouts = _pipelineLayout.DescriptorSetLayouts;
+
+        std::sort(layouts.Data(), layouts.Data() + layouts.GetCount(),
+            [](const VulkanDescriptorSetLayout& a, const VulkanDescriptorSetLayout& b)
+            {
+                return a.DescriptorSetIndex < b.DescriptorSetIndex;
+            });
+
+        if (layouts.IsEmpty())
+            return;
+
+        // Spaces that hold no descriptors, such as an empty global scope, still need a set so later sets keep their index
+        const uint32 setCount = layouts.Back().DescriptorSetIndex + 1;
+        if (setCount == layouts.GetCount())
+            return;
+
+        Array<VulkanDescriptorSetLayout> filledLayouts(nullptr, setCount);
+        uint64 nextLayout = 0;
+
+        for (uint32 i = 0; i < setCount; i++)
+        {
+            if (layouts[nextLayout].DescriptorSetIndex == i)
+            {
+                filledLayouts.Append(layouts[nextLayout++]);
+                continue;
+            }
+
+            VulkanDescriptorSetLayout& emptyLayout = filledLayouts.EmplaceBack();
+            emptyLayout.ShaderStages = ShaderStageFlags::All;
+            emptyLayout.DescriptorSetIndex = i;
+            emptyLayout.DescriptorSetLayout = nullptr;
+            emptyLayout.IsBindlessTextureTable = false;
+        }
+
+        layouts = std::move(filledLayouts);
+    }
+
+    void VulkanPipelineLayoutBuilder::MapParamBlockSetIndices(const ShaderTypeLayout* globalParamsTypeLayout)
+    {
+        for (const ShaderFieldLayout& field : globalParamsTypeLayout->Fields)
+        {
+            const ShaderSubObjectRangeLayout* range = globalParamsTypeLayout->FindSubObjectRangeForField(field);
+
+            if (!range || range->BindingType != slang::BindingType::ParameterBlock)
+            {
+                _pipelineLayout.ParamBlockSetIndices.Append(VulkanPipelineLayout::InvalidSetIndex);
+                continue;
+            }
+
+            _pipelineLayout.ParamBlockSetIndices.Append(_pipelineLayout.GlobalDescriptorSetIndexOffset + range->SpaceOffset);
+        }
+    }
 } // Coco
\ No newline at end of file
@@ -10,7 +10,7 @@
 #include "VulkanDescriptorSetLayout.h"
 #include "VulkanPipelineLayout.h"
 #include "VulkanIncludes.h"
-#include <slang.h>
+#include "Coco/Rendering/Graphics/ShaderLayout.h"
 
 namespace Coco
 {
@@ -22,17 +22,35 @@ namespace Coco
     public:
         VulkanPipelineLayoutBuilder(VulkanGraphicsPlatform* platform);
 
-        VulkanPipelineLayout BuildForProgram(slang::ProgramLayout* programLayout);
+        VulkanPipelineLayout BuildForProgram(const ShaderProgramLayout& programLayout);
 
     private:
         VulkanGraphicsPlatform* _platform;
         VkShaderStageFlags _currentShaderStage;
         VulkanPipelineLayout _pipelineLayout;
 
-        void AddDescriptorSetForParameterBlock(slang::TypeLayoutReflection* parameterBlockTypeLayout);
-        void AddSubObjectRanges(slang::TypeLayoutReflection* typeLayout);
-        void AddSubObjectRange(slang::TypeLayoutReflection* typeLayout, long subObjectRangeIndex);
-        void AddPushConstantRange(slang::TypeLayoutReflection* typeLayout);
+        void AddDescriptorSetForParameterBlock(const ShaderTypeLayout* parameterBlockTypeLayout, uint32 space);
+        void AddSubObjectRanges(const ShaderTypeLayout* typeLayout, uint32 space);
+        void AddSubObjectRange(const ShaderSubObjectRangeLayout& subObjectRange, uint32 space);
+        void AddPushConstantRange(const ShaderTypeLayout* typeLayout);
+
+        /// @brief Gets the index of the set for a register space. Global spaces map to sets after the entry point sets,
+        /// while entry point sets are placed in the order they're added
+        /// @param space The register space
+        /// @return The descriptor set index
+        uint32 GetDescriptorSetIndex(uint32 space) const;
+
+        /// @brief Adds a set that is bound to the device's bindless texture table. Only one set is added, no matter how many unbounded arrays the program declares
+        /// @param bindingType The type of the unbounded array
+        /// @param space The register space that Slang gave the unbounded array
+        void AddBindlessTextureTable(slang::BindingType bindingType, uint32 space);
+
+        /// @brief Fills the indices that aren't used by any set with empty sets, and sorts the sets by their index
+        void FillDescriptorSetGaps();
+
+        /// @brief Records the set index of each global parameter block
+        /// @param globalParamsTypeLayout The layout of the program's global parameters
+        void MapParamBlockSetIndices(const ShaderTypeLayout* globalParamsTypeLayout);
     };
 } // Coco
 
@@ -4,11 +4,13 @@
 
 #include "VulkanGraphicsPlatform.h"
 #include "Coco/Rendering/RenderScene.h"
+#include "Coco/Rendering/RenderService.h"
 #include "Coco/Rendering/RenderGraph/RenderGraph.h"
 
 #include "Resources/VulkanGraphicsSurface.h"
 #include "Resources/VulkanRenderContext.h"
 #include "Resources/VulkanImage.h"
+#include "Resources/VulkanBuffer.h"
 
 #include "VulkanRenderFrame.h"
 
@@ -18,13 +20,19 @@
 
 namespace Coco
 {
-    VulkanRenderTask::VulkanRenderTask(Ref<VulkanRenderContext> renderContext) :
+    VulkanRenderTask::VulkanRenderTask(VkCommandBuffer commandBuffer) :
         ImageAcquiredSemaphore(),
         RenderCompletedSemaphore(),
-        RenderContext(renderContext) {}
+        CommandBuffer(commandBuffer) {}
+
+    VulkanImageReadback::VulkanImageReadback(Ref<VulkanImage> sourceImage, SharedPtr<ImageReadback> readback, uint64 bufferOffset) :
+        SourceImage(sourceImage),
+        Readback(readback),
+        BufferOffset(bufferOffset)
+    {}
 
     VulkanRenderFrame::VulkanRenderFrame(VulkanGraphicsPlatform* platform) :
-        RenderFrame(platform->GetMeshStorage()),
+        RenderFrame(platform->GetMeshStorage(), platform->GetRenderService()->GetWorkerPool()),
         _platform(platform),
         _semaphores(nullptr, 2),
         _nextSemaphoreIndex(0),
@@ -32,7 +40,12 @@ namespace Coco
         _nextRenderContextIndex(0),
         _surfaces(nullptr, 1),
         _uniformStorage(platform, _uniformDataPageSize),
-        _stagingBuffer(platform, *this)
+        _stagingBuffer(platform, *this),
+        _indirectDrawStorage(platform),
+        _renderCompletedFence(CreateDefaultManagedRef<VulkanGraphicsFence>(0, platform, true)),
+        _readbacks(),
+        _readbackBufferSize(0),
+        _readbackBuffer()
     {
         _commandPools.EmplaceBack(_platform, VulkanQueue::Type::Graphics);
         _commandPools.EmplaceBack(_platform, VulkanQueue::Type::Transfer);
@@ -43,6 +56,12 @@ namespace Coco
     {
         _uniformStorage.Clear();
 
+        for (auto& uniformStorage : _streamUniformStorages)
+            uniformStorage.Clear();
+
+        _streamUniformStorages.Clear(true);
+        _indirectDrawStorage.Clear();
+
         _semaphores.Clear(true);
 
         for (auto& renderContext : _renderContexts)
@@ -50,18 +69,29 @@ namespace Coco
 
         _renderContexts.Clear(true);
 
+        for (auto& renderContext : _streamRenderContexts)
+            _platform->InvalidateResource(renderContext->GetID());
+
+        _streamRenderContexts.Clear(true);
+
         _surfaces.Clear(true);
 
         _commandPools.Clear(true);
+        _streamCommandPools.Clear(true);
+
+        _renderCompletedFence.Invalidate();
+
+        _readbacks.Clear(true);
+
+        if (_readbackBuffer.IsValid())
+            _platform->InvalidateResource(_readbackBuffer->GetID());
     }
 
     void VulkanRenderFrame::NewFrame()
     {
         _stagingBuffer.WaitForWorkToComplete();
-
-        // Only wait for contexts that actually rendered last frame
-        for (uint64 i = 0; i < _nextRenderContextIndex; ++i)
-            _renderContexts[i]->WaitForWorkToComplete();
+        _renderCompletedFence->WaitForSignal(false);
+        CompleteReadbacks();
 
         RenderFrame::NewFrame();
         _renderTasks.Clear();
@@ -72,8 +102,16 @@ namespace Coco
         for (auto& pool : _commandPools)
             pool.Reset();
 
+        for (auto& pool : _streamCommandPools)
+            pool.Reset();
+
         _uniformStorage.Clear();
 
+        for (auto& uniformStorage : _streamUniformStorages)
+            uniformStorage.Clear();
+
+        _indirectDrawStorage.Clear();
+
         auto resourceCache = _platform->GetResourceCache();
         for (const auto& id : _transientResources)
             resourceCache->ReleaseResource(id);
@@ -109,7 +147,7 @@ namespace Coco
         // Transition the swapchain image for presentation
         swapchainImage->TransitionLayout(commandBuffer, VK_IMAGE_LAYOUT_PRESENT_SRC_KHR);
 
-        VulkanRenderTask& renderTask = _renderTasks.EmplaceBack(renderContext);
+        VulkanRenderTask& renderTask = _renderTasks.EmplaceBack(renderContext->End());
         renderTask.ImageAcquiredSemaphore = imageAcquiredSemaphore;
         renderTask.RenderCompletedSemaphore = vkSurface->GetRenderingCompleteSemaphore();
 
@@ -117,24 +155,173 @@ namespace Coco
         _transientResources.AppendRange(graph.GetTransientResources());
     }
 
+    void VulkanRenderFrame::Render(RenderGraph&& graph, RenderScene&& scene, Ref<Image> targetImage)
+    {
+        COCO_ASSERT(targetImage, "Image was null");
+
+        graph.LinkAttachment(0, targetImage);
+
+        VkCommandBuffer commandBuffer = AllocateCommandBuffer(VulkanQueue::Type::Graphics);
+
+        Ref<VulkanRenderContext> renderContext = GetNextRenderContext();
+        renderContext->Begin(*this, graph, scene, commandBuffer);
+
+        graph.Execute(scene, *renderContext);
+
+        // Offscreen targets don't have a swapchain image to wait on or present, so the task only needs its command buffer
+        _renderTasks.EmplaceBack(renderContext->End());
+        _transientResources.AppendRange(graph.GetTransientResources());
+    }
+
+    SharedPtr<ImageReadback> VulkanRenderFrame::ReadbackImage(Ref<Image> image)
+    {
+        Ref<VulkanImage> vkImage = image.Downcast<VulkanImage>();
+        COCO_ASSERT(vkImage, "Image was null");
+
+        const ImageDescription& description = vkImage->GetDescription();
+        COCO_ASSERT((description.UsageFlags & ImageUsageFlags::TransferSource) == ImageUsageFlags::TransferSource, "Image is not a transfer source");
+        COCO_ASSERT((description.UsageFlags & ImageUsageFlags::Presented) == ImageUsageFlags::None, "Presented images can't be read back");
+        COCO_ASSERT(description.AttachmentType == ImageAttachmentType::Color, "Only color images can be read back");
+
+        SharedPtr<ImageReadback> readback = CreateDefaultShared<ImageReadback>(description, _platform->GetCurrentFrameNumber());
+
+        _readbacks.EmplaceBack(vkImage, readback, _readbackBufferSize);
+        _readbackBufferSize = Math::AlignedAddress(_readbackBufferSize + readback->GetPixelDataSize(), _readbackAlignment);
+
+        return readback;
+    }
+
     void VulkanRenderFrame::EndFrame()
     {
         bool hadSubmissions = _stagingBuffer.EndAndSubmit();
 
-        for (auto& task : _renderTasks)
+        VkCommandBuffer readbackCommandBuffer = RecordReadbacks();
+
+        if (_renderTasks.IsEmpty() && !readbackCommandBuffer)
+            return;
+
+        const uint64 batchCount = _renderTasks.GetCount() + 1;
+        const uint64 currentFrameNumber = _platform->GetCurrentFrameNumber();
+
+        // The submit infos point into these arrays, so they must not grow while being filled
+        Array<VkSemaphoreSubmitInfo> waitInfos(&_frameAllocator, batchCount * 2);
+        Array<VkSemaphoreSubmitInfo> signalInfos(&_frameAllocator, batchCount);
+        Array<VkCommandBufferSubmitInfo> bufferInfos(&_frameAllocator, batchCount);
+        Array<VkSubmitInfo2> submitInfos(&_frameAllocator, batchCount);
+
+        // Each surface keeps its own batch so it only waits on its own swapchain image, but every batch goes to the queue in a single submit
+        for (const VulkanRenderTask& task : _renderTasks)
         {
-            StackArray<std::pair<Ref<VulkanGraphicsSemaphore>, VkPipelineStageFlags2>, 2> waitSemaphores = {
-                {task.ImageAcquiredSemaphore, VK_PIPELINE_STAGE_2_COLOR_ATTACHMENT_OUTPUT_BIT}
-            };
+            VkSubmitInfo2& submitInfo = submitInfos.EmplaceBack(VK_STRUCTURE_TYPE_SUBMIT_INFO_2);
+            submitInfo.pWaitSemaphoreInfos = waitInfos.Data() + waitInfos.GetCount();
+
+            if (task.ImageAcquiredSemaphore)
+            {
+                VkSemaphoreSubmitInfo& acquiredInfo = waitInfos.EmplaceBack(VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO);
+                acquiredInfo.semaphore = task.ImageAcquiredSemaphore->GetSemaphore();
+                acquiredInfo.value = currentFrameNumber;
+                acquiredInfo.stageMask = VK_PIPELINE_STAGE_2_COLOR_ATTACHMENT_OUTPUT_BIT;
+                submitInfo.waitSemaphoreInfoCount++;
+            }
 
             if (hadSubmissions)
-                waitSemaphores.EmplaceBack(_stagingBuffer.GetOperationsCompletedSemaphore(), VK_PIPELINE_STAGE_2_TOP_OF_PIPE_BIT);
+            {
+                VkSemaphoreSubmitInfo& stagingInfo = waitInfos.EmplaceBack(VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO);
+                stagingInfo.semaphore = _stagingBuffer.GetOperationsCompletedSemaphore()->GetSemaphore();
+                stagingInfo.value = currentFrameNumber;
+                stagingInfo.stageMask = VK_PIPELINE_STAGE_2_TOP_OF_PIPE_BIT;
+                submitInfo.waitSemaphoreInfoCount++;
+            }
+
+            VkCommandBufferSubmitInfo& bufferInfo = bufferInfos.EmplaceBack(VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO);
+            bufferInfo.commandBuffer = task.CommandBuffer;
+            submitInfo.commandBufferInfoCount = 1;
+            submitInfo.pCommandBufferInfos = &bufferInfo;
+
+            if (task.RenderCompletedSemaphore)
+            {
+                VkSemaphoreSubmitInfo& signalInfo = signalInfos.EmplaceBack(VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO);
+                signalInfo.semaphore = task.RenderCompletedSemaphore->GetSemaphore();
+                signalInfo.stageMask = VK_PIPELINE_STAGE_2_COLOR_ATTACHMENT_OUTPUT_BIT;
+                submitInfo.signalSemaphoreInfoCount = 1;
+                submitInfo.pSignalSemaphoreInfos = &signalInfo;
+            }
+        }
+
+        // Readbacks go last so their copies are ordered after every render in the queue
+        if (readbackCommandBuffer)
+        {
+            VkSubmitInfo2& submitInfo = submitInfos.EmplaceBack(VK_STRUCTURE_TYPE_SUBMIT_INFO_2);
 
-            task.RenderContext->Submit(waitSemaphores, task.RenderCompletedSemaphore);
+            VkCommandBufferSubmitInfo& bufferInfo = bufferInfos.EmplaceBack(VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO);
+            bufferInfo.commandBuffer = readbackCommandBuffer;
+            submitInfo.commandBufferInfoCount = 1;
+            submitInfo.pCommandBufferInfos = &bufferInfo;
         }
 
-        for (auto& surface : _surfaces)
-            surface->Present();
+        _renderCompletedFence->Reset();
+
+        VulkanQueue* graphicsQueue = _platform->GetQueue(VulkanQueue::Type::Graphics);
+        AssertVkSuccess(vkQueueSubmit2(graphicsQueue->GetQueue(), static_cast<uint32>(submitInfos.GetCount()), submitInfos.Data(), _renderCompletedFence->GetFence()));
+
+        VulkanGraphicsSurface::Present(_platform, _surfaces);
+    }
+
+    VkCommandBuffer VulkanRenderFrame::RecordReadbacks()
+    {
+        if (_readbacks.IsEmpty())
+            return nullptr;
+
+        // The buffer only grows, and this frame's previous readbacks were completed in NewFrame(), so it is safe to replace
+        if (!_readbackBuffer.IsValid() || _readbackBuffer->GetSize() < _readbackBufferSize)
+        {
+            if (_readbackBuffer.IsValid())
+                _platform->InvalidateResource(_readbackBuffer->GetID());
+
+            _readbackBuffer = _platform->CreateBuffer(
+                BufferDescription(_readbackBufferSize, BufferUsageFlags::TransferDestination | BufferUsageFlags::HostReadable)
+            ).Downcast<VulkanBuffer>();
+        }
+
+        VkCommandBuffer commandBuffer = AllocateCommandBuffer(VulkanQueue::Type::Graphics);
+
+        VkCommandBufferBeginInfo beginInfo{VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO};
+        beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+        vkBeginCommandBuffer(commandBuffer, &beginInfo);
+
+        for (VulkanImageReadback& readback : _readbacks)
+            readback.SourceImage->CopyToBuffer(commandBuffer, _readbackBuffer->GetBuffer(), readback.BufferOffset);
+
+        // Make the copies visible to the host once the fence is signalled
+        VkMemoryBarrier2 hostBarrier{VK_STRUCTURE_TYPE_MEMORY_BARRIER_2};
+        hostBarrier.srcStageMask = VK_PIPELINE_STAGE_2_COPY_BIT;
+        hostBarrier.srcAccessMask = VK_ACCESS_2_TRANSFER_WRITE_BIT;
+        hostBarrier.dstStageMask = VK_PIPELINE_STAGE_2_HOST_BIT;
+        hostBarrier.dstAccessMask = VK_ACCESS_2_HOST_READ_BIT;
+
+        VkDependencyInfo dependencyInfo{VK_STRUCTURE_TYPE_DEPENDENCY_INFO};
+        dependencyInfo.memoryBarrierCount = 1;
+        dependencyInfo.pMemoryBarriers = &hostBarrier;
+        vkCmdPipelineBarrier2(commandBuffer, &dependencyInfo);
+
+        vkEndCommandBuffer(commandBuffer);
+
+        return commandBuffer;
+    }
+
+    void VulkanRenderFrame::CompleteReadbacks()
+    {
+        if (_readbacks.IsEmpty())
+            return;
+
+        _readbackBuffer->InvalidateMappedRange(0, _readbackBufferSize);
+        const uint8* mappedData = static_cast<const uint8*>(_readbackBuffer->GetMappedPtr());
+
+        for (VulkanImageReadback& readback : _readbacks)
+            readback.Readback->Complete(Span<const uint8>(mappedData + readback.BufferOffset, readback.Readback->GetPixelDataSize()));
+
+        _readbacks.Clear();
+        _readbackBufferSize = 0;
     }
 
     VkCommandBuffer VulkanRenderFrame::AllocateCommandBuffer(VulkanQueue::Type queueType)
@@ -142,6 +329,39 @@ namespace Coco
         return _commandPools[static_cast<uint8>(queueType)].AllocateCommandBuffer();
     }
 
+    VkCommandBuffer VulkanRenderFrame::AllocateStreamCommandBuffer(uint32 streamIndex)
+    {
+        // Each stream gets its own pool since command pools can't be used from multiple threads at once
+        while (streamIndex >= _streamCommandPools.GetCount())
+            _streamCommandPools.EmplaceBack(_platform, VulkanQueue::Type::Graphics);
+
+        return _streamCommandPools[streamIndex].AllocateCommandBuffer(true);
+    }
+
+    Ref<VulkanRenderContext> VulkanRenderFrame::GetStreamRenderContext(uint32 streamIndex)
+    {
+        while (streamIndex >= _streamRenderContexts.GetCount())
+            _streamRenderContexts.EmplaceBack(_platform->CreateRenderContext().Downcast<VulkanRenderContext>());
+
+        return _streamRenderContexts[streamIndex];
+    }
+
+    VulkanUniformStorage& VulkanRenderFrame::GetStreamUniformStorage(uint32 streamIndex)
+    {
+        while (streamIndex >= _streamUniformStorages.GetCount())
+            _streamUniformStorages.EmplaceBack(_platform, _uniformDataPageSize);
+
+        return _streamUniformStorages[streamIndex];
+    }
+
+    void VulkanRenderFrame::OnResourceInvalidated(uint64 resourceID)
+    {
+        _uniformStorage.OnResourceInvalidated(resourceID);
+
+        for (VulkanUniformStorage& storage : _streamUniformStorages)
+            storage.OnResourceInvalidated(resourceID);
+    }
+
     Matrix4x4 VulkanRenderFrame::CreateOrthographicProjection(float left, float right, float bottom, float top,
                                                               float nearClip, float farClip) const
     {
@@ -8,22 +8,37 @@
 #include "VulkanCommandPool.h"
 #include "VulkanStagingBuffer.h"
 #include "Coco/Rendering/Graphics/RenderFrame.h"
+#include "Coco/Rendering/Graphics/Resources/RenderContext.h"
 #include "Resources/VulkanGraphicsSemaphore.h"
+#include "Resources/VulkanGraphicsFence.h"
 #include "VulkanUniformStorage.h"
+#include "VulkanIndirectDrawStorage.h"
 
 namespace Coco
 {
     class VulkanRenderContext;
     class VulkanGraphicsPlatform;
     class VulkanGraphicsSurface;
+    class VulkanImage;
+    class VulkanBuffer;
 
     struct VulkanRenderTask
     {
         Ref<VulkanGraphicsSemaphore> ImageAcquiredSemaphore;
         Ref<VulkanGraphicsSemaphore> RenderCompletedSemaphore;
-        Ref<VulkanRenderContext> RenderContext;
+        VkCommandBuffer CommandBuffer;
 
-        VulkanRenderTask(Ref<VulkanRenderContext> renderContext);
+        VulkanRenderTask(VkCommandBuffer commandBuffer);
+    };
+
+    /// @brief An image copy to the frame's readback buffer
+    struct VulkanImageReadback
+    {
+        Ref<VulkanImage> SourceImage;
+        SharedPtr<ImageReadback> Readback;
+        uint64 BufferOffset;
+
+        VulkanImageReadback(Ref<VulkanImage> sourceImage, SharedPtr<ImageReadback> readback, uint64 bufferOffset);
     };
 
     class VulkanRenderFrame : public RenderFrame
@@ -34,20 +49,47 @@ namespace Coco
 
         void NewFrame() override;
         void Render(RenderGraph&& graph, RenderScene&& scene, Ref<GraphicsSurface> surface) override;
+        void Render(RenderGraph&& graph, RenderScene&& scene, Ref<Image> targetImage) override;
+        SharedPtr<ImageReadback> ReadbackImage(Ref<Image> image) override;
         Matrix4x4 CreateOrthographicProjection(float left, float right, float bottom, float top, float nearClip, float farClip) const override;
         Matrix4x4 CreatePerspectiveProjection(float verticalFOV, float aspectRatio, float nearClip, float farClip) const override;
 
+        /// @brief Submits the render tasks of every surface in a single queue submission and presents the surfaces together
         void EndFrame();
         VulkanUniformStorage& GetUniformStorage() { return _uniformStorage; }
         VulkanStagingBuffer& GetStagingBuffer() { return _stagingBuffer; }
+        VulkanIndirectDrawStorage& GetIndirectDrawStorage() { return _indirectDrawStorage; }
         VkCommandBuffer AllocateCommandBuffer(VulkanQueue::Type queueType);
 
+        /// @brief Allocates a secondary command buffer from the command pool dedicated to a parallel recording stream
+        /// @param streamIndex The index of the stream
+        /// @return The secondary command buffer
+        VkCommandBuffer AllocateStreamCommandBuffer(uint32 streamIndex);
+
+        /// @brief Gets the render context used to record a parallel recording stream
+        /// @param streamIndex The index of the stream
+        /// @return The render context
+        Ref<VulkanRenderContext> GetStreamRenderContext(uint32 streamIndex);
+
+        /// @brief Gets the uniform storage dedicated to a parallel recording stream, so streams never allocate from the same storage at once
+        /// @param streamIndex The index of the stream
+        /// @return The uniform storage
+        VulkanUniformStorage& GetStreamUniformStorage(uint32 streamIndex);
+
+        /// @brief Purges the frame's uniform storages of a resource that was invalidated
+        /// @param resourceID The ID of the invalidated resource
+        void OnResourceInvalidated(uint64 resourceID);
+
     private:
         static constexpr int _uniformDataPageSize = 1024 * 1024;
+        static constexpr uint64 _readbackAlignment = 16;
 
         VulkanGraphicsPlatform* _platform;
 
         StackArray<VulkanCommandPool, 3> _commandPools;
+        StackArray<VulkanCommandPool, RenderContext::MaxParallelStreams> _streamCommandPools;
+        StackArray<Ref<VulkanRenderContext>, RenderContext::MaxParallelStreams> _streamRenderContexts;
+        StackArray<VulkanUniformStorage, RenderContext::MaxParallelStreams> _streamUniformStorages;
         Array<ManagedRef<VulkanGraphicsSemaphore>> _semaphores;
         uint64 _nextSemaphoreIndex;
 
@@ -59,12 +101,25 @@ namespace Coco
 
         VulkanUniformStorage _uniformStorage;
         VulkanStagingBuffer _stagingBuffer;
+        VulkanIndirectDrawStorage _indirectDrawStorage;
 
         Array<VulkanRenderTask> _renderTasks;
+        ManagedRef<VulkanGraphicsFence> _renderCompletedFence;
+
+        Array<VulkanImageReadback> _readbacks;
+        uint64 _readbackBufferSize;
+        Ref<VulkanBuffer> _readbackBuffer;
 
     private:
         Ref<VulkanGraphicsSemaphore> GetNextSemaphore();
         Ref<VulkanRenderContext> GetNextRenderContext();
+
+        /// @brief Records the copies of this frame's readbacks into a command buffer
+        /// @return The command buffer, or nullptr if there were no readbacks
+        VkCommandBuffer RecordReadbacks();
+
+        /// @brief Completes the readbacks that were submitted the last time this frame was rendered
+        void CompleteReadbacks();
     };
 } // Coco
 
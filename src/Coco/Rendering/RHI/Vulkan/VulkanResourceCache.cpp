@@ -6,13 +6,24 @@
 
 #include "VulkanGraphicsPlatform.h"
 #include "CachedResources/VulkanPipeline.h"
+#include "Resources/VulkanShaderProgram.h"
+
+#include "Coco/Core/Engine.h"
 
 namespace Coco
 {
-    VulkanResourceCache::VulkanResourceCache(VulkanGraphicsPlatform* platform) :
+    VulkanResourceCache::VulkanResourceCache(VulkanGraphicsPlatform* platform, bool enablePipelinePrewarming, bool enableBindlessTextures) :
         _platform(platform),
+        _pipelineCache(platform, enablePipelinePrewarming),
+        _samplerCache(platform),
+        _descriptorSetCache(platform),
+        _bindlessTextureTable(),
+        _indirectCullingPipeline(),
         _pipelines()
-    {}
+    {
+        if (enableBindlessTextures)
+            _bindlessTextureTable.emplace(platform);
+    }
 
     VulkanResourceCache::~VulkanResourceCache()
     {
@@ -20,13 +31,14 @@ namespace Coco
     }
 
     VulkanPipeline* VulkanResourceCache::GetOrCreatePipeline(const VulkanShaderProgram& shaderProgram,
-        const RenderGraph& graph, const GraphicsPipelineState& pipelineState)
+        const VulkanPipelineAttachmentFormats& attachmentFormats, const GraphicsPipelineState& pipelineState, const VertexFormat& vertexFormat)
     {
-        uint64 key = VulkanPipeline::MakeKey(shaderProgram, graph, pipelineState);
+        uint64 key = VulkanPipeline::MakeKey(shaderProgram, attachmentFormats, pipelineState, vertexFormat);
         VulkanPipeline* existing = _pipelines.TryGetValue(key);
         if (!existing)
         {
-            existing = &_pipelines.Emplace(key, key, _platform, shaderProgram, graph, pipelineState);
+            existing = &_pipelines.Emplace(key, key, _platform, shaderProgram, attachmentFormats, pipelineState, vertexFormat);
+            _pipelineCache.RecordPipeline(shaderProgram.GetShaderPath(), attachmentFormats, pipelineState, vertexFormat);
         }
         else
         {
@@ -35,4 +47,47 @@ namespace Coco
 
         return existing;
     }
+
+    void VulkanResourceCache::PrewarmPipelines(const VulkanShaderProgram& shaderProgram)
+    {
+        Array<const VulkanPipelineManifestEntry*> entries;
+        _pipelineCache.GetManifestEntries(shaderProgram.GetShaderPath(), entries);
+
+        for (const VulkanPipelineManifestEntry* entry : entries)
+        {
+            uint64 key = VulkanPipeline::MakeKey(shaderProgram, entry->AttachmentFormats, entry->PipelineState, entry->MeshVertexFormat);
+            if (!_pipelines.Contains(key))
+                _pipelines.Emplace(key, key, _platform, shaderProgram, entry->AttachmentFormats, entry->PipelineState, entry->MeshVertexFormat);
+        }
+
+        if (!entries.IsEmpty())
+            COCO_ENGINE_LOG_VERBOSE("Prewarmed %u pipelines for shader \"%s\"", entries.GetCount(), shaderProgram.GetShaderPath().CStr());
+    }
+
+    VulkanIndirectCullingPipeline* VulkanResourceCache::GetIndirectCullingPipeline()
+    {
+        if (!_platform->GetDeviceDescription().SupportsIndirectDrawCount)
+            return nullptr;
+
+        if (!_indirectCullingPipeline.has_value())
+            _indirectCullingPipeline.emplace(_platform);
+
+        return &_indirectCullingPipeline.value();
+    }
+
+    void VulkanResourceCache::OnResourceInvalidated(uint64 resourceID)
+    {
+        _descriptorSetCache.OnResourceInvalidated(resourceID);
+
+        if (_bindlessTextureTable.has_value())
+            _bindlessTextureTable->OnResourceInvalidated(resourceID);
+    }
+
+    void VulkanResourceCache::PurgeUnused()
+    {
+        _descriptorSetCache.PurgeUnused();
+
+        if (_bindlessTextureTable.has_value())
+            _bindlessTextureTable->PurgeUnused();
+    }
 } // Coco
\ No newline at end of file
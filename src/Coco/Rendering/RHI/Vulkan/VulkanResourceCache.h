@@ -5,25 +5,58 @@
 #ifndef COCOENGINE_VULKANRESOURCECACHE_H
 #define COCOENGINE_VULKANRESOURCECACHE_H
 #include "Coco/Core/Types/Map.h"
+#include "Coco/Core/Types/Optional.h"
+#include "VulkanPipelineCache.h"
+#include "CachedResources/VulkanBindlessTextureTable.h"
+#include "CachedResources/VulkanDescriptorSetCache.h"
+#include "CachedResources/VulkanIndirectCullingPipeline.h"
+#include "CachedResources/VulkanSamplerCache.h"
 
 namespace Coco
 {
     class VulkanGraphicsPlatform;
     struct GraphicsPipelineState;
-    class RenderGraph;
     class VulkanShaderProgram;
     class VulkanPipeline;
 
     class VulkanResourceCache
     {
     public:
-        VulkanResourceCache(VulkanGraphicsPlatform* platform);
+        VulkanResourceCache(VulkanGraphicsPlatform* platform, bool enablePipelinePrewarming, bool enableBindlessTextures);
         ~VulkanResourceCache();
 
-        VulkanPipeline* GetOrCreatePipeline(const VulkanShaderProgram& shaderProgram, const RenderGraph& graph, const GraphicsPipelineState& pipelineState);
+        VulkanPipeline* GetOrCreatePipeline(const VulkanShaderProgram& shaderProgram, const VulkanPipelineAttachmentFormats& attachmentFormats, const GraphicsPipelineState& pipelineState, const VertexFormat& vertexFormat);
+
+        /// @brief Creates all pipelines that were recorded for a shader program in previous runs
+        /// @param shaderProgram The shader program
+        void PrewarmPipelines(const VulkanShaderProgram& shaderProgram);
+
+        /// @brief Releases cached resources that reference a resource that is being destroyed
+        /// @param resourceID The ID of the resource
+        void OnResourceInvalidated(uint64 resourceID);
+
+        /// @brief Releases cached resources that haven't been used recently. Should be called once per frame
+        void PurgeUnused();
+
+        VulkanPipelineCache& GetPipelineCache() { return _pipelineCache; }
+        VulkanSamplerCache& GetSamplerCache() { return _samplerCache; }
+        VulkanDescriptorSetCache& GetDescriptorSetCache() { return _descriptorSetCache; }
+
+        /// @brief Gets the bindless texture table
+        /// @return The bindless texture table, or nullptr if bindless textures aren't enabled
+        VulkanBindlessTextureTable* GetBindlessTextureTable() { return _bindlessTextureTable.has_value() ? &_bindlessTextureTable.value() : nullptr; }
+
+        /// @brief Gets the compute pipeline that culls objects drawn indirectly, creating it the first time it is used
+        /// @return The culling pipeline, or nullptr if the device doesn't support drawing with an indirect draw count
+        VulkanIndirectCullingPipeline* GetIndirectCullingPipeline();
 
     private:
         VulkanGraphicsPlatform* _platform;
+        VulkanPipelineCache _pipelineCache;
+        VulkanSamplerCache _samplerCache;
+        VulkanDescriptorSetCache _descriptorSetCache;
+        Optional<VulkanBindlessTextureTable> _bindlessTextureTable;
+        Optional<VulkanIndirectCullingPipeline> _indirectCullingPipeline;
         Map<uint64, VulkanPipeline> _pipelines;
     };
 } // Coco
@@ -12,26 +12,26 @@
 #include "VulkanUtils.h"
 
 #include "VulkanPipelineLayout.h"
+#include "VulkanResourceCache.h"
+#include "CachedResources/VulkanBindlessTextureTable.h"
 
 #include "Resources/VulkanBuffer.h"
 #include "Resources/VulkanImage.h"
 #include "Resources/VulkanImageSampler.h"
 
-#include <slang.h>
-
 namespace Coco
 {
-    VulkanShaderBufferInterface::VulkanShaderBufferInterface(VulkanGraphicsPlatform* platform, slang::TypeLayoutReflection* blockTypeLayout,
+    VulkanShaderBufferInterface::VulkanShaderBufferInterface(VulkanGraphicsPlatform* platform, const ShaderTypeLayout* blockTypeLayout,
         const VulkanDescriptorSetInfo& descriptorSetInfo, const VulkanPipelineLayout* pipelineLayout, VkCommandBuffer commandBuffer) :
         ShaderBufferInterface(blockTypeLayout),
         _platform(platform),
         _setInfo(descriptorSetInfo),
         _pipelineLayout(pipelineLayout),
-        _commandBuffer(commandBuffer)
-    {
-        if (_blockTypeLayout->getSize() > 0)
-            WriteUniformBuffer();
-    }
+        _commandBuffer(commandBuffer),
+        _bindlessTextureIndices(),
+        _bindlessReleaseCount(0),
+        _hasLoadingTextures(false)
+    {}
 
     void VulkanShaderBufferInterface::Write(const ShaderElementLocation& location, const void* data, uint64 dataSize)
     {
@@ -41,15 +41,24 @@ namespace Coco
 
     void VulkanShaderBufferInterface::Write(const ShaderElementLocation& location, Texture* texture)
     {
-        if (!texture)
+        Ref<VulkanImage> image;
+        Ref<VulkanImageSampler> imageSampler;
+
         {
-            RenderService* rendering = _platform->GetRenderService();
-            texture = rendering->GetDefaultCheckerTexture().get();
+            // Checking if a texture is ready can finish loading it, which parallel recording streams may also be doing.
+            // The descriptor write below only touches this block's own set, so it doesn't need the lock
+            std::lock_guard<std::mutex> guard(_platform->GetSharedStateLock());
+
+            if (!texture || !texture->IsReady())
+            {
+                RenderService* rendering = _platform->GetRenderService();
+                texture = rendering->GetDefaultCheckerTexture().get();
+            }
+
+            image = texture->GetImage().Downcast<VulkanImage>();
+            imageSampler = texture->GetSampler().Downcast<VulkanImageSampler>();
         }
 
-        Ref<VulkanImage> image = texture->GetImage().Downcast<VulkanImage>();
-        Ref<VulkanImageSampler> imageSampler = texture->GetSampler().Downcast<VulkanImageSampler>();
-
         VkDescriptorImageInfo imageInfo;
         imageInfo.imageView = image->GetNativeView();
         imageInfo.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
@@ -66,6 +75,40 @@ namespace Coco
         vkUpdateDescriptorSets(_platform->GetDevice(), 1, &write, 0, nullptr);
     }
 
+    void VulkanShaderBufferInterface::WriteTextureIndex(const ShaderElementLocation& location, Texture* texture)
+    {
+        VulkanBindlessTextureTable* table = _platform->GetVulkanCache()->GetBindlessTextureTable();
+        if (!table)
+        {
+            const uint32 textureIndex = 0;
+            Write(location, &textureIndex, sizeof(uint32));
+            return;
+        }
+
+        uint32 textureIndex;
+        uint64 releaseCount;
+
+        {
+            // The bindless table and texture loading are shared by parallel recording streams
+            std::lock_guard<std::mutex> guard(_platform->GetSharedStateLock());
+
+            if (texture && !texture->IsReady())
+                _hasLoadingTextures = true;
+
+            textureIndex = table->GetTextureIndex(texture);
+            releaseCount = table->GetReleaseCount();
+        }
+
+        Write(location, &textureIndex, sizeof(uint32));
+
+        // Adding a later texture may release the slot of an earlier one, so the release count is only taken after the first.
+        // Any release after that makes the block rewrite its indices
+        if (_bindlessTextureIndices.IsEmpty())
+            _bindlessReleaseCount = releaseCount;
+
+        _bindlessTextureIndices.Append(textureIndex);
+    }
+
     void VulkanShaderBufferInterface::Flush()
     {
         // TODO
@@ -73,24 +116,30 @@ namespace Coco
 
     void VulkanShaderBufferInterface::Bind(VkCommandBuffer buffer)
     {
-        vkCmdBindDescriptorSets(buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, _pipelineLayout->PipelineLayout, _setInfo.DescriptorSetIndex, 1, &_setInfo.DescriptorSet, 0, nullptr);
+        const uint32 dynamicOffset = static_cast<uint32>(_setInfo.BufferOffset);
+        vkCmdBindDescriptorSets(buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, _pipelineLayout->PipelineLayout, _setInfo.DescriptorSetIndex, 1, &_setInfo.DescriptorSet,
+            _setInfo.UsesDynamicOffset ? 1 : 0, &dynamicOffset);
     }
 
-    void VulkanShaderBufferInterface::WriteUniformBuffer()
+    bool VulkanShaderBufferInterface::AreTextureIndicesValid() const
     {
-        VkDescriptorBufferInfo bufferInfo;
-        bufferInfo.buffer = _setInfo.UniformBuffer->GetBuffer();
-        bufferInfo.offset = _setInfo.BufferOffset;
-        bufferInfo.range = _blockTypeLayout->getSize();
+        if (_bindlessTextureIndices.IsEmpty())
+            return true;
 
-        VkWriteDescriptorSet write = {VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET};
-        write.dstSet = _setInfo.DescriptorSet;
-        write.dstBinding = 0;
-        write.dstArrayElement = 0;
-        write.descriptorCount = 1;
-        write.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
-        write.pBufferInfo = &bufferInfo;
+        if (_hasLoadingTextures)
+            return false;
 
-        vkUpdateDescriptorSets(_platform->GetDevice(), 1, &write, 0, nullptr);
+        VulkanBindlessTextureTable* table = _platform->GetVulkanCache()->GetBindlessTextureTable();
+        return table && table->GetReleaseCount() == _bindlessReleaseCount;
+    }
+
+    void VulkanShaderBufferInterface::MarkTextureIndicesUsed() const
+    {
+        if (_bindlessTextureIndices.IsEmpty())
+            return;
+
+        VulkanBindlessTextureTable* table = _platform->GetVulkanCache()->GetBindlessTextureTable();
+        for (const uint32 textureIndex : _bindlessTextureIndices)
+            table->MarkUsed(textureIndex);
     }
 } // Coco
\ No newline at end of file
@@ -6,6 +6,7 @@
 #define COCOENGINE_VULKANSHADERBUFFERINTERFACE_H
 #include "Coco/Rendering/Graphics/ShaderBufferInterface.h"
 #include "Coco/Core/Memory/Refs.h"
+#include "Coco/Core/Types/Array.h"
 #include "VulkanForwardDeclarations.h"
 
 namespace Coco
@@ -20,27 +21,43 @@ namespace Coco
         uint64 DescriptorSetIndex;
         Ref<VulkanBuffer> UniformBuffer;
         uint64 BufferOffset;
+
+        /// @brief If true, the set has a dynamic uniform buffer that is bound with BufferOffset as its dynamic offset
+        bool UsesDynamicOffset;
     };
 
     class VulkanShaderBufferInterface : public ShaderBufferInterface
     {
     public:
-        VulkanShaderBufferInterface(VulkanGraphicsPlatform* platform, slang::TypeLayoutReflection* blockTypeLayout,
+        VulkanShaderBufferInterface(VulkanGraphicsPlatform* platform, const ShaderTypeLayout* blockTypeLayout,
             const VulkanDescriptorSetInfo& descriptorSetInfo, const VulkanPipelineLayout* pipelineLayout, VkCommandBuffer commandBuffer);
 
         void Write(const ShaderElementLocation& location, const void* data, uint64 dataSize) override;
         void Write(const ShaderElementLocation& location, Texture* texture) override;
+        void WriteTextureIndex(const ShaderElementLocation& location, Texture* texture) override;
         void Flush() override;
         void Bind(VkCommandBuffer buffer);
 
+        /// @brief Checks if the bindless texture indices written to this block still refer to the textures they were written for
+        /// @return True if no slot has been released from the bindless texture table since the indices were written,
+        /// and none of the indices were written for the default texture in place of a texture that was still loading
+        bool AreTextureIndicesValid() const;
+
+        /// @brief Marks the bindless texture slots that this block references as used this frame, so they aren't evicted while it is drawn
+        void MarkTextureIndicesUsed() const;
+
     private:
         VulkanGraphicsPlatform* _platform;
         VulkanDescriptorSetInfo _setInfo;
         const VulkanPipelineLayout* _pipelineLayout;
         VkCommandBuffer _commandBuffer;
 
-    private:
-        void WriteUniformBuffer();
+        /// @brief The bindless texture indices written to this block, and the table's release count when they were written
+        Array<uint32> _bindlessTextureIndices;
+        uint64 _bindlessReleaseCount;
+
+        /// @brief If true, a texture was still loading when its index was written, so the default texture's index was written instead
+        bool _hasLoadingTextures;
     };
 } // Coco
 
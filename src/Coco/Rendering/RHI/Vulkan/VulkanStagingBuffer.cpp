@@ -37,7 +37,8 @@ namespace Coco
         _fence(CreateDefaultManagedRef<VulkanGraphicsFence>(0, platform, true)),
         _currentTransferCommandBuffer(nullptr),
         _currentGraphicsCommandBuffer(nullptr),
-        _lastSignalValue(0)
+        _lastSignalValue(0),
+        _hasDeviceCopies(false)
     {}
 
     VulkanStagingBuffer::~VulkanStagingBuffer()
@@ -63,6 +64,7 @@ namespace Coco
     {
         _stagingOperations.Clear();
         _buffers.Clear();
+        _hasDeviceCopies = false;
 
         _currentTransferCommandBuffer = _renderFrame->AllocateCommandBuffer(VulkanQueue::Type::Transfer);
 
@@ -79,7 +81,7 @@ namespace Coco
         vkEndCommandBuffer(_currentTransferCommandBuffer);
         vkEndCommandBuffer(_currentGraphicsCommandBuffer);
 
-        if (_stagingOperations.IsEmpty())
+        if (_stagingOperations.IsEmpty() && !_hasDeviceCopies)
             return false;
 
         _fence->Reset();
@@ -163,6 +165,12 @@ namespace Coco
         return true;
     }
 
+    VkCommandBuffer VulkanStagingBuffer::AcquireTransferCommandBuffer()
+    {
+        _hasDeviceCopies = true;
+        return _currentTransferCommandBuffer;
+    }
+
     void VulkanStagingBuffer::WaitForWorkToComplete()
     {
         _fence->WaitForSignal(false);
@@ -170,8 +178,20 @@ namespace Coco
 
     void VulkanStagingBuffer::AddBufferMemoryBarrier(VkBuffer targetBuffer, uint64 offset, uint64 size)
     {
-        uint32 graphicsQueueIndex = _graphicsQueue->GetFamilyIndex();
-        uint32 transferQueueIndex = _transferQueue->GetFamilyIndex();
+        RecordBufferMemoryBarrier(_currentTransferCommandBuffer, _currentGraphicsCommandBuffer, *_transferQueue, *_graphicsQueue, targetBuffer, offset, size);
+    }
+
+    void VulkanStagingBuffer::AddImageLayoutTransitionBarrier(VkImage targetImage, VkImageLayout newLayout, const VkImageSubresourceRange& subresourceRange)
+    {
+        RecordImageLayoutTransitionBarrier(_currentTransferCommandBuffer, _currentGraphicsCommandBuffer, *_transferQueue, *_graphicsQueue, targetImage, newLayout, subresourceRange);
+    }
+
+    void VulkanStagingBuffer::RecordBufferMemoryBarrier(VkCommandBuffer transferCommandBuffer, VkCommandBuffer graphicsCommandBuffer,
+        const VulkanQueue& transferQueue, const VulkanQueue& graphicsQueue,
+        VkBuffer targetBuffer, uint64 offset, uint64 size)
+    {
+        uint32 graphicsQueueIndex = graphicsQueue.GetFamilyIndex();
+        uint32 transferQueueIndex = transferQueue.GetFamilyIndex();
 
         if (transferQueueIndex == graphicsQueueIndex)
         {
@@ -193,7 +213,7 @@ namespace Coco
                 0, nullptr
             };
 
-            vkCmdPipelineBarrier2(_currentTransferCommandBuffer, &dependencyInfo);
+            vkCmdPipelineBarrier2(transferCommandBuffer, &dependencyInfo);
         }
         else
         {
@@ -217,7 +237,7 @@ namespace Coco
                 0, nullptr
             };
 
-            vkCmdPipelineBarrier2(_currentTransferCommandBuffer, &transferBarrierDependencyInfo);
+            vkCmdPipelineBarrier2(transferCommandBuffer, &transferBarrierDependencyInfo);
 
             VkBufferMemoryBarrier2 graphicsMemoryBarrier = {
                 VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER_2,
@@ -239,14 +259,16 @@ namespace Coco
                 0, nullptr
             };
 
-            vkCmdPipelineBarrier2(_currentGraphicsCommandBuffer, &graphicsBarrierDependencyInfo);
+            vkCmdPipelineBarrier2(graphicsCommandBuffer, &graphicsBarrierDependencyInfo);
         }
     }
 
-    void VulkanStagingBuffer::AddImageLayoutTransitionBarrier(VkImage targetImage, VkImageLayout newLayout, const VkImageSubresourceRange& subresourceRange)
+    void VulkanStagingBuffer::RecordImageLayoutTransitionBarrier(VkCommandBuffer transferCommandBuffer, VkCommandBuffer graphicsCommandBuffer,
+        const VulkanQueue& transferQueue, const VulkanQueue& graphicsQueue,
+        VkImage targetImage, VkImageLayout newLayout, const VkImageSubresourceRange& subresourceRange)
     {
-        uint32 graphicsQueueIndex = _graphicsQueue->GetFamilyIndex();
-        uint32 transferQueueIndex = _transferQueue->GetFamilyIndex();
+        uint32 graphicsQueueIndex = graphicsQueue.GetFamilyIndex();
+        uint32 transferQueueIndex = transferQueue.GetFamilyIndex();
 
         if (transferQueueIndex == graphicsQueueIndex)
         {
@@ -270,7 +292,7 @@ namespace Coco
                 1, &imageMemoryBarrier
             };
 
-            vkCmdPipelineBarrier2(_currentTransferCommandBuffer, &imageBarrierDependencyInfo);
+            vkCmdPipelineBarrier2(transferCommandBuffer, &imageBarrierDependencyInfo);
         }
         else
         {
@@ -294,7 +316,7 @@ namespace Coco
                 1, &postCopyTransferMemoryBarrier
             };
 
-            vkCmdPipelineBarrier2(_currentTransferCommandBuffer, &postCopyTransferDependencyInfo);
+            vkCmdPipelineBarrier2(transferCommandBuffer, &postCopyTransferDependencyInfo);
 
             VkImageMemoryBarrier2 postCopyGraphicsMemoryBarrier = {
                 VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2,
@@ -316,7 +338,7 @@ namespace Coco
                 1, &postCopyGraphicsMemoryBarrier
             };
 
-            vkCmdPipelineBarrier2(_currentGraphicsCommandBuffer, &postCopyGraphicsDependencyInfo);
+            vkCmdPipelineBarrier2(graphicsCommandBuffer, &postCopyGraphicsDependencyInfo);
         }
     }
 
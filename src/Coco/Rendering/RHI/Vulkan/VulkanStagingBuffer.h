@@ -40,11 +40,39 @@ namespace Coco
         bool EndAndSubmit();
         Ref<VulkanGraphicsSemaphore> GetOperationsCompletedSemaphore() { return _graphicsSemaphore; }
         VkCommandBuffer GetCurrentGraphicsCommandBuffer() const { return _currentGraphicsCommandBuffer; }
+
+        /// @brief Gets the transfer command buffer for copies that don't need staging memory, ensuring it is submitted this frame
+        /// @return The transfer command buffer
+        VkCommandBuffer AcquireTransferCommandBuffer();
         void WaitForWorkToComplete();
 
         void AddBufferMemoryBarrier(VkBuffer targetBuffer, uint64 offset, uint64 size);
         void AddImageLayoutTransitionBarrier(VkImage targetImage, VkImageLayout newLayout, const VkImageSubresourceRange& subresourceRange);
 
+        /// @brief Records the barriers that make a buffer range written on the transfer queue readable on the graphics queue
+        /// @param transferCommandBuffer The transfer command buffer the copy was recorded in
+        /// @param graphicsCommandBuffer The graphics command buffer that is submitted after the transfer command buffer
+        /// @param transferQueue The transfer queue
+        /// @param graphicsQueue The graphics queue
+        /// @param targetBuffer The buffer that was written
+        /// @param offset The offset of the written range
+        /// @param size The size of the written range
+        static void RecordBufferMemoryBarrier(VkCommandBuffer transferCommandBuffer, VkCommandBuffer graphicsCommandBuffer,
+            const VulkanQueue& transferQueue, const VulkanQueue& graphicsQueue,
+            VkBuffer targetBuffer, uint64 offset, uint64 size);
+
+        /// @brief Records the barriers that transition an image written on the transfer queue and make it usable on the graphics queue
+        /// @param transferCommandBuffer The transfer command buffer the copy was recorded in
+        /// @param graphicsCommandBuffer The graphics command buffer that is submitted after the transfer command buffer
+        /// @param transferQueue The transfer queue
+        /// @param graphicsQueue The graphics queue
+        /// @param targetImage The image that was written
+        /// @param newLayout The layout to transition the image to
+        /// @param subresourceRange The subresources that were written
+        static void RecordImageLayoutTransitionBarrier(VkCommandBuffer transferCommandBuffer, VkCommandBuffer graphicsCommandBuffer,
+            const VulkanQueue& transferQueue, const VulkanQueue& graphicsQueue,
+            VkImage targetImage, VkImageLayout newLayout, const VkImageSubresourceRange& subresourceRange);
+
     private:
         static constexpr uint64 _pageSize = 1024 * 1024 * 10;
 
@@ -60,6 +88,7 @@ namespace Coco
         VkCommandBuffer _currentTransferCommandBuffer;
         VkCommandBuffer _currentGraphicsCommandBuffer;
         uint64 _lastSignalValue;
+        bool _hasDeviceCopies;
     };
 } // Coco
 
@@ -23,7 +23,7 @@ namespace Coco
     {}
 
     VulkanShaderBufferInterface* VulkanUniformStorage::BindOrAllocate(const char* blockName, uint64 instanceID,
-        Ref<VulkanShaderProgram> shaderProgram, VkCommandBuffer commandBuffer)
+        const Ref<VulkanShaderProgram>& shaderProgram, VkCommandBuffer commandBuffer)
     {
         uint64 interfaceID = GetInterfaceID(blockName, instanceID, *shaderProgram);
 
@@ -36,9 +36,7 @@ namespace Coco
         const VulkanPipelineLayout* pipelineLayout = shaderProgram->GetPipelineLayout();
         auto descriptorSetLayouts = shaderProgram->GetDescriptorSetLayouts();
 
-        auto programLayout = shaderProgram->GetProgramLayout();
-        auto globalTypeLayout = programLayout->getGlobalParamsTypeLayout();
-        int64 blockIndex = globalTypeLayout->findFieldIndexByName(blockName);
+        int64 blockIndex = shaderProgram->GetParamBlockIndex(blockName);
         if (blockIndex == -1)
         {
             COCO_ENGINE_LOG_ERROR("Invalid uniform block \"%s\"", blockName);
@@ -46,25 +44,41 @@ namespace Coco
         }
 
         VulkanDescriptorSetInfo setInfo;
-        setInfo.DescriptorSetIndex = pipelineLayout->GlobalDescriptorSetIndexOffset + blockIndex;
+        setInfo.DescriptorSetIndex = pipelineLayout->ParamBlockSetIndices[blockIndex];
         auto& descriptorSetLayout = descriptorSetLayouts[setInfo.DescriptorSetIndex];
         COCO_ASSERT(!descriptorSetLayout.LayoutBindings.IsEmpty(), "Uniform block contained no bindings");
 
-        slang::TypeLayoutReflection* blockLayout = nullptr;
-
-        auto field = globalTypeLayout->getFieldByIndex(blockIndex);
-        blockLayout = field->getTypeLayout()->getElementTypeLayout();
+        const ShaderTypeLayout* blockLayout = shaderProgram->GetParamBlockLayout(blockIndex);
 
         // TODO: use existing uniform buffer data
-        uint64 dataSize = blockLayout->getSize();
-        if (dataSize > 0)
+        uint64 dataSize = blockLayout->Size;
+        setInfo.UsesDynamicOffset = dataSize > 0;
+        setInfo.BufferOffset = 0;
+
+        if (dataSize > 0 && !_pagedBuffers.TryAllocate(dataSize, setInfo.UniformBuffer, setInfo.BufferOffset))
+        {
+            // New pages are created through the platform, which parallel recording streams share
+            std::lock_guard<std::mutex> guard(_platform->GetSharedStateLock());
             _pagedBuffers.Allocate(dataSize, setInfo.UniformBuffer, setInfo.BufferOffset);
+        }
 
-        auto pool = _descriptorSetPools.TryGetValue(shaderProgram->GetID());
-        if (!pool)
-            pool = &_descriptorSetPools.Emplace(shaderProgram->GetID(), _platform, shaderProgram);
+        if (dataSize > 0 && descriptorSetLayout.LayoutBindings.GetCount() == 1)
+        {
+            // Blocks with only uniform data only differ by their offset, so they share one set per page
+            setInfo.DescriptorSet = GetOrCreateSharedUniformSet(shaderProgram, setInfo.DescriptorSetIndex, *setInfo.UniformBuffer, dataSize);
+        }
+        else
+        {
+            // Blocks with textures need their own set to write the textures into
+            UniquePtr<VulkanDescriptorSetPool>* pool = _descriptorSetPools.TryGetValue(shaderProgram->GetID());
+            if (!pool)
+                pool = &_descriptorSetPools.Emplace(shaderProgram->GetID(), CreateDefaultUnique<VulkanDescriptorSetPool>(_platform, shaderProgram));
 
-        setInfo.DescriptorSet = pool->AllocateDescriptorSet(setInfo.DescriptorSetIndex);
+            setInfo.DescriptorSet = (*pool)->AllocateDescriptorSet(setInfo.DescriptorSetIndex);
+
+            if (dataSize > 0)
+                WriteUniformBufferDescriptor(_platform->GetDevice(), setInfo.DescriptorSet, *setInfo.UniformBuffer, dataSize);
+        }
 
         auto& interface = _interfaces.Emplace(interfaceID, _platform, blockLayout, setInfo, pipelineLayout, commandBuffer);
         interface.Bind(commandBuffer);
@@ -77,9 +91,7 @@ namespace Coco
         if (_interfaces.Contains(id))
             return &_interfaces.Get(id);
 
-        auto programLayout = shaderProgram->GetProgramLayout();
-        auto globalTypeLayout = programLayout->getGlobalParamsTypeLayout();
-        int64 blockIndex = globalTypeLayout->findFieldIndexByName(blockName);
+        int64 blockIndex = shaderProgram->GetParamBlockIndex(blockName);
         if (blockIndex == -1)
         {
             COCO_ENGINE_LOG_ERROR("Invalid uniform block \"%s\"", blockName);
@@ -90,16 +102,13 @@ namespace Coco
         auto descriptorSetLayouts = shaderProgram->GetDescriptorSetLayouts();
 
         VulkanDescriptorSetInfo setInfo;
-        setInfo.DescriptorSetIndex = pipelineLayout->GlobalDescriptorSetIndexOffset + blockIndex;
+        setInfo.DescriptorSetIndex = pipelineLayout->ParamBlockSetIndices[blockIndex];
         auto& descriptorSetLayout = descriptorSetLayouts[setInfo.DescriptorSetIndex];
         COCO_ASSERT(!descriptorSetLayout.LayoutBindings.IsEmpty(), "Uniform block contained no bindings");
 
-        slang::TypeLayoutReflection* blockLayout = nullptr;
+        const ShaderTypeLayout* blockLayout = shaderProgram->GetParamBlockLayout(blockIndex);
 
-        auto field = globalTypeLayout->getFieldByIndex(blockIndex);
-        blockLayout = field->getTypeLayout()->getElementTypeLayout();
-
-        uint64 dataSize = blockLayout->getSize();
+        uint64 dataSize = blockLayout->Size;
         if (dataSize > 0)
             _pagedBuffers.Allocate(dataSize, setInfo.UniformBuffer, setInfo.BufferOffset);
 
@@ -114,18 +123,11 @@ namespace Coco
     }*/
 
     void VulkanUniformStorage::BindDrawTextures(Span<const SharedPtr<Texture>> textures,
-                                                Ref<VulkanShaderProgram> shaderProgram, VkCommandBuffer commandBuffer)
+                                                const Ref<VulkanShaderProgram>& shaderProgram, VkCommandBuffer commandBuffer)
     {
         auto descriptorSetLayouts = shaderProgram->GetDescriptorSetLayouts();
 
-        auto pool = _descriptorSetPools.TryGetValue(shaderProgram->GetID());
-        if (!pool)
-            pool = &_descriptorSetPools.Emplace(shaderProgram->GetID(), _platform, shaderProgram);
-
         StackArray<VkDescriptorSet, 2> descriptorSets;
-        StackArray<VkWriteDescriptorSet, 32> writes;
-        StackArray<VkDescriptorImageInfo, 32> imageInfos;
-        RenderService* rendering = _platform->GetRenderService();
         uint64 currentTextureIndex = 0;
         uint32 firstSetIndex = std::numeric_limits<uint32>::max();
 
@@ -137,42 +139,21 @@ namespace Coco
             if (firstSetIndex == std::numeric_limits<uint32>::max())
                 firstSetIndex = descriptorSetLayout.DescriptorSetIndex;
 
-            VkDescriptorSet descriptorSet = pool->AllocateDescriptorSet(descriptorSetLayout.DescriptorSetIndex);
-            descriptorSets.Append(descriptorSet);
+            StackArray<VulkanDescriptorImageBinding, VulkanDescriptorSetCache::MaxBindings> bindings;
 
-            for (const auto& setBindings : descriptorSetLayout.LayoutBindings)
+            for (uint64 i = 0; i < descriptorSetLayout.LayoutBindings.GetCount(); i++)
             {
-                Texture* tex;
-                if (currentTextureIndex >= textures.size() || textures[currentTextureIndex] == nullptr)
-                {
-                    tex = rendering->GetDefaultCheckerTexture().get();
-                }
-                else
-                {
-                    tex = textures[currentTextureIndex].get();
-                }
-
-                Ref<VulkanImage> image = tex->GetImage().Downcast<VulkanImage>();
-                Ref<VulkanImageSampler> imageSampler = tex->GetSampler().Downcast<VulkanImageSampler>();
-
-                VkDescriptorImageInfo& imageInfo = imageInfos.EmplaceBack();
-                imageInfo.imageView = image->GetNativeView();
-                imageInfo.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
-                imageInfo.sampler = imageSampler->GetSampler();
-
-                VkWriteDescriptorSet& write = writes.EmplaceBack(VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET);
-                write.dstSet = descriptorSet;
-                write.dstBinding = setBindings.binding;
-                write.dstArrayElement = 0;
-                write.descriptorCount = 1;
-                write.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
-                write.pImageInfo = &imageInfo;
-
+                Texture* texture = currentTextureIndex < textures.size() ? textures[currentTextureIndex].get() : nullptr;
+                bindings.Append(GetDrawTextureBinding(texture));
                 currentTextureIndex++;
             }
+
+            // Sets with the same textures are written once and reused across draws and frames
+            descriptorSets.Append(GetDrawTextureSet(shaderProgram, descriptorSetLayout, bindings));
         }
 
-        vkUpdateDescriptorSets(_platform->GetDevice(), static_cast<uint32>(writes.GetCount()), writes.Data(), 0, nullptr);
+        if (descriptorSets.IsEmpty())
+            return;
 
         const VulkanPipelineLayout* pipelineLayout = shaderProgram->GetPipelineLayout();
         vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipelineLayout->PipelineLayout,
@@ -190,6 +171,24 @@ namespace Coco
         }
     }
 
+    uint32 VulkanUniformStorage::GetBindlessTextureIndex(Texture* texture, VulkanBindlessTextureTable& table)
+    {
+        if (const uint32* index = _bindlessTextureIndices.TryGetValue(texture))
+            return *index;
+
+        uint32 index;
+
+        {
+            // The table and texture loading are shared by parallel recording streams
+            std::lock_guard<std::mutex> guard(_platform->GetSharedStateLock());
+            index = table.GetTextureIndex(texture);
+        }
+
+        // Slots used this frame aren't evicted until frames in flight are done with them, so the index stays valid for the frame
+        _bindlessTextureIndices.Emplace(texture, index);
+        return index;
+    }
+
     bool VulkanUniformStorage::Has(uint64 id) const
     {
         return _interfaces.Contains(id);
@@ -199,22 +198,179 @@ namespace Coco
     {
         _pagedBuffers.Clear();
         _interfaces.Clear();
+        _drawTextureBindings.Clear();
+        _drawTextureSets.Clear();
+        _bindlessTextureIndices.Clear();
 
         for (auto& pool : _descriptorSetPools)
         {
-            pool.second.Reset();
+            pool.second->Reset();
 
             // TODO: free stale pools
-            //if (_platform->GetCurrentFrameNumber() - pool.second.GetLastAllocatedFrameNumber())
+            //if (_platform->GetCurrentFrameNumber() - pool.second->GetLastAllocatedFrameNumber())
             //{
 
             //}
         }
     }
 
+    void VulkanUniformStorage::OnResourceInvalidated(uint64 resourceID)
+    {
+        UniquePtr<VulkanDescriptorSetPool>* pool = _descriptorSetPools.TryGetValue(resourceID);
+        UniquePtr<VulkanDescriptorSetPool>* sharedPool = _sharedDescriptorSetPools.TryGetValue(resourceID);
+
+        if (!pool && !sharedPool)
+            return;
+
+        Array<uint64> staleKeys;
+
+        for (const auto& [key, set] : _sharedUniformSets)
+        {
+            if (set.ShaderProgramID == resourceID)
+                staleKeys.Append(key);
+        }
+
+        for (const uint64 key : staleKeys)
+            _sharedUniformSets.Remove(key);
+
+        // Take the pools out of the maps first, since destroying them invalidates the shader program again
+        UniquePtr<VulkanDescriptorSetPool> removedPool;
+        if (pool)
+        {
+            removedPool = std::move(*pool);
+            _descriptorSetPools.Remove(resourceID);
+        }
+
+        UniquePtr<VulkanDescriptorSetPool> removedSharedPool;
+        if (sharedPool)
+        {
+            removedSharedPool = std::move(*sharedPool);
+            _sharedDescriptorSetPools.Remove(resourceID);
+        }
+
+        // Frames in flight may still be using the pools' sets
+        _platform->WaitForIdle();
+        removedPool.reset();
+        removedSharedPool.reset();
+    }
+
     uint64 VulkanUniformStorage::GetInterfaceID(const char* blockName, uint64 instanceID,
         VulkanShaderProgram& shaderProgram)
     {
         return Math::CombineHashes(shaderProgram.GetID(), instanceID, ToHash(blockName));
     }
+
+    VkDescriptorSet VulkanUniformStorage::GetOrCreateSharedUniformSet(const Ref<VulkanShaderProgram>& shaderProgram, uint64 descriptorSetIndex,
+        const VulkanBuffer& uniformBuffer, uint64 blockSize)
+    {
+        const uint64 key = Math::CombineHashes(shaderProgram->GetID(), descriptorSetIndex, uniformBuffer.GetID());
+
+        if (const SharedUniformSet* existing = _sharedUniformSets.TryGetValue(key))
+            return existing->DescriptorSet;
+
+        UniquePtr<VulkanDescriptorSetPool>* pool = _sharedDescriptorSetPools.TryGetValue(shaderProgram->GetID());
+        if (!pool)
+            pool = &_sharedDescriptorSetPools.Emplace(shaderProgram->GetID(), CreateDefaultUnique<VulkanDescriptorSetPool>(_platform, shaderProgram));
+
+        VkDescriptorSet descriptorSet = (*pool)->AllocateDescriptorSet(descriptorSetIndex);
+        WriteUniformBufferDescriptor(_platform->GetDevice(), descriptorSet, uniformBuffer, blockSize);
+
+        _sharedUniformSets.Emplace(key, SharedUniformSet{shaderProgram->GetID(), descriptorSet});
+        return descriptorSet;
+    }
+
+    const VulkanDescriptorImageBinding& VulkanUniformStorage::GetDrawTextureBinding(Texture* texture)
+    {
+        if (const VulkanDescriptorImageBinding* binding = _drawTextureBindings.TryGetValue(texture))
+            return *binding;
+
+        Ref<VulkanImage> image;
+        Ref<VulkanImageSampler> imageSampler;
+
+        {
+            // Checking if a texture is ready can finish loading it, which other streams may also be doing
+            std::lock_guard<std::mutex> guard(_platform->GetSharedStateLock());
+
+            Texture* tex = texture;
+            if (!tex || !tex->IsReady())
+                tex = _platform->GetRenderService()->GetDefaultCheckerTexture().get();
+
+            image = tex->GetImage().Downcast<VulkanImage>();
+            imageSampler = tex->GetSampler().Downcast<VulkanImageSampler>();
+        }
+
+        VulkanDescriptorImageBinding binding{};
+        binding.ImageID = image->GetID();
+        binding.SamplerID = imageSampler->GetID();
+        binding.ImageInfo.imageView = image->GetNativeView();
+        binding.ImageInfo.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+        binding.ImageInfo.sampler = imageSampler->GetSampler();
+
+        return _drawTextureBindings.Emplace(texture, binding);
+    }
+
+    VkDescriptorSet VulkanUniformStorage::GetDrawTextureSet(const Ref<VulkanShaderProgram>& shaderProgram,
+        const VulkanDescriptorSetLayout& setLayout, Span<const VulkanDescriptorImageBinding> bindings)
+    {
+        const uint64 shaderProgramID = shaderProgram->GetID();
+        uint64 key = Math::CombineHashes(shaderProgramID, static_cast<uint64>(setLayout.DescriptorSetIndex));
+
+        for (const auto& binding : bindings)
+            key = Math::CombineHashes(key, binding.ImageID, binding.SamplerID);
+
+        if (const DrawTextureSet* existing = _drawTextureSets.TryGetValue(key))
+        {
+            bool matches = existing->ShaderProgramID == shaderProgramID &&
+                existing->DescriptorSetIndex == setLayout.DescriptorSetIndex &&
+                existing->ResourceIDs.GetCount() == bindings.size() * 2;
+
+            for (uint64 i = 0; matches && i < bindings.size(); i++)
+                matches = existing->ResourceIDs[i * 2] == bindings[i].ImageID && existing->ResourceIDs[i * 2 + 1] == bindings[i].SamplerID;
+
+            if (matches)
+                return existing->DescriptorSet;
+        }
+
+        DrawTextureSet set{};
+        set.ShaderProgramID = shaderProgramID;
+        set.DescriptorSetIndex = setLayout.DescriptorSetIndex;
+
+        for (const auto& binding : bindings)
+        {
+            set.ResourceIDs.Append(binding.ImageID);
+            set.ResourceIDs.Append(binding.SamplerID);
+        }
+
+        {
+            // The descriptor set cache is shared by parallel recording streams
+            std::lock_guard<std::mutex> guard(_platform->GetSharedStateLock());
+            set.DescriptorSet = _platform->GetVulkanCache()->GetDescriptorSetCache().GetOrCreateImageSet(shaderProgram, setLayout, bindings);
+        }
+
+        // Sets the cache replaces are only freed once frames in flight are done with them, so the set stays valid for the frame
+        if (_drawTextureSets.Contains(key))
+            _drawTextureSets.Remove(key);
+
+        _drawTextureSets.Emplace(key, set);
+        return set.DescriptorSet;
+    }
+
+    void VulkanUniformStorage::WriteUniformBufferDescriptor(VkDevice device, VkDescriptorSet descriptorSet, const VulkanBuffer& uniformBuffer, uint64 blockSize)
+    {
+        // The offset comes from the dynamic offset when the set is bound
+        VkDescriptorBufferInfo bufferInfo;
+        bufferInfo.buffer = uniformBuffer.GetBuffer();
+        bufferInfo.offset = 0;
+        bufferInfo.range = blockSize;
+
+        VkWriteDescriptorSet write = {VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET};
+        write.dstSet = descriptorSet;
+        write.dstBinding = 0;
+        write.dstArrayElement = 0;
+        write.descriptorCount = 1;
+        write.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
+        write.pBufferInfo = &bufferInfo;
+
+        vkUpdateDescriptorSets(device, 1, &write, 0, nullptr);
+    }
 }
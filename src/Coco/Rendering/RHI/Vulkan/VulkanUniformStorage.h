@@ -10,31 +10,95 @@
 #include "Coco/Rendering/Graphics/PagedLinearBuffer.h"
 #include "VulkanShaderBufferInterface.h"
 #include "VulkanDescriptorSetPool.h"
+#include "CachedResources/VulkanDescriptorSetCache.h"
 #include "Resources/VulkanBuffer.h"
 
 namespace Coco
 {
     class VulkanShaderProgram;
     class VulkanGraphicsPlatform;
+    class VulkanBindlessTextureTable;
 
     class VulkanUniformStorage
     {
     public:
         VulkanUniformStorage(VulkanGraphicsPlatform* platform, uint64 pageSize);
 
-        VulkanShaderBufferInterface* BindOrAllocate(const char* blockName, uint64 instanceID, Ref<VulkanShaderProgram> shaderProgram, VkCommandBuffer commandBuffer);
-        void BindDrawTextures(Span<const SharedPtr<Texture>> textures, Ref<VulkanShaderProgram> shaderProgram, VkCommandBuffer commandBuffer);
+        VulkanShaderBufferInterface* BindOrAllocate(const char* blockName, uint64 instanceID, const Ref<VulkanShaderProgram>& shaderProgram, VkCommandBuffer commandBuffer);
+        void BindDrawTextures(Span<const SharedPtr<Texture>> textures, const Ref<VulkanShaderProgram>& shaderProgram, VkCommandBuffer commandBuffer);
+
+        /// @brief Gets the index of a texture in the bindless texture table.
+        /// Indices are remembered for the rest of the frame, so the shared table is only locked the first time this storage uses a texture
+        /// @param texture The texture, or null for the default texture
+        /// @param table The bindless texture table
+        /// @return The index of the texture in the table
+        uint32 GetBindlessTextureIndex(Texture* texture, VulkanBindlessTextureTable& table);
+
         void Bind(const char* blockName, uint64 instanceID, VulkanShaderProgram& shaderProgram, VkCommandBuffer commandBuffer);
         bool Has(uint64 id) const;
         void Clear();
 
+        /// @brief Destroys the descriptor set pools and sets of a shader program that was invalidated
+        /// @param resourceID The ID of the invalidated resource
+        void OnResourceInvalidated(uint64 resourceID);
+
+        /// @brief Writes a dynamic uniform buffer descriptor into binding 0 of a set
+        /// @param device The device
+        /// @param descriptorSet The descriptor set
+        /// @param uniformBuffer The buffer
+        /// @param blockSize The size of the block that dynamic offsets will point to
+        static void WriteUniformBufferDescriptor(VkDevice device, VkDescriptorSet descriptorSet, const VulkanBuffer& uniformBuffer, uint64 blockSize);
+
     private:
+        /// @brief A descriptor set shared by all instances of a uniform-only block in a page
+        struct SharedUniformSet
+        {
+            uint64 ShaderProgramID;
+            VkDescriptorSet DescriptorSet;
+        };
+
+        /// @brief A draw texture set that this storage has gotten from the platform's descriptor set cache this frame
+        struct DrawTextureSet
+        {
+            uint64 ShaderProgramID;
+            uint32 DescriptorSetIndex;
+            StackArray<uint64, VulkanDescriptorSetCache::MaxBindings * 2> ResourceIDs;
+            VkDescriptorSet DescriptorSet;
+        };
+
         VulkanGraphicsPlatform* _platform;
         PagedLinearBuffer<VulkanBuffer> _pagedBuffers;
         Map<uint64, VulkanShaderBufferInterface> _interfaces;
-        Map<uint64, VulkanDescriptorSetPool> _descriptorSetPools;
+        Map<uint64, UniquePtr<VulkanDescriptorSetPool>> _descriptorSetPools;
+        Map<uint64, UniquePtr<VulkanDescriptorSetPool>> _sharedDescriptorSetPools;
+        Map<uint64, SharedUniformSet> _sharedUniformSets;
+        Map<const Texture*, VulkanDescriptorImageBinding> _drawTextureBindings;
+        Map<uint64, DrawTextureSet> _drawTextureSets;
+        Map<const Texture*, uint32> _bindlessTextureIndices;
 
         static uint64 GetInterfaceID(const char* blockName, uint64 instanceID, VulkanShaderProgram& shaderProgram);
+
+        /// @brief Gets the descriptor set shared by all instances of a uniform-only block in a page, creating it if needed.
+        /// These sets are only freed when their shader program is invalidated, since the pages they point to live as long as the storage
+        /// @param shaderProgram The shader program
+        /// @param descriptorSetIndex The index of the block's descriptor set
+        /// @param uniformBuffer The page the block was allocated from
+        /// @param blockSize The size of the block
+        /// @return The descriptor set
+        VkDescriptorSet GetOrCreateSharedUniformSet(const Ref<VulkanShaderProgram>& shaderProgram, uint64 descriptorSetIndex, const VulkanBuffer& uniformBuffer, uint64 blockSize);
+
+        /// @brief Gets the image binding of a draw texture, resolving it the first time this storage uses the texture this frame.
+        /// Textures that aren't ready are bound as the default texture
+        /// @param texture The texture, or null for the default texture
+        /// @return The image binding
+        const VulkanDescriptorImageBinding& GetDrawTextureBinding(Texture* texture);
+
+        /// @brief Gets a draw texture set from the platform's descriptor set cache, remembering it for the rest of the frame
+        /// @param shaderProgram The shader program
+        /// @param setLayout The layout of the descriptor set
+        /// @param bindings The images bound to the set
+        /// @return The descriptor set
+        VkDescriptorSet GetDrawTextureSet(const Ref<VulkanShaderProgram>& shaderProgram, const VulkanDescriptorSetLayout& setLayout, Span<const VulkanDescriptorImageBinding> bindings);
     };
 }
 
@@ -0,0 +1,456 @@
+//
+// Created by cullen on 10/18/26.
+//
+
+#include "VulkanUploadScheduler.h"
+
+#include "VulkanGraphicsPlatform.h"
+#include "VulkanStagingBuffer.h"
+#include "VulkanUtils.h"
+
+#include "Coco/Core/Engine.h"
+
+namespace Coco
+{
+    VulkanQueuedUpload::VulkanQueuedUpload(uint64 id, Array<uint8>&& data, UploadCompletedCallback onCompleted) :
+        ID(id),
+        TargetBuffer(),
+        TargetOffset(0),
+        TargetImage(),
+        Data(std::move(data)),
+        BytesRecorded(0),
+        MipLevel(0),
+        MipOffset(0),
+        UploadsMips(false),
+        OnCompleted(std::move(onCompleted))
+    {}
+
+    VulkanInFlightUpload::VulkanInFlightUpload(uint64 id, uint64 completionValue, UploadCompletedCallback&& onCompleted) :
+        ID(id),
+        CompletionValue(completionValue),
+        OnCompleted(std::move(onCompleted))
+    {}
+
+    VulkanStagingRingAllocation::VulkanStagingRingAllocation(uint64 endOffset, uint64 completionValue) :
+        EndOffset(endOffset),
+        CompletionValue(completionValue)
+    {}
+
+    VulkanUploadSubmission::VulkanUploadSubmission(VulkanGraphicsPlatform* platform) :
+        TransferCommandPool(CreateDefaultUnique<VulkanCommandPool>(platform, VulkanQueue::Type::Transfer)),
+        GraphicsCommandPool(CreateDefaultUnique<VulkanCommandPool>(platform, VulkanQueue::Type::Graphics)),
+        CompletionValue(0)
+    {}
+
+    VulkanUploadScheduler::VulkanUploadScheduler(VulkanGraphicsPlatform* platform, uint64 frameBudget) :
+        _platform(platform),
+        _transferQueue(platform->GetQueue(VulkanQueue::Type::Transfer)),
+        _graphicsQueue(platform->GetQueue(VulkanQueue::Type::Graphics)),
+        _stagingRing(),
+        _stagingRingHead(0),
+        _stagingRingTail(0),
+        _stagingRingAllocations(),
+        _timelineSemaphore(CreateDefaultManagedRef<VulkanGraphicsSemaphore>(0, platform, true)),
+        _lastSignalValue(0),
+        _completedValue(0),
+        _submissions(nullptr, _submissionCount),
+        _currentSubmissionIndex(0),
+        _queuedUploads(),
+        _inFlightUploads(),
+        _uploadCompletionValues(),
+        _nextUploadID(InvalidUploadID + 1),
+        _frameBudget(frameBudget),
+        _queuedBytes(0)
+    {
+        _stagingRing = platform->CreateBuffer(
+            BufferDescription(_stagingRingSize, BufferUsageFlags::HostVisible | BufferUsageFlags::TransferSource)
+        ).Downcast<VulkanBuffer>();
+
+        for (uint64 i = 0; i < _submissionCount; i++)
+            _submissions.EmplaceBack(platform);
+
+        COCO_ENGINE_LOG_VERBOSE("Created VulkanUploadScheduler with a %u byte staging ring and a %u byte frame budget", _stagingRingSize, _frameBudget);
+    }
+
+    VulkanUploadScheduler::~VulkanUploadScheduler()
+    {
+        _platform->WaitForIdle();
+
+        for (Array<VulkanQueuedUpload>& queue : _queuedUploads)
+            queue.Clear(true);
+
+        _inFlightUploads.Clear(true);
+        _uploadCompletionValues.Clear();
+        _submissions.Clear(true);
+        _stagingRingAllocations.Clear(true);
+
+        if (_stagingRing.IsValid())
+            _platform->InvalidateResource(_stagingRing->GetID());
+
+        _timelineSemaphore.Invalidate();
+    }
+
+    uint64 VulkanUploadScheduler::QueueBufferUpload(Ref<Buffer> buffer, uint64 offset, Array<uint8>&& data, UploadPriority priority,
+        UploadCompletedCallback onCompleted)
+    {
+        COCO_ASSERT(buffer.IsValid(), "Buffer was invalid");
+        COCO_ASSERT(offset + data.GetCount() <= buffer->GetSize(), "Upload must fit within the buffer");
+
+        VulkanQueuedUpload upload(_nextUploadID, std::move(data), std::move(onCompleted));
+        upload.TargetBuffer = buffer.Downcast<VulkanBuffer>();
+        upload.TargetOffset = offset;
+
+        return AddQueuedUpload(priority, std::move(upload));
+    }
+
+    uint64 VulkanUploadScheduler::QueueImageUpload(Ref<Image> image, Array<uint8>&& pixelData, UploadPriority priority,
+        UploadCompletedCallback onCompleted)
+    {
+        COCO_ASSERT(image.IsValid(), "Image was invalid");
+        COCO_ASSERT(pixelData.GetCount() >= image->GetPixelDataSize(), "Pixel data must cover the whole image");
+
+        Ref<VulkanImage> vulkanImage = image.Downcast<VulkanImage>();
+
+        if (GetImageCopyGranularity(*vulkanImage, 0) > _stagingRingSize)
+        {
+            COCO_ENGINE_LOG_ERROR("Image %u is too large to upload through the staging ring", image->GetID());
+            return InvalidUploadID;
+        }
+
+        const ImageDescription& description = vulkanImage->GetDescription();
+        const uint64 mipChainSize = vulkanImage->GetMipChainDataSize();
+        const bool uploadsMips = description.MipCount > 1 && pixelData.GetCount() >= mipChainSize;
+
+        // Mip maps are generated with blits, which compressed formats don't support
+        if (description.MipCount > 1 && !uploadsMips && ImageDescription::IsCompressed(description.PixelFormat))
+        {
+            COCO_ENGINE_LOG_ERROR("Compressed image %u must be uploaded with all of its mip levels", image->GetID());
+            return InvalidUploadID;
+        }
+
+        pixelData.Resize(uploadsMips ? mipChainSize : vulkanImage->GetPixelDataSize());
+
+        VulkanQueuedUpload upload(_nextUploadID, std::move(pixelData), std::move(onCompleted));
+        upload.TargetImage = vulkanImage;
+        upload.UploadsMips = uploadsMips;
+
+        return AddQueuedUpload(priority, std::move(upload));
+    }
+
+    bool VulkanUploadScheduler::IsUploadComplete(uint64 uploadID) const
+    {
+        const uint64* completionValue = _uploadCompletionValues.TryGetValue(uploadID);
+
+        // Uploads are forgotten once their callbacks are called
+        if (!completionValue)
+            return true;
+
+        return *completionValue != 0 && *completionValue <= _completedValue;
+    }
+
+    void VulkanUploadScheduler::Process()
+    {
+        ReleaseCompletedUploads();
+        SubmitQueuedUploads();
+    }
+
+    uint64 VulkanUploadScheduler::GetImageCopyGranularity(const VulkanImage& image, uint32 mipLevel)
+    {
+        const ImageDescription& description = image.GetDescription();
+        const uint64 mipSize = image.GetMipDataSize(mipLevel);
+
+        // 3D images are copied in one go, as their pixel data is ordered by depth slice
+        if (description.Depth > 1 || description.Height == 0)
+            return mipSize;
+
+        return mipSize / image.GetCopyRowCount(mipLevel);
+    }
+
+    void VulkanUploadScheduler::ReleaseCompletedUploads()
+    {
+        AssertVkSuccess(vkGetSemaphoreCounterValue(_platform->GetDevice(), _timelineSemaphore->GetSemaphore(), &_completedValue));
+
+        // Staging ring space is allocated and released in submission order
+        while (!_stagingRingAllocations.IsEmpty() && _stagingRingAllocations.Front().CompletionValue <= _completedValue)
+        {
+            _stagingRingTail = _stagingRingAllocations.Front().EndOffset;
+            _stagingRingAllocations.RemoveAt(0);
+        }
+
+        uint64 i = 0;
+        while (i < _inFlightUploads.GetCount())
+        {
+            VulkanInFlightUpload& upload = _inFlightUploads[i];
+
+            if (upload.CompletionValue > _completedValue)
+            {
+                i++;
+                continue;
+            }
+
+            UploadCompletedCallback callback = std::move(upload.OnCompleted);
+            _uploadCompletionValues.Remove(upload.ID);
+            _inFlightUploads.RemoveAt(i);
+
+            // Called last as callbacks are free to queue more uploads
+            if (callback)
+                callback();
+        }
+    }
+
+    void VulkanUploadScheduler::SubmitQueuedUploads()
+    {
+        if (_queuedBytes == 0)
+            return;
+
+        VulkanUploadSubmission& submission = _submissions[_currentSubmissionIndex];
+
+        // Every submission is still in use by the GPU, so wait for one to finish
+        if (submission.CompletionValue > _completedValue)
+            return;
+
+        submission.TransferCommandPool->Reset();
+        submission.GraphicsCommandPool->Reset();
+
+        VkCommandBuffer transferCommandBuffer = submission.TransferCommandPool->AllocateCommandBuffer();
+        VkCommandBuffer graphicsCommandBuffer = submission.GraphicsCommandPool->AllocateCommandBuffer();
+
+        VkCommandBufferBeginInfo beginInfo{ VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO };
+        beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+        vkBeginCommandBuffer(transferCommandBuffer, &beginInfo);
+        vkBeginCommandBuffer(graphicsCommandBuffer, &beginInfo);
+
+        // The transfer submission signals the first value, and the graphics submission that acquires the resources signals the second
+        const uint64 transferSignalValue = _lastSignalValue + 1;
+        const uint64 completionValue = _lastSignalValue + 2;
+
+        uint64 remainingBudget = _frameBudget;
+        bool recordedAnyChunks = false;
+        bool stagingRingFull = false;
+
+        for (uint64 p = _priorityCount; p > 0 && remainingBudget > 0 && !stagingRingFull; p--)
+        {
+            Array<VulkanQueuedUpload>& queue = _queuedUploads[p - 1];
+
+            while (!queue.IsEmpty() && remainingBudget > 0)
+            {
+                VulkanQueuedUpload& upload = queue.Front();
+
+                if (!upload.TargetBuffer.IsValid() && !upload.TargetImage.IsValid())
+                {
+                    COCO_ENGINE_LOG_VERBOSE("Dropped upload %u as its target was destroyed", upload.ID);
+
+                    _queuedBytes -= upload.Data.GetCount() - upload.BytesRecorded;
+                    _uploadCompletionValues.Remove(upload.ID);
+                    queue.RemoveAt(0);
+                    continue;
+                }
+
+                if (!RecordUploadChunk(upload, transferCommandBuffer, graphicsCommandBuffer, completionValue, remainingBudget))
+                {
+                    stagingRingFull = true;
+                    break;
+                }
+
+                recordedAnyChunks = true;
+
+                if (upload.BytesRecorded < upload.Data.GetCount())
+                    continue;
+
+                _uploadCompletionValues[upload.ID] = completionValue;
+                _inFlightUploads.EmplaceBack(upload.ID, completionValue, std::move(upload.OnCompleted));
+                queue.RemoveAt(0);
+            }
+        }
+
+        vkEndCommandBuffer(transferCommandBuffer);
+        vkEndCommandBuffer(graphicsCommandBuffer);
+
+        if (!recordedAnyChunks)
+            return;
+
+        VkCommandBufferSubmitInfo transferBufferInfo = {
+            VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO,
+            nullptr,
+            transferCommandBuffer,
+            0
+        };
+
+        VkSemaphoreSubmitInfo transferSignalInfo = {
+            VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO,
+            nullptr,
+            _timelineSemaphore->GetSemaphore(),
+            transferSignalValue,
+            VK_PIPELINE_STAGE_2_BOTTOM_OF_PIPE_BIT,
+            0
+        };
+
+        VkSubmitInfo2 transferSubmitInfo = {
+            VK_STRUCTURE_TYPE_SUBMIT_INFO_2,
+            nullptr,
+            0,
+            0, nullptr,
+            1, &transferBufferInfo,
+            1, &transferSignalInfo
+        };
+
+        AssertVkSuccess(vkQueueSubmit2(_transferQueue->GetQueue(), 1, &transferSubmitInfo, nullptr));
+
+        VkSemaphoreSubmitInfo graphicsWaitInfo = {
+            VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO,
+            nullptr,
+            _timelineSemaphore->GetSemaphore(),
+            transferSignalValue,
+            VK_PIPELINE_STAGE_2_TOP_OF_PIPE_BIT,
+            0
+        };
+
+        VkCommandBufferSubmitInfo graphicsBufferInfo = {
+            VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO,
+            nullptr,
+            graphicsCommandBuffer,
+            0
+        };
+
+        VkSemaphoreSubmitInfo graphicsSignalInfo = {
+            VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO,
+            nullptr,
+            _timelineSemaphore->GetSemaphore(),
+            completionValue,
+            VK_PIPELINE_STAGE_2_BOTTOM_OF_PIPE_BIT,
+            0
+        };
+
+        VkSubmitInfo2 graphicsSubmitInfo = {
+            VK_STRUCTURE_TYPE_SUBMIT_INFO_2,
+            nullptr,
+            0,
+            1, &graphicsWaitInfo,
+            1, &graphicsBufferInfo,
+            1, &graphicsSignalInfo
+        };
+
+        AssertVkSuccess(vkQueueSubmit2(_graphicsQueue->GetQueue(), 1, &graphicsSubmitInfo, nullptr));
+
+        _lastSignalValue = completionValue;
+        submission.CompletionValue = completionValue;
+        _currentSubmissionIndex = (_currentSubmissionIndex + 1) % _submissionCount;
+    }
+
+    bool VulkanUploadScheduler::RecordUploadChunk(VulkanQueuedUpload& upload, VkCommandBuffer transferCommandBuffer,
+        VkCommandBuffer graphicsCommandBuffer, uint64 completionValue, uint64& remainingBudget)
+    {
+        const uint64 remainingBytes = upload.Data.GetCount() - upload.BytesRecorded;
+        uint64 chunkSize = Math::Min(remainingBytes, Math::Min(remainingBudget, _stagingRingSize));
+
+        uint64 rowSize = 0;
+        uint64 mipSize = 0;
+        if (upload.TargetImage.IsValid())
+        {
+            // Images are copied in whole rows of a single mip level. At least one row is copied so that rows larger than the budget still make progress
+            rowSize = GetImageCopyGranularity(*upload.TargetImage, upload.MipLevel);
+            mipSize = upload.TargetImage->GetMipDataSize(upload.MipLevel);
+            chunkSize = Math::Min(chunkSize, upload.MipOffset + mipSize - upload.BytesRecorded);
+            chunkSize = Math::Max(chunkSize - chunkSize % rowSize, rowSize);
+        }
+
+        uint64 stagingOffset;
+        if (!TryAllocateStaging(chunkSize, completionValue, stagingOffset))
+            return false;
+
+        uint8* stagingPtr = static_cast<uint8*>(_stagingRing->GetMappedPtr()) + stagingOffset;
+        memcpy(stagingPtr, upload.Data.Data() + upload.BytesRecorded, chunkSize);
+
+        if (upload.TargetImage.IsValid())
+        {
+            VulkanImage& image = *upload.TargetImage;
+            const uint32 firstRow = static_cast<uint32>((upload.BytesRecorded - upload.MipOffset) / rowSize);
+            const uint32 rowCount = static_cast<uint32>(chunkSize / rowSize);
+
+            image.CopyFromStaging(transferCommandBuffer, _stagingRing->GetBuffer(), stagingOffset, upload.MipLevel, firstRow, rowCount);
+
+            if (upload.BytesRecorded + chunkSize == upload.MipOffset + mipSize)
+            {
+                upload.MipOffset += mipSize;
+                upload.MipLevel++;
+            }
+
+            if (chunkSize == remainingBytes)
+                image.FinishUpload(transferCommandBuffer, graphicsCommandBuffer, *_transferQueue, *_graphicsQueue, upload.UploadsMips);
+        }
+        else
+        {
+            const uint64 targetOffset = upload.TargetOffset + upload.BytesRecorded;
+
+            VkBufferCopy copyRegion = {
+                .srcOffset = stagingOffset,
+                .dstOffset = targetOffset,
+                .size = chunkSize
+            };
+
+            vkCmdCopyBuffer(transferCommandBuffer, _stagingRing->GetBuffer(), upload.TargetBuffer->GetBuffer(), 1, &copyRegion);
+
+            VulkanStagingBuffer::RecordBufferMemoryBarrier(transferCommandBuffer, graphicsCommandBuffer, *_transferQueue, *_graphicsQueue,
+                upload.TargetBuffer->GetBuffer(), targetOffset, chunkSize);
+        }
+
+        upload.BytesRecorded += chunkSize;
+        _queuedBytes -= chunkSize;
+        remainingBudget -= Math::Min(remainingBudget, chunkSize);
+
+        return true;
+    }
+
+    bool VulkanUploadScheduler::TryAllocateStaging(uint64 size, uint64 completionValue, uint64& outOffset)
+    {
+        if (_stagingRingAllocations.IsEmpty())
+        {
+            _stagingRingHead = 0;
+            _stagingRingTail = 0;
+        }
+
+        const uint64 alignedHead = Math::AlignedAddress(_stagingRingHead, _platform->GetDeviceDescription().MinimumBufferAlignment);
+
+        if (_stagingRingAllocations.IsEmpty() || _stagingRingHead > _stagingRingTail)
+        {
+            // Free space runs from the head to the end of the ring, then wraps around to the tail
+            if (alignedHead + size <= _stagingRingSize)
+                outOffset = alignedHead;
+            else if (size <= _stagingRingTail)
+                outOffset = 0;
+            else
+                return false;
+        }
+        else
+        {
+            // The head has wrapped around behind the tail
+            if (alignedHead + size > _stagingRingTail)
+                return false;
+
+            outOffset = alignedHead;
+        }
+
+        _stagingRingHead = outOffset + size;
+        _stagingRingAllocations.EmplaceBack(_stagingRingHead, completionValue);
+
+        return true;
+    }
+
+    uint64 VulkanUploadScheduler::AddQueuedUpload(UploadPriority priority, VulkanQueuedUpload&& upload)
+    {
+        if (upload.Data.IsEmpty())
+        {
+            if (upload.OnCompleted)
+                upload.OnCompleted();
+
+            return InvalidUploadID;
+        }
+
+        const uint64 id = _nextUploadID++;
+        _queuedBytes += upload.Data.GetCount();
+        _uploadCompletionValues.Emplace(id, 0);
+        _queuedUploads[static_cast<uint8>(priority)].EmplaceBack(std::move(upload));
+
+        return id;
+    }
+} // Coco
\ No newline at end of file
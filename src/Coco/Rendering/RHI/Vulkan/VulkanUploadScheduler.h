@@ -0,0 +1,153 @@
+//
+// Created by cullen on 10/18/26.
+//
+
+#ifndef COCOENGINE_VULKANUPLOADSCHEDULER_H
+#define COCOENGINE_VULKANUPLOADSCHEDULER_H
+#include "Coco/Core/Memory/Ptrs.h"
+#include "Coco/Core/Types/Array.h"
+#include "Coco/Core/Types/Map.h"
+#include "Coco/Rendering/Graphics/UploadScheduler.h"
+#include "VulkanCommandPool.h"
+#include "Resources/VulkanBuffer.h"
+#include "Resources/VulkanImage.h"
+#include "Resources/VulkanGraphicsSemaphore.h"
+
+namespace Coco
+{
+    /// @brief An upload that is waiting for transfer bandwidth
+    struct VulkanQueuedUpload
+    {
+        uint64 ID;
+        Ref<VulkanBuffer> TargetBuffer;
+        uint64 TargetOffset;
+        Ref<VulkanImage> TargetImage;
+        Array<uint8> Data;
+
+        /// @brief The number of bytes of Data that have already been recorded
+        uint64 BytesRecorded;
+
+        /// @brief The mip level of TargetImage that the next chunk is copied to
+        uint32 MipLevel;
+
+        /// @brief The offset in Data of the pixel data for MipLevel
+        uint64 MipOffset;
+
+        /// @brief If true, Data holds every mip level of TargetImage, so mip maps aren't generated
+        bool UploadsMips;
+        UploadCompletedCallback OnCompleted;
+
+        VulkanQueuedUpload(uint64 id, Array<uint8>&& data, UploadCompletedCallback onCompleted);
+    };
+
+    /// @brief An upload whose data has all been submitted, but may still be in use by the GPU
+    struct VulkanInFlightUpload
+    {
+        uint64 ID;
+        uint64 CompletionValue;
+        UploadCompletedCallback OnCompleted;
+
+        VulkanInFlightUpload(uint64 id, uint64 completionValue, UploadCompletedCallback&& onCompleted);
+    };
+
+    /// @brief A region at the end of the staging ring that is in use until a submission completes
+    struct VulkanStagingRingAllocation
+    {
+        uint64 EndOffset;
+        uint64 CompletionValue;
+
+        VulkanStagingRingAllocation(uint64 endOffset, uint64 completionValue);
+    };
+
+    /// @brief The command pools for a single upload submission
+    struct VulkanUploadSubmission
+    {
+        UniquePtr<VulkanCommandPool> TransferCommandPool;
+        UniquePtr<VulkanCommandPool> GraphicsCommandPool;
+
+        /// @brief The timeline value that is signaled once the submission completes
+        uint64 CompletionValue;
+
+        VulkanUploadSubmission(VulkanGraphicsPlatform* platform);
+    };
+
+    /// @brief Copies queued uploads through a persistent staging ring, submitting up to a byte budget each frame.
+    /// Each submission signals a timeline semaphore, so uploads complete independently of the render frames
+    class VulkanUploadScheduler : public UploadScheduler
+    {
+    public:
+        VulkanUploadScheduler(VulkanGraphicsPlatform* platform, uint64 frameBudget);
+        ~VulkanUploadScheduler();
+
+        VulkanUploadScheduler(const VulkanUploadScheduler&) = delete;
+        VulkanUploadScheduler& operator=(const VulkanUploadScheduler&) = delete;
+
+        uint64 QueueBufferUpload(Ref<Buffer> buffer, uint64 offset, Array<uint8>&& data, UploadPriority priority, UploadCompletedCallback onCompleted) override;
+        uint64 QueueImageUpload(Ref<Image> image, Array<uint8>&& pixelData, UploadPriority priority, UploadCompletedCallback onCompleted) override;
+        bool IsUploadComplete(uint64 uploadID) const override;
+        void SetFrameBudget(uint64 budget) override { _frameBudget = budget; }
+        uint64 GetFrameBudget() const override { return _frameBudget; }
+        uint64 GetQueuedBytes() const override { return _queuedBytes; }
+
+        /// @brief Calls the callbacks of completed uploads and submits queued uploads up to the frame budget.
+        /// Should be called once per frame
+        void Process();
+
+    private:
+        static constexpr uint64 _stagingRingSize = 1024 * 1024 * 64;
+        static constexpr uint64 _submissionCount = 3;
+        static constexpr uint64 _priorityCount = 3;
+
+        VulkanGraphicsPlatform* _platform;
+        VulkanQueue* _transferQueue;
+        VulkanQueue* _graphicsQueue;
+        Ref<VulkanBuffer> _stagingRing;
+        uint64 _stagingRingHead;
+        uint64 _stagingRingTail;
+        Array<VulkanStagingRingAllocation> _stagingRingAllocations;
+        ManagedRef<VulkanGraphicsSemaphore> _timelineSemaphore;
+        uint64 _lastSignalValue;
+        uint64 _completedValue;
+        Array<VulkanUploadSubmission> _submissions;
+        uint64 _currentSubmissionIndex;
+        Array<VulkanQueuedUpload> _queuedUploads[_priorityCount];
+        Array<VulkanInFlightUpload> _inFlightUploads;
+        Map<uint64, uint64> _uploadCompletionValues;
+        uint64 _nextUploadID;
+        uint64 _frameBudget;
+        uint64 _queuedBytes;
+
+    private:
+        /// @brief Gets the smallest number of bytes of a mip level's pixel data that can be copied on its own
+        /// @param image The image
+        /// @param mipLevel The mip level
+        /// @return The size of a row of pixels or blocks, or the whole mip level if it can't be copied in rows
+        static uint64 GetImageCopyGranularity(const VulkanImage& image, uint32 mipLevel);
+
+        /// @brief Releases the staging ring space of completed submissions and calls the callbacks of completed uploads
+        void ReleaseCompletedUploads();
+
+        /// @brief Records and submits queued uploads, highest priority first, until the frame budget is spent
+        void SubmitQueuedUploads();
+
+        /// @brief Records the next chunk of an upload
+        /// @param upload The upload
+        /// @param transferCommandBuffer The transfer command buffer to record copies to
+        /// @param graphicsCommandBuffer The graphics command buffer to record queue ownership acquires and mip generation to
+        /// @param completionValue The timeline value the submission will signal
+        /// @param remainingBudget The remaining frame budget. Will be reduced by the size of the recorded chunk
+        /// @return True if a chunk was recorded, or false if the staging ring is full
+        bool RecordUploadChunk(VulkanQueuedUpload& upload, VkCommandBuffer transferCommandBuffer, VkCommandBuffer graphicsCommandBuffer, uint64 completionValue, uint64& remainingBudget);
+
+        /// @brief Allocates space in the staging ring
+        /// @param size The number of bytes to allocate
+        /// @param completionValue The timeline value after which the space can be reused
+        /// @param outOffset Will be set to the offset of the allocation in the staging ring
+        /// @return True if the space was allocated
+        bool TryAllocateStaging(uint64 size, uint64 completionValue, uint64& outOffset);
+
+        uint64 AddQueuedUpload(UploadPriority priority, VulkanQueuedUpload&& upload);
+    };
+} // Coco
+
+#endif //COCOENGINE_VULKANUPLOADSCHEDULER_H
\ No newline at end of file
@@ -89,6 +89,17 @@ namespace Coco
                 return ImagePixelFormat::Depth24_Stencil8;
             case VK_FORMAT_D32_SFLOAT_S8_UINT:
                 return ImagePixelFormat::Depth32_Stencil8;
+            case VK_FORMAT_BC1_RGBA_SRGB_BLOCK:
+            case VK_FORMAT_BC1_RGBA_UNORM_BLOCK:
+                return ImagePixelFormat::BC1_RGBA;
+            case VK_FORMAT_BC3_SRGB_BLOCK:
+            case VK_FORMAT_BC3_UNORM_BLOCK:
+                return ImagePixelFormat::BC3_RGBA;
+            case VK_FORMAT_BC5_UNORM_BLOCK:
+                return ImagePixelFormat::BC5_RG;
+            case VK_FORMAT_BC7_SRGB_BLOCK:
+            case VK_FORMAT_BC7_UNORM_BLOCK:
+                return ImagePixelFormat::BC7_RGBA;
             default:
                 return ImagePixelFormat::Unknown;
         }
@@ -120,6 +131,14 @@ namespace Coco
                 return VK_FORMAT_R32G32B32A32_UINT;
             case ImagePixelFormat::Depth32_Stencil8:
                 return VK_FORMAT_D32_SFLOAT_S8_UINT;
+            case ImagePixelFormat::BC1_RGBA:
+                return colorSpace == ImageColorSpace::sRGB ? VK_FORMAT_BC1_RGBA_SRGB_BLOCK : VK_FORMAT_BC1_RGBA_UNORM_BLOCK;
+            case ImagePixelFormat::BC3_RGBA:
+                return colorSpace == ImageColorSpace::sRGB ? VK_FORMAT_BC3_SRGB_BLOCK : VK_FORMAT_BC3_UNORM_BLOCK;
+            case ImagePixelFormat::BC5_RG:
+                return VK_FORMAT_BC5_UNORM_BLOCK;
+            case ImagePixelFormat::BC7_RGBA:
+                return colorSpace == ImageColorSpace::sRGB ? VK_FORMAT_BC7_SRGB_BLOCK : VK_FORMAT_BC7_UNORM_BLOCK;
             default:
                 return VK_FORMAT_UNDEFINED;
         }
@@ -131,9 +150,16 @@ namespace Coco
         {
             case VK_FORMAT_R8G8B8A8_SRGB:
             case VK_FORMAT_B8G8R8A8_SRGB:
+            case VK_FORMAT_BC1_RGBA_SRGB_BLOCK:
+            case VK_FORMAT_BC3_SRGB_BLOCK:
+            case VK_FORMAT_BC7_SRGB_BLOCK:
                 return ImageColorSpace::sRGB;
             case VK_FORMAT_R8G8B8A8_UNORM:
             case VK_FORMAT_B8G8R8A8_UNORM:
+            case VK_FORMAT_BC1_RGBA_UNORM_BLOCK:
+            case VK_FORMAT_BC3_UNORM_BLOCK:
+            case VK_FORMAT_BC5_UNORM_BLOCK:
+            case VK_FORMAT_BC7_UNORM_BLOCK:
             case VK_FORMAT_R32_SINT:
             case VK_FORMAT_R32G32_SINT:
             case VK_FORMAT_R32G32B32_SINT:
@@ -294,6 +320,9 @@ namespace Coco
                 return VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
             case slang::BindingType::CombinedTextureSampler:
                 return VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+            case slang::BindingType::RawBuffer:
+            case slang::BindingType::MutableRawBuffer:
+                return VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
             default:
                 COCO_ASSERT(false, "Unknown binding type %u", bindingType);
                 return VK_DESCRIPTOR_TYPE_MAX_ENUM;
@@ -431,22 +460,45 @@ namespace Coco
         }
     }
 
-    VkFormat VulkanUtils::ToVkFormat(VertexChannel channel)
+    VkFormat VulkanUtils::ToVkFormat(VertexChannel channel, VertexAttributeFormat format)
     {
-        switch (channel)
+        const uint8 elementCount = GetVertexChannelElementCount(channel);
+
+        // 3-element 16-bit and 8-bit formats are poorly supported for vertex input, so those channels are padded to 4 elements
+        switch (format)
         {
-            case VertexChannel::Position:
-            case VertexChannel::Normal:
-                return VK_FORMAT_R32G32B32_SFLOAT;
-            case VertexChannel::Color:
-            case VertexChannel::Tangent:
-                return VK_FORMAT_R32G32B32A32_SFLOAT;
-            case VertexChannel::UV0:
-                return VK_FORMAT_R32G32_SFLOAT;
+            case VertexAttributeFormat::Float32:
+            {
+                switch (elementCount)
+                {
+                    case 2:
+                        return VK_FORMAT_R32G32_SFLOAT;
+                    case 3:
+                        return VK_FORMAT_R32G32B32_SFLOAT;
+                    case 4:
+                        return VK_FORMAT_R32G32B32A32_SFLOAT;
+                    default:
+                        break;
+                }
+                break;
+            }
+            case VertexAttributeFormat::Float16:
+                return elementCount == 2 ? VK_FORMAT_R16G16_SFLOAT : VK_FORMAT_R16G16B16A16_SFLOAT;
+            case VertexAttributeFormat::SNorm8:
+                return VK_FORMAT_R8G8B8A8_SNORM;
+            case VertexAttributeFormat::UNorm8:
+                return VK_FORMAT_R8G8B8A8_UNORM;
             default:
-                COCO_ASSERT(false, "Unknown vertex channel type");
-                return VK_FORMAT_UNDEFINED;
+                break;
         }
+
+        COCO_ASSERT(false, "Unsupported vertex channel format");
+        return VK_FORMAT_UNDEFINED;
+    }
+
+    VkIndexType VulkanUtils::ToVkIndexType(IndexFormat format) noexcept
+    {
+        return format == IndexFormat::UInt16 ? VK_INDEX_TYPE_UINT16 : VK_INDEX_TYPE_UINT32;
     }
 
     VkBufferUsageFlags VulkanUtils::ToVkBufferUsageFlags(BufferUsageFlags usageFlags) noexcept
@@ -468,6 +520,12 @@ namespace Coco
         if ((usageFlags & BufferUsageFlags::Vertex) == BufferUsageFlags::Vertex)
             flags |= VK_BUFFER_USAGE_VERTEX_BUFFER_BIT;
 
+        if ((usageFlags & BufferUsageFlags::Storage) == BufferUsageFlags::Storage)
+            flags |= VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
+
+        if ((usageFlags & BufferUsageFlags::Indirect) == BufferUsageFlags::Indirect)
+            flags |= VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT;
+
         return flags;
     }
 
@@ -82,7 +82,16 @@ namespace Coco
         /// @return The VkPrimitiveTopology
         static VkPrimitiveTopology ToVkPrimitiveTopology(MeshTopologyMode mode) noexcept;
 
-        static VkFormat ToVkFormat(VertexChannel channel);
+        /// @brief Gets the VkFormat of a vertex channel's data
+        /// @param channel The vertex channel
+        /// @param format The encoding of the channel's data
+        /// @return The VkFormat
+        static VkFormat ToVkFormat(VertexChannel channel, VertexAttributeFormat format);
+
+        /// @brief Converts an IndexFormat to a VkIndexType
+        /// @param format The IndexFormat
+        /// @return The VkIndexType
+        static VkIndexType ToVkIndexType(IndexFormat format) noexcept;
 
         /// @brief Converts BufferUsageFlags to VkBufferUsageFlags
         /// @param usageFlags The BufferUsageFlags
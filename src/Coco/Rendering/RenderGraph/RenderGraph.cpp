@@ -8,6 +8,7 @@
 
 #include "Coco/Core/Engine.h"
 #include "Coco/Core/Math/Math.h"
+#include "Coco/Core/Types/Sorting/QSorter.h"
 #include "Coco/Rendering/Graphics/GraphicsPlatform.h"
 #include "Coco/Rendering/Graphics/GraphicsResourceCache.h"
 
@@ -22,7 +23,12 @@ namespace Coco
         _textureResources(&allocator),
         _attachments(),
         _currentPassAttachments(),
-        _transientResources(&allocator, 16)
+        _currentPassReads(),
+        _transientResources(&allocator, 16),
+        _culledPassIndices(&allocator),
+        _culledResourceIDs(&allocator),
+        _memorySlots(&allocator, 8),
+        _unaliasedTransientMemorySize(0)
     {}
 
     void RenderGraph::AddColorAttachment(ImageColorSpace colorSpace)
@@ -96,8 +102,20 @@ namespace Coco
         return hash;
     }
 
+    uint64 RenderGraph::GetTransientMemorySize() const
+    {
+        uint64 size = 0;
+        for (const auto& slot : _memorySlots)
+            size += slot.Requirements.Size;
+
+        return size;
+    }
+
     bool RenderGraph::Compile()
     {
+        _culledPassIndices.Clear();
+        _culledResourceIDs.Clear();
+
         CullSetupNodes();
 
         for (uint32 i = 0; i < _nodes.GetCount(); ++i)
@@ -116,9 +134,60 @@ namespace Coco
             }
         }
 
+        AssignMemorySlots();
+
         return true;
     }
 
+    bool RenderGraph::Compile(RenderGraphCompilation& compilation)
+    {
+        const uint64 topologyHash = CalculateTopologyHash();
+
+        if (compilation.TopologyHash == topologyHash)
+        {
+            ApplyCompilation(compilation);
+            return true;
+        }
+
+        if (!Compile())
+        {
+            compilation.Invalidate();
+            return false;
+        }
+
+        SaveCompilation(topologyHash, compilation);
+        return true;
+    }
+
+    uint64 RenderGraph::CalculateTopologyHash() const
+    {
+        uint64 hash = Math::CombineHashes(static_cast<uint64>(_nodes.GetCount()), static_cast<uint64>(_nextResourceID));
+
+        for (const auto& node : _nodes)
+        {
+            hash = Math::CombineHashes(hash, ToHash(node.PassName), static_cast<uint64>(node.RecordsInParallel));
+
+            for (const auto& input : node.Inputs)
+                hash = Math::CombineHashes(hash, static_cast<uint64>(input.ID), static_cast<uint64>(input.AccessType));
+
+            for (const auto& output : node.Outputs)
+                hash = Math::CombineHashes(hash, static_cast<uint64>(output.ID), static_cast<uint64>(output.AccessType));
+        }
+
+        // Resource IDs are handed out in order, so visit them in order to keep the hash independent of the map's layout
+        for (uint32 id = 1; id < _nextResourceID; ++id)
+        {
+            if (const RenderGraphTextureResource* texture = _textureResources.TryGetValue(id))
+                hash = Math::CombineHashes(hash, static_cast<uint64>(id), ToHash(texture->Desc), static_cast<uint64>(texture->IsExternal));
+        }
+
+        for (const auto& attachment : _attachments)
+            hash = Math::CombineHashes(hash, attachment.TextureID);
+
+        // Never collide with an empty compilation
+        return hash == 0 ? 1 : hash;
+    }
+
     void RenderGraph::Execute(const RenderScene& scene, RenderContext& ctx)
     {
         for (uint64 passIndex = 0; passIndex < _nodes.GetCount(); ++passIndex)
@@ -126,16 +195,26 @@ namespace Coco
             const auto& node = _nodes[passIndex];
 
             _currentPassAttachments.Clear();
+            _currentPassReads.Clear();
+
+            for (const auto& input : node.Inputs)
+            {
+                if (input.AccessType != ResourceAccessType::ShaderRead)
+                    continue;
+
+                const auto& inputTexture = _textureResources.Get(input.ID);
+                COCO_ASSERT(inputTexture.TextureImage, "Input image isn't valid");
+                _currentPassReads.Append(inputTexture.TextureImage);
+            }
 
             for (const auto& output : node.Outputs)
             {
                 auto& outputTexture = _textureResources.Get(output.ID);
 
-                if (!outputTexture.IsExternal && outputTexture.FirstPassIndex == node.PassIndex)
-                {
-                    outputTexture.TextureImage = _platform->GetResourceCache()->GetOrCreateImage(outputTexture.Desc);
-                    _transientResources.Append(outputTexture.TextureImage->GetID());
-                }
+                const bool isFirstUse = outputTexture.FirstPassIndex == node.PassIndex;
+
+                if (!outputTexture.IsExternal && isFirstUse)
+                    AcquireTransientImage(outputTexture);
 
                 Ref<Image> outputImage = outputTexture.TextureImage;
                 COCO_ASSERT(outputImage, "Output image isn't valid");
@@ -156,6 +235,9 @@ namespace Coco
                         attachmentInfo.SaveResult = outputTexture.IsExternal || passIndex < outputTexture.LastPassIndex;
                         attachmentInfo.Type = outputImageDesc.AttachmentType;
 
+                        // Aliased memory may still hold another texture's contents, so drop them the first time the texture is written
+                        attachmentInfo.DiscardPrevious = isFirstUse && outputTexture.MemorySlot != -1;
+
                         if (outputTexture.FirstPassIndex == passIndex && graphAttachment.ClearValue.has_value())
                             attachmentInfo.ClearValue = graphAttachment.ClearValue;
 
@@ -168,7 +250,11 @@ namespace Coco
                 }
             }
 
-            ctx.BeginPass(passIndex, _currentPassAttachments);
+            // Passes can record work that can't be done while rendering, such as compute dispatches, before the pass begins
+            if (node.PrepareFunction)
+                node.PrepareFunction(scene, ctx);
+
+            ctx.BeginPass(passIndex, _currentPassAttachments, node.RecordsInParallel);
 
             node.CallbackFunction(scene, ctx);
 
@@ -183,8 +269,9 @@ namespace Coco
 
         while (!unusedResourceStack.IsEmpty())
         {
-            uint32& id = unusedResourceStack.Back();
+            uint32 id = unusedResourceStack.Back();
             unusedResourceStack.RemoveAt(unusedResourceStack.GetCount() - 1);
+            _culledResourceIDs.Append(id);
 
             // Figure out which nodes write to this resource
             for (uint64 i = 0; i < _nodes.GetCount(); ++i)
@@ -213,7 +300,10 @@ namespace Coco
         for (int64 i = static_cast<int64>(_nodes.GetCount()) - 1; i >= 0; --i)
         {
             if (_nodes[i].Outputs.IsEmpty())
+            {
                 _nodes.RemoveAt(i);
+                _culledPassIndices.Append(static_cast<uint32>(i));
+            }
         }
     }
 
@@ -226,6 +316,148 @@ namespace Coco
         resource->LastPassIndex = Math::Max(resource->LastPassIndex, passIndex);
     }
 
+    void RenderGraph::AssignMemorySlots()
+    {
+        _memorySlots.Clear();
+        _unaliasedTransientMemorySize = 0;
+
+        Array<std::pair<RenderGraphTextureResource*, GraphicsMemoryRequirements>> transientTextures(Engine::Get()->GetTemporaryStackAllocator(), _textureResources.GetCount());
+
+        for (auto& [id, texture] : _textureResources)
+        {
+            // Textures that were culled never got a lifetime
+            if (texture.IsExternal || texture.FirstPassIndex > texture.LastPassIndex)
+                continue;
+
+            texture.MemorySlot = -1;
+            GraphicsMemoryRequirements requirements = _platform->GetImageMemoryRequirements(texture.Desc);
+            _unaliasedTransientMemorySize += requirements.Size;
+            transientTextures.EmplaceBack(&texture, requirements);
+        }
+
+        // Place the largest textures first so smaller ones fill in the slots they create
+        QSorter<std::pair<RenderGraphTextureResource*, GraphicsMemoryRequirements>> sorter(
+            [](const auto& a, const auto& b) { return a.second.Size > b.second.Size; });
+        sorter.Sort(transientTextures);
+
+        for (auto& [texture, requirements] : transientTextures)
+        {
+            int64 slotIndex = _memorySlots.Find([&](const RenderGraphMemorySlot& slot)
+            {
+                if ((slot.Requirements.CompatibilityMask & requirements.CompatibilityMask) == 0)
+                    return false;
+
+                for (const uint32 otherID : slot.TextureIDs)
+                {
+                    const RenderGraphTextureResource& other = _textureResources.Get(otherID);
+                    if (texture->FirstPassIndex <= other.LastPassIndex && other.FirstPassIndex <= texture->LastPassIndex)
+                        return false;
+                }
+
+                return true;
+            });
+
+            if (slotIndex == -1)
+            {
+                slotIndex = static_cast<int64>(_memorySlots.GetCount());
+                _memorySlots.EmplaceBack(requirements);
+            }
+            else
+            {
+                GraphicsMemoryRequirements& slotRequirements = _memorySlots[slotIndex].Requirements;
+                slotRequirements.Size = Math::Max(slotRequirements.Size, requirements.Size);
+                slotRequirements.Alignment = Math::Max(slotRequirements.Alignment, requirements.Alignment);
+                slotRequirements.CompatibilityMask &= requirements.CompatibilityMask;
+            }
+
+            _memorySlots[slotIndex].TextureIDs.Append(texture->ID);
+            texture->MemorySlot = static_cast<int32>(slotIndex);
+        }
+    }
+
+    void RenderGraph::SaveCompilation(uint64 topologyHash, RenderGraphCompilation& outCompilation) const
+    {
+        outCompilation.Invalidate();
+        outCompilation.TopologyHash = topologyHash;
+        outCompilation.CulledPassIndices.AppendRange(_culledPassIndices);
+        outCompilation.CulledResourceIDs.AppendRange(_culledResourceIDs);
+
+        for (const auto& [id, texture] : _textureResources)
+            outCompilation.TextureLifetimes.EmplaceBack(id, texture.FirstPassIndex, texture.LastPassIndex, texture.MemorySlot);
+
+        // The compilation outlives this graph, so only copy the slot layouts and not the memory bound to them
+        for (const auto& slot : _memorySlots)
+        {
+            RenderGraphMemorySlot& savedSlot = outCompilation.MemorySlots.EmplaceBack(slot.Requirements);
+            savedSlot.TextureIDs.AppendRange(slot.TextureIDs);
+        }
+
+        outCompilation.UnaliasedTransientMemorySize = _unaliasedTransientMemorySize;
+    }
+
+    void RenderGraph::ApplyCompilation(const RenderGraphCompilation& compilation)
+    {
+        // Replay the culling in the same order it happened when the graph was compiled
+        if (!compilation.CulledResourceIDs.IsEmpty())
+        {
+            for (auto& node : _nodes)
+            {
+                for (const uint32 id : compilation.CulledResourceIDs)
+                {
+                    int64 outputIndex = node.Outputs.Find([id](const RenderGraphResourceRef& ref) { return ref.ID == id; });
+                    if (outputIndex != -1)
+                        node.Outputs.RemoveAt(outputIndex);
+                }
+            }
+        }
+
+        for (const uint32 passIndex : compilation.CulledPassIndices)
+            _nodes.RemoveAt(passIndex);
+
+        for (uint32 i = 0; i < _nodes.GetCount(); ++i)
+            _nodes[i].PassIndex = i;
+
+        for (const auto& lifetime : compilation.TextureLifetimes)
+        {
+            RenderGraphTextureResource& texture = _textureResources.Get(lifetime.TextureID);
+            texture.FirstPassIndex = lifetime.FirstPassIndex;
+            texture.LastPassIndex = lifetime.LastPassIndex;
+            texture.MemorySlot = lifetime.MemorySlot;
+        }
+
+        _memorySlots.Clear();
+        for (const auto& slot : compilation.MemorySlots)
+        {
+            RenderGraphMemorySlot& graphSlot = _memorySlots.EmplaceBack(slot.Requirements);
+            graphSlot.TextureIDs.AppendRange(slot.TextureIDs);
+        }
+
+        _unaliasedTransientMemorySize = compilation.UnaliasedTransientMemorySize;
+    }
+
+    void RenderGraph::AcquireTransientImage(RenderGraphTextureResource& texture)
+    {
+        GraphicsResourceCache* cache = _platform->GetResourceCache();
+
+        if (texture.MemorySlot == -1)
+        {
+            texture.TextureImage = cache->GetOrCreateImage(texture.Desc);
+        }
+        else
+        {
+            RenderGraphMemorySlot& slot = _memorySlots[texture.MemorySlot];
+            if (!slot.Memory)
+            {
+                slot.Memory = cache->GetOrCreateTransientMemory(slot.Requirements);
+                _transientResources.Append(slot.Memory->GetID());
+            }
+
+            texture.TextureImage = cache->GetOrCreateAliasedImage(texture.Desc, slot.Memory);
+        }
+
+        _transientResources.Append(texture.TextureImage->GetID());
+    }
+
     RenderGraphResource* RenderGraph::TryGetResource(uint32 id, ResourceType type)
     {
         switch (type)
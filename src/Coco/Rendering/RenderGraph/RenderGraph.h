@@ -54,6 +54,9 @@ namespace Coco
             RenderGraphNode& node = _nodes.EmplaceBack(_builder.EndNode());
             node.CallbackFunction = [pass](const RenderScene& scene, RenderContext& ctx) {pass.Render(scene, ctx);};
 
+            if constexpr (requires (const RenderPassType& p, const RenderScene& s, RenderContext& c) { p.Prepare(s, c); })
+                node.PrepareFunction = [pass](const RenderScene& scene, RenderContext& ctx) {pass.Prepare(scene, ctx);};
+
             return pass;
         }
 
@@ -66,10 +69,36 @@ namespace Coco
         uint64 GetPassCount() const { return _nodes.GetCount(); }
         void GetPassAttachments(uint64 passIndex, Array<std::pair<uint64, RenderGraphAttachment>>& outAttachments) const;
         Span<const RenderPassAttachmentInfo> GetCurrentPassAttachments() const { return _currentPassAttachments; }
+
+        /// @brief Gets the images that the current pass samples from. They need to be readable by shaders before the pass begins
+        /// @return The sampled images
+        Span<const Ref<Image>> GetCurrentPassReads() const { return _currentPassReads; }
         uint64 GetCurrentPassAttachmentHash() const;
         Span<const uint64> GetTransientResources() const { return _transientResources; }
 
+        /// @brief Gets the amount of memory the transient textures need once textures with non-overlapping lifetimes share memory.
+        /// Only valid after the graph has been compiled
+        /// @return The peak transient memory, in bytes
+        uint64 GetTransientMemorySize() const;
+
+        /// @brief Gets the amount of memory the transient textures would need if each had its own memory.
+        /// Only valid after the graph has been compiled
+        /// @return The unaliased transient memory, in bytes
+        uint64 GetUnaliasedTransientMemorySize() const { return _unaliasedTransientMemorySize; }
+
         bool Compile();
+
+        /// @brief Compiles this graph, reusing a previous compilation if this graph has the same passes and resources.
+        /// Only the compile results are reused: the culling, texture lifetimes, and transient memory slots.
+        /// The graph's nodes and their callbacks are still created by this frame's render listeners, since they carry the per-frame pass data.
+        /// The compilation is updated if this graph had to be compiled
+        /// @param compilation The compilation from a previous frame
+        /// @return True if the graph was compiled
+        bool Compile(RenderGraphCompilation& compilation);
+
+        /// @brief Calculates a hash of the declared passes and resources of this graph
+        /// @return The topology hash
+        uint64 CalculateTopologyHash() const;
         void Execute(const RenderScene& scene, RenderContext& ctx);
 
     private:
@@ -80,13 +109,34 @@ namespace Coco
         Array<RenderGraphNode> _nodes;
         StackArray<RenderGraphAttachment, 16> _attachments;
         StackArray<RenderPassAttachmentInfo, 16> _currentPassAttachments;
+        StackArray<Ref<Image>, 8> _currentPassReads;
         Array<uint64> _transientResources;
+        Array<uint32> _culledPassIndices;
+        Array<uint32> _culledResourceIDs;
+        Array<RenderGraphMemorySlot> _memorySlots;
+        uint64 _unaliasedTransientMemorySize;
         uint32 _nextResourceID;
 
     private:
         void CullSetupNodes();
         void AddResource(const RenderGraphResourceRef& resourceRef, uint32 passIndex);
 
+        /// @brief Assigns transient textures to memory slots so that textures whose lifetimes don't overlap share memory
+        void AssignMemorySlots();
+
+        /// @brief Saves the compiled state of this graph so later graphs can reuse it
+        /// @param topologyHash The topology hash of this graph
+        /// @param outCompilation Will be filled with the compiled state
+        void SaveCompilation(uint64 topologyHash, RenderGraphCompilation& outCompilation) const;
+
+        /// @brief Applies a compilation from a graph with the same topology instead of compiling this graph
+        /// @param compilation The compilation
+        void ApplyCompilation(const RenderGraphCompilation& compilation);
+
+        /// @brief Gets the image for a transient texture the first time it is used
+        /// @param texture The texture
+        void AcquireTransientImage(RenderGraphTextureResource& texture);
+
         RenderGraphResource* TryGetResource(uint32 id, ResourceType type);
         void GetUnusedResources(Array<uint32>& unusedResources) const;
     };
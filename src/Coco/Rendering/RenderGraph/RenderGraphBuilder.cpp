@@ -115,4 +115,10 @@ namespace Coco
 
         COCO_ASSERT(false, "Resource does not exist");
     }
+
+    void RenderGraphBuilder::RecordInParallel()
+    {
+        COCO_ASSERT(_currentNode.has_value(), "Node was not started");
+        _currentNode->RecordsInParallel = true;
+    }
 } // Coco
\ No newline at end of file
@@ -28,6 +28,9 @@ namespace Coco
         RenderGraphResourceRef CreateRenderTarget(ImagePixelFormat pixelFormat, Optional<RenderTargetClearValue> clearValue = Optional<RenderTargetClearValue>());
         RenderGraphResourceRef WriteRenderTarget(const RenderGraphResourceRef& resourceRef);
 
+        /// @brief Marks the current pass as recording all of its commands through RenderContext::RecordParallel()
+        void RecordInParallel();
+
     private:
         RenderGraph* _graph;
         Optional<RenderGraphNode> _currentNode;
@@ -33,9 +33,43 @@ namespace Coco
 
     RenderGraphTextureResource::RenderGraphTextureResource(uint32 id, const ImageDescription& desc) :
         RenderGraphResource(id, ResourceType::Texture),
-        Desc(desc)
+        Desc(desc),
+        IsAttachment(false),
+        MemorySlot(-1)
     {}
 
+    RenderGraphMemorySlot::RenderGraphMemorySlot(const GraphicsMemoryRequirements& requirements) :
+        Requirements(requirements),
+        TextureIDs(),
+        Memory()
+    {}
+
+    RenderGraphTextureLifetime::RenderGraphTextureLifetime(uint32 textureID, uint32 firstPassIndex, uint32 lastPassIndex, int32 memorySlot) :
+        TextureID(textureID),
+        FirstPassIndex(firstPassIndex),
+        LastPassIndex(lastPassIndex),
+        MemorySlot(memorySlot)
+    {}
+
+    RenderGraphCompilation::RenderGraphCompilation() :
+        TopologyHash(0),
+        CulledPassIndices(),
+        CulledResourceIDs(),
+        TextureLifetimes(),
+        MemorySlots(),
+        UnaliasedTransientMemorySize(0)
+    {}
+
+    void RenderGraphCompilation::Invalidate()
+    {
+        TopologyHash = 0;
+        CulledPassIndices.Clear();
+        CulledResourceIDs.Clear();
+        TextureLifetimes.Clear();
+        MemorySlots.Clear();
+        UnaliasedTransientMemorySize = 0;
+    }
+
     RenderGraphAttachment::RenderGraphAttachment(uint64 textureID) :
         TextureID(textureID),
         ClearValue()
@@ -44,8 +78,10 @@ namespace Coco
     RenderGraphNode::RenderGraphNode(const char* passName) :
         PassName(passName),
         CallbackFunction(nullptr),
+        PrepareFunction(nullptr),
         Inputs(),
         Outputs(),
-        PassIndex(0)
+        PassIndex(0),
+        RecordsInParallel(false)
     {}
 }
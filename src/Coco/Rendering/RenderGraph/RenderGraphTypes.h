@@ -9,6 +9,8 @@
 #include "Coco/Core/Types/Optional.h"
 #include "Coco/Core/Types/String.h"
 #include "Coco/Rendering/Graphics/Resources/ImageTypes.h"
+#include "Coco/Rendering/Graphics/Resources/TransientMemory.h"
+#include "Coco/Core/Types/Array.h"
 #include "Coco/Core/Types/StackArray.h"
 #include <functional>
 
@@ -68,9 +70,56 @@ namespace Coco
         ImageDescription Desc;
         bool IsAttachment;
 
+        /// @brief The index of the transient memory slot this texture is placed in, or -1 if it has its own memory
+        int32 MemorySlot;
+
         RenderGraphTextureResource(uint32 id, const ImageDescription& desc);
     };
 
+    /// @brief A block of transient memory that is shared by textures whose lifetimes don't overlap
+    struct RenderGraphMemorySlot
+    {
+        GraphicsMemoryRequirements Requirements;
+        Array<uint32> TextureIDs;
+        Ref<TransientMemory> Memory;
+
+        RenderGraphMemorySlot(const GraphicsMemoryRequirements& requirements);
+    };
+
+    /// @brief The passes a texture is used in, and the memory slot it was placed in
+    struct RenderGraphTextureLifetime
+    {
+        uint32 TextureID;
+        uint32 FirstPassIndex;
+        uint32 LastPassIndex;
+        int32 MemorySlot;
+
+        RenderGraphTextureLifetime(uint32 textureID, uint32 firstPassIndex, uint32 lastPassIndex, int32 memorySlot);
+    };
+
+    /// @brief The result of compiling a RenderGraph. Graphs built with the same passes and resources on later frames reuse it instead of compiling again.
+    /// It doesn't store the graph's nodes, so each frame's graph still declares its own passes
+    struct RenderGraphCompilation
+    {
+        /// @brief The hash of the passes and resources of the compiled graph, or 0 if nothing has been compiled
+        uint64 TopologyHash;
+
+        /// @brief The indices of the culled passes, in the order they were removed
+        Array<uint32> CulledPassIndices;
+
+        /// @brief The IDs of the culled resources, in the order they were removed from pass outputs
+        Array<uint32> CulledResourceIDs;
+
+        Array<RenderGraphTextureLifetime> TextureLifetimes;
+        Array<RenderGraphMemorySlot> MemorySlots;
+        uint64 UnaliasedTransientMemorySize;
+
+        RenderGraphCompilation();
+
+        /// @brief Clears the compiled state so the next graph is compiled from scratch
+        void Invalidate();
+    };
+
     struct RenderGraphAttachment
     {
         uint64 TextureID;
@@ -83,9 +132,13 @@ namespace Coco
     {
         String PassName;
         RenderGraphExecuteFunction CallbackFunction;
+
+        /// @brief An optional function that is called before the pass begins
+        RenderGraphExecuteFunction PrepareFunction;
         StackArray<RenderGraphResourceRef, 8> Inputs;
         StackArray<RenderGraphResourceRef, 8> Outputs;
         uint32 PassIndex;
+        bool RecordsInParallel;
 
         RenderGraphNode(const char* passName);
     };
@@ -96,6 +149,9 @@ namespace Coco
         ImageAttachmentType Type;
         Optional<RenderTargetClearValue> ClearValue;
         bool SaveResult;
+
+        /// @brief If true, the previous contents of the image don't need to be kept, such as when it aliases memory used by another image
+        bool DiscardPrevious;
     };
 }
 
@@ -11,6 +11,7 @@ namespace Coco
 {
     RenderListener::RenderListener(RenderCallback callback, int order) :
         _callback(std::move(callback)),
+        _extractCallback(),
         _order(order),
         _isListening(false)
     {}
@@ -55,6 +56,19 @@ namespace Coco
         _callback = std::move(callbackFunction);
     }
 
+    void RenderListener::SetExtractCallbackFunction(ExtractCallback callbackFunction)
+    {
+        _extractCallback = std::move(callbackFunction);
+    }
+
+    void RenderListener::DispatchExtract(RenderScene& sharedScene)
+    {
+        if (!_extractCallback)
+            return;
+
+        _extractCallback(sharedScene);
+    }
+
     void RenderListener::Dispatch(uint64 targetID, RenderGraph& graph, RenderScene& scene)
     {
         if (!_callback)
@@ -17,6 +17,7 @@ namespace Coco
     {
     public:
         using RenderCallback = std::function<void(uint64, RenderGraph&, RenderScene&)>;
+        using ExtractCallback = std::function<void(RenderScene&)>;
 
         RenderListener(RenderCallback callback, int order);
 
@@ -65,6 +66,32 @@ namespace Coco
             _callback = [instance, callbackFunction](uint64 targetID, RenderGraph& graph, RenderScene& scene) { return (instance->*callbackFunction)(targetID, graph, scene); };
         }
 
+        /// @brief Sets the callback that adds objects shared by every view. It is called once per frame before any view is rendered,
+        /// and the objects it adds are culled against each view's camera
+        /// @param callbackFunction The function that will be called during extraction
+        void SetExtractCallbackFunction(ExtractCallback callbackFunction);
+
+        /// @brief Sets the callback that adds objects shared by every view
+        /// @tparam InstanceType The instance class type
+        /// @param instance A pointer to the instance
+        /// @param callbackFunction The member function that will be called during extraction
+        template<typename InstanceType>
+        void SetExtractCallbackFunction(InstanceType* instance, void(InstanceType::* callbackFunction)(RenderScene&))
+        {
+            COCO_ASSERT(instance, "Instance was null");
+            COCO_ASSERT(callbackFunction, "Callback was null");
+
+            _extractCallback = [instance, callbackFunction](RenderScene& scene) { return (instance->*callbackFunction)(scene); };
+        }
+
+        /// @brief Determines if this listener adds objects shared by every view
+        /// @return True if this listener has an extract callback
+        bool HasExtractCallback() const { return static_cast<bool>(_extractCallback); }
+
+        /// @brief Called once per frame to call this listener's extract callback function
+        /// @param sharedScene The scene shared by every view this frame
+        void DispatchExtract(RenderScene& sharedScene);
+
         /// @brief Called during rendering to call this listener's callback function
         /// @param targetID The ID of the target being rendered
         /// @param graph The render graph
@@ -73,6 +100,7 @@ namespace Coco
 
     private:
         RenderCallback _callback;
+        ExtractCallback _extractCallback;
         int _order;
         bool _isListening;
     };
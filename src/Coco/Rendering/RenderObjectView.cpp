@@ -10,8 +10,8 @@ namespace Coco
 {
     RenderObjectView::Iterator::Iterator(const RenderObjectView& view, bool isEnd) :
         _view(&view),
-        _lastIndex(view._scene->_firstRenderObjectIndex + view._scene->_renderObjectCount),
-        _currentIndex(isEnd ? _lastIndex : view._scene->_firstRenderObjectIndex)
+        _lastIndex(view._lastIndex),
+        _currentIndex(isEnd ? _lastIndex : view._firstIndex)
     {}
 
     RenderObjectView::Iterator::Iterator(const Iterator& other) :
@@ -28,12 +28,12 @@ namespace Coco
 
     RenderObjectView::Iterator::pointer RenderObjectView::Iterator::operator->()
     {
-        return &_view->_scene->_frame->_renderObjects[_currentIndex];
+        return &_view->_scene->_frame->_renderObjects[_view->_scene->_objectIndices[_currentIndex]];
     }
 
     RenderObjectView::Iterator::reference RenderObjectView::Iterator::operator*()
     {
-        return _view->_scene->_frame->_renderObjects[_currentIndex];
+        return _view->_scene->_frame->_renderObjects[_view->_scene->_objectIndices[_currentIndex]];
     }
 
     RenderObjectView::Iterator& RenderObjectView::Iterator::operator++()
@@ -53,7 +53,7 @@ namespace Coco
 
     RenderObjectView::Iterator& RenderObjectView::Iterator::operator--()
     {
-        if (_currentIndex > _view->_scene->_firstRenderObjectIndex)
+        if (_currentIndex > _view->_firstIndex)
             _currentIndex--;
 
         return *this;
@@ -72,7 +72,13 @@ namespace Coco
     }
 
     RenderObjectView::RenderObjectView(const RenderScene& scene) :
-        _scene(&scene)
+        RenderObjectView(scene, 0, scene._objectIndices.GetCount())
+    {}
+
+    RenderObjectView::RenderObjectView(const RenderScene& scene, uint64 offset, uint64 count) :
+        _scene(&scene),
+        _firstIndex(Math::Min(offset, scene._objectIndices.GetCount())),
+        _lastIndex(Math::Min(offset + count, scene._objectIndices.GetCount()))
     {}
 
     void swap(RenderObjectView::Iterator& a, RenderObjectView::Iterator& b) noexcept
@@ -55,12 +55,15 @@ namespace Coco
         };
 
         RenderObjectView(const RenderScene& scene);
+        RenderObjectView(const RenderScene& scene, uint64 offset, uint64 count);
 
         Iterator begin() const { return Iterator(*this, false); }
         Iterator end() const { return Iterator(*this, true); }
 
     private:
         const RenderScene* _scene;
+        uint64 _firstIndex;
+        uint64 _lastIndex;
     };
 } // Coco
 
@@ -0,0 +1,124 @@
+//
+// Created by cullen on 10/18/26.
+//
+
+#ifndef COCOENGINE_INDIRECTRENDERPASS_H
+#define COCOENGINE_INDIRECTRENDERPASS_H
+#include <type_traits>
+#include "Coco/Core/Types/Array.h"
+#include "Coco/Rendering/RenderScene.h"
+#include "Coco/Rendering/Shader.h"
+#include "Coco/Rendering/ShaderTypes.h"
+#include "Coco/Rendering/RenderGraph/RenderGraphBuilder.h"
+#include "Coco/Rendering/Graphics/Resources/RenderContext.h"
+
+namespace Coco
+{
+    /// @brief A pass that frustum culls its objects on the GPU and draws the visible ones with indirect draws.
+    /// The draw shader reads each object's ObjectDataType from the "indirectInstances" parameter block, indexed by the instance ID.
+    /// Objects that can't be drawn indirectly are culled on the CPU and drawn one at a time with the fallback shader, if one is given
+    template<class SceneDataType, typename ObjectDataType>
+    class IndirectRenderPass
+    {
+        static_assert(std::is_trivially_copyable_v<ObjectDataType>, "Object data is copied to the GPU as-is, so it must be trivially copyable");
+
+    public:
+        IndirectRenderPass(const RenderGraphResourceRef& colorAttachment, SharedPtr<Shader> drawShader, SharedPtr<Shader> fallbackShader, const GraphicsPipelineState& pipelineState, const char* cameraDataUniformName = "cameraData") :
+            _drawShader(std::move(drawShader)),
+            _fallbackShader(std::move(fallbackShader)),
+            _pipelineState(pipelineState),
+            _cameraDataUniformName(cameraDataUniformName),
+            _colorAttachment(colorAttachment)
+        {}
+
+        void Setup(RenderGraphBuilder& builder)
+        {
+            _colorAttachment = builder.WriteRenderTarget(_colorAttachment);
+        }
+
+        void Prepare(const RenderScene& sceneData, RenderContext& ctx) const
+        {
+            // The GPU culls these objects itself, so the objects from before CPU culling are used if the scene keeps them
+            const uint64 objectCount = sceneData.GetUnculledObjectCount();
+            Array<IndirectDrawObject> objects(nullptr, objectCount);
+            Array<uint8> instanceData(nullptr, objectCount * sizeof(ObjectDataType));
+
+            for (uint64 i = 0; i < objectCount; i++)
+            {
+                const RenderObject& obj = sceneData.GetUnculledObject(i);
+                if (!ctx.CanDrawIndirect(obj))
+                    continue;
+
+                const ObjectDataType* objData = sceneData.GetObjectData<ObjectDataType>(obj);
+                if (!objData)
+                    continue;
+
+                IndirectDrawObject& drawObject = objects.EmplaceBack();
+                drawObject.Object = &obj;
+                sceneData.GetUnculledObjectBounds(i, drawObject.BoundsCenter, drawObject.BoundsExtents);
+
+                instanceData.AppendRange(Span<const uint8>(reinterpret_cast<const uint8*>(objData), sizeof(ObjectDataType)));
+            }
+
+            ViewFrustum frustum = ViewFrustum::FromViewProjection(sceneData.GetProjectionMatrix() * sceneData.GetViewMatrix());
+            ctx.CullIndirect(GetBatchID(sceneData), frustum, objects, instanceData, sizeof(ObjectDataType));
+        }
+
+        void Render(const RenderScene& sceneData, RenderContext& ctx) const
+        {
+            ctx.SetShader(*_drawShader, _pipelineState);
+            BindCameraData(sceneData, ctx);
+            ctx.DrawIndirect(GetBatchID(sceneData));
+
+            if (!_fallbackShader)
+                return;
+
+            bool isFallbackShaderBound = false;
+
+            for (const auto& obj : sceneData.GetRenderObjectView())
+            {
+                if (ctx.CanDrawIndirect(obj))
+                    continue;
+
+                const ObjectDataType* objData = sceneData.GetObjectData<ObjectDataType>(obj);
+                if (!objData)
+                    continue;
+
+                if (!isFallbackShaderBound)
+                {
+                    ctx.SetShader(*_fallbackShader, _pipelineState);
+                    BindCameraData(sceneData, ctx);
+                    isFallbackShaderBound = true;
+                }
+
+                objData->SetDrawData(ctx);
+                ctx.DrawObject(obj);
+            }
+        }
+
+    private:
+        SharedPtr<Shader> _drawShader;
+        SharedPtr<Shader> _fallbackShader;
+        GraphicsPipelineState _pipelineState;
+        String _cameraDataUniformName;
+        RenderGraphResourceRef _colorAttachment;
+
+        /// @brief Gets the ID of this pass's batch, which is unique per scene so each view is culled separately
+        uint64 GetBatchID(const RenderScene& sceneData) const
+        {
+            return Math::CombineHashes(sceneData.GetID(), _drawShader->GetID(), static_cast<uint64>(_colorAttachment.ID));
+        }
+
+        void BindCameraData(const RenderScene& sceneData, RenderContext& ctx) const
+        {
+            ShaderCursor globalCursor;
+            if (ctx.CreateAndBindGlobalBuffer(_cameraDataUniformName.CStr(), globalCursor))
+            {
+                const SceneDataType* globalData = sceneData.GetData<SceneDataType>(0, false);
+                globalData->WriteInto(globalCursor);
+            }
+        }
+    };
+} // Coco
+
+#endif //COCOENGINE_INDIRECTRENDERPASS_H
\ No newline at end of file
@@ -14,19 +14,52 @@ namespace Coco
     class SimpleRenderPass
     {
     public:
-        SimpleRenderPass(const RenderGraphResourceRef& colorAttachment, SharedPtr<Shader> drawShader, const GraphicsPipelineState& pipelineState, const char* cameraDataUniformName = "cameraData") :
+        SimpleRenderPass(const RenderGraphResourceRef& colorAttachment, SharedPtr<Shader> drawShader, const GraphicsPipelineState& pipelineState, const char* cameraDataUniformName = "cameraData", bool recordInParallel = false) :
             _drawShader(std::move(drawShader)),
             _pipelineState(pipelineState),
             _colorAttachment(colorAttachment),
-            _cameraDataUniformName(cameraDataUniformName)
+            _cameraDataUniformName(cameraDataUniformName),
+            _recordInParallel(recordInParallel)
         {}
 
         void Setup(RenderGraphBuilder& builder)
         {
             _colorAttachment = builder.WriteRenderTarget(_colorAttachment);
+
+            if (_recordInParallel)
+                builder.RecordInParallel();
         }
 
         void Render(const RenderScene& sceneData, RenderContext& ctx) const
+        {
+            uint64 objectCount = sceneData.GetRenderObjectCount();
+
+            if (!_recordInParallel)
+            {
+                RenderObjects(sceneData, ctx, sceneData.GetRenderObjectView());
+                return;
+            }
+
+            // Split the objects into contiguous ranges so the streams execute in the same order as a sequential recording
+            uint64 streamCount = Math::Max<uint64>(1, Math::Min<uint64>(RenderContext::MaxParallelStreams, objectCount / _minObjectsPerStream));
+            uint64 objectsPerStream = (objectCount + streamCount - 1) / streamCount;
+
+            ctx.RecordParallel(static_cast<uint32>(streamCount), [&](RenderContext& streamContext, uint32 streamIndex)
+            {
+                RenderObjects(sceneData, streamContext, sceneData.GetRenderObjectView(streamIndex * objectsPerStream, objectsPerStream));
+            });
+        }
+
+    private:
+        static constexpr uint64 _minObjectsPerStream = 256;
+
+        SharedPtr<Shader> _drawShader;
+        GraphicsPipelineState _pipelineState;
+        String _cameraDataUniformName;
+        RenderGraphResourceRef _colorAttachment;
+        bool _recordInParallel;
+
+        void RenderObjects(const RenderScene& sceneData, RenderContext& ctx, const RenderObjectView& objects) const
         {
             ctx.SetShader(*_drawShader, _pipelineState);
             ShaderCursor globalCursor;
@@ -36,23 +69,20 @@ namespace Coco
                 globalData->WriteInto(globalCursor);
             }
 
-            for (const auto& obj : sceneData.GetRenderObjectView())
+            for (const auto& obj : objects)
             {
-                if (sceneData.HasData<ObjectDataType>(obj.ID, true))
+                if (const ObjectDataType* objData = sceneData.GetObjectData<ObjectDataType>(obj))
                 {
-                    const ObjectDataType* objData = sceneData.GetData<ObjectDataType>(obj.ID, true);
-                    objData->SetDrawData(ctx);
+                    // Object data that references scene data, such as materials, gets the scene to look it up in
+                    if constexpr (requires { objData->SetDrawData(ctx, sceneData); })
+                        objData->SetDrawData(ctx, sceneData);
+                    else
+                        objData->SetDrawData(ctx);
 
                     ctx.DrawObject(obj);
                 }
             }
         }
-
-    private:
-        SharedPtr<Shader> _drawShader;
-        GraphicsPipelineState _pipelineState;
-        String _cameraDataUniformName;
-        RenderGraphResourceRef _colorAttachment;
     };
 } // Coco
 
@@ -11,21 +11,29 @@
 #include <Coco/Core/Engine.h>
 
 #include "Material.h"
+#include "Culling/ViewFrustum.h"
 
 namespace Coco
 {
-    RenderScene::RenderScene(RenderFrame* frame, uint64 id, const Sizei& frameSize) :
+    RenderScene::RenderScene(RenderFrame* frame, uint64 id, const Sizei& frameSize, bool isShared) :
         _frame(frame),
         _id(id),
         _frameSize(frameSize),
+        _isShared(isShared),
         _viewPosition(),
         _viewRotation(),
-        _firstRenderObjectIndex(frame->_renderObjects.GetCount()),
-        _renderObjectCount(0)
+        _objectIndices(&frame->_frameAllocator, 0),
+        _unculledObjectIndices(&frame->_frameAllocator, 0),
+        _sharedLODObjects(&frame->_frameAllocator, 0),
+        _nextCullIndex(0),
+        _keepUnculledObjects(false),
+        _viewLODs(nullptr)
     {}
 
     Matrix4x4 RenderScene::CreateOrthographicProjection(float size, float nearClip, float farClip) const
     {
+        COCO_ASSERT(!_isShared, "Shared scenes have no size to create a projection for");
+
         float aspect = static_cast<float>(_frameSize.Width) / static_cast<float>(_frameSize.Height);
         float halfSize = size * 0.5f;
         return CreateOrthographicProjection(-halfSize * aspect, halfSize * aspect, -halfSize, halfSize, nearClip, farClip);
@@ -39,6 +47,8 @@ namespace Coco
 
     Matrix4x4 RenderScene::CreatePerspectiveProjection(float verticalFOV, float nearClip, float farClip) const
     {
+        COCO_ASSERT(!_isShared, "Shared scenes have no size to create a projection for");
+
         float aspect = static_cast<float>(_frameSize.Width) / static_cast<float>(_frameSize.Height);
         return CreatePerspectiveProjection(verticalFOV, aspect, nearClip, farClip);
     }
@@ -121,9 +131,24 @@ namespace Coco
         return _frame->_renderSceneStorage.GetUniforms(dataID);
     }
 
-    void RenderScene::StoreMaterial(Material& material)
+    MaterialHandle RenderScene::StoreMaterial(const Material& material)
+    {
+        MaterialHandle handle(material.GetID(), material.GetVersion());
+        StoreData(material.GetID(), true, handle);
+        return handle;
+    }
+
+    const MaterialHandle* RenderScene::GetMaterialHandle(uint64 materialID) const
     {
-        StoreUniforms(material.GetID(), true, material.GetUniformValues());
+        return GetData<MaterialHandle>(materialID, true);
+    }
+
+    SharedPtr<Material> RenderScene::GetMaterial(uint64 id) const
+    {
+        if (id == 0)
+            return nullptr;
+
+        return Engine::Get()->GetResourceManager()->GetResourceAs<Material>(id);
     }
 
     void RenderScene::AddMeshData(uint64 id, Span<const Vector3> positions, Span<const uint32> indices,
@@ -133,32 +158,226 @@ namespace Coco
         _frame->EnsureDynamicMeshData(id, positions, indices, normals, colors, tangents, uvs);
     }
 
-    void RenderScene::AddObject(uint64 id, uint64 layer, float order, Mesh& mesh, uint32 submeshIndex)
+    RenderObject& RenderScene::AddObject(uint64 id, uint64 layer, float order, Mesh& mesh, uint32 submeshIndex)
     {
         _frame->EnsureMeshData(mesh);
 
         auto submeshes = mesh.GetSubmeshes();
         Submesh drawSubmesh = submeshIndex < submeshes.size() ? submeshes[submeshIndex] : submeshes[0];
+        return AddObjectInternal(id, layer, order, mesh.GetID(), drawSubmesh, BoundingBox::CreateInfinite());
+    }
+
+    RenderObject& RenderScene::AddObject(uint64 id, uint64 layer, float order, Mesh& mesh, const Matrix4x4& transform,
+        uint32 submeshIndex, uint32 lod)
+    {
+        _frame->EnsureMeshData(mesh);
 
-        _frame->_renderObjects.EmplaceBack(id, layer, mesh.GetID(), drawSubmesh, order);
-        _renderObjectCount++;
+        auto submeshes = mesh.GetLODSubmeshes(lod);
+        Submesh drawSubmesh = submeshIndex < submeshes.size() ? submeshes[submeshIndex] : submeshes[0];
+        return AddObjectInternal(id, layer, order, mesh.GetID(), drawSubmesh, mesh.GetBounds().Transformed(transform));
     }
 
-    void RenderScene::AddObject(uint64 id, uint64 layer, float order, Mesh& mesh, uint32 indexOffset, uint32 indexCount,
+    RenderObject& RenderScene::AddLODObject(uint64 id, uint64 layer, float order, Mesh& mesh, const Matrix4x4& transform,
+        uint32 submeshIndex, uint64 lodObjectID, const BoundingSphere& worldSphere, float bias, float hysteresis)
+    {
+        if (mesh.GetLODCount() <= 1)
+            return AddObject(id, layer, order, mesh, transform, submeshIndex);
+
+        if (!_isShared)
+            return AddObject(id, layer, order, mesh, transform, submeshIndex, SelectLOD(lodObjectID, mesh, worldSphere, bias, hysteresis));
+
+        // There's no camera yet, so each view selects the LOD when it adds the object
+        RenderObject& object = AddObject(id, layer, order, mesh, transform, submeshIndex);
+        _sharedLODObjects.Append(SharedLODObject{
+            _objectIndices[_objectIndices.GetCount() - 1],
+            &mesh,
+            submeshIndex,
+            lodObjectID,
+            worldSphere,
+            mesh.GetBounds().Transformed(transform),
+            bias,
+            hysteresis
+        });
+
+        return object;
+    }
+
+    RenderObject& RenderScene::AddObject(uint64 id, uint64 layer, float order, Mesh& mesh, uint32 indexOffset, uint32 indexCount,
         int32 vertexOffset)
     {
         _frame->EnsureMeshData(mesh);
-
-        AddObject(id, layer, order, mesh.GetID(), indexOffset, indexCount, vertexOffset);
+        return AddObject(id, layer, order, mesh.GetID(), indexOffset, indexCount, vertexOffset);
     }
 
-    void RenderScene::AddObject(uint64 id, uint64 layer, float order, uint64 meshID, uint32 indexOffset, uint32 indexCount,
+    RenderObject& RenderScene::AddObject(uint64 id, uint64 layer, float order, uint64 meshID, uint32 indexOffset, uint32 indexCount,
         int32 vertexOffset)
     {
         Submesh submesh(indexOffset, indexCount, vertexOffset);
+        return AddObjectInternal(id, layer, order, meshID, submesh, BoundingBox::CreateInfinite());
+    }
+
+    float RenderScene::GetProjectedScreenSize(const BoundingSphere& worldSphere) const
+    {
+        COCO_ASSERT(!_isShared, "Shared scenes have no camera to project with");
+
+        const Vector4 viewCenter = _viewMatrix * Vector4(worldSphere.Center, 1.0f);
+
+        // The W row gives the view depth for perspective projections and a constant for orthographic ones
+        const float w = _projectionMatrix.Row[3].Dot(viewCenter);
+        const bool isPerspective = _projectionMatrix.Values[3][3] == 0.0f;
+
+        if (isPerspective && w <= worldSphere.Radius)
+            return std::numeric_limits<float>::max();
+
+        return worldSphere.Radius * Math::Abs(_projectionMatrix.Values[1][1]) / w;
+    }
+
+    uint32 RenderScene::SelectLOD(uint64 objectID, const Mesh& mesh, const BoundingSphere& worldSphere, float bias, float hysteresis)
+    {
+        COCO_ASSERT(!_isShared, "Shared scenes have no camera to select LODs with. Use AddLODObject() instead");
+
+        if (mesh.GetLODCount() <= 1)
+            return 0;
+
+        const float screenSize = GetProjectedScreenSize(worldSphere) * bias;
+
+        // Objects this view didn't draw last frame have no LOD to stay at, so they get the LOD that fits them best
+        const Optional<uint32> previousLOD = _viewLODs ? _viewLODs->GetPreviousLOD(objectID) : Optional<uint32>();
+        const uint32 lod = mesh.SelectLOD(screenSize, previousLOD.value_or(0), previousLOD.has_value() ? hysteresis : 0.0f);
+
+        if (_viewLODs)
+            _viewLODs->SetCurrentLOD(objectID, lod);
+
+        return lod;
+    }
+
+    void RenderScene::CullObjects()
+    {
+        COCO_ASSERT(!_isShared, "Shared scenes have no camera to cull with");
+
+        const uint64 endIndex = _objectIndices.GetCount();
+
+        if (_nextCullIndex >= endIndex)
+        {
+            _nextCullIndex = endIndex;
+            return;
+        }
+
+        // Objects added since the last cull were appended to the frame one after another, so they can be culled as a single range
+        const uint64 firstObjectIndex = _objectIndices[_nextCullIndex];
+        const uint64 objectCount = _objectIndices[endIndex - 1] - firstObjectIndex + 1;
+
+        ViewFrustum frustum = ViewFrustum::FromViewProjection(_projectionMatrix * _viewMatrix);
+        FrustumCuller& culler = _frame->_culler;
+        const uint64 culledCount = culler.Cull(frustum, firstObjectIndex, objectCount);
+
+        if (culledCount > 0)
+        {
+            // Only this scene's index list is compacted. The objects stay in the frame so other scenes can still reference them
+            uint64 writeIndex = _nextCullIndex;
 
-        _frame->_renderObjects.EmplaceBack(id, layer, meshID, submesh, order);
-        _renderObjectCount++;
+            for (uint64 i = _nextCullIndex; i < endIndex; i++)
+            {
+                const uint64 objectIndex = _objectIndices[i];
+
+                if (culler.IsVisible(objectIndex))
+                    _objectIndices[writeIndex++] = objectIndex;
+            }
+
+            _objectIndices.Resize(writeIndex);
+            _frame->_stats.ObjectsCulled += culledCount;
+        }
+
+        _nextCullIndex = _objectIndices.GetCount();
+    }
+
+    void RenderScene::AddVisibleObjects(const RenderScene& sourceScene)
+    {
+        COCO_ASSERT(sourceScene._frame == _frame, "Scenes must be from the same frame");
+        COCO_ASSERT(!_isShared, "Shared scenes have no camera to cull with");
+
+        // Cull this scene's own objects first so the objects added since the last cull stay a contiguous range
+        CullObjects();
+
+        const Array<uint64>& sourceIndices = sourceScene._objectIndices;
+
+        if (sourceIndices.IsEmpty())
+            return;
+
+        const uint64 firstObjectIndex = sourceIndices[0];
+        const uint64 objectCount = sourceIndices[sourceIndices.GetCount() - 1] - firstObjectIndex + 1;
+
+        ViewFrustum frustum = ViewFrustum::FromViewProjection(_projectionMatrix * _viewMatrix);
+        FrustumCuller& culler = _frame->_culler;
+        culler.Cull(frustum, firstObjectIndex, objectCount);
+
+        const Array<SharedLODObject>& lodObjects = sourceScene._sharedLODObjects;
+        uint64 lodObjectIndex = 0;
+        uint64 visibleCount = 0;
+
+        for (const uint64 objectIndex : sourceIndices)
+        {
+            const bool isVisible = culler.IsVisible(objectIndex);
+
+            // LOD objects were recorded in the same order as the objects they belong to
+            while (lodObjectIndex < lodObjects.GetCount() && lodObjects[lodObjectIndex].ObjectIndex < objectIndex)
+                lodObjectIndex++;
+
+            if (!isVisible && !_keepUnculledObjects)
+                continue;
+
+            uint64 drawIndex = objectIndex;
+
+            if (lodObjectIndex < lodObjects.GetCount() && lodObjects[lodObjectIndex].ObjectIndex == objectIndex)
+            {
+                const SharedLODObject& lodObject = lodObjects[lodObjectIndex];
+                const uint32 lod = SelectLOD(lodObject.LODObjectID, *lodObject.LODMesh, lodObject.WorldSphere, lodObject.Bias, lodObject.Hysteresis);
+
+                if (lod != 0)
+                {
+                    // The shared object draws LOD 0, so this view draws a copy with its own submesh. The copy keeps the object's data
+                    RenderObject lodRenderObject = _frame->_renderObjects[objectIndex];
+                    auto submeshes = lodObject.LODMesh->GetLODSubmeshes(lod);
+                    lodRenderObject.DrawSubmesh = lodObject.SubmeshIndex < submeshes.size() ? submeshes[lodObject.SubmeshIndex] : submeshes[0];
+
+                    drawIndex = _frame->_renderObjects.GetCount();
+                    _frame->_renderObjects.Append(lodRenderObject);
+                    culler.AddBounds(lodObject.WorldBounds);
+                }
+            }
+
+            if (_keepUnculledObjects)
+                _unculledObjectIndices.Append(drawIndex);
+
+            if (isVisible)
+            {
+                _objectIndices.Append(drawIndex);
+                visibleCount++;
+            }
+        }
+
+        _frame->_stats.ObjectsCulled += sourceIndices.GetCount() - visibleCount;
+        _nextCullIndex = _objectIndices.GetCount();
+    }
+
+    const RenderObject& RenderScene::GetRenderObject(uint64 index) const
+    {
+        return _frame->_renderObjects[_objectIndices[index]];
+    }
+
+    void RenderScene::GetRenderObjectBounds(uint64 index, Vector3& outCenter, Vector3& outExtents) const
+    {
+        _frame->_culler.GetBounds(_objectIndices[index], outCenter, outExtents);
+    }
+
+    const RenderObject& RenderScene::GetUnculledObject(uint64 index) const
+    {
+        return _frame->_renderObjects[GetUnculledObjectIndices()[index]];
+    }
+
+    void RenderScene::GetUnculledObjectBounds(uint64 index, Vector3& outCenter, Vector3& outExtents) const
+    {
+        _frame->_culler.GetBounds(GetUnculledObjectIndices()[index], outCenter, outExtents);
     }
 
     RenderObjectView RenderScene::GetRenderObjectView() const
@@ -166,6 +385,11 @@ namespace Coco
         return RenderObjectView(*this);
     }
 
+    RenderObjectView RenderScene::GetRenderObjectView(uint64 offset, uint64 count) const
+    {
+        return RenderObjectView(*this, offset, count);
+    }
+
     uint64 RenderScene::GetDataID(uint64 id, bool isShared) const
     {
         if (isShared)
@@ -173,4 +397,18 @@ namespace Coco
 
         return Math::CombineHashes(_id, id);
     }
+
+    RenderObject& RenderScene::AddObjectInternal(uint64 id, uint64 layer, float order, uint64 meshID, const Submesh& submesh,
+        const BoundingBox& worldBounds)
+    {
+        _objectIndices.Append(_frame->_renderObjects.GetCount());
+
+        if (_keepUnculledObjects)
+            _unculledObjectIndices.Append(_frame->_renderObjects.GetCount());
+
+        RenderObject& object = _frame->_renderObjects.EmplaceBack(id, layer, meshID, submesh, order);
+        _frame->_culler.AddBounds(worldBounds);
+
+        return object;
+    }
 } // Coco
\ No newline at end of file
@@ -11,6 +11,8 @@
 #include "RenderObjectView.h"
 #include "RenderSceneTypes.h"
 
+#include "Coco/Core/Math/BoundingBox.h"
+#include "Coco/Core/Math/BoundingSphere.h"
 #include "Coco/Core/Math/Matrix4x4.h"
 
 #include "Graphics/RenderFrame.h"
@@ -30,12 +32,17 @@ namespace Coco
         friend class RenderObjectView::Iterator;
 
     public:
-        RenderScene(RenderFrame* frame, uint64 id, const Sizei& frameSize);
+        RenderScene(RenderFrame* frame, uint64 id, const Sizei& frameSize, bool isShared = false);
 
         /// @brief Gets the ID of this render
         /// @return The ID
         uint64 GetID() const { return _id; }
 
+        /// @brief Determines if this is the scene that objects are extracted into once per frame for every view.
+        /// Shared scenes have no size or camera, so only per-view scenes can create projections or select LODs
+        /// @return True if this is a shared scene
+        bool IsShared() const { return _isShared; }
+
         /// @brief Gets the resolution of the primary output
         /// @return The resolution of the primary output
         const Sizei& GetFrameSize() const { return _frameSize; }
@@ -166,6 +173,26 @@ namespace Coco
             return _frame->GetSceneStorage().Get<DataType>(dataID);
         }
 
+        /// @brief Stores per-object data for a RenderObject. Unlike StoreData(), this is an append-only write that isn't deduplicated
+        /// @tparam DataType The type of data
+        /// @param object The object
+        /// @param data The data to store
+        template<typename DataType>
+        void SetObjectData(RenderObject& object, const DataType& data)
+        {
+            object.DataHandle = _frame->GetSceneStorage().Append(data);
+        }
+
+        /// @brief Gets the per-object data for a RenderObject
+        /// @tparam DataType The type of data
+        /// @param object The object
+        /// @return The object's data, or nullptr if the object doesn't have data of the given type
+        template<typename DataType>
+        const DataType* GetObjectData(const RenderObject& object) const
+        {
+            return _frame->GetSceneStorage().Get<DataType>(object.DataHandle);
+        }
+
         /// @brief Gets a texture resource via its ID
         /// @param id The ID of the texture resource
         /// @return The texture
@@ -189,9 +216,20 @@ namespace Coco
         /// @return The shader uniforms
         Span<const ShaderUniformValue> GetUniforms(uint64 id, bool sharedData) const;
 
-        /// @brief Stores the given materials uniforms for this scene
+        /// @brief Stores a handle to a material for this scene. Its parameters aren't copied, since draws bind the material's persistent uniform block
         /// @param material The material
-        void StoreMaterial(Material& material);
+        /// @return The handle to the material
+        MaterialHandle StoreMaterial(const Material& material);
+
+        /// @brief Gets the handle to a material previously stored for this scene
+        /// @param materialID The ID of the material
+        /// @return The handle, or nullptr if the material wasn't stored
+        const MaterialHandle* GetMaterialHandle(uint64 materialID) const;
+
+        /// @brief Gets a material resource via its ID
+        /// @param id The ID of the material resource
+        /// @return The material
+        SharedPtr<Material> GetMaterial(uint64 id) const;
 
         /// @brief Adds raw mesh data for this scene
         /// @param id The mesh ID
@@ -211,7 +249,35 @@ namespace Coco
         /// @param order An ordering value for sorting RenderObjects
         /// @param mesh The mesh to render the object with
         /// @param submeshIndex The index of the submesh to render the object with
-        void AddObject(uint64 id, uint64 layer, float order, Mesh& mesh, uint32 submeshIndex = 0);
+        /// @return The added RenderObject
+        RenderObject& AddObject(uint64 id, uint64 layer, float order, Mesh& mesh, uint32 submeshIndex = 0);
+
+        /// @brief Adds a RenderObject for this scene that can be frustum culled using the mesh's bounds
+        /// @param id The object ID
+        /// @param layer The object's layer
+        /// @param order An ordering value for sorting RenderObjects
+        /// @param mesh The mesh to render the object with
+        /// @param transform The object's local-to-world transform, used to transform the mesh's bounds
+        /// @param submeshIndex The index of the submesh to render the object with
+        /// @param lod The level of detail of the mesh to render the object with
+        /// @return The added RenderObject
+        RenderObject& AddObject(uint64 id, uint64 layer, float order, Mesh& mesh, const Matrix4x4& transform, uint32 submeshIndex = 0, uint32 lod = 0);
+
+        /// @brief Adds a RenderObject for this scene that draws the level of detail of a mesh that fits its projected screen size.
+        /// Per-view scenes select the LOD right away. Shared scenes add the object at LOD 0, and each view selects its own LOD in AddVisibleObjects()
+        /// @param id The object ID
+        /// @param layer The object's layer
+        /// @param order An ordering value for sorting RenderObjects
+        /// @param mesh The mesh to render the object with. It must stay alive until the frame has been rendered
+        /// @param transform The object's local-to-world transform, used to transform the mesh's bounds
+        /// @param submeshIndex The index of the submesh to render the object with
+        /// @param lodObjectID The ID the object's LOD is kept with across frames. Submeshes of the same object should share it
+        /// @param worldSphere The world-space bounding sphere of the object
+        /// @param bias A factor the screen size is multiplied by before selecting the LOD
+        /// @param hysteresis The fraction the screen size must pass a LOD's threshold by before switching to or from it
+        /// @return The added RenderObject
+        RenderObject& AddLODObject(uint64 id, uint64 layer, float order, Mesh& mesh, const Matrix4x4& transform, uint32 submeshIndex,
+            uint64 lodObjectID, const BoundingSphere& worldSphere, float bias, float hysteresis);
 
         /// @brief Adds a RenderObject for this scene
         /// @param id The object ID
@@ -221,7 +287,8 @@ namespace Coco
         /// @param indexOffset The offset in the vertex buffer of the first index to render
         /// @param indexCount The number of indices to render
         /// @param vertexOffset An offset to apply to each vertex index
-        void AddObject(uint64 id, uint64 layer, float order, Mesh& mesh, uint32 indexOffset, uint32 indexCount, int32 vertexOffset = 0);
+        /// @return The added RenderObject
+        RenderObject& AddObject(uint64 id, uint64 layer, float order, Mesh& mesh, uint32 indexOffset, uint32 indexCount, int32 vertexOffset = 0);
 
         /// @brief Adds a RenderObject for this scene
         /// @param id The object ID
@@ -231,29 +298,137 @@ namespace Coco
         /// @param indexOffset The offset in the vertex buffer of the first index to render
         /// @param indexCount The number of indices to render
         /// @param vertexOffset An offset to apply to each vertex index
-        void AddObject(uint64 id, uint64 layer, float order, uint64 meshID, uint32 indexOffset, uint32 indexCount, int32 vertexOffset = 0);
+        /// @return The added RenderObject
+        RenderObject& AddObject(uint64 id, uint64 layer, float order, uint64 meshID, uint32 indexOffset, uint32 indexCount, int32 vertexOffset = 0);
+
+        /// @brief Gets the projected height of a sphere as seen by this scene's primary camera
+        /// @param worldSphere The world-space sphere
+        /// @return The projected height as a fraction of the viewport height, or the maximum float value if the camera is inside the sphere
+        float GetProjectedScreenSize(const BoundingSphere& worldSphere) const;
+
+        /// @brief Sets the levels of detail this scene's view drew its objects with, so LODs can be selected with hysteresis per view
+        /// @param viewLODs The view's LODs, or nullptr to select LODs without hysteresis
+        void SetViewLODs(RenderViewLODs* viewLODs) { _viewLODs = viewLODs; }
+
+        /// @brief Selects the level of detail of a mesh from its projected screen size as seen by this scene's primary camera.
+        /// Hysteresis is relative to the LOD this scene's view drew the object with last frame, so views don't change each other's LODs
+        /// @param objectID The ID of the object, which must stay the same across frames
+        /// @param mesh The mesh
+        /// @param worldSphere The world-space bounding sphere of the object
+        /// @param bias A factor the screen size is multiplied by before selecting the LOD
+        /// @param hysteresis The fraction the screen size must pass a LOD's threshold by before switching to or from it
+        /// @return The level of detail to draw the object with
+        uint32 SelectLOD(uint64 objectID, const Mesh& mesh, const BoundingSphere& worldSphere, float bias, float hysteresis);
+
+        /// @brief Sets if this scene also keeps its RenderObjects from before frustum culling, for passes that cull their objects on the GPU.
+        /// Other passes still draw only the objects that CullObjects() and AddVisibleObjects() leave visible
+        /// @param keep If true, the unculled objects will be kept
+        void SetKeepUnculledObjects(bool keep) { _keepUnculledObjects = keep; }
+
+        /// @brief Determines if this scene keeps its RenderObjects from before frustum culling
+        /// @return True if the unculled objects are kept
+        bool IsKeepingUnculledObjects() const { return _keepUnculledObjects; }
+
+        /// @brief Removes RenderObjects added since the last cull whose bounds are outside the frustum of this scene's primary camera.
+        /// Objects added without a transform have infinite bounds and are never culled
+        void CullObjects();
+
+        /// @brief Adds the RenderObjects of another scene from the same frame that are inside the frustum of this scene's primary camera.
+        /// This lets objects that were extracted once per frame be shared by every view without being extracted again.
+        /// Objects added with AddLODObject() get this view's LOD
+        /// @param sourceScene The scene to add the visible objects of
+        void AddVisibleObjects(const RenderScene& sourceScene);
 
         /// @brief Gets a view to iterate over this scene's RenderObjects
         /// @return A view over this scene's RenderObjects
         RenderObjectView GetRenderObjectView() const;
 
+        /// @brief Gets a view to iterate over a range of this scene's RenderObjects
+        /// @param offset The index of the first RenderObject in the range
+        /// @param count The number of RenderObjects in the range
+        /// @return A view over the range of RenderObjects
+        RenderObjectView GetRenderObjectView(uint64 offset, uint64 count) const;
+
+        /// @brief Gets the number of RenderObjects in this scene
+        /// @return The number of RenderObjects
+        uint64 GetRenderObjectCount() const { return _objectIndices.GetCount(); }
+
+        /// @brief Gets one of this scene's RenderObjects
+        /// @param index The index of the RenderObject in this scene
+        /// @return The RenderObject
+        const RenderObject& GetRenderObject(uint64 index) const;
+
+        /// @brief Gets the world-space bounds of one of this scene's RenderObjects
+        /// @param index The index of the RenderObject in this scene
+        /// @param outCenter Will be set to the center of the bounds
+        /// @param outExtents Will be set to the extents of the bounds. Objects added without a transform have the maximum float extents
+        void GetRenderObjectBounds(uint64 index, Vector3& outCenter, Vector3& outExtents) const;
+
+        /// @brief Gets the number of RenderObjects in this scene before frustum culling.
+        /// If this scene doesn't keep its unculled objects, this is the number of visible objects instead
+        /// @return The number of unculled RenderObjects
+        uint64 GetUnculledObjectCount() const { return GetUnculledObjectIndices().GetCount(); }
+
+        /// @brief Gets one of this scene's RenderObjects from before frustum culling
+        /// @param index The index of the RenderObject in the unculled objects
+        /// @return The RenderObject
+        const RenderObject& GetUnculledObject(uint64 index) const;
+
+        /// @brief Gets the world-space bounds of one of this scene's RenderObjects from before frustum culling
+        /// @param index The index of the RenderObject in the unculled objects
+        /// @param outCenter Will be set to the center of the bounds
+        /// @param outExtents Will be set to the extents of the bounds. Objects added without a transform have the maximum float extents
+        void GetUnculledObjectBounds(uint64 index, Vector3& outCenter, Vector3& outExtents) const;
+
     private:
+        /// @brief An object of a shared scene whose level of detail is selected by each view that adds it
+        struct SharedLODObject
+        {
+            uint64 ObjectIndex;
+            const Mesh* LODMesh;
+            uint32 SubmeshIndex;
+            uint64 LODObjectID;
+            BoundingSphere WorldSphere;
+            BoundingBox WorldBounds;
+            float Bias;
+            float Hysteresis;
+        };
+
         RenderFrame* _frame;
         uint64 _id;
         Sizei _frameSize;
+        bool _isShared;
 
         Vector3 _viewPosition;
         Quaternion _viewRotation;
         Matrix4x4 _viewMatrix;
         Matrix4x4 _projectionMatrix;
-        uint64 _firstRenderObjectIndex;
-        uint64 _renderObjectCount;
+        Array<uint64> _objectIndices;
+        Array<uint64> _unculledObjectIndices;
+        Array<SharedLODObject> _sharedLODObjects;
+        uint64 _nextCullIndex;
+        bool _keepUnculledObjects;
+        RenderViewLODs* _viewLODs;
+
+        /// @brief Gets the indices of the frame's objects that passes culling on the GPU should use
+        /// @return The unculled object indices if they're kept, or the visible object indices otherwise
+        const Array<uint64>& GetUnculledObjectIndices() const { return _keepUnculledObjects ? _unculledObjectIndices : _objectIndices; }
 
         /// @brief Computes an ID for render data for this scene
         /// @param id The ID
         /// @param isShared If true, the ID will be consistent across renders for this frame
         /// @return The data ID
         uint64 GetDataID(uint64 id, bool isShared) const;
+
+        /// @brief Adds a RenderObject and its world-space bounds to the frame
+        /// @param id The object ID
+        /// @param layer The object's layer
+        /// @param order An ordering value for sorting RenderObjects
+        /// @param meshID The ID of the mesh
+        /// @param submesh The submesh to render
+        /// @param worldBounds The world-space bounds of the object
+        /// @return The added RenderObject
+        RenderObject& AddObjectInternal(uint64 id, uint64 layer, float order, uint64 meshID, const Submesh& submesh, const BoundingBox& worldBounds);
     };
 } // Coco
 
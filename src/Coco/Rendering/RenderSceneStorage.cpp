@@ -10,21 +10,36 @@ namespace Coco
         Uniforms(uniforms)
     {}
 
+    RenderSceneStorage::DataPool::DataPool(Allocator* allocator) :
+        ElementSize(0),
+        Count(0),
+        Chunks(allocator)
+    {}
+
+    RenderSceneStorage::LookupSlot::LookupSlot() :
+        ID(0),
+        Handle(),
+        Generation(0)
+    {}
+
     RenderSceneStorage::RenderSceneStorage(Allocator* allocator, uint64 rawDataPageSize, uint64 uniformPageSize) :
         _allocator(allocator),
         _pageSize(rawDataPageSize),
         _allocators(allocator, 2),
-        _dataMap(allocator),
-        _shaderUniformValues(uniformPageSize, allocator),
-        _shaderUniformGroups(allocator)
-    {}
+        _pools(allocator),
+        _lookupSlots(allocator),
+        _lookupCount(0),
+        _lookupGeneration(1),
+        _shaderUniformValues(uniformPageSize, allocator)
+    {
+        _lookupSlots.Resize(_initialLookupCapacity);
+    }
 
     RenderSceneStorage::~RenderSceneStorage()
     {
-        _shaderUniformGroups.Clear();
         _shaderUniformValues.Clear();
-
-        _dataMap.Clear();
+        _lookupSlots.Clear(true);
+        _pools.Clear(true);
 
         for (auto& allocator : _allocators)
             allocator.Reset();
@@ -34,31 +49,153 @@ namespace Coco
 
     void RenderSceneStorage::StoreUniforms(uint64 id, Span<const ShaderUniformValue> uniforms)
     {
-        if (_shaderUniformGroups.Contains(id))
+        if (HasUniforms(id))
             return;
 
         auto data = _shaderUniformValues.Allocate(uniforms);
-        _shaderUniformGroups.Emplace(id, data);
+        Store(id, ShaderUniformGroup(data));
     }
 
     bool RenderSceneStorage::HasUniforms(uint64 id) const
     {
-        return _shaderUniformGroups.Contains(id);
+        return Has<ShaderUniformGroup>(id);
     }
 
     Span<const ShaderUniformValue> RenderSceneStorage::GetUniforms(uint64 id) const
     {
-        return _shaderUniformGroups.Get(id).Uniforms;
+        const ShaderUniformGroup* group = Get<ShaderUniformGroup>(id);
+        COCO_ASSERT(group, "No uniforms exist with the given ID");
+
+        return group->Uniforms;
     }
 
     void RenderSceneStorage::Clear()
     {
-        _shaderUniformGroups.Clear();
         _shaderUniformValues.Clear();
 
-        _dataMap.Clear();
+        for (auto& pool : _pools)
+        {
+            pool.Count = 0;
+            pool.Chunks.Clear();
+        }
+
+        // Bumping the generation invalidates every slot without touching them
+        _lookupCount = 0;
+        _lookupGeneration++;
+
+        if (_lookupGeneration == 0)
+        {
+            for (auto& slot : _lookupSlots)
+                slot.Generation = 0;
+
+            _lookupGeneration = 1;
+        }
 
         for (auto& allocator : _allocators)
             allocator.Reset();
     }
-} // Coco
\ No newline at end of file
+
+    uint32 RenderSceneStorage::CreateTypeIndex()
+    {
+        static uint32 nextTypeIndex = 0;
+        return nextTypeIndex++;
+    }
+
+    uint64 RenderSceneStorage::GetLookupHash(uint32 typeIndex, uint64 id)
+    {
+        return Math::CombineHashes(id, static_cast<uint64>(typeIndex));
+    }
+
+    void* RenderSceneStorage::AllocateElement(uint32 typeIndex, uint64 elementSize, uint32& outIndex)
+    {
+        if (typeIndex >= _pools.GetCount())
+            _pools.Resize(typeIndex + 1, DataPool(_allocator));
+
+        DataPool& pool = _pools[typeIndex];
+        pool.ElementSize = elementSize;
+
+        const uint32 chunkIndex = pool.Count / _elementsPerChunk;
+        const uint32 elementIndex = pool.Count % _elementsPerChunk;
+
+        if (chunkIndex >= pool.Chunks.GetCount())
+            pool.Chunks.Append(static_cast<uint8*>(AllocateBlock(elementSize * _elementsPerChunk)));
+
+        outIndex = pool.Count++;
+        return pool.Chunks[chunkIndex] + elementIndex * elementSize;
+    }
+
+    const void* RenderSceneStorage::GetElement(const RenderDataHandle& handle) const
+    {
+        COCO_ASSERT(handle.TypeIndex < _pools.GetCount(), "Invalid data type");
+
+        const DataPool& pool = _pools[handle.TypeIndex];
+        COCO_ASSERT(handle.Index < pool.Count, "Invalid data index");
+
+        return pool.Chunks[handle.Index / _elementsPerChunk] + (handle.Index % _elementsPerChunk) * pool.ElementSize;
+    }
+
+    void* RenderSceneStorage::AllocateBlock(uint64 size)
+    {
+        for (auto& allocator : _allocators)
+        {
+            if (void* memory = allocator.Allocate(size))
+                return memory;
+        }
+
+        auto& allocator = _allocators.EmplaceBack(_allocator->GetGroup(), Math::Max(_pageSize, size), _allocator);
+        void* memory = allocator.Allocate(size);
+        COCO_ASSERT(memory, "Memory could not be allocated");
+
+        return memory;
+    }
+
+    const RenderDataHandle* RenderSceneStorage::FindSharedData(uint32 typeIndex, uint64 id) const
+    {
+        const uint64 mask = _lookupSlots.GetCount() - 1;
+
+        for (uint64 i = GetLookupHash(typeIndex, id) & mask; ; i = (i + 1) & mask)
+        {
+            const LookupSlot& slot = _lookupSlots[i];
+
+            if (slot.Generation != _lookupGeneration)
+                return nullptr;
+
+            if (slot.ID == id && slot.Handle.TypeIndex == typeIndex)
+                return &slot.Handle;
+        }
+    }
+
+    void RenderSceneStorage::InsertSharedData(uint64 id, const RenderDataHandle& handle)
+    {
+        // Keep the load factor under 75% so probe sequences stay short
+        if ((_lookupCount + 1) * 4 > _lookupSlots.GetCount() * 3)
+            ResizeLookupTable(_lookupSlots.GetCount() * 2);
+
+        const uint64 mask = _lookupSlots.GetCount() - 1;
+        uint64 i = GetLookupHash(handle.TypeIndex, id) & mask;
+
+        while (_lookupSlots[i].Generation == _lookupGeneration)
+            i = (i + 1) & mask;
+
+        LookupSlot& slot = _lookupSlots[i];
+        slot.ID = id;
+        slot.Handle = handle;
+        slot.Generation = _lookupGeneration;
+        _lookupCount++;
+    }
+
+    void RenderSceneStorage::ResizeLookupTable(uint64 newCapacity)
+    {
+        Array<LookupSlot> oldSlots(_allocator);
+        swap(oldSlots, _lookupSlots);
+
+        _lookupSlots.Resize(newCapacity);
+        _lookupCount = 0;
+
+        for (const auto& slot : oldSlots)
+        {
+            if (slot.Generation == _lookupGeneration)
+                InsertSharedData(slot.ID, slot.Handle);
+        }
+    }
+} // Coco
@@ -10,9 +10,9 @@
 #include "Coco/Core/Math/Math.h"
 #include "Coco/Core/Memory/Allocators/LinearAllocator.h"
 #include "Coco/Core/Types/Array.h"
-#include "Coco/Core/Types/Map.h"
 #include "Coco/Core/Types/PagedArray.h"
 
+#include "RenderSceneTypes.h"
 #include "Graphics/ShaderUniformValue.h"
 
 namespace Coco
@@ -25,46 +25,57 @@ namespace Coco
         ShaderUniformGroup(Span<const ShaderUniformValue> uniforms);
     };
 
-    /// @brief Data storage for a RenderScene
+    /// @brief Data storage for a RenderScene. Data is stored in dense per-type arrays and referenced by RenderDataHandles.
+    /// Only data that is stored with an ID is deduplicated, using an open-addressed table that is reset each frame
     class RenderSceneStorage
     {
     public:
         RenderSceneStorage(Allocator* allocator, uint64 rawDataPageSize, uint64 uniformPageSize);
         ~RenderSceneStorage();
 
-        /// @brief Stores arbitrary render data. The same ID can be used for different data types
+        /// @brief Appends data without deduplication
         /// @tparam DataType The type of data
-        /// @param id The ID of the data
         /// @param data The data
+        /// @return A handle to the stored data
         template<typename DataType>
-        void Store(uint64 id, const DataType& data)
+        RenderDataHandle Append(const DataType& data)
         {
-            uint64 key = GetKey<DataType>(id);
-            if (_dataMap.Contains(key))
-                return;
-
-            uint64 size = sizeof(DataType);
-            LinearAllocator* targetAllocator = nullptr;
-            for (auto& allocator : _allocators)
-            {
-                if (allocator.GetRemainingSpace() >= size)
-                {
-                    targetAllocator = &allocator;
-                    break;
-                }
-            }
-
-            if (!targetAllocator)
-            {
-                targetAllocator = &_allocators.EmplaceBack(_allocator->GetGroup(), _pageSize, _allocator);
-            }
-
-            void* memory = targetAllocator->Allocate(size);
-            COCO_ASSERT(memory, "Memory could not be allocated");
+            const uint32 typeIndex = GetTypeIndex<DataType>();
+            uint32 index = 0;
+            void* memory = AllocateElement(typeIndex, sizeof(DataType), index);
 
             memcpy(memory, &data, sizeof(DataType));
 
-            _dataMap.Emplace(key, memory);
+            return {typeIndex, index};
+        }
+
+        /// @brief Gets data via its handle
+        /// @tparam DataType The type of data
+        /// @param handle The handle to the data
+        /// @return The data, or nullptr if the handle is invalid or points to a different type of data
+        template<typename DataType>
+        const DataType* Get(const RenderDataHandle& handle) const
+        {
+            if (!handle.IsValid() || handle.TypeIndex != GetTypeIndex<DataType>())
+                return nullptr;
+
+            return static_cast<const DataType*>(GetElement(handle));
+        }
+
+        /// @brief Stores arbitrary render data that can be shared. The same ID can be used for different data types
+        /// @tparam DataType The type of data
+        /// @param id The ID of the data
+        /// @param data The data
+        /// @return A handle to the stored data. If data with the ID already exists, the existing handle is returned
+        template<typename DataType>
+        RenderDataHandle Store(uint64 id, const DataType& data)
+        {
+            if (const RenderDataHandle* existing = FindSharedData(GetTypeIndex<DataType>(), id))
+                return *existing;
+
+            RenderDataHandle handle = Append(data);
+            InsertSharedData(id, handle);
+            return handle;
         }
 
         /// @brief Determines if render data with the given ID and type exists
@@ -74,19 +85,18 @@ namespace Coco
         template<typename DataType>
         bool Has(uint64 id) const
         {
-            uint64 key = GetKey<DataType>(id);
-            return _dataMap.Contains(key);
+            return FindSharedData(GetTypeIndex<DataType>(), id) != nullptr;
         }
 
         /// @brief Gets arbitrary render data previously stored
         /// @tparam DataType The type of data
         /// @param id The ID of the data
-        /// @return The data
+        /// @return The data, or nullptr if no data with the ID exists
         template<typename DataType>
         const DataType* Get(uint64 id) const
         {
-            uint64 key = GetKey<DataType>(id);
-            return static_cast<const DataType*>(_dataMap.Get(key));
+            const RenderDataHandle* handle = FindSharedData(GetTypeIndex<DataType>(), id);
+            return handle ? Get<DataType>(*handle) : nullptr;
         }
 
         /// @brief Stores a group of shader uniforms with a given ID. This ID is separate from the ID of data stored using Store()
@@ -108,23 +118,90 @@ namespace Coco
         void Clear();
 
     private:
+        /// @brief A set of fixed-size chunks of data of a single type
+        struct DataPool
+        {
+            uint64 ElementSize;
+            uint32 Count;
+            Array<uint8*> Chunks;
+
+            DataPool(Allocator* allocator = nullptr);
+        };
+
+        /// @brief A slot in the shared data lookup table
+        struct LookupSlot
+        {
+            uint64 ID;
+            RenderDataHandle Handle;
+            uint32 Generation;
+
+            LookupSlot();
+        };
+
+        static constexpr uint32 _elementsPerChunk = 64;
+        static constexpr uint64 _initialLookupCapacity = 256;
+
         Allocator* _allocator;
         uint64 _pageSize;
         Array<LinearAllocator> _allocators;
-        Map<uint64, void*> _dataMap;
+        Array<DataPool> _pools;
+        Array<LookupSlot> _lookupSlots;
+        uint64 _lookupCount;
+        uint32 _lookupGeneration;
         PagedArray<ShaderUniformValue> _shaderUniformValues;
-        Map<uint64, ShaderUniformGroup> _shaderUniformGroups;
 
-        /// @brief Creates a key unique to a combination of data type and ID
+        /// @brief Gets a unique index for a type of data
         /// @tparam DataType The type of data
-        /// @param id The ID of the data
-        /// @return The data key
+        /// @return The type index
         template<typename DataType>
-        static uint64 GetKey(uint64 id)
+        static uint32 GetTypeIndex()
         {
-            return Math::CombineHashes(typeid(DataType).hash_code(), id);
+            static const uint32 typeIndex = CreateTypeIndex();
+            return typeIndex;
         }
+
+        /// @brief Creates a new type index
+        /// @return The type index
+        static uint32 CreateTypeIndex();
+
+        /// @brief Gets the lookup table hash for a combination of data type and ID
+        /// @param typeIndex The index of the data type
+        /// @param id The ID of the data
+        /// @return The hash
+        static uint64 GetLookupHash(uint32 typeIndex, uint64 id);
+
+        /// @brief Allocates memory for a single element of a type
+        /// @param typeIndex The index of the data type
+        /// @param elementSize The size of the element
+        /// @param outIndex Will be set to the index of the element
+        /// @return The element memory
+        void* AllocateElement(uint32 typeIndex, uint64 elementSize, uint32& outIndex);
+
+        /// @brief Gets the memory for an element
+        /// @param handle The handle to the element
+        /// @return The element memory
+        const void* GetElement(const RenderDataHandle& handle) const;
+
+        /// @brief Allocates a block of memory from the storage pages
+        /// @param size The size of the block
+        /// @return The block memory
+        void* AllocateBlock(uint64 size);
+
+        /// @brief Finds shared data in the lookup table
+        /// @param typeIndex The index of the data type
+        /// @param id The ID of the data
+        /// @return The handle to the data, or nullptr if it doesn't exist
+        const RenderDataHandle* FindSharedData(uint32 typeIndex, uint64 id) const;
+
+        /// @brief Inserts shared data into the lookup table
+        /// @param id The ID of the data
+        /// @param handle The handle to the data
+        void InsertSharedData(uint64 id, const RenderDataHandle& handle);
+
+        /// @brief Resizes the lookup table, keeping all entries from the current generation
+        /// @param newCapacity The new capacity. Must be a power of 2
+        void ResizeLookupTable(uint64 newCapacity);
     };
 } // Coco
 
-#endif //COCOENGINE_RENDERSCENESTORAGE_H
\ No newline at end of file
+#endif //COCOENGINE_RENDERSCENESTORAGE_H
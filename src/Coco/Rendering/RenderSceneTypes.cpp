@@ -5,11 +5,59 @@
 
 namespace Coco
 {
+    RenderDataHandle::RenderDataHandle() :
+        TypeIndex(InvalidIndex),
+        Index(InvalidIndex)
+    {}
+
+    RenderDataHandle::RenderDataHandle(uint32 typeIndex, uint32 index) :
+        TypeIndex(typeIndex),
+        Index(index)
+    {}
+
     RenderObject::RenderObject(uint64 id, uint64 layer, uint64 meshID, const Submesh& drawSubmesh, float order) :
         ID(id),
         Layer(layer),
         MeshID(meshID),
         DrawSubmesh(drawSubmesh),
-        Order(order)
+        Order(order),
+        DataHandle()
+    {}
+
+    MaterialHandle::MaterialHandle(uint64 materialID, uint64 version) :
+        MaterialID(materialID),
+        Version(version)
+    {}
+
+    RenderViewLODs::RenderViewLODs() :
+        _lods(),
+        _currentIndex(0)
     {}
+
+    void RenderViewLODs::NextFrame()
+    {
+        _currentIndex = 1 - _currentIndex;
+        _lods[_currentIndex].Clear();
+    }
+
+    Optional<uint32> RenderViewLODs::GetPreviousLOD(uint64 objectID) const
+    {
+        if (const uint32* lod = _lods[1 - _currentIndex].TryGetValue(objectID))
+            return *lod;
+
+        return {};
+    }
+
+    Optional<uint32> RenderViewLODs::GetCurrentLOD(uint64 objectID) const
+    {
+        if (const uint32* lod = _lods[_currentIndex].TryGetValue(objectID))
+            return *lod;
+
+        return {};
+    }
+
+    void RenderViewLODs::SetCurrentLOD(uint64 objectID, uint32 lod)
+    {
+        _lods[_currentIndex][objectID] = lod;
+    }
 }
@@ -5,11 +5,35 @@
 #ifndef COCOENGINE_RENDERSCENETYPES_H
 #define COCOENGINE_RENDERSCENETYPES_H
 #include <Coco/Core/Types/CoreTypes.h>
+#include <Coco/Core/Types/Map.h>
+#include <Coco/Core/Types/Optional.h>
+
+#include <limits>
 
 #include "Mesh.h"
 
 namespace Coco
 {
+    /// @brief A handle to typed data stored in a RenderSceneStorage
+    struct RenderDataHandle
+    {
+        /// @brief The index used for invalid handles
+        static constexpr uint32 InvalidIndex = std::numeric_limits<uint32>::max();
+
+        /// @brief The index of the type of data
+        uint32 TypeIndex;
+
+        /// @brief The index of the data within the storage for its type
+        uint32 Index;
+
+        RenderDataHandle();
+        RenderDataHandle(uint32 typeIndex, uint32 index);
+
+        /// @brief Determines if this handle points to data
+        /// @return True if this handle is valid
+        bool IsValid() const { return Index != InvalidIndex; }
+    };
+
     /// @brief An individual object that can be rendered
     struct RenderObject
     {
@@ -28,7 +52,53 @@ namespace Coco
         /// @brief An ordering value for sorting render objects
         float Order;
 
+        /// @brief A handle to the per-object data of this object, if any
+        RenderDataHandle DataHandle;
+
         RenderObject(uint64 id, uint64 layer, uint64 meshID, const Submesh& drawSubmesh, float order);
     };
+
+    /// @brief A reference to a material stored in a scene. The material's parameters live in its persistent uniform block,
+    /// so storing a material doesn't copy them
+    struct MaterialHandle
+    {
+        /// @brief The ID of the material
+        uint64 MaterialID;
+
+        /// @brief The version of the material's parameters when it was stored
+        uint64 Version;
+
+        MaterialHandle(uint64 materialID, uint64 version);
+    };
+
+    /// @brief The levels of detail a view drew its objects with. Each view keeps its own across frames,
+    /// so LOD hysteresis compares against what the same view drew last frame
+    class RenderViewLODs
+    {
+    public:
+        RenderViewLODs();
+
+        /// @brief Starts a new frame. Objects that weren't drawn last frame are forgotten
+        void NextFrame();
+
+        /// @brief Gets the LOD an object was drawn with last frame
+        /// @param objectID The ID of the object
+        /// @return The LOD, or an empty optional if the object wasn't drawn last frame
+        Optional<uint32> GetPreviousLOD(uint64 objectID) const;
+
+        /// @brief Gets the LOD an object is drawn with this frame
+        /// @param objectID The ID of the object
+        /// @return The LOD, or an empty optional if the object hasn't been drawn this frame
+        Optional<uint32> GetCurrentLOD(uint64 objectID) const;
+
+        /// @brief Sets the LOD an object is drawn with this frame
+        /// @param objectID The ID of the object
+        /// @param lod The LOD
+        void SetCurrentLOD(uint64 objectID, uint32 lod);
+
+    private:
+        Map<uint64, uint32> _lods[2];
+        uint32 _currentIndex;
+    };
 }
 #endif //COCOENGINE_RENDERSCENETYPES_H
\ No newline at end of file
@@ -13,7 +13,18 @@ namespace Coco
 {
     FinalRenderTarget::FinalRenderTarget(uint64 id, Ref<GraphicsSurface> targetSurface) :
         ID(id),
-        TargetSurface(targetSurface)
+        TargetSurface(targetSurface),
+        TargetImage(),
+        GraphCompilation(),
+        ViewLODs()
+    {}
+
+    FinalRenderTarget::FinalRenderTarget(uint64 id, Ref<Image> targetImage) :
+        ID(id),
+        TargetSurface(),
+        TargetImage(targetImage),
+        GraphCompilation(),
+        ViewLODs()
     {}
 
     RenderService::RenderService(Engine* engine) :
@@ -22,6 +33,7 @@ namespace Coco
         _graphicsPlatform(nullptr),
         _renderTickListener(this, &RenderService::RenderTick, RenderTickOrder),
         _renderListenersNeedSorting(false),
+        _gpuCullingEnabled(false),
         _lastFrameStats()
     {
         if (!_renderingPlatform)
@@ -30,6 +42,8 @@ namespace Coco
         _renderTickListener.ListenTo(*engine->GetMainLoop());
         //_renderer2D = CreateDefaultUnique<Renderer2D>();
         _gizmos = CreateDefaultUnique<Gizmos>(this);
+        _textureDecoder = CreateDefaultUnique<TextureDecoder>(engine->GetFileSystem(), TextureDecoder::GetDefaultWorkerCount());
+        _workerPool = CreateDefaultUnique<WorkerPool>(WorkerPool::GetDefaultWorkerCount());
 
         COCO_ENGINE_LOG_VERBOSE("Created RenderService");
     }
@@ -48,6 +62,8 @@ namespace Coco
         _finalRenderTargets.Clear();
         _renderTickListener.StopListening();
         _graphicsPlatform.reset();
+        _textureDecoder.reset();
+        _workerPool.reset();
 
         COCO_ENGINE_LOG_VERBOSE("Destroyed RenderService");
     }
@@ -77,11 +93,43 @@ namespace Coco
         _finalRenderTargets.Emplace(targetID, targetID, surface);
     }
 
+    void RenderService::AddOffscreenRenderTarget(uint64 targetID, Ref<Image> image)
+    {
+        if (_finalRenderTargets.Contains(targetID))
+            return;
+
+        COCO_ASSERT(image, "Image was null");
+        _finalRenderTargets.Emplace(targetID, targetID, image);
+    }
+
+    SharedPtr<ImageReadback> RenderService::ReadbackRenderTarget(uint64 targetID)
+    {
+        FinalRenderTarget* target = _finalRenderTargets.TryGetValue(targetID);
+        if (!target || !target->TargetImage || !_graphicsPlatform)
+            return nullptr;
+
+        return _graphicsPlatform->GetCurrentRenderFrame()->ReadbackImage(target->TargetImage);
+    }
+
     void RenderService::RemoveFinalRenderTarget(uint64 targetID)
     {
         _finalRenderTargets.Remove(targetID);
     }
 
+    Optional<uint32> RenderService::GetObjectLOD(uint64 targetID, uint64 objectID) const
+    {
+        const FinalRenderTarget* target = _finalRenderTargets.TryGetValue(targetID);
+        if (!target)
+            return {};
+
+        return target->ViewLODs.GetCurrentLOD(objectID);
+    }
+
+    bool RenderService::IsGPUCullingEnabled() const
+    {
+        return _gpuCullingEnabled && _graphicsPlatform && _graphicsPlatform->GetDeviceDescription().SupportsIndirectDrawCount;
+    }
+
     void RenderService::CreateDefaultResources()
     {
         CreateDefaultCheckerTexture();
@@ -132,10 +180,19 @@ namespace Coco
 
         Ref<RenderFrame> frame = _graphicsPlatform->GetCurrentRenderFrame();
 
+        // Objects that look the same from every view are extracted once and culled per view
+        RenderScene sharedScene = frame->CreateSharedRenderScene();
+
+        for (const auto& listener : _renderListeners)
+        {
+            if (listener->HasExtractCallback())
+                listener->DispatchExtract(sharedScene);
+        }
+
         for (auto& pair : _finalRenderTargets)
         {
-            if (pair.second.TargetSurface)
-                RenderForSurface(pair.first, pair.second.TargetSurface, frame, tickInfo);
+            if (pair.second.TargetSurface || pair.second.TargetImage)
+                RenderForTarget(pair.second, frame, sharedScene, tickInfo);
         }
 
         _lastFrameStats = frame->GetStats();
@@ -156,27 +213,52 @@ namespace Coco
         _renderListenersNeedSorting = false;
     }
 
-    void RenderService::RenderForSurface(uint64 targetID, Ref<GraphicsSurface> surface, Ref<RenderFrame> renderFrame, const TickInfo& tickInfo)
+    void RenderService::RenderForTarget(FinalRenderTarget& target, Ref<RenderFrame> renderFrame, const RenderScene& sharedScene, const TickInfo& tickInfo)
     {
-        surface->RebuildIfNeeded();
+        Sizei targetSize;
+        ImageColorSpace colorSpace = ImageColorSpace::sRGB;
 
-        Sizei surfaceSize = surface->GetFramebufferSize();
+        if (target.TargetSurface)
+        {
+            target.TargetSurface->RebuildIfNeeded();
+            targetSize = target.TargetSurface->GetFramebufferSize();
+        }
+        else
+        {
+            const ImageDescription& imageDescription = target.TargetImage->GetDescription();
+            targetSize = Sizei(static_cast<int>(imageDescription.Width), static_cast<int>(imageDescription.Height));
+            colorSpace = imageDescription.ColorSpace;
+        }
+
+        RenderScene scene = renderFrame->CreateRenderScene(targetSize);
+        scene.SetKeepUnculledObjects(IsGPUCullingEnabled());
 
-        RenderScene scene = renderFrame->CreateRenderScene(surfaceSize);
+        target.ViewLODs.NextFrame();
+        scene.SetViewLODs(&target.ViewLODs);
 
-        RenderGraph graph(_graphicsPlatform.get(), renderFrame->GetFrameAllocator(), surfaceSize);
-        graph.AddColorAttachment(ImageColorSpace::sRGB);
+        RenderGraph graph(_graphicsPlatform.get(), renderFrame->GetFrameAllocator(), targetSize);
+        graph.AddColorAttachment(colorSpace);
 
         for (const auto& listener : _renderListeners)
         {
             COCO_ASSERT(listener->IsListening(), "Listener wasn't connected");
 
-            listener->Dispatch(targetID, graph, scene);
+            listener->Dispatch(target.ID, graph, scene);
+
+            // Listeners can set their own camera, so cull their objects before the next listener runs
+            scene.CullObjects();
         }
 
-        if (graph.Compile())
+        // Listeners have set the final camera by now, so the shared objects can be culled for this view
+        scene.AddVisibleObjects(sharedScene);
+
+        if (graph.Compile(target.GraphCompilation))
         {
-            renderFrame->Render(std::move(graph), std::move(scene), surface);
+            renderFrame->AddTransientMemory(graph.GetTransientMemorySize(), graph.GetUnaliasedTransientMemorySize());
+            if (target.TargetSurface)
+                renderFrame->Render(std::move(graph), std::move(scene), target.TargetSurface);
+            else
+                renderFrame->Render(std::move(graph), std::move(scene), target.TargetImage);
         }
         else
         {
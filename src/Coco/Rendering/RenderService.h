@@ -9,6 +9,8 @@
 #include "RenderingEnginePlatform.h"
 #include "RenderListener.h"
 #include "RenderScene.h"
+#include "TextureDecoder.h"
+#include "WorkerPool.h"
 
 #include "Coco/Core/Memory/Ptrs.h"
 #include "Coco/Core/ProcessLoop/TickListener.h"
@@ -16,22 +18,33 @@
 #include "Gizmos/Gizmos.h"
 
 #include "Graphics/GraphicsPlatform.h"
+#include "RenderGraph/RenderGraphTypes.h"
 
 namespace Coco
 {
     class RenderGraph;
     class Texture;
 
-    /// @brief A surface that can be drawn to
+    /// @brief A surface or offscreen image that can be drawn to
     struct FinalRenderTarget
     {
-        /// @brief The surface ID
+        /// @brief The target ID
         uint64 ID;
 
-        /// @brief The surface
+        /// @brief The surface, if this target renders to a window
         Ref<GraphicsSurface> TargetSurface;
 
+        /// @brief The image, if this target renders offscreen
+        Ref<Image> TargetImage;
+
+        /// @brief The compile results of the last frame's render graph, reused while the graph's passes and resources stay the same
+        RenderGraphCompilation GraphCompilation;
+
+        /// @brief The levels of detail this target's view drew its objects with
+        RenderViewLODs ViewLODs;
+
         FinalRenderTarget(uint64 id, Ref<GraphicsSurface> targetSurface);
+        FinalRenderTarget(uint64 id, Ref<Image> targetImage);
     };
 
     class RenderService : public EngineService
@@ -82,14 +95,48 @@ namespace Coco
         /// @param surface The surface of the target
         void AddFinalRenderTarget(uint64 targetID, Ref<GraphicsSurface> surface);
 
+        /// @brief Adds a final render target that renders to an image instead of a window surface. This doesn't need a display, so it can be used for headless rendering
+        /// @param targetID The ID of the target
+        /// @param image The image to render to. It must be usable as a render target, and as a transfer source if it will be read back
+        void AddOffscreenRenderTarget(uint64 targetID, Ref<Image> image);
+
+        /// @brief Requests a copy of an offscreen render target's pixels after it is rendered this frame
+        /// @param targetID The ID of the offscreen target
+        /// @return The readback, or nullptr if there isn't an offscreen target with the given ID
+        SharedPtr<ImageReadback> ReadbackRenderTarget(uint64 targetID);
+
         /// @brief Removes a final render target, and it will no longer be rendered for during the render tick
         /// @param targetID The ID of the target
         void RemoveFinalRenderTarget(uint64 targetID);
 
+        /// @brief Gets the level of detail a target's view drew an object with in the last frame
+        /// @param targetID The ID of the target
+        /// @param objectID The ID the object's LOD was selected with
+        /// @return The LOD, or an empty optional if the target didn't draw the object with a selected LOD
+        Optional<uint32> GetObjectLOD(uint64 targetID, uint64 objectID) const;
+
+        /// @brief Sets if objects drawn indirectly should be frustum culled on the GPU instead of the CPU.
+        /// Scenes then also keep their objects from before CPU culling, which indirect passes cull through RenderContext::CullIndirect().
+        /// Every other pass still draws the CPU culled objects
+        /// @param enabled If true, objects drawn indirectly will be culled on the GPU
+        void SetGPUCullingEnabled(bool enabled) { _gpuCullingEnabled = enabled; }
+
+        /// @brief Gets if objects are frustum culled on the GPU
+        /// @return True if GPU culling is enabled and supported by the graphics device
+        bool IsGPUCullingEnabled() const;
+
         /// @brief Gets the default checker texture (mostly used for errors)
         /// @return The default checker texture
         SharedPtr<Texture> GetDefaultCheckerTexture() { return _defaultCheckerTexture; }
 
+        /// @brief Gets the decoder that loads texture files on worker threads
+        /// @return The texture decoder
+        TextureDecoder* GetTextureDecoder() { return _textureDecoder.get(); }
+
+        /// @brief Gets the worker threads that rendering work such as culling is split across
+        /// @return The worker pool
+        WorkerPool* GetWorkerPool() { return _workerPool.get(); }
+
         /// @brief Gets the rendering statistics of the last frame
         /// @return The rendering statistics of the last frame
         const RenderFrameStats& GetLastFrameStats() const { return _lastFrameStats; }
@@ -102,10 +149,13 @@ namespace Coco
         TickListener _renderTickListener;
         Array<RenderListener*> _renderListeners;
         bool _renderListenersNeedSorting;
+        bool _gpuCullingEnabled;
         Map<uint64, FinalRenderTarget> _finalRenderTargets;
         SharedPtr<Texture> _defaultCheckerTexture;
         RenderFrameStats _lastFrameStats;
         UniquePtr<Gizmos> _gizmos;
+        UniquePtr<TextureDecoder> _textureDecoder;
+        UniquePtr<WorkerPool> _workerPool;
 
         /// @brief Creates the default resources used by the renderer
         void CreateDefaultResources();
@@ -120,12 +170,12 @@ namespace Coco
         /// @brief Sorts the render listeners
         void SortRenderListeners();
 
-        /// @brief Renders for the given surface
-        /// @param targetID The surface ID
-        /// @param surface The surface
+        /// @brief Renders for the given surface or offscreen target
+        /// @param target The target
         /// @param renderFrame The current RenderFrame
+        /// @param sharedScene The scene with the objects shared by every view this frame
         /// @param tickInfo The tick info
-        void RenderForSurface(uint64 targetID, Ref<GraphicsSurface> surface, Ref<RenderFrame> renderFrame, const TickInfo& tickInfo);
+        void RenderForTarget(FinalRenderTarget& target, Ref<RenderFrame> renderFrame, const RenderScene& sharedScene, const TickInfo& tickInfo);
     };
 } // Coco
 
@@ -5,8 +5,8 @@
 #include "Texture.h"
 
 #include "RenderService.h"
+#include "TextureDecoder.h"
 #include <Coco/Core/Engine.h>
-#include "Vendor/stbimage.h"
 
 namespace Coco
 {
@@ -15,7 +15,12 @@ namespace Coco
     Texture::Texture(Engine* engine, uint64 id, const ImageDescription& imageDescription, const ImageSamplerDescription& samplerDescription) :
         Resource(engine, id),
         _image(),
-        _sampler()
+        _sampler(),
+        _pendingUploadID(UploadScheduler::InvalidUploadID),
+        _decodeJobID(TextureDecoder::InvalidJobID),
+        _imagePath(),
+        _samplerDescription(samplerDescription),
+        _loadFailed(false)
     {
         RenderService* rendering = engine->TryGetService<RenderService>();
         COCO_ASSERT(rendering, "No active RenderService found");
@@ -31,23 +36,30 @@ namespace Coco
 	    const ImageSamplerDescription& samplerDescription, bool generateMipMaps) :
 		Resource(engine, id),
 		_image(),
-		_sampler()
+		_sampler(),
+		_pendingUploadID(UploadScheduler::InvalidUploadID),
+		_decodeJobID(TextureDecoder::InvalidJobID),
+		_imagePath(imagePath),
+		_samplerDescription(samplerDescription),
+		_loadFailed(false)
     {
     	RenderService* rendering = engine->TryGetService<RenderService>();
     	COCO_ASSERT(rendering, "No active RenderService found");
 
-    	GraphicsPlatform* platform = rendering->GetGraphicsPlatform();
-    	COCO_ASSERT(platform, "No active GraphicsPlatform found");
-
-		_image = CreateImageFromFile(imagePath, pixelFormat, colorSpace, generateMipMaps);
-    	_sampler = platform->CreateImageSampler(UpdateSamplerDescription(_image->GetDescription(), samplerDescription));
+    	// The image and sampler are created once the file is decoded, since its size and mip levels aren't known until then
+		_decodeJobID = rendering->GetTextureDecoder()->QueueDecode(imagePath, pixelFormat, colorSpace, generateMipMaps);
     }
 
     Texture::~Texture()
     {
         if (RenderService* rendering = _engine->TryGetService<RenderService>())
         {
-            if (GraphicsPlatform* platform = rendering->GetGraphicsPlatform())
+            TextureDecoder* decoder = rendering->GetTextureDecoder();
+            if (decoder && _decodeJobID != TextureDecoder::InvalidJobID)
+                decoder->Cancel(_decodeJobID);
+
+            GraphicsPlatform* platform = rendering->GetGraphicsPlatform();
+            if (platform && _image)
             {
                 platform->InvalidateResource(_image->GetID());
                 platform->InvalidateResource(_sampler->GetID());
@@ -57,11 +69,62 @@ namespace Coco
 
     void Texture::SetPixels(const void* pixelData, uint64 pixelDataSize)
     {
+    	COCO_ASSERT(_image, "Texture has no image until its file is decoded");
         _image->SetPixels(pixelData, pixelDataSize);
     }
 
+    void Texture::SetPixelRegion(uint32 x, uint32 y, uint32 width, uint32 height, const void* pixelData, uint64 pixelDataSize)
+    {
+    	COCO_ASSERT(_image, "Texture has no image until its file is decoded");
+    	_image->SetPixelRegion(x, y, width, height, pixelData, pixelDataSize);
+    }
+
+    void Texture::SetPixelsAsync(Array<uint8>&& pixelData, UploadPriority priority)
+    {
+    	RenderService* rendering = _engine->TryGetService<RenderService>();
+    	COCO_ASSERT(rendering, "RenderService hasn't been created");
+
+    	GraphicsPlatform* graphicsPlatform = rendering->GetGraphicsPlatform();
+    	COCO_ASSERT(graphicsPlatform, "No active GraphicsPlatform found");
+    	COCO_ASSERT(_image, "Texture has no image until its file is decoded");
+
+    	_pendingUploadID = graphicsPlatform->GetUploadScheduler()->QueueImageUpload(_image, std::move(pixelData), priority, nullptr);
+    }
+
+    TextureLoadState Texture::GetLoadState()
+    {
+    	RenderService* rendering = _engine->TryGetService<RenderService>();
+
+    	if (_decodeJobID != TextureDecoder::InvalidJobID)
+    	{
+    		TextureDecoder* decoder = rendering ? rendering->GetTextureDecoder() : nullptr;
+    		UniquePtr<DecodedTexture> decodedTexture = decoder ? decoder->TryTakeResult(_decodeJobID) : nullptr;
+    		if (!decodedTexture)
+    			return TextureLoadState::Decoding;
+
+    		_decodeJobID = TextureDecoder::InvalidJobID;
+    		CreateImageFromDecoded(*decodedTexture);
+    	}
+
+    	if (_loadFailed)
+    		return TextureLoadState::Failed;
+
+    	if (_pendingUploadID == UploadScheduler::InvalidUploadID)
+    		return TextureLoadState::Ready;
+
+    	GraphicsPlatform* graphicsPlatform = rendering ? rendering->GetGraphicsPlatform() : nullptr;
+
+    	if (!graphicsPlatform || !graphicsPlatform->GetUploadScheduler()->IsUploadComplete(_pendingUploadID))
+    		return TextureLoadState::Uploading;
+
+    	_pendingUploadID = UploadScheduler::InvalidUploadID;
+    	return TextureLoadState::Ready;
+    }
+
     void Texture::Resize(uint32 newWidth, uint32 newHeight)
     {
+    	COCO_ASSERT(_image, "Texture has no image until its file is decoded");
+
 	    ImageDescription newDescription(_image->GetDescription());
     	newDescription.Width = newWidth;
     	newDescription.Height = newHeight;
@@ -74,6 +137,7 @@ namespace Coco
 
     	graphicsPlatform->InvalidateResource(_image->GetID());
     	_image = graphicsPlatform->CreateImage(newDescription);
+    	_pendingUploadID = UploadScheduler::InvalidUploadID;
     }
 
     ImageSamplerDescription Texture::UpdateSamplerDescription(const ImageDescription& imageDesc,
@@ -84,99 +148,50 @@ namespace Coco
     	return r;
     }
 
-    Ref<Image> Texture::CreateImageFromFile(const FilePath& imagePath, ImagePixelFormat pixelFormat,
-                                            ImageColorSpace colorSpace, bool generateMipMaps)
+    void Texture::CreateImageFromDecoded(DecodedTexture& decodedTexture)
     {
+    	if (!decodedTexture.Error.IsEmpty())
+    	{
+    		COCO_ENGINE_LOG_ERROR("Failed to load image from \"%s\": %s", _imagePath.CStr(), decodedTexture.Error.CStr());
+    		_loadFailed = true;
+    		return;
+    	}
+
+    	if (!decodedTexture.Warning.IsEmpty())
+    		COCO_ENGINE_LOG_WARN("\"%s\": %s", _imagePath.CStr(), decodedTexture.Warning.CStr());
+
 	    RenderService* rendering = _engine->TryGetService<RenderService>();
 		COCO_ASSERT(rendering, "RenderService hasn't been created");
 
     	GraphicsPlatform* graphicsPlatform = rendering->GetGraphicsPlatform();
     	COCO_ASSERT(graphicsPlatform, "No active GraphicsPlatform found");
 
-		// Set Y = 0 to the top
-		stbi_set_flip_vertically_on_load(true);
-
-		// Load in the image data from the file
-		int channelsToLoad = ImageDescription::GetChannelCount(pixelFormat);
-		int actualChannelCount;
-		int width, height;
-
-    	Engine* engine = Engine::Get();
-		File f = engine->GetFileSystem()->Open(imagePath, FileOpenFlags::Read, false);
-		Array<uint8> fileData;
-		f.ReadToEnd(fileData);
-		f.Close();
-
-		uint8* rawImageData = stbi_load_from_memory(fileData.Data(), static_cast<int>(fileData.GetCount()), &width, &height, &actualChannelCount, channelsToLoad);
-
-		if (rawImageData == nullptr || stbi_failure_reason())
-		{
-			COCO_ENGINE_LOG_ERROR("Failed to load image data from \"%s\": %s", imagePath.CStr(), stbi_failure_reason());
-
-			// Free the image data if it was somehow loaded
-			if (rawImageData)
-			{
-				stbi_image_free(rawImageData);
-				rawImageData = nullptr;
-			}
-
-			// Clears any error so it won't cause subsequent false failures
-			stbi_clear_error();
-
-			return Ref<Image>();
-		}
-
-		ImageDescription imageDesc(
-			static_cast<uint32>(width), static_cast<uint32>(height),
-			pixelFormat,
-			colorSpace,
-			ImageUsageFlags::Sampled,
-			generateMipMaps);
-
-		uint64 byteSize = static_cast<uint64_t>(width) * height * channelsToLoad;
-
-		// Check if there is any transparency in the image
-		//bool hasTransparency = false;
-		//double averageMagnitude = 0.0;
-		//
-		//for (uint64_t i = 0; i < byteSize; i += channelsToLoad)
-		//{
-		//	if (actualChannelCount > 3 && rawImageData[i + 3] < 255)
-		//	{
-		//		hasTransparency = true;
-		//	}
-		//
-		//	double x = (rawImageData[i] - 127.0) / 128.0;
-		//	double y = (rawImageData[i + 1] - 127.0) / 128.0;
-		//	Vector3 rgb(x, y, rawImageData[i + 2] / 255.0);
-		//	averageMagnitude += rgb.GetLength();
-		//}
-		//
-		//// If this value is very close to 1.0, then the texture is likely to be a normal map
-		//averageMagnitude /= static_cast<double>(width) * height;
-		//
-		//if (Math::Approximately(averageMagnitude, 1.0, 0.02))
-		//{
-		//	// TODO: add more automatic normalmap detection, like compression
-		//	imageDesc.ColorSpace = ImageColorSpace::Linear;
-		//}
-
-    	Ref<Image> image;
     	try
     	{
-    		image = graphicsPlatform->CreateImage(imageDesc);
-    		image->SetPixels(rawImageData, byteSize);
-    		stbi_image_free(rawImageData);
+    		if (ImageDescription::IsCompressed(decodedTexture.Description.PixelFormat) && !graphicsPlatform->GetDeviceDescription().SupportsBCCompression)
+    			throw Exception("The device doesn't support BC compressed images");
+
+    		_image = graphicsPlatform->CreateImage(decodedTexture.Description);
+    		_sampler = graphicsPlatform->CreateImageSampler(UpdateSamplerDescription(decodedTexture.Description, _samplerDescription));
+
+    		// Upload in the background so loading many textures doesn't stall a single frame. Mip maps are generated once it finishes
+    		_pendingUploadID = graphicsPlatform->GetUploadScheduler()->QueueImageUpload(_image, std::move(decodedTexture.PixelData), UploadPriority::Normal, nullptr);
     	} catch (const Exception& ex)
     	{
-    		COCO_ENGINE_LOG_ERROR("Failed to transfer image data into backend: %s", ex.what());
+    		COCO_ENGINE_LOG_ERROR("Failed to transfer image data from \"%s\" into backend: %s", _imagePath.CStr(), ex.what());
+
+    		if (_image)
+    			graphicsPlatform->InvalidateResource(_image->GetID());
 
-    		stbi_image_free(rawImageData);
+    		if (_sampler)
+    			graphicsPlatform->InvalidateResource(_sampler->GetID());
 
-    		return image;
+    		_image = Ref<Image>();
+    		_sampler = Ref<ImageSampler>();
+    		_loadFailed = true;
+    		return;
     	}
 
-		COCO_ENGINE_LOG_VERBOSE("Created image %u from file \"%s\"", image->GetID(), imagePath.CStr());
-    	return image;
+		COCO_ENGINE_LOG_VERBOSE("Created image %u from file \"%s\"", _image->GetID(), _imagePath.CStr());
     }
 } // Coco
\ No newline at end of file
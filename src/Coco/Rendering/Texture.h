@@ -11,9 +11,28 @@
 #include "Graphics/Resources/Image.h"
 #include "Graphics/Resources/ImageSampler.h"
 #include "Graphics/Resources/ImageSamplerTypes.h"
+#include "Graphics/UploadScheduler.h"
 
 namespace Coco
 {
+    struct DecodedTexture;
+
+    /// @brief The loading progress of a texture
+    enum class TextureLoadState
+    {
+        /// @brief The texture's image file is being decoded on a worker thread
+        Decoding,
+
+        /// @brief The texture's pixel data is being uploaded
+        Uploading,
+
+        /// @brief The texture can be sampled
+        Ready,
+
+        /// @brief The texture's image file couldn't be loaded
+        Failed
+    };
+
     /// @brief Holds pixel data used during rendering
     class Texture : public Resource
     {
@@ -21,6 +40,7 @@ namespace Coco
 
     public:
         Texture(Engine* engine, uint64 id, const ImageDescription& imageDescription, const ImageSamplerDescription& samplerDescription);
+        /// @brief Creates a texture from an image file, which is decoded on a worker thread. The texture has no image until the file is decoded
         Texture(Engine* engine, uint64 id, const FilePath& imagePath, ImagePixelFormat pixelFormat, ImageColorSpace colorSpace, const ImageSamplerDescription& samplerDescription, bool generateMipMaps);
         ~Texture();
 
@@ -29,12 +49,35 @@ namespace Coco
         /// @param pixelDataSize The size of the raw pixel data
         void SetPixels(const void* pixelData, uint64 pixelDataSize);
 
+        /// @brief Sets the pixels of a region of this texture, leaving the rest of it as-is
+        /// @param x The x offset of the region, in pixels
+        /// @param y The y offset of the region, in pixels
+        /// @param width The width of the region, in pixels
+        /// @param height The height of the region, in pixels
+        /// @param pixelData The pixels of the region, with tightly packed rows
+        /// @param pixelDataSize The size of the pixel data
+        void SetPixelRegion(uint32 x, uint32 y, uint32 width, uint32 height, const void* pixelData, uint64 pixelDataSize);
+
+        /// @brief Queues the pixel data of this texture to be uploaded over the next frames.
+        /// Until the upload completes, this texture isn't ready and draws use the default texture in its place
+        /// @param pixelData The raw pixel data
+        /// @param priority The priority of the upload
+        void SetPixelsAsync(Array<uint8>&& pixelData, UploadPriority priority = UploadPriority::Normal);
+
+        /// @brief Gets if this texture's pixel data has finished uploading
+        /// @return True if this texture can be sampled
+        bool IsReady() { return GetLoadState() == TextureLoadState::Ready; }
+
+        /// @brief Gets the loading progress of this texture. Until it is ready, draws use the default texture in its place
+        /// @return The load state
+        TextureLoadState GetLoadState();
+
         /// @brief Changes the size of this texture
         /// @param newWidth The new width, in pixels
         /// @param newHeight The new height, in pixels
         void Resize(uint32 newWidth, uint32 newHeight);
 
-        /// @brief Gets the image data resource
+        /// @brief Gets the image data resource. Textures loaded from files don't have one until their file is decoded
         /// @return The image data resource
         Ref<Image> GetImage() { return _image; }
 
@@ -45,6 +88,11 @@ namespace Coco
     private:
         Ref<Image> _image;
         Ref<ImageSampler> _sampler;
+        uint64 _pendingUploadID;
+        uint64 _decodeJobID;
+        FilePath _imagePath;
+        ImageSamplerDescription _samplerDescription;
+        bool _loadFailed;
 
         /// @brief Updates an image sampler description to match limits of the given image description
         /// @param imageDesc The image description
@@ -52,13 +100,9 @@ namespace Coco
         /// @return The updated image sampler description
         static ImageSamplerDescription UpdateSamplerDescription(const ImageDescription& imageDesc, const ImageSamplerDescription& samplerDesc);
 
-        /// @brief Creates an image resource from an image file
-        /// @param imagePath The path to the image file
-        /// @param pixelFormat The image file's pixel format
-        /// @param colorSpace The image file's color space
-        /// @param generateMipMaps If true, mip maps will be generated
-        /// @return The image
-        Ref<Image> CreateImageFromFile(const FilePath& imagePath, ImagePixelFormat pixelFormat, ImageColorSpace colorSpace, bool generateMipMaps);
+        /// @brief Creates the image and sampler for a decoded image file and queues its pixel data to be uploaded
+        /// @param decodedTexture The decoded image file
+        void CreateImageFromDecoded(DecodedTexture& decodedTexture);
     };
 } // Coco
 
@@ -0,0 +1,253 @@
+//
+// Created by cullen on 10/18/26.
+//
+
+#include "TextureDecoder.h"
+
+#include "KTX2File.h"
+#include "Coco/Core/IO/FileSystem.h"
+#include "Coco/Core/Math/Math.h"
+#include "Vendor/stbimage.h"
+
+namespace Coco
+{
+    TextureDecodeRequest::TextureDecodeRequest(uint64 jobID, const FilePath& path, ImagePixelFormat pixelFormat,
+                                               ImageColorSpace colorSpace, bool generateMipMaps) :
+        JobID(jobID),
+        Path(path),
+        PixelFormat(pixelFormat),
+        ColorSpace(colorSpace),
+        GenerateMipMaps(generateMipMaps)
+    {}
+
+    DecodedTexture::DecodedTexture(const ImageDescription& description, Array<uint8>&& pixelData) :
+        Description(description),
+        PixelData(std::move(pixelData)),
+        Error(),
+        Warning()
+    {}
+
+    DecodedTexture::DecodedTexture(const String& error) :
+        Description(),
+        PixelData(),
+        Error(error),
+        Warning()
+    {}
+
+    TextureDecoder::TextureDecoder(FileSystem* fileSystem, uint32 workerCount) :
+        _fileSystem(fileSystem),
+        _workers(),
+        _requests(),
+        _results(),
+        _cancelledJobIDs(),
+        _nextJobID(InvalidJobID + 1),
+        _stopping(false)
+    {
+        _workers.Reserve(workerCount);
+
+        for (uint32 i = 0; i < workerCount; i++)
+            _workers.EmplaceBack(&TextureDecoder::WorkerLoop, this);
+    }
+
+    TextureDecoder::~TextureDecoder()
+    {
+        {
+            std::lock_guard<std::mutex> guard(_lock);
+            _stopping = true;
+        }
+
+        _requestAvailable.notify_all();
+
+        // Workers finish the file they're decoding, but leave the rest of the queue
+        for (std::thread& worker : _workers)
+            worker.join();
+
+        _workers.Clear();
+    }
+
+    uint32 TextureDecoder::GetDefaultWorkerCount()
+    {
+        // Leave the other half of the hardware threads for the main loop and the graphics driver
+        const uint32 hardwareThreads = std::thread::hardware_concurrency();
+        return Math::Clamp(hardwareThreads / 2, 1u, MaxDefaultWorkerCount);
+    }
+
+    uint64 TextureDecoder::QueueDecode(const FilePath& path, ImagePixelFormat pixelFormat, ImageColorSpace colorSpace, bool generateMipMaps)
+    {
+        std::unique_lock<std::mutex> lock(_lock);
+        const uint64 jobID = _nextJobID++;
+
+        if (_workers.IsEmpty())
+        {
+            lock.unlock();
+
+            Array<uint8> fileData;
+            UniquePtr<DecodedTexture> result = Decode(_fileSystem, TextureDecodeRequest(jobID, path, pixelFormat, colorSpace, generateMipMaps), fileData);
+
+            lock.lock();
+            AddResult(jobID, std::move(result));
+
+            return jobID;
+        }
+
+        _requests.EmplaceBack(jobID, path, pixelFormat, colorSpace, generateMipMaps);
+        lock.unlock();
+
+        _requestAvailable.notify_one();
+        return jobID;
+    }
+
+    UniquePtr<DecodedTexture> TextureDecoder::TryTakeResult(uint64 jobID)
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+
+        UniquePtr<DecodedTexture>* result = _results.TryGetValue(jobID);
+        if (!result)
+            return nullptr;
+
+        UniquePtr<DecodedTexture> takenResult = std::move(*result);
+        _results.Remove(jobID);
+
+        return takenResult;
+    }
+
+    void TextureDecoder::Cancel(uint64 jobID)
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+
+        if (_results.Contains(jobID))
+        {
+            _results.Remove(jobID);
+            return;
+        }
+
+        const bool wasQueued = _requests.RemoveIf([jobID](const TextureDecodeRequest& request)
+        {
+            return request.JobID == jobID;
+        });
+
+        // The job is being decoded right now, so its result is discarded once it finishes
+        if (!wasQueued)
+            _cancelledJobIDs.Append(jobID);
+    }
+
+    uint64 TextureDecoder::GetQueuedCount()
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        return _requests.GetCount();
+    }
+
+    void TextureDecoder::WorkerLoop()
+    {
+        // Each worker reads its files into the same buffer, so it grows to the largest file and then stops allocating
+        Array<uint8> fileData;
+
+        while (true)
+        {
+            std::unique_lock<std::mutex> lock(_lock);
+            _requestAvailable.wait(lock, [this]() { return _stopping || !_requests.IsEmpty(); });
+
+            if (_stopping)
+                return;
+
+            TextureDecodeRequest request = _requests.Front();
+            _requests.RemoveAt(0);
+            lock.unlock();
+
+            UniquePtr<DecodedTexture> result = Decode(_fileSystem, request, fileData);
+
+            lock.lock();
+            AddResult(request.JobID, std::move(result));
+        }
+    }
+
+    void TextureDecoder::AddResult(uint64 jobID, UniquePtr<DecodedTexture>&& result)
+    {
+        if (_cancelledJobIDs.Remove(jobID))
+            return;
+
+        _results.Emplace(jobID, std::move(result));
+    }
+
+    UniquePtr<DecodedTexture> TextureDecoder::Decode(FileSystem* fileSystem, const TextureDecodeRequest& request, Array<uint8>& fileData)
+    {
+        try
+        {
+            File f = fileSystem->Open(request.Path, FileOpenFlags::Read, false);
+            f.ReadToEnd(fileData);
+            f.Close();
+        }
+        catch (const Exception& ex)
+        {
+            return CreateDefaultUnique<DecodedTexture>(FormatString("Failed to read file: %s", ex.what()));
+        }
+
+        // KTX2 files are already in a GPU format, so they skip decoding and mip generation entirely
+        if (KTX2File::IsKTX2(fileData))
+            return DecodeKTX2(request, fileData);
+
+        return DecodeWithStb(request, fileData);
+    }
+
+    UniquePtr<DecodedTexture> TextureDecoder::DecodeWithStb(const TextureDecodeRequest& request, Span<const uint8> fileData)
+    {
+        // Set Y = 0 to the top. This only affects the calling thread, so workers don't change how other threads load images
+        stbi_set_flip_vertically_on_load_thread(true);
+
+        // Load in the image data from the file
+        int channelsToLoad = ImageDescription::GetChannelCount(request.PixelFormat);
+        int actualChannelCount;
+        int width, height;
+
+        uint8* rawImageData = stbi_load_from_memory(fileData.data(), static_cast<int>(fileData.size()), &width, &height, &actualChannelCount, channelsToLoad);
+
+        if (rawImageData == nullptr || stbi_failure_reason())
+        {
+            UniquePtr<DecodedTexture> result = CreateDefaultUnique<DecodedTexture>(FormatString("Failed to load image data: %s", stbi_failure_reason()));
+
+            // Free the image data if it was somehow loaded
+            if (rawImageData)
+                stbi_image_free(rawImageData);
+
+            // Clears any error so it won't cause subsequent false failures
+            stbi_clear_error();
+
+            return result;
+        }
+
+        ImageDescription imageDesc(
+            static_cast<uint32>(width), static_cast<uint32>(height),
+            request.PixelFormat,
+            request.ColorSpace,
+            ImageUsageFlags::Sampled,
+            request.GenerateMipMaps);
+
+        uint64 byteSize = static_cast<uint64_t>(width) * height * channelsToLoad;
+        Array<uint8> pixelData(Span<const uint8>(rawImageData, byteSize));
+        stbi_image_free(rawImageData);
+
+        return CreateDefaultUnique<DecodedTexture>(imageDesc, std::move(pixelData));
+    }
+
+    UniquePtr<DecodedTexture> TextureDecoder::DecodeKTX2(const TextureDecodeRequest& request, Span<const uint8> fileData)
+    {
+        try
+        {
+            KTX2Image ktxImage = KTX2File::Read(fileData);
+
+            // Match the rows of images loaded through stb, which start from the bottom
+            const bool flipFailed = ktxImage.IsTopDown && !ktxImage.FlipVertically();
+
+            UniquePtr<DecodedTexture> result = CreateDefaultUnique<DecodedTexture>(ktxImage.Description, std::move(ktxImage.PixelData));
+
+            if (flipFailed)
+                result->Warning = "The file stores its rows top-down, which compressed images can't be flipped from. Cook it with bottom-up rows to avoid it appearing upside down";
+
+            return result;
+        }
+        catch (const Exception& ex)
+        {
+            return CreateDefaultUnique<DecodedTexture>(FormatString("Failed to load KTX2 image: %s", ex.what()));
+        }
+    }
+} // Coco
\ No newline at end of file
@@ -0,0 +1,144 @@
+//
+// Created by cullen on 10/18/26.
+//
+
+#ifndef COCOENGINE_TEXTUREDECODER_H
+#define COCOENGINE_TEXTUREDECODER_H
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include "Coco/Core/IO/FilePath.h"
+#include "Coco/Core/Memory/Ptrs.h"
+#include "Coco/Core/Types/Array.h"
+#include "Coco/Core/Types/Map.h"
+#include "Coco/Core/Types/String.h"
+#include "Graphics/Resources/ImageTypes.h"
+
+namespace Coco
+{
+    class FileSystem;
+
+    /// @brief A request to decode an image file
+    struct TextureDecodeRequest
+    {
+        /// @brief The ID of the decode job
+        uint64 JobID;
+
+        /// @brief The path to the image file
+        FilePath Path;
+
+        /// @brief The pixel format to decode the image to. Ignored for KTX2 files, which store their own format
+        ImagePixelFormat PixelFormat;
+
+        /// @brief The color space of the image. Ignored for KTX2 files, which store their own color space
+        ImageColorSpace ColorSpace;
+
+        /// @brief If true, the image will be created with mip maps that are generated after it is uploaded
+        bool GenerateMipMaps;
+
+        TextureDecodeRequest(uint64 jobID, const FilePath& path, ImagePixelFormat pixelFormat, ImageColorSpace colorSpace, bool generateMipMaps);
+    };
+
+    /// @brief An image file that has been decoded into pixels that can be uploaded
+    struct DecodedTexture
+    {
+        /// @brief The description of the image
+        ImageDescription Description;
+
+        /// @brief The pixel data of the image, ready to be uploaded
+        Array<uint8> PixelData;
+
+        /// @brief If not empty, the file couldn't be decoded and this is the reason why
+        String Error;
+
+        /// @brief If not empty, the file was decoded but may not look as expected, and this is the reason why
+        String Warning;
+
+        DecodedTexture(const ImageDescription& description, Array<uint8>&& pixelData);
+        DecodedTexture(const String& error);
+    };
+
+    /// @brief Reads and decodes image files on worker threads so loading textures doesn't stall the main loop.
+    /// Decoded pixels are held until the texture that requested them takes them on the main thread and queues their upload
+    class TextureDecoder
+    {
+    public:
+        /// @brief An invalid decode job ID
+        static constexpr uint64 InvalidJobID = 0;
+
+        /// @brief The most worker threads that are created by default
+        static constexpr uint32 MaxDefaultWorkerCount = 4;
+
+        /// @brief Creates a texture decoder
+        /// @param fileSystem The file system to read image files from. It must be safe to open files from multiple threads
+        /// @param workerCount The number of worker threads. If 0, files are decoded on the thread that queues them
+        TextureDecoder(FileSystem* fileSystem, uint32 workerCount);
+        ~TextureDecoder();
+
+        /// @brief Gets the number of worker threads to use on this machine
+        /// @return Half of the hardware threads, between 1 and MaxDefaultWorkerCount
+        static uint32 GetDefaultWorkerCount();
+
+        /// @brief Queues an image file to be decoded
+        /// @param path The path to the image file
+        /// @param pixelFormat The pixel format to decode the image to
+        /// @param colorSpace The color space of the image
+        /// @param generateMipMaps If true, the image will be created with mip maps
+        /// @return The ID of the decode job
+        uint64 QueueDecode(const FilePath& path, ImagePixelFormat pixelFormat, ImageColorSpace colorSpace, bool generateMipMaps);
+
+        /// @brief Takes the result of a decode job if it has finished. The result can only be taken once
+        /// @param jobID The ID of the decode job
+        /// @return The decoded image, or nullptr if the job hasn't finished yet
+        UniquePtr<DecodedTexture> TryTakeResult(uint64 jobID);
+
+        /// @brief Cancels a decode job. If it has already finished, its result is discarded
+        /// @param jobID The ID of the decode job
+        void Cancel(uint64 jobID);
+
+        /// @brief Gets the number of decode jobs that haven't been started yet
+        /// @return The number of queued decode jobs
+        uint64 GetQueuedCount();
+
+    private:
+        FileSystem* _fileSystem;
+        Array<std::thread> _workers;
+        std::mutex _lock;
+        std::condition_variable _requestAvailable;
+        Array<TextureDecodeRequest> _requests;
+        Map<uint64, UniquePtr<DecodedTexture>> _results;
+        Array<uint64> _cancelledJobIDs;
+        uint64 _nextJobID;
+        bool _stopping;
+
+        /// @brief Takes requests from the queue and decodes them until the decoder is stopped
+        void WorkerLoop();
+
+        /// @brief Stores the result of a decode job, unless it was cancelled. Must be called with the lock held
+        /// @param jobID The ID of the decode job
+        /// @param result The decoded image
+        void AddResult(uint64 jobID, UniquePtr<DecodedTexture>&& result);
+
+        /// @brief Reads and decodes an image file
+        /// @param fileSystem The file system to read the file from
+        /// @param request The decode request
+        /// @param fileData A buffer to read the file into. It is reused between requests so each one doesn't allocate its own
+        /// @return The decoded image
+        static UniquePtr<DecodedTexture> Decode(FileSystem* fileSystem, const TextureDecodeRequest& request, Array<uint8>& fileData);
+
+        /// @brief Decodes a PNG, JPEG, or other file supported by stb_image
+        /// @param request The decode request
+        /// @param fileData The contents of the file
+        /// @return The decoded image
+        static UniquePtr<DecodedTexture> DecodeWithStb(const TextureDecodeRequest& request, Span<const uint8> fileData);
+
+        /// @brief Reads the image and mip levels stored in a KTX2 file
+        /// @param request The decode request
+        /// @param fileData The contents of the file
+        /// @return The decoded image
+        static UniquePtr<DecodedTexture> DecodeKTX2(const TextureDecodeRequest& request, Span<const uint8> fileData);
+    };
+} // Coco
+
+#endif //COCOENGINE_TEXTUREDECODER_H
@@ -0,0 +1,134 @@
+//
+// Created by cullen on 10/18/26.
+//
+
+#include "WorkerPool.h"
+
+#include "Coco/Core/Math/Math.h"
+
+namespace Coco
+{
+    WorkerPool::WorkerPool(uint32 workerCount) :
+        _workers(),
+        _dispatching(false),
+        _nextTaskIndex(0),
+        _task(nullptr),
+        _taskCount(0),
+        _finishedTaskCount(0),
+        _dispatchID(0),
+        _activeWorkerCount(0),
+        _stopping(false)
+    {
+        _workers.Reserve(workerCount);
+
+        for (uint32 i = 0; i < workerCount; i++)
+            _workers.EmplaceBack(&WorkerPool::WorkerLoop, this);
+    }
+
+    WorkerPool::~WorkerPool()
+    {
+        {
+            std::lock_guard<std::mutex> guard(_lock);
+            _stopping = true;
+        }
+
+        _workAvailable.notify_all();
+
+        for (std::thread& worker : _workers)
+            worker.join();
+
+        _workers.Clear();
+    }
+
+    uint32 WorkerPool::GetDefaultWorkerCount()
+    {
+        const uint32 hardwareThreads = std::thread::hardware_concurrency();
+        return Math::Clamp(hardwareThreads > 1 ? hardwareThreads - 1 : 1u, 1u, MaxDefaultWorkerCount);
+    }
+
+    void WorkerPool::ParallelFor(uint64 count, const TaskFunction& task)
+    {
+        if (count == 0)
+            return;
+
+        // Nested or concurrent dispatches run inline so a task waiting on the pool can never deadlock it
+        if (_workers.IsEmpty() || count == 1 || _dispatching.exchange(true))
+        {
+            for (uint64 i = 0; i < count; i++)
+                task(i);
+
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> guard(_lock);
+            _task = &task;
+            _taskCount = count;
+            _finishedTaskCount = 0;
+            _nextTaskIndex.store(0);
+            _dispatchID++;
+        }
+
+        _workAvailable.notify_all();
+
+        const uint64 ranCount = RunTasks(task, count);
+
+        {
+            std::unique_lock<std::mutex> lock(_lock);
+            _finishedTaskCount += ranCount;
+
+            // Workers hold a pointer to the task, so it can't go out of scope until they've all let go of it
+            _workFinished.wait(lock, [this]() { return _finishedTaskCount == _taskCount && _activeWorkerCount == 0; });
+            _task = nullptr;
+        }
+
+        _dispatching.store(false);
+    }
+
+    void WorkerPool::WorkerLoop()
+    {
+        uint64 lastDispatchID = 0;
+
+        while (true)
+        {
+            std::unique_lock<std::mutex> lock(_lock);
+            _workAvailable.wait(lock, [this, lastDispatchID]() { return _stopping || (_task && _dispatchID != lastDispatchID); });
+
+            if (_stopping)
+                return;
+
+            lastDispatchID = _dispatchID;
+            const TaskFunction* task = _task;
+            const uint64 count = _taskCount;
+            _activeWorkerCount++;
+            lock.unlock();
+
+            const uint64 ranCount = RunTasks(*task, count);
+
+            lock.lock();
+            _activeWorkerCount--;
+            _finishedTaskCount += ranCount;
+
+            const bool isFinished = _finishedTaskCount == _taskCount && _activeWorkerCount == 0;
+            lock.unlock();
+
+            if (isFinished)
+                _workFinished.notify_one();
+        }
+    }
+
+    uint64 WorkerPool::RunTasks(const TaskFunction& task, uint64 count)
+    {
+        uint64 ranCount = 0;
+
+        while (true)
+        {
+            const uint64 index = _nextTaskIndex.fetch_add(1);
+            if (index >= count)
+                return ranCount;
+
+            task(index);
+            ranCount++;
+        }
+    }
+} // Coco
\ No newline at end of file
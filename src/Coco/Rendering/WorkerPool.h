@@ -0,0 +1,72 @@
+//
+// Created by cullen on 10/18/26.
+//
+
+#ifndef COCOENGINE_WORKERPOOL_H
+#define COCOENGINE_WORKERPOOL_H
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+#include "Coco/Core/Types/Array.h"
+
+namespace Coco
+{
+    /// @brief A set of worker threads that split a range of tasks with the thread that dispatches them.
+    /// Used by the renderer for work that can be divided into independent pieces, such as culling batches and recording command buffers
+    class WorkerPool
+    {
+    public:
+        /// @brief A task that is run for each index in a range
+        using TaskFunction = std::function<void(uint64 index)>;
+
+        /// @brief The most worker threads that are created by default
+        static constexpr uint32 MaxDefaultWorkerCount = 7;
+
+        /// @brief Creates a worker pool
+        /// @param workerCount The number of worker threads. If 0, every task runs on the thread that dispatches it
+        WorkerPool(uint32 workerCount);
+        ~WorkerPool();
+
+        /// @brief Gets the number of worker threads to use on this machine
+        /// @return One less than the hardware threads since the dispatching thread also runs tasks, between 1 and MaxDefaultWorkerCount
+        static uint32 GetDefaultWorkerCount();
+
+        /// @brief Gets the number of worker threads
+        /// @return The number of worker threads
+        uint32 GetWorkerCount() const { return static_cast<uint32>(_workers.GetCount()); }
+
+        /// @brief Runs a task for every index in [0, count), split between the worker threads and the calling thread. Blocks until every task has finished.
+        /// If the pool is already running tasks, such as when this is called from a task, the tasks run on the calling thread instead
+        /// @param count The number of tasks
+        /// @param task The task. It must be safe to run concurrently for different indices
+        void ParallelFor(uint64 count, const TaskFunction& task);
+
+    private:
+        Array<std::thread> _workers;
+        std::mutex _lock;
+        std::condition_variable _workAvailable;
+        std::condition_variable _workFinished;
+        std::atomic<bool> _dispatching;
+        std::atomic<uint64> _nextTaskIndex;
+        const TaskFunction* _task;
+        uint64 _taskCount;
+        uint64 _finishedTaskCount;
+        uint64 _dispatchID;
+        uint32 _activeWorkerCount;
+        bool _stopping;
+
+        /// @brief Runs tasks from the current dispatch until the pool is stopped
+        void WorkerLoop();
+
+        /// @brief Runs tasks from a dispatch until all of them have been taken
+        /// @param task The task
+        /// @param count The number of tasks
+        /// @return The number of tasks that were run
+        uint64 RunTasks(const TaskFunction& task, uint64 count);
+    };
+} // Coco
+
+#endif //COCOENGINE_WORKERPOOL_H